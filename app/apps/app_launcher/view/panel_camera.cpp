@@ -38,7 +38,15 @@ public:
         if (!_is_camera_closing) {
             _is_camera_closing = true;
             _camera_canvas->setOpa(0);
+            _label_stats->setOpa(0);
+            _label_capture->setOpa(0);
+            _btn_snapshot->setOpa(0);
+            _btn_burst->setOpa(0);
+            _btn_record->setOpa(0);
             _label_msg->setText("Closing Camera ...");
+            GetHAL()->stopCameraBurst();
+            GetHAL()->stopCameraRecord();
+            GetHAL()->stopCameraVision();
             GetHAL()->stopCameraCapture();
         }
     }
@@ -61,6 +69,43 @@ public:
             update_camera_canvas();
         });
 
+        _label_stats = std::make_unique<Label>(lv_screen_active());
+        _label_stats->setTextFont(&lv_font_montserrat_16);
+        _label_stats->setTextColor(lv_color_hex(0xF4F3F3));
+        _label_stats->setText("");
+
+        // Snapshot, burst and H.264 recording to the sd card, the status line shows what the encoder and the card keep
+        // up with for whichever was started last
+        _label_capture = std::make_unique<Label>(lv_screen_active());
+        _label_capture->setTextFont(&lv_font_montserrat_16);
+        _label_capture->setTextColor(lv_color_hex(0xF4F3F3));
+        _label_capture->setText("");
+
+        _btn_snapshot = create_capture_button("SNAP");
+        _btn_snapshot->onClick().connect([&]() {
+            if (!GetHAL()->getCameraCaptureStatus().isCapturing && GetHAL()->cameraSnapshot()) {
+                _show_record = false;
+            }
+        });
+
+        _btn_burst = create_capture_button("BURST");
+        _btn_burst->onClick().connect([&]() {
+            if (GetHAL()->getCameraCaptureStatus().isCapturing) {
+                GetHAL()->stopCameraBurst();
+            } else if (GetHAL()->startCameraBurst(kBurstDurationMs)) {
+                _show_record = false;
+            }
+        });
+
+        _btn_record = create_capture_button("REC");
+        _btn_record->onClick().connect([&]() {
+            if (GetHAL()->getCameraRecordStatus().isRecording) {
+                GetHAL()->stopCameraRecord();
+            } else if (GetHAL()->startCameraRecord(hal::HalBase::CameraRecordConfig_t())) {
+                _show_record = true;
+            }
+        });
+
         update_camera_canvas();
     }
 
@@ -80,10 +125,25 @@ public:
         }
 
         if (!_is_camera_opened) {
+            // Vision is started by whoever consumes its frames, the preview alone doesn't need it
             GetHAL()->startCameraCapture(_camera_canvas->get());
             _is_camera_opened = true;
             _camera_canvas->setOpa(255);
         }
+
+        if (!_is_camera_closing && GetHAL()->millis() - _time_count > 500) {
+            auto stats  = GetHAL()->getCameraStats();
+            auto vision = GetHAL()->getCameraVisionStatus();
+            auto text   = fmt::format("{:.1f} FPS  {} ms  {} dropped\nqueue {}  free {}/{}", stats.fps, stats.latencyMs,
+                                      stats.dropped, stats.queueDepth, stats.minDriverBuffers, stats.bufferCount);
+            if (vision.isRunning) {
+                text += fmt::format("\nvision {:.1f} FPS  {:.1f} ms  {}", vision.fps, vision.scaleUs / 1000.0f,
+                                    vision.hardware ? "ppa" : "sw");
+            }
+            _label_stats->setText(text);
+            update_capture_status();
+            _time_count = GetHAL()->millis();
+        }
     }
 
     void onClose() override
@@ -92,11 +152,20 @@ public:
     }
 
 private:
+    static constexpr uint32_t kBurstDurationMs = 5000;
+
     std::unique_ptr<Label> _label_msg;
     std::unique_ptr<Canvas> _camera_canvas;
+    std::unique_ptr<Label> _label_stats;
+    std::unique_ptr<Label> _label_capture;
+    std::unique_ptr<Button> _btn_snapshot;
+    std::unique_ptr<Button> _btn_burst;
+    std::unique_ptr<Button> _btn_record;
+    uint32_t _time_count      = 0;
     bool _is_camera_opened    = false;
     bool _is_camera_minimized = true;
     bool _is_camera_closing   = false;
+    bool _show_record         = false;
 
     void update_camera_canvas()
     {
@@ -109,6 +178,67 @@ private:
             _camera_canvas->setSize(1280, 720);
             _camera_canvas->setRadius(0);
         }
+        // Kept on top of the canvas, stats in its top left corner, capture along its bottom edge
+        _label_stats->moveForeground();
+        lv_obj_align_to(_label_stats->get(), _camera_canvas->get(), LV_ALIGN_TOP_LEFT, 16, 12);
+        _label_capture->moveForeground();
+        lv_obj_align_to(_label_capture->get(), _camera_canvas->get(), LV_ALIGN_BOTTOM_LEFT, 16, -12);
+        _btn_burst->moveForeground();
+        lv_obj_align_to(_btn_burst->get(), _camera_canvas->get(), LV_ALIGN_BOTTOM_RIGHT, -16, -12);
+        _btn_snapshot->moveForeground();
+        lv_obj_align_to(_btn_snapshot->get(), _btn_burst->get(), LV_ALIGN_OUT_LEFT_MID, -12, 0);
+        _btn_record->moveForeground();
+        lv_obj_align_to(_btn_record->get(), _btn_snapshot->get(), LV_ALIGN_OUT_LEFT_MID, -12, 0);
+    }
+
+    std::unique_ptr<Button> create_capture_button(const char* text)
+    {
+        auto button = std::make_unique<Button>(lv_screen_active());
+        button->setSize(96, 48);
+        button->setRadius(24);
+        button->setBgColor(lv_color_hex(0x383838));
+        button->setShadowWidth(0);
+        button->label().setText(text);
+        button->label().setTextFont(&lv_font_montserrat_16);
+        button->label().setTextColor(lv_color_hex(0xF4F3F3));
+        return button;
+    }
+
+    void update_capture_status()
+    {
+        auto record = GetHAL()->getCameraRecordStatus();
+        _btn_record->label().setText(record.isRecording ? "STOP" : "REC");
+        auto status = GetHAL()->getCameraCaptureStatus();
+        _btn_burst->label().setText(status.isCapturing ? "STOP" : "BURST");
+
+        if (_show_record) {
+            update_record_status(record);
+            return;
+        }
+        if (status.path.empty()) {
+            return;
+        }
+
+        const auto name = status.path.substr(status.path.find_last_of('/') + 1);
+        _label_capture->setText(
+            fmt::format("{} {}  {} frames  {} dropped  {} KB\nencode {:.1f} ms (max {:.1f})  {:.1f} FPS",
+                        status.isCapturing ? "REC" : "SAVED", name, status.frames, status.dropped, status.bytes / 1024,
+                        status.encodeUs / 1000.0f, status.maxEncodeUs / 1000.0f, status.fps));
+    }
+
+    void update_record_status(const hal::HalBase::CameraRecordStatus_t& status)
+    {
+        if (status.path.empty()) {
+            return;
+        }
+
+        // The writer queue is what absorbs the card's stalls, once it runs full frames drop until the next IDR
+        const auto name = status.path.substr(status.path.find_last_of('/') + 1);
+        _label_capture->setText(fmt::format(
+            "{} {}  {} frames  {} dropped  {} KB\n{} kbps  {:.1f} FPS  encode {:.1f} ms  queue {}/{} (max {})",
+            status.isRecording ? "REC" : "SAVED", name, status.frames, status.dropped, status.bytes / 1024,
+            status.bitrate / 1000, status.fps, status.encodeUs / 1000.0f, status.queued, status.queueSize,
+            status.maxQueued));
     }
 };
 
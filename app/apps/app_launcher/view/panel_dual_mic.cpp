@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  */
 #include "view.h"
+#include <algorithm>
 #include <cstdint>
 #include <lvgl.h>
 #include <hal/hal.h>
@@ -12,6 +13,7 @@
 #include <smooth_ui_toolkit.h>
 #include <smooth_lvgl.h>
 #include <apps/utils/audio/audio.h>
+#include <apps/utils/audio/capture_analyzer.h>
 #include <apps/utils/ui/window.h>
 
 using namespace launcher_view;
@@ -35,11 +37,16 @@ public:
     {
         _window->setScrollbarMode(LV_SCROLLBAR_MODE_OFF);
 
-        _chart_mic_left = std::make_unique<Chart>(_window->get());
-        apply_chart_style(_chart_mic_left.get(), -189, 0);
+        // Same mic gain the blocking record path uses, so the meters read like the old scope did
+        GetHAL()->setMicGain(80.0f);
 
-        _chart_mic_right = std::make_unique<Chart>(_window->get());
-        apply_chart_style(_chart_mic_right.get(), 80, 0);
+        // Left: peak level history, right: spectrum, MIC-L and MIC-R in both
+        _chart_level = std::make_unique<Chart>(_window->get());
+        apply_chart_style(_chart_level.get(), -189, 0, kLevelPoints, kLevelFloorDb);
+        _chart_level->setUpdateMode(LV_CHART_UPDATE_MODE_SHIFT);
+
+        _chart_spectrum = std::make_unique<Chart>(_window->get());
+        apply_chart_style(_chart_spectrum.get(), 80, 0, audio::CaptureSnapshot_t::kBands, kSpectrumFloorDb);
 
         _rec_btn = std::make_unique<Button>(_window->get());
         _rec_btn->align(LV_ALIGN_CENTER, 267, 0);
@@ -64,46 +71,83 @@ public:
             _time_count = GetHAL()->millis();
         }
 
-        // Record and plot
-        if (_chart_mic_left && _chart_mic_right) {
-            GetHAL()->audioRecord(_record_data, 4);  // 48000 * 4 / 1000 = 192
-            // [MIC-L, AEC, MIC-R, MIC-HP]
-            for (int i = 0; i < _record_data.size(); i += 4) {
-                _chart_mic_left->setNextValue(0, _record_data[i]);
-                _chart_mic_right->setNextValue(0, _record_data[i + 2]);
-            }
+        // Whatever the capture side analyzed since the last frame, never waits on the mics
+        if (_chart_level && _chart_spectrum && GetHAL()->getAudioCaptureSnapshot(_snapshot)) {
+            update_level_chart();
+            update_spectrum_chart();
         }
     }
 
     void onClose() override
     {
         audio::play_next_tone_progression();
-        _chart_mic_left.reset();
-        _chart_mic_right.reset();
+        _chart_level.reset();
+        _chart_spectrum.reset();
     }
 
 private:
-    uint32_t _time_count = 0;
-    std::vector<int16_t> _record_data;
-    std::unique_ptr<Chart> _chart_mic_left;
-    std::unique_ptr<Chart> _chart_mic_right;
+    static constexpr uint32_t kLevelPoints    = 128;  // 1.28 s of 10 ms points
+    static constexpr int32_t kLevelFloorDb    = -60;
+    static constexpr int32_t kSpectrumFloorDb = -90;
+
+    uint32_t _time_count     = 0;
+    uint32_t _level_count    = 0;
+    uint32_t _spectrum_count = 0;
+    audio::CaptureSnapshot_t _snapshot;
+    std::unique_ptr<Chart> _chart_level;
+    std::unique_ptr<Chart> _chart_spectrum;
     std::unique_ptr<Button> _rec_btn;
     std::unique_ptr<Spinner> _rec_btn_spinner;
 
-    void apply_chart_style(Chart* chart, int16_t x, int16_t y)
+    // Values are in tenths of a dB
+    void apply_chart_style(Chart* chart, int16_t x, int16_t y, uint32_t pointCount, int32_t floorDb)
     {
         chart->align(LV_ALIGN_CENTER, x, y);
         chart->setBgColor(lv_color_hex(0x383838));
         chart->setRadius(12);
         chart->setSize(243, 120);
         chart->setStyleSize(0, 0, LV_PART_INDICATOR);
-        chart->setPointCount(512);
-        chart->setRange(LV_CHART_AXIS_PRIMARY_Y, -32768, 32767);
-        chart->setUpdateMode(LV_CHART_UPDATE_MODE_SHIFT);
+        chart->setPointCount(pointCount);
+        chart->setRange(LV_CHART_AXIS_PRIMARY_Y, floorDb * 10, 0);
         chart->setBgOpa(LV_OPA_TRANSP, LV_PART_ITEMS);
         chart->setBorderWidth(0, LV_PART_MAIN | LV_STATE_DEFAULT);
         chart->setDivLineCount(0, 0);
-        chart->addSeries(lv_color_hex(0x40FFA1), LV_CHART_AXIS_PRIMARY_Y);
+        chart->addSeries(lv_color_hex(0x40FFA1), LV_CHART_AXIS_PRIMARY_Y);  // MIC-L
+        chart->addSeries(lv_color_hex(0x4FB4FF), LV_CHART_AXIS_PRIMARY_Y);  // MIC-R
+    }
+
+    void update_level_chart()
+    {
+        // Points older than the snapshot ring are gone, skip ahead instead of stalling the plot
+        const uint32_t count = _snapshot.envelopeCount;
+        if (count - _level_count > audio::CaptureSnapshot_t::kEnvelopePoints) {
+            _level_count = count - audio::CaptureSnapshot_t::kEnvelopePoints;
+        }
+        for (; _level_count != count; _level_count++) {
+            const auto& peak = _snapshot.peakDb[_level_count % audio::CaptureSnapshot_t::kEnvelopePoints];
+            for (int c = 0; c < 2; c++) {
+                _chart_level->setNextValue(c, std::max<int32_t>(peak[c] * 10, kLevelFloorDb * 10));
+            }
+        }
+    }
+
+    void update_spectrum_chart()
+    {
+        if (_snapshot.spectrumCount == _spectrum_count) {
+            return;
+        }
+        _spectrum_count = _snapshot.spectrumCount;
+
+        lv_obj_t* chart      = _chart_spectrum->get();
+        lv_chart_series_t* s = nullptr;
+        for (int c = 0; c < 2; c++) {
+            s          = lv_chart_get_series_next(chart, s);
+            int32_t* y = lv_chart_get_y_array(chart, s);
+            for (size_t b = 0; b < audio::CaptureSnapshot_t::kBands; b++) {
+                y[b] = std::max<int32_t>(_snapshot.spectrumDb[c][b] * 10, kSpectrumFloorDb * 10);
+            }
+        }
+        lv_chart_refresh(chart);
     }
 
     void update_rec_button()
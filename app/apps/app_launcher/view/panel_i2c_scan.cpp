@@ -117,6 +117,9 @@ public:
         audio::play_next_tone_progression();
         _label_addrs.clear();
         _img_i2c_dev_chart.reset();
+        // The charts are the biggest decoded images, only keep them cached while the window is up
+        lv_image_cache_drop(&internal_i2c_dev_chart);
+        lv_image_cache_drop(&porta_i2c_dev_chart);
         GetHAL()->deinitPortAI2c();
     }
 
@@ -129,6 +132,7 @@ private:
     bool _is_scanning_internal = true;
     uint32_t _scan_time_count  = 0;
 
+    // Each chart decodes to 334000 bytes and the image cache holds 512 KB, so switching evicts and re-decodes
     void update_i2c_dev_chart()
     {
         if (_is_scanning_internal) {
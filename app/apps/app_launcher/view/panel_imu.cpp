@@ -14,6 +14,9 @@
 #include <smooth_ui_toolkit.h>
 #include <smooth_lvgl.h>
 #include <apps/utils/audio/audio.h>
+#include <apps/utils/imu/attitude_estimator.h>
+#include <apps/utils/ui/alpha_raster.h>
+#include <assets/meshes/space_ship.h>
 
 using namespace launcher_view;
 using namespace smooth_ui_toolkit;
@@ -32,416 +35,19 @@ namespace {
 constexpr float kRadToDeg = 57.2957795f;
 constexpr float kBasePitchOffset = -90.0f / kRadToDeg;
 
-struct Vec3 {
-    float x;
-    float y;
-    float z;
-};
-
-struct Edge {
-    uint16_t a;
-    uint16_t b;
-};
-
-static constexpr Vec3 kShipVertices[] = {
-    {0.650832f, 0.271315f, -1.000000f},
-    {1.240349f, -0.000333f, 1.000000f},
-    {0.650832f, 0.315481f, -1.000000f},
-    {1.240348f, 0.180615f, 0.560630f},
-    {0.805783f, -0.000334f, 4.284117f},
-    {0.805782f, 0.180615f, 4.284118f},
-    {3.119281f, -0.942804f, 2.322021f},
-    {3.119280f, -0.761855f, 1.882651f},
-    {0.650832f, 0.315481f, -1.000000f},
-    {1.240348f, 0.180615f, 0.560630f},
-    {3.119280f, -0.761855f, 1.882651f},
-    {0.507604f, 0.512063f, -1.000000f},
-    {0.556329f, 0.986010f, 1.000001f},
-    {0.218978f, 0.452316f, 3.753458f},
-    {1.240349f, -0.000333f, -0.372761f},
-    {1.240349f, 0.180615f, -0.372760f},
-    {3.119281f, -0.942804f, 0.949260f},
-    {3.119281f, -0.761855f, 0.949260f},
-    {1.240349f, 0.180615f, -0.372760f},
-    {3.119281f, -0.761855f, 0.949260f},
-    {0.653542f, 0.986010f, -0.372760f},
-    {3.457423f, -0.942803f, 2.322021f},
-    {3.457423f, -0.761854f, 1.882651f},
-    {3.457423f, -0.942803f, 0.949260f},
-    {3.457423f, -0.761854f, 0.949261f},
-    {3.119281f, -0.942804f, 2.322021f},
-    {3.119280f, -0.761855f, 2.321895f},
-    {3.457423f, -0.942803f, 2.322021f},
-    {3.457423f, -0.761854f, 2.321895f},
-    {3.182715f, -0.908858f, 2.321997f},
-    {3.182715f, -0.795800f, 2.321919f},
-    {3.393988f, -0.908857f, 2.321997f},
-    {3.393988f, -0.795800f, 2.321919f},
-    {3.182715f, -0.907922f, 3.673004f},
-    {3.182715f, -0.794865f, 3.672926f},
-    {3.393988f, -0.907922f, 3.673004f},
-    {3.393988f, -0.794865f, 3.672926f},
-    {3.242466f, -0.875948f, 3.672982f},
-    {3.242466f, -0.826839f, 3.672948f},
-    {3.334237f, -0.875948f, 3.672982f},
-    {3.334237f, -0.826839f, 3.672948f},
-    {3.242466f, -0.875760f, 3.945883f},
-    {3.242466f, -0.826651f, 3.945849f},
-    {3.334237f, -0.875760f, 3.945883f},
-    {3.334237f, -0.826651f, 3.945849f},
-    {0.960107f, 0.565249f, 0.770461f},
-    {0.525541f, 0.310371f, 4.030690f},
-    {0.582431f, 0.409363f, -1.000000f},
-    {0.960107f, 0.565249f, -0.372760f},
-    {0.845504f, 0.498033f, 1.630241f},
-    {0.538940f, 0.845265f, 1.726136f},
-    {1.125746f, 0.180615f, 1.542580f},
-    {1.125746f, -0.000333f, 1.866080f},
-    {-0.650832f, 0.271315f, -1.000000f},
-    {-1.240349f, -0.000333f, 1.000000f},
-    {0.000000f, -0.000333f, 1.000000f},
-    {0.000000f, 0.271315f, -1.000000f},
-    {-0.650832f, 0.315481f, -1.000000f},
-    {-1.240348f, 0.180615f, 0.560630f},
-    {0.000000f, 0.315481f, -1.000000f},
-    {-0.805783f, -0.000334f, 4.284117f},
-    {0.000000f, -0.000334f, 5.383713f},
-    {-0.805782f, 0.180615f, 4.284118f},
-    {0.000000f, 0.180615f, 5.383713f},
-    {-3.119281f, -0.942804f, 2.322021f},
-    {-3.119280f, -0.761855f, 1.882651f},
-    {-0.650832f, 0.315481f, -1.000000f},
-    {-1.240348f, 0.180615f, 0.560630f},
-    {-3.119280f, -0.761855f, 1.882651f},
-    {-0.507604f, 0.512063f, -1.000000f},
-    {-0.556329f, 0.986010f, 1.000001f},
-    {0.000000f, 0.986010f, 1.000000f},
-    {0.000000f, 0.512063f, -1.000000f},
-    {-0.218978f, 0.452316f, 3.753458f},
-    {0.000000f, 0.452316f, 4.853053f},
-    {-1.240349f, -0.000333f, -0.372761f},
-    {0.000000f, -0.000333f, -0.372761f},
-    {-1.240349f, 0.180615f, -0.372760f},
-    {-3.119281f, -0.942804f, 0.949260f},
-    {-3.119281f, -0.761855f, 0.949260f},
-    {-1.240349f, 0.180615f, -0.372760f},
-    {-3.119281f, -0.761855f, 0.949260f},
-    {-0.653542f, 0.986010f, -0.372760f},
-    {0.000000f, 0.986010f, -0.372761f},
-    {-3.457423f, -0.942803f, 2.322021f},
-    {-3.457423f, -0.761854f, 1.882651f},
-    {-3.457423f, -0.942803f, 0.949260f},
-    {-3.457423f, -0.761854f, 0.949261f},
-    {-3.119281f, -0.942804f, 2.322021f},
-    {-3.119280f, -0.761855f, 2.321895f},
-    {-3.457423f, -0.942803f, 2.322021f},
-    {-3.457423f, -0.761854f, 2.321895f},
-    {-3.182715f, -0.908858f, 2.321997f},
-    {-3.182715f, -0.795800f, 2.321919f},
-    {-3.393988f, -0.908857f, 2.321997f},
-    {-3.393988f, -0.795800f, 2.321919f},
-    {-3.182715f, -0.907922f, 3.673004f},
-    {-3.182715f, -0.794865f, 3.672926f},
-    {-3.393988f, -0.907922f, 3.673004f},
-    {-3.393988f, -0.794865f, 3.672926f},
-    {-3.242466f, -0.875948f, 3.672982f},
-    {-3.242466f, -0.826839f, 3.672948f},
-    {-3.334237f, -0.875948f, 3.672982f},
-    {-3.334237f, -0.826839f, 3.672948f},
-    {-3.242466f, -0.875760f, 3.945883f},
-    {-3.242466f, -0.826651f, 3.945849f},
-    {-3.334237f, -0.875760f, 3.945883f},
-    {-3.334237f, -0.826651f, 3.945849f},
-    {0.000000f, 0.409363f, -1.000000f},
-    {-0.960107f, 0.565249f, 0.770461f},
-    {-0.525541f, 0.310371f, 4.030690f},
-    {-0.582431f, 0.409363f, -1.000000f},
-    {0.000000f, 0.310371f, 5.130285f},
-    {-0.960107f, 0.565249f, -0.372760f},
-    {-0.845504f, 0.498033f, 1.630241f},
-    {-0.538940f, 0.845265f, 1.726136f},
-    {0.000000f, 0.948491f, 1.700656f},
-    {0.000000f, -0.000333f, 2.156063f},
-    {-1.125746f, 0.180615f, 1.542580f},
-    {-1.125746f, -0.000333f, 1.866080f},
-};
-
-static constexpr Edge kShipEdges[] = {
-    {0, 2},
-    {0, 14},
-    {0, 56},
-    {1, 3},
-    {1, 6},
-    {1, 14},
-    {1, 52},
-    {1, 55},
-    {2, 8},
-    {2, 15},
-    {2, 47},
-    {2, 59},
-    {3, 7},
-    {3, 9},
-    {3, 15},
-    {3, 45},
-    {3, 51},
-    {4, 5},
-    {4, 52},
-    {4, 61},
-    {5, 46},
-    {5, 51},
-    {5, 63},
-    {6, 7},
-    {6, 16},
-    {6, 21},
-    {6, 25},
-    {7, 10},
-    {7, 17},
-    {7, 22},
-    {7, 26},
-    {8, 18},
-    {9, 10},
-    {9, 18},
-    {10, 19},
-    {11, 20},
-    {11, 47},
-    {11, 72},
-    {12, 20},
-    {12, 45},
-    {12, 50},
-    {12, 71},
-    {13, 46},
-    {13, 50},
-    {13, 74},
-    {14, 15},
-    {14, 16},
-    {14, 18},
-    {14, 76},
-    {15, 18},
-    {15, 48},
-    {16, 17},
-    {16, 19},
-    {16, 23},
-    {17, 19},
-    {17, 24},
-    {18, 19},
-    {20, 48},
-    {20, 83},
-    {21, 22},
-    {21, 23},
-    {21, 27},
-    {22, 24},
-    {22, 28},
-    {23, 24},
-    {25, 26},
-    {25, 27},
-    {25, 29},
-    {26, 28},
-    {26, 30},
-    {27, 28},
-    {27, 31},
-    {28, 32},
-    {29, 30},
-    {29, 31},
-    {29, 33},
-    {30, 32},
-    {30, 34},
-    {31, 32},
-    {31, 35},
-    {32, 36},
-    {33, 34},
-    {33, 35},
-    {33, 37},
-    {34, 36},
-    {34, 38},
-    {35, 36},
-    {35, 39},
-    {36, 40},
-    {37, 38},
-    {37, 39},
-    {37, 41},
-    {38, 40},
-    {38, 42},
-    {39, 40},
-    {39, 43},
-    {40, 44},
-    {41, 42},
-    {41, 43},
-    {42, 44},
-    {43, 44},
-    {45, 48},
-    {45, 49},
-    {46, 49},
-    {46, 112},
-    {47, 48},
-    {47, 108},
-    {49, 50},
-    {49, 51},
-    {50, 116},
-    {51, 52},
-    {52, 117},
-    {53, 56},
-    {53, 57},
-    {53, 75},
-    {54, 55},
-    {54, 58},
-    {54, 64},
-    {54, 75},
-    {54, 119},
-    {55, 76},
-    {55, 117},
-    {56, 59},
-    {56, 76},
-    {57, 59},
-    {57, 66},
-    {57, 77},
-    {57, 111},
-    {58, 65},
-    {58, 67},
-    {58, 77},
-    {58, 109},
-    {58, 118},
-    {59, 108},
-    {60, 61},
-    {60, 62},
-    {60, 119},
-    {61, 63},
-    {61, 117},
-    {62, 63},
-    {62, 110},
-    {62, 118},
-    {63, 112},
-    {64, 65},
-    {64, 78},
-    {64, 84},
-    {64, 88},
-    {65, 68},
-    {65, 79},
-    {65, 85},
-    {65, 89},
-    {66, 80},
-    {67, 68},
-    {67, 80},
-    {68, 81},
-    {69, 72},
-    {69, 82},
-    {69, 111},
-    {70, 71},
-    {70, 82},
-    {70, 109},
-    {70, 115},
-    {71, 83},
-    {71, 116},
-    {72, 83},
-    {72, 108},
-    {73, 74},
-    {73, 110},
-    {73, 115},
-    {74, 112},
-    {74, 116},
-    {75, 76},
-    {75, 77},
-    {75, 78},
-    {75, 80},
-    {77, 80},
-    {77, 113},
-    {78, 79},
-    {78, 81},
-    {78, 86},
-    {79, 81},
-    {79, 87},
-    {80, 81},
-    {82, 83},
-    {82, 113},
-    {84, 85},
-    {84, 86},
-    {84, 90},
-    {85, 87},
-    {85, 91},
-    {86, 87},
-    {88, 89},
-    {88, 90},
-    {88, 92},
-    {89, 91},
-    {89, 93},
-    {90, 91},
-    {90, 94},
-    {91, 95},
-    {92, 93},
-    {92, 94},
-    {92, 96},
-    {93, 95},
-    {93, 97},
-    {94, 95},
-    {94, 98},
-    {95, 99},
-    {96, 97},
-    {96, 98},
-    {96, 100},
-    {97, 99},
-    {97, 101},
-    {98, 99},
-    {98, 102},
-    {99, 103},
-    {100, 101},
-    {100, 102},
-    {100, 104},
-    {101, 103},
-    {101, 105},
-    {102, 103},
-    {102, 106},
-    {103, 107},
-    {104, 105},
-    {104, 106},
-    {105, 107},
-    {106, 107},
-    {108, 111},
-    {109, 113},
-    {109, 114},
-    {110, 112},
-    {110, 114},
-    {111, 113},
-    {114, 115},
-    {114, 118},
-    {115, 116},
-    {117, 119},
-    {118, 119},
-};
-
-struct ModelBounds {
-    float min_x = 0.0f;
-    float max_x = 0.0f;
-    float min_y = 0.0f;
-    float max_y = 0.0f;
-    float min_z = 0.0f;
-    float max_z = 0.0f;
-};
+// Generated from LowPolySpaceShip/SpaceShip.obj at build time, see app/assets/meshes
+namespace ship = meshes::space_ship;
 
-static ModelBounds ship_bounds()
-{
-    ModelBounds bounds;
-    bounds.min_x = bounds.max_x = kShipVertices[0].x;
-    bounds.min_y = bounds.max_y = kShipVertices[0].y;
-    bounds.min_z = bounds.max_z = kShipVertices[0].z;
-    for (size_t i = 1; i < (sizeof(kShipVertices) / sizeof(kShipVertices[0])); ++i) {
-        const auto& v = kShipVertices[i];
-        bounds.min_x = std::min(bounds.min_x, v.x);
-        bounds.max_x = std::max(bounds.max_x, v.x);
-        bounds.min_y = std::min(bounds.min_y, v.y);
-        bounds.max_y = std::max(bounds.max_y, v.y);
-        bounds.min_z = std::min(bounds.min_z, v.z);
-        bounds.max_z = std::max(bounds.max_z, v.z);
-    }
-    return bounds;
-}
 } // namespace
 
 namespace launcher_view {
 
 struct ShipWireframe {
-    lv_obj_t* container = nullptr;
-    std::vector<lv_obj_t*> lines;
-    std::vector<std::array<lv_point_precise_t, 2>> line_points;
-    std::vector<lv_point_precise_t> projected_points;
+    // One A8 canvas for all the edges, drawn in the line colour through the image recolor
+    lv_obj_t* canvas = nullptr;
+    ui::AlphaRaster raster;
+    std::vector<std::array<float, 2>> projected_points;
+    float line_width = 1.0f;
     float center_x = 0.0f;
     float center_y = 0.0f;
     float center_z = 0.0f;
@@ -452,21 +58,22 @@ struct ShipWireframe {
 
     void init(lv_obj_t* parent, lv_coord_t w, lv_coord_t h, lv_coord_t x, lv_coord_t y, lv_color_t color, int line_width)
     {
-        container = lv_obj_create(parent);
-        lv_obj_set_size(container, w, h);
-        lv_obj_align(container, LV_ALIGN_LEFT_MID, x, y);
-        lv_obj_set_style_bg_opa(container, LV_OPA_TRANSP, 0);
-        lv_obj_set_style_border_width(container, 0, 0);
-        lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE);
-
-        ModelBounds bounds = ship_bounds();
-        center_x = (bounds.min_x + bounds.max_x) * 0.5f;
-        center_y = (bounds.min_y + bounds.max_y) * 0.5f;
-        center_z = (bounds.min_z + bounds.max_z) * 0.5f;
-
-        float model_w = bounds.max_x - bounds.min_x;
-        float model_h = bounds.max_y - bounds.min_y;
-        float model_z = bounds.max_z - bounds.min_z;
+        raster.init(w, h, lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8));
+
+        canvas = lv_canvas_create(parent);
+        lv_canvas_set_buffer(canvas, raster.data(), w, h, LV_COLOR_FORMAT_A8);
+        lv_obj_align(canvas, LV_ALIGN_LEFT_MID, x, y);
+        lv_obj_set_style_image_recolor(canvas, color, 0);
+        lv_obj_set_style_image_recolor_opa(canvas, LV_OPA_COVER, 0);
+
+        // Everything stays in quantized mesh units, the projection only needs their ratios
+        center_x = (ship::kMin.x + ship::kMax.x) * 0.5f;
+        center_y = (ship::kMin.y + ship::kMax.y) * 0.5f;
+        center_z = (ship::kMin.z + ship::kMax.z) * 0.5f;
+
+        float model_w = ship::kMax.x - ship::kMin.x;
+        float model_h = ship::kMax.y - ship::kMin.y;
+        float model_z = ship::kMax.z - ship::kMin.z;
         float scale_x = static_cast<float>(w) / model_w;
         float scale_y = static_cast<float>(h) / model_h;
         scale = 0.82f * std::min(scale_x, scale_y);
@@ -477,25 +84,14 @@ struct ShipWireframe {
         origin_x = static_cast<float>(w) * 0.5f;
         origin_y = static_cast<float>(h) * 0.5f;
 
-        size_t edge_count = sizeof(kShipEdges) / sizeof(kShipEdges[0]);
-        size_t vertex_count = sizeof(kShipVertices) / sizeof(kShipVertices[0]);
-        lines.reserve(edge_count);
-        line_points.assign(edge_count, {{{0, 0}, {0, 0}}});
-        projected_points.assign(vertex_count, {0, 0});
-
-        for (size_t i = 0; i < edge_count; ++i) {
-            lv_obj_t* line = lv_line_create(container);
-            lv_line_set_points(line, line_points[i].data(), line_points[i].size());
-            lv_obj_set_style_line_color(line, color, 0);
-            lv_obj_set_style_line_width(line, line_width, 0);
-            lv_obj_set_style_line_rounded(line, true, 0);
-            lines.push_back(line);
-        }
+        size_t vertex_count = sizeof(ship::kVertices) / sizeof(ship::kVertices[0]);
+        projected_points.assign(vertex_count, {0.0f, 0.0f});
+        this->line_width = static_cast<float>(line_width);
     }
 
     void update(float roll_deg, float pitch_deg)
     {
-        if (!container) {
+        if (!canvas) {
             return;
         }
 
@@ -508,7 +104,7 @@ struct ShipWireframe {
 
         size_t vertex_count = projected_points.size();
         for (size_t i = 0; i < vertex_count; ++i) {
-            const auto& v = kShipVertices[i];
+            const auto& v = ship::kVertices[i];
             float x = v.x - center_x;
             float y = v.y - center_y;
             float z = v.z - center_z;
@@ -525,19 +121,30 @@ struct ShipWireframe {
             float y3 = x2;
 
             float perspective = depth / (depth + z2 + depth * 0.15f);
-            float px = origin_x + (x3 * scale * perspective);
-            float py = origin_y - (y3 * scale * perspective);
-
-            projected_points[i].x = static_cast<lv_coord_t>(px);
-            projected_points[i].y = static_cast<lv_coord_t>(py);
+            projected_points[i][0] = origin_x + (x3 * scale * perspective);
+            projected_points[i][1] = origin_y - (y3 * scale * perspective);
         }
 
-        for (size_t i = 0; i < line_points.size(); ++i) {
-            const auto& edge = kShipEdges[i];
-            line_points[i][0] = projected_points[edge.a];
-            line_points[i][1] = projected_points[edge.b];
-            lv_line_set_points(lines[i], line_points[i].data(), line_points[i].size());
+        // Redraw from scratch, the area to refresh is what the last frame covered plus what this one does
+        ui::AlphaRaster::Area_t dirty = raster.clear();
+        for (const auto& edge : ship::kEdges) {
+            const auto& a = projected_points[edge.a];
+            const auto& b = projected_points[edge.b];
+            raster.drawLine(a[0], a[1], b[0], b[1], line_width);
         }
+        dirty.join(raster.drawnArea());
+        if (dirty.empty()) {
+            return;
+        }
+
+        lv_area_t coords;
+        lv_obj_get_coords(canvas, &coords);
+        lv_area_t area;
+        area.x1 = coords.x1 + dirty.x1;
+        area.y1 = coords.y1 + dirty.y1;
+        area.x2 = coords.x1 + dirty.x2;
+        area.y2 = coords.y1 + dirty.y2;
+        lv_obj_invalidate_area(canvas, &area);
     }
 };
 
@@ -666,7 +273,8 @@ void PanelImu::init()
 
 void PanelImu::update(bool isStacked)
 {
-    if (GetHAL()->millis() - _time_count < 100) {
+    // Reading the fused attitude is a snapshot copy, so the ship can follow at display rate
+    if (GetHAL()->millis() - _time_count < 33) {
         return;
     }
 
@@ -676,8 +284,17 @@ void PanelImu::update(bool isStacked)
     float accel_y = GetHAL()->imuData.accelY;
     float accel_z = GetHAL()->imuData.accelZ;
 
-    float roll_deg = std::atan2(accel_y, accel_z) * kRadToDeg;
-    float pitch_deg = std::atan2(-accel_x, std::sqrt(accel_y * accel_y + accel_z * accel_z)) * kRadToDeg;
+    float roll_deg = 0.0f;
+    float pitch_deg = 0.0f;
+    imu::Attitude_t attitude;
+    if (GetHAL()->getImuAttitude(attitude)) {
+        // imuData's accel y is mirrored against the estimator frame, keep the roll sense the ship was tuned to
+        roll_deg = -attitude.roll;
+        pitch_deg = attitude.pitch;
+    } else {
+        roll_deg = std::atan2(accel_y, accel_z) * kRadToDeg;
+        pitch_deg = std::atan2(-accel_x, std::sqrt(accel_y * accel_y + accel_z * accel_z)) * kRadToDeg;
+    }
 
     if (_ship_wireframe) {
         _ship_wireframe->update(roll_deg, pitch_deg);
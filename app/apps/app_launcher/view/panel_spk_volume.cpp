@@ -65,6 +65,18 @@ static void on_enabled_changed(lv_event_t* e)
     app::dsp::BoostSettingsStore::instance().set_enabled(enabled);
 }
 
+static void on_live_monitor_changed(lv_event_t* e)
+{
+    lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    bool enabled = lv_obj_has_state(obj, LV_STATE_CHECKED);
+    ESP_LOGI(TAG, "live monitor: %s", enabled ? "ON" : "OFF");
+    if (enabled) {
+        GetHAL()->startAudioDsp();
+    } else {
+        GetHAL()->stopAudioDsp();
+    }
+}
+
 static void on_near_field_changed(lv_event_t* e)
 {
     lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_target(e));
@@ -91,6 +103,16 @@ static void on_beam_width_changed(lv_event_t* e)
     app::dsp::BoostSettingsStore::instance().set_beam_width(static_cast<float>(v) / 100.0f);
 }
 
+static void on_beam_steer_changed(lv_event_t* e)
+{
+    lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    lv_obj_t* label = static_cast<lv_obj_t*>(lv_event_get_user_data(e));
+    int v = std::clamp((int)lv_slider_get_value(obj), -90, 90);
+    update_label_db(label, "Beam steer: %+d deg", v);
+    ESP_LOGI(TAG, "beam steer: %d deg", v);
+    app::dsp::BoostSettingsStore::instance().set_beam_steer_deg(static_cast<float>(v));
+}
+
 static void on_pre_gain_changed(lv_event_t* e)
 {
     lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_target(e));
@@ -159,6 +181,16 @@ static void on_aes_changed(lv_event_t* e)
     app::dsp::BoostSettingsStore::instance().set_aes_enable(enabled);
 }
 
+static void on_aec_tail_changed(lv_event_t* e)
+{
+    lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_target(e));
+    lv_obj_t* label = static_cast<lv_obj_t*>(lv_event_get_user_data(e));
+    int v = std::clamp((int)lv_slider_get_value(obj), 10, 200);
+    update_label_db(label, "Echo tail: %d ms", v);
+    ESP_LOGI(TAG, "aec tail: %d ms", v);
+    app::dsp::BoostSettingsStore::instance().set_aec_tail_ms(static_cast<float>(v));
+}
+
 static void on_headset_mic_only_changed(lv_event_t* e)
 {
     lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_target(e));
@@ -364,6 +396,13 @@ void PanelSpeakerVolume::init()
     }
     lv_obj_add_event_cb(cb_enabled, &on_enabled_changed, LV_EVENT_VALUE_CHANGED, nullptr);
 
+    lv_obj_t* cb_live_monitor = lv_checkbox_create(_panel_tuning);
+    lv_checkbox_set_text(cb_live_monitor, "Live monitor");
+    if (GetHAL()->isAudioDspRunning()) {
+        lv_obj_add_state(cb_live_monitor, LV_STATE_CHECKED);
+    }
+    lv_obj_add_event_cb(cb_live_monitor, &on_live_monitor_changed, LV_EVENT_VALUE_CHANGED, nullptr);
+
     lv_obj_t* cb_near_field = lv_checkbox_create(_panel_tuning);
     lv_checkbox_set_text(cb_near_field, "Near-field tuning");
     if (settings.near_field) {
@@ -392,6 +431,15 @@ void PanelSpeakerVolume::init()
     }
     lv_obj_add_event_cb(cb_aes, &on_aes_changed, LV_EVENT_VALUE_CHANGED, nullptr);
 
+    lv_obj_t* label_aec_tail = lv_label_create(_panel_tuning);
+    lv_label_set_text_fmt(label_aec_tail, "Echo tail: %d ms", (int)settings.aec_tail_ms);
+    lv_obj_t* sl_aec_tail = lv_slider_create(_panel_tuning);
+    lv_slider_set_range(sl_aec_tail, 10, 200);
+    lv_slider_set_value(sl_aec_tail, (int)settings.aec_tail_ms, LV_ANIM_OFF);
+    lv_obj_set_width(sl_aec_tail, LV_PCT(100));
+    lv_obj_add_event_cb(sl_aec_tail, &on_aec_tail_changed, LV_EVENT_VALUE_CHANGED, label_aec_tail);
+    apply_slider_style(sl_aec_tail);
+
     lv_obj_t* cb_beamform = lv_checkbox_create(_panel_tuning);
     lv_checkbox_set_text(cb_beamform, "Beamforming");
     if (settings.beamform_enable) {
@@ -408,6 +456,15 @@ void PanelSpeakerVolume::init()
     lv_obj_add_event_cb(sl_beam_width, &on_beam_width_changed, LV_EVENT_VALUE_CHANGED, label_beam_width);
     apply_slider_style(sl_beam_width);
 
+    lv_obj_t* label_beam_steer = lv_label_create(_panel_tuning);
+    lv_label_set_text_fmt(label_beam_steer, "Beam steer: %+d deg", (int)settings.beam_steer_deg);
+    lv_obj_t* sl_beam_steer = lv_slider_create(_panel_tuning);
+    lv_slider_set_range(sl_beam_steer, -90, 90);
+    lv_slider_set_value(sl_beam_steer, (int)settings.beam_steer_deg, LV_ANIM_OFF);
+    lv_obj_set_width(sl_beam_steer, LV_PCT(100));
+    lv_obj_add_event_cb(sl_beam_steer, &on_beam_steer_changed, LV_EVENT_VALUE_CHANGED, label_beam_steer);
+    apply_slider_style(sl_beam_steer);
+
     lv_obj_t* label_pre_gain = lv_label_create(_panel_tuning);
     lv_label_set_text_fmt(label_pre_gain, "Pre gain: %+d dB", (int)settings.pre_gain_db);
     lv_obj_t* sl_pre_gain = lv_slider_create(_panel_tuning);
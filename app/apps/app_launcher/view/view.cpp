@@ -65,6 +65,11 @@ void LauncherView::init()
     lv_obj_set_style_bg_opa(lcars_header, LV_OPA_90, 0);
     lv_obj_set_style_border_width(lcars_header, 0, 0);
     lv_obj_clear_flag(lcars_header, LV_OBJ_FLAG_SCROLLABLE);
+    // Long press the header to run the render benchmark over this screen
+    lv_obj_add_event_cb(
+        lcars_header,
+        [](lv_event_t* e) { static_cast<LauncherView*>(lv_event_get_user_data(e))->_bench_requested = true; },
+        LV_EVENT_LONG_PRESSED, this);
 
     lv_obj_t* lcars_title = lv_label_create(lcars_header);
     lv_label_set_text(lcars_title, "BOOST LCARS SYSTEMS");
@@ -106,4 +111,15 @@ void LauncherView::update()
     for (auto& panel : _panels) {
         panel->update(_is_stacked);
     }
+
+    if (_bench_requested) {
+        _bench_requested = false;
+        if (!_render_bench) {
+            _render_bench = std::make_unique<ui::RenderBench>();
+        }
+        _render_bench->start(lv_screen_active());
+    }
+    if (_render_bench) {
+        _render_bench->update();
+    }
 }
@@ -8,6 +8,7 @@
 #include <memory>
 #include <lvgl.h>
 #include <apps/utils/ui/window.h>
+#include <apps/utils/ui/render_bench.h>
 #include <smooth_ui_toolkit.h>
 #include <smooth_lvgl.h>
 #include <vector>
@@ -309,8 +310,10 @@ public:
     void update();
 
 private:
-    bool _is_stacked = false;
+    bool _is_stacked      = false;
+    bool _bench_requested = false;
     std::vector<std::unique_ptr<PanelBase>> _panels;
+    std::unique_ptr<ui::RenderBench> _render_bench;
 
     void update_anim();
 };
@@ -128,6 +128,9 @@ void AppStartupAnim::onClose()
     _logo_tab.reset();
     _logo_5.reset();
     _label_version.reset();
+    // Never shown again, free their decoded copies from the image cache
+    lv_image_cache_drop(&logo_tab);
+    lv_image_cache_drop(&logo_5);
 
     GetHAL()->setSpeakerVolume(60);
 }
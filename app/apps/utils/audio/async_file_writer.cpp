@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "async_file_writer.h"
+#include <chrono>
+#include <cstring>
+
+using namespace audio;
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    close();
+}
+
+bool AsyncFileWriter::open(const std::string& path, size_t chunks)
+{
+    close();
+    if (chunks < 2) {
+        return false;
+    }
+
+    _file = fopen(path.c_str(), "wb");
+    if (_file == nullptr) {
+        return false;
+    }
+    // Chunks are already as large as a write gets, stdio buffering would only add a copy
+    setvbuf(_file, nullptr, _IONBF, 0);
+
+    _chunk_count = chunks;
+    _chunks.reset(new Chunk[_chunk_count]);
+    _ready.reset(new std::atomic<bool>[_chunk_count]);
+    for (size_t i = 0; i < _chunk_count; i++) {
+        _ready[i].store(false, std::memory_order_relaxed);
+    }
+    _fill_chunk  = 0;
+    _fill_bytes  = 0;
+    _write_chunk = 0;
+    _bytes_written.store(0, std::memory_order_relaxed);
+    _bytes_dropped.store(0, std::memory_order_relaxed);
+    _chunks_written.store(0, std::memory_order_relaxed);
+    _write_errors.store(0, std::memory_order_relaxed);
+    _slowest_write_us.store(0, std::memory_order_relaxed);
+    _queued_chunks.store(0, std::memory_order_relaxed);
+    _max_queued_chunks.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+void AsyncFileWriter::close()
+{
+    if (_file) {
+        fclose(_file);
+        _file = nullptr;
+    }
+    _chunks.reset();
+    _ready.reset();
+    _chunk_count = 0;
+}
+
+bool AsyncFileWriter::append(const void* data, size_t bytes)
+{
+    if (_file == nullptr || bytes > kChunkBytes * (_chunk_count - 1)) {
+        return false;
+    }
+
+    // Check every chunk the bytes would touch before copying anything
+    const size_t touched = (_fill_bytes + bytes + kChunkBytes - 1) / kChunkBytes;
+    bool blocked         = touched > _chunk_count;
+    for (size_t i = 0; i < touched && !blocked; i++) {
+        blocked = _ready[(_fill_chunk + i) % _chunk_count].load(std::memory_order_acquire);
+    }
+    if (blocked) {
+        _bytes_dropped.fetch_add(bytes, std::memory_order_relaxed);
+        return false;
+    }
+
+    const uint8_t* in = static_cast<const uint8_t*>(data);
+    while (bytes > 0) {
+        const size_t room  = kChunkBytes - _fill_bytes;
+        const size_t count = bytes < room ? bytes : room;
+        memcpy(_chunks[_fill_chunk].data + _fill_bytes, in, count);
+        _fill_bytes += count;
+        in          += count;
+        bytes       -= count;
+
+        if (_fill_bytes == kChunkBytes) {
+            _ready[_fill_chunk].store(true, std::memory_order_release);
+            _fill_chunk = (_fill_chunk + 1) % _chunk_count;
+            _fill_bytes = 0;
+
+            const uint32_t queued = _queued_chunks.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (queued > _max_queued_chunks.load(std::memory_order_relaxed)) {
+                _max_queued_chunks.store(queued, std::memory_order_relaxed);
+            }
+        }
+    }
+    return true;
+}
+
+bool AsyncFileWriter::service()
+{
+    if (_file == nullptr) {
+        return false;
+    }
+
+    bool wrote = false;
+    while (_ready[_write_chunk].load(std::memory_order_acquire)) {
+        write_chunk(_chunks[_write_chunk].data, kChunkBytes);
+        _ready[_write_chunk].store(false, std::memory_order_release);
+        _queued_chunks.fetch_sub(1, std::memory_order_relaxed);
+        _write_chunk = (_write_chunk + 1) % _chunk_count;
+        wrote        = true;
+    }
+    return wrote;
+}
+
+void AsyncFileWriter::flush()
+{
+    if (_file == nullptr) {
+        return;
+    }
+    service();
+    if (_fill_bytes > 0) {
+        write_chunk(_chunks[_fill_chunk].data, _fill_bytes);
+        _fill_bytes = 0;
+    }
+    fflush(_file);
+}
+
+bool AsyncFileWriter::writeAt(size_t offset, const void* data, size_t bytes)
+{
+    if (_file == nullptr) {
+        return false;
+    }
+    const long end = ftell(_file);
+    const bool ok  = fseek(_file, static_cast<long>(offset), SEEK_SET) == 0 && fwrite(data, 1, bytes, _file) == bytes;
+    fseek(_file, end, SEEK_SET);
+    return ok;
+}
+
+void AsyncFileWriter::write_chunk(const uint8_t* data, size_t bytes)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const size_t n   = fwrite(data, 1, bytes, _file);
+    const auto us    = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    _bytes_written.fetch_add(n, std::memory_order_relaxed);
+    _chunks_written.fetch_add(1, std::memory_order_relaxed);
+    if (n != bytes) {
+        _write_errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (static_cast<uint32_t>(us.count()) > _slowest_write_us.load(std::memory_order_relaxed)) {
+        _slowest_write_us.store(static_cast<uint32_t>(us.count()), std::memory_order_relaxed);
+    }
+}
+
+AsyncFileWriter::Stats_t AsyncFileWriter::stats() const
+{
+    Stats_t ret;
+    ret.bytesWritten    = _bytes_written.load(std::memory_order_relaxed);
+    ret.bytesDropped    = _bytes_dropped.load(std::memory_order_relaxed);
+    ret.chunksWritten   = _chunks_written.load(std::memory_order_relaxed);
+    ret.writeErrors     = _write_errors.load(std::memory_order_relaxed);
+    ret.slowestWriteUs  = _slowest_write_us.load(std::memory_order_relaxed);
+    ret.queuedChunks    = _queued_chunks.load(std::memory_order_relaxed);
+    ret.maxQueuedChunks = _max_queued_chunks.load(std::memory_order_relaxed);
+    return ret;
+}
@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace audio {
+
+/**
+ * @brief Double buffered file writer, one side fills while the other side writes
+ *
+ * The producer appends into a chunk and hands it over when it is full, the consumer (a low priority task owned by
+ * the platform) writes handed over chunks out whole and gives them back. Chunks are large and cache line aligned,
+ * and the file is unbuffered, so a full chunk goes straight from our memory to the card in one write.
+ *
+ * append() never blocks. If the consumer falls so far behind that no chunk is free, the append is dropped as a
+ * whole and counted, so the file loses a record instead of getting torn ones. Chunks only exist between open() and
+ * close(), more of them let a single record span several chunks and give the consumer more slack.
+ */
+class AsyncFileWriter {
+public:
+    static constexpr size_t kChunkBytes = 64 * 1024;
+    static constexpr size_t kChunks     = 2;
+    static constexpr size_t kAlignment  = 64;
+
+    struct Stats_t {
+        uint64_t bytesWritten    = 0;
+        uint64_t bytesDropped    = 0;
+        uint32_t chunksWritten   = 0;
+        uint32_t writeErrors     = 0;
+        uint32_t slowestWriteUs  = 0;
+        uint32_t queuedChunks    = 0;  // handed over, waiting for the consumer
+        uint32_t maxQueuedChunks = 0;
+    };
+
+    ~AsyncFileWriter();
+
+    /**
+     * @brief Create or truncate the file, neither side may be running
+     *
+     */
+    bool open(const std::string& path, size_t chunks = kChunks);
+    void close();
+
+    bool isOpen() const
+    {
+        return _file != nullptr;
+    }
+    size_t chunkCount() const
+    {
+        return _chunk_count;
+    }
+
+    /* ------------------------------ Producer side ----------------------------- */
+    /**
+     * @brief Queue bytes, all or nothing
+     *
+     * @param bytes at most kChunkBytes * (chunks - 1)
+     * @return false if there was no room and the bytes were dropped
+     */
+    bool append(const void* data, size_t bytes);
+
+    /* ------------------------------ Consumer side ----------------------------- */
+    /**
+     * @brief Write out every chunk that has been handed over
+     *
+     * @return false if there was nothing to do, the caller can sleep
+     */
+    bool service();
+
+    /**
+     * @brief Write everything including the partial chunk, only once the producer has stopped
+     *
+     */
+    void flush();
+
+    /**
+     * @brief Overwrite already flushed bytes, e.g. a header whose sizes are only known at the end
+     *
+     */
+    bool writeAt(size_t offset, const void* data, size_t bytes);
+
+    Stats_t stats() const;
+
+private:
+    struct alignas(kAlignment) Chunk {
+        uint8_t data[kChunkBytes];
+    };
+
+    std::unique_ptr<Chunk[]> _chunks;
+    std::unique_ptr<std::atomic<bool>[]> _ready;  // true while the consumer owns the chunk
+    size_t _chunk_count = 0;
+    FILE* _file         = nullptr;
+
+    // Producer
+    size_t _fill_chunk = 0;
+    size_t _fill_bytes = 0;
+
+    // Consumer
+    size_t _write_chunk = 0;
+
+    std::atomic<uint64_t> _bytes_written{0};
+    std::atomic<uint64_t> _bytes_dropped{0};
+    std::atomic<uint32_t> _chunks_written{0};
+    std::atomic<uint32_t> _write_errors{0};
+    std::atomic<uint32_t> _slowest_write_us{0};
+    std::atomic<uint32_t> _queued_chunks{0};
+    std::atomic<uint32_t> _max_queued_chunks{0};
+
+    void write_chunk(const uint8_t* data, size_t bytes);
+};
+
+}  // namespace audio
@@ -3,36 +3,45 @@
  *
  * SPDX-License-Identifier: MIT
  */
+#include "tone_synth.h"
 #include <vector>
-#include <cmath>
 #include <cstdlib>
 #include <cstdint>
 #include <algorithm>
+#include <mutex>
 #include <hal/hal.h>
 
-static constexpr int SAMPLE_RATE = 48000;
-static constexpr double PI       = 3.14159265358979323846;
+using ToneSynth = audio::ToneSynth;
 
-// 简单线性包络：attack + decay
-void generate_tone_with_linear_envelope(std::vector<int16_t>& buffer, double freq, double duration, double volume)
+static constexpr uint32_t TONE_FADE_FRAMES    = 200;                           // 结尾淡出长度
+static constexpr int16_t TONE_AMPLITUDE       = 32767 / 5;
+static constexpr uint32_t CHORD_ATTACK_FRAMES = ToneSynth::kSampleRate / 200;  // 5ms attack
+static constexpr int16_t CHORD_AMPLITUDE      = 32767 * 35 / 100;
+
+// Notes are rendered by the playback mixer, registered on first use
+static ToneSynth& tone_synth()
 {
-    int samples        = static_cast<int>(SAMPLE_RATE * duration);
-    int attack_samples = SAMPLE_RATE * 0.005;  // 5ms attack
-    for (int i = 0; i < samples; ++i) {
-        double t         = static_cast<double>(i) / SAMPLE_RATE;
-        double amplitude = 1.0;
-
-        if (i < attack_samples) {
-            amplitude = static_cast<double>(i) / attack_samples;  // Linear attack
-        } else {
-            amplitude = 1.0 - static_cast<double>(i - attack_samples) / (samples - attack_samples);  // Linear decay
-        }
+    static ToneSynth synth;
+    static std::once_flag flag;
+    std::call_once(flag, []() { GetHAL()->audioAddSource(&synth); });
+    return synth;
+}
 
-        double sample = std::sin(2.0 * PI * freq * t) * amplitude;
-        int16_t s     = static_cast<int16_t>(sample * volume * 32767);
-        buffer.push_back(s);  // Left
-        buffer.push_back(s);  // Right
-    }
+static uint32_t midi_phase_increment(int midi)
+{
+    return ToneSynth::kMidiPhaseIncrement[std::clamp(midi, 0, 127)];
+}
+
+// 恒定音量 + 结尾淡出
+static void queue_tone(uint32_t phaseIncrement, uint32_t frames, uint32_t delayFrames)
+{
+    ToneSynth::Note_t note;
+    note.phaseIncrement = phaseIncrement;
+    note.delayFrames    = delayFrames;
+    note.releaseFrames  = std::min(frames, TONE_FADE_FRAMES);
+    note.holdFrames     = frames - note.releaseFrames;
+    note.amplitude      = TONE_AMPLITUDE;
+    tone_synth().trigger(note);
 }
 
 namespace audio {
@@ -43,66 +52,24 @@ void play_tone(int frequency, double durationSec)
         return;
     }
 
-    const int sample_rate = 48000;
-    const int samples     = static_cast<int>(sample_rate * durationSec);
-    std::vector<int16_t> buffer(samples * 2);  // 双声道
-
-    const int fade_len    = 200;  // 淡出长度（采样点）
-    const float amplitude = 32767.0f / 5;
-
-    for (int i = 0; i < samples; ++i) {
-        float amp = amplitude;
-
-        // 应用结尾淡出（fade-out）
-        if (i >= samples - fade_len) {
-            float fade_factor = static_cast<float>(samples - i) / fade_len;
-            amp *= fade_factor;
-        }
-
-        int16_t value     = static_cast<int16_t>(amp * sin(2.0 * M_PI * frequency * i / sample_rate));
-        buffer[i * 2]     = value;  // 左声道
-        buffer[i * 2 + 1] = value;  // 右声道
-    }
-
-    GetHAL()->audioPlay(buffer);
+    queue_tone(ToneSynth::phaseIncrementFromHz(frequency), ToneSynth::framesFromSeconds(durationSec), 0);
 }
 
-void play_melody(const std::vector<int>& midiList, double durationSec = 0.1)
+void play_melody(const std::vector<int>& midiList, double durationSec)
 {
     if (GetHAL()->getSpeakerVolume() <= 0) {
         return;
     }
 
-    const int sample_rate      = 48000;
-    const int samples_per_note = static_cast<int>(sample_rate * durationSec);
-    const int fade_len         = 200;  // 每个音符结尾的淡出长度
-    const float amplitude      = 32767.0f / 5;
-
-    std::vector<int16_t> buffer;                             // 大 buffer 存放整首旋律
-    buffer.reserve(midiList.size() * samples_per_note * 2);  // 双声道预留空间
-
+    // The whole melody goes out at once, each note delayed to its slot
+    const uint32_t frames_per_note = ToneSynth::framesFromSeconds(durationSec);
+    uint32_t delay                 = 0;
     for (int midiNote : midiList) {
-        for (int i = 0; i < samples_per_note; ++i) {
-            float amp = amplitude;
-
-            // 应用淡出（仅每个音符的结尾）
-            if (i >= samples_per_note - fade_len) {
-                float fade_factor = static_cast<float>(samples_per_note - i) / fade_len;
-                amp *= fade_factor;
-            }
-
-            int16_t sample = 0;
-            if (midiNote >= 0) {
-                double freq = 440.0 * pow(2.0, (midiNote - 69) / 12.0);
-                sample      = static_cast<int16_t>(amp * sin(2.0 * M_PI * freq * i / sample_rate));
-            }
-
-            buffer.push_back(sample);  // 左声道
-            buffer.push_back(sample);  // 右声道
+        if (midiNote >= 0) {
+            queue_tone(midi_phase_increment(midiNote), frames_per_note, delay);
         }
+        delay += frames_per_note;
     }
-
-    GetHAL()->audioPlay(buffer);
 }
 
 void play_tone_from_midi(int midi, double durationSec)
@@ -111,8 +78,7 @@ void play_tone_from_midi(int midi, double durationSec)
         return;
     }
 
-    double freq = 440.0 * std::pow(2.0, (midi - 69) / 12.0);
-    play_tone(static_cast<int>(freq), durationSec);
+    queue_tone(midi_phase_increment(midi), ToneSynth::framesFromSeconds(durationSec), 0);
 }
 
 void play_random_tone(int semitoneShift = 0, double durationSec = 0.15)
@@ -159,31 +125,16 @@ void play_chord(const std::vector<int>& midiNotes, double durationSec)
         return;
     }
 
-    std::vector<double> freqs;
+    // 5ms 线性 attack，其余时间线性 decay，每个音一个 voice，由混音器叠加
+    const uint32_t frames = ToneSynth::framesFromSeconds(durationSec);
     for (int midi : midiNotes) {
-        double freq = 440.0 * std::pow(2.0, (midi - 69) / 12.0);
-        freqs.push_back(freq);
+        ToneSynth::Note_t note;
+        note.phaseIncrement = midi_phase_increment(midi);
+        note.attackFrames   = std::min(frames, CHORD_ATTACK_FRAMES);
+        note.releaseFrames  = frames - note.attackFrames;
+        note.amplitude      = CHORD_AMPLITUDE;
+        tone_synth().trigger(note);
     }
-
-    std::vector<int16_t> buffer;
-    std::vector<std::vector<int16_t>> tones;
-    for (double freq : freqs) {
-        std::vector<int16_t> tone;
-        generate_tone_with_linear_envelope(tone, freq, durationSec, 0.35);
-        tones.push_back(tone);
-    }
-
-    size_t num_samples = tones[0].size();
-    buffer.resize(num_samples, 0);
-    for (size_t i = 0; i < num_samples; ++i) {
-        int32_t mixed = 0;
-        for (auto& tone : tones) {
-            mixed += tone[i];
-        }
-        buffer[i] = std::clamp((int)mixed, -32768, 32767);
-    }
-
-    GetHAL()->audioPlay(buffer);
 }
 
 void play_random_chord(int semitoneShift, double durationSec)
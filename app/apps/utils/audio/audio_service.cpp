@@ -0,0 +1,242 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "audio_service.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+using namespace audio;
+
+AudioService::AudioService()
+{
+    for (auto& reader : _readers) {
+        reader.ring.resize(kCaptureRingFrames * kCaptureChannels);
+    }
+    _duplex_ring.resize(kDuplexRingPeriods * kPeriodFrames * kCaptureChannels);
+}
+
+void AudioService::setDeviceLatency(size_t captureFrames, size_t playbackFrames)
+{
+    _device_latency.store(captureFrames + playbackFrames, std::memory_order_relaxed);
+}
+
+bool AudioService::reader_active(const CaptureReader& reader) const
+{
+    // Nobody reading means nothing to overrun, a ring is only fed while someone polls it
+    const uint64_t idle = _captured_frames.load(std::memory_order_relaxed) -
+                          reader.stamp.load(std::memory_order_relaxed);
+    return idle < static_cast<uint64_t>(kSampleRate) * kReaderTimeoutMs / 1000;
+}
+
+void AudioService::touch_reader(CaptureReader& reader)
+{
+    reader.stamp.store(_captured_frames.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+bool AudioService::meter_active() const
+{
+    const uint64_t idle = _captured_frames.load(std::memory_order_relaxed) -
+                          _meter_stamp.load(std::memory_order_relaxed);
+    return idle < static_cast<uint64_t>(kSampleRate) * kMeterTimeoutMs / 1000;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   Capture                                  */
+/* -------------------------------------------------------------------------- */
+void AudioService::onCapture(const int16_t* capture, size_t frames)
+{
+    const size_t samples = frames * kCaptureChannels;
+
+    for (auto& reader : _readers) {
+        if (reader_active(reader) && reader.ring.write(capture, samples) < samples) {
+            _overruns.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (_duplex_active.load(std::memory_order_acquire)) {
+        if (_duplex_ring.write(capture, samples) < samples) {
+            _overruns.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (meter_active()) {
+        _analyzer.process(capture, frames);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        if (_capture_callback) {
+            _capture_callback(capture, frames);
+        }
+    }
+
+    _captured_frames.fetch_add(frames, std::memory_order_relaxed);
+}
+
+size_t AudioService::pullCapture(int16_t* capture, size_t frames)
+{
+    auto& reader = _readers[ReaderStream];
+    std::lock_guard<std::mutex> lock(reader.mutex);
+    touch_reader(reader);
+    return reader.ring.read(capture, frames * kCaptureChannels) / kCaptureChannels;
+}
+
+bool AudioService::readCapture(int16_t* capture, size_t frames, uint32_t timeoutMs)
+{
+    auto& reader = _readers[ReaderRecord];
+    std::lock_guard<std::mutex> lock(reader.mutex);
+    touch_reader(reader);
+
+    const size_t queued = reader.ring.size() / kCaptureChannels;
+    if (queued > frames) {
+        reader.ring.discard((queued - frames) * kCaptureChannels);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    size_t got          = 0;
+    while (true) {
+        got += reader.ring.read(capture + got * kCaptureChannels, (frames - got) * kCaptureChannels) /
+               kCaptureChannels;
+        if (got == frames) {
+            return true;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        touch_reader(reader);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::memset(capture + got * kCaptureChannels, 0, (frames - got) * kCaptureChannels * sizeof(int16_t));
+    return false;
+}
+
+CaptureSnapshot_t AudioService::captureSnapshot()
+{
+    _meter_stamp.store(_captured_frames.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return _analyzer.snapshot();
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Playback                                  */
+/* -------------------------------------------------------------------------- */
+void AudioService::onPlayback(int16_t* playback, size_t frames)
+{
+    // The device block size is its own business, processing always sees whole periods
+    while (frames > 0) {
+        if (_period_pos == kPeriodFrames) {
+            render_period();
+            _period_pos = 0;
+        }
+        const size_t count = std::min(frames, kPeriodFrames - _period_pos);
+        std::memcpy(playback, _period + _period_pos * kPlaybackChannels, count * kPlaybackChannels * sizeof(int16_t));
+        playback += count * kPlaybackChannels;
+        frames -= count;
+        _period_pos += count;
+    }
+}
+
+void AudioService::render_period()
+{
+    constexpr size_t period_samples = kPeriodFrames * kPlaybackChannels;
+    constexpr size_t capture_period = kPeriodFrames * kCaptureChannels;
+
+    std::fill(std::begin(_mix), std::end(_mix), 0.0f);
+    _mixer.render(_mix, kPeriodFrames);
+
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+
+        if (_duplex_callback) {
+            // Keep at most two periods in flight, when the device clocks drift apart latency would creep up
+            const size_t queued = _duplex_ring.size();
+            if (queued > capture_period * 2) {
+                _duplex_ring.discard(queued - capture_period * 2);
+                _overruns.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            const size_t got = _duplex_ring.read(_duplex_capture, capture_period);
+            if (got < capture_period) {
+                std::memset(_duplex_capture + got, 0, (capture_period - got) * sizeof(int16_t));
+                _underruns.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            std::memset(_scratch, 0, sizeof(_scratch));
+            _duplex_callback(_duplex_capture, _scratch);
+            for (size_t i = 0; i < period_samples; i++) {
+                _mix[i] += _scratch[i];
+            }
+        }
+
+        if (_playback_callback) {
+            std::memset(_scratch, 0, sizeof(_scratch));
+            _playback_callback(_scratch, kPeriodFrames);
+            for (size_t i = 0; i < period_samples; i++) {
+                _mix[i] += _scratch[i];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < period_samples; i++) {
+        const int32_t v = static_cast<int32_t>(std::lrintf(_mix[i]));
+        _period[i]      = static_cast<int16_t>(std::clamp(v, -32768, 32767));
+    }
+
+    _periods.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t AudioService::pushPlayback(const int16_t* stereo, size_t frames)
+{
+    std::lock_guard<std::mutex> lock(_push_mutex);
+    if (_push_stream == nullptr) {
+        _push_stream = _mixer.openStream(kPushStreamFrames);
+        if (_push_stream == nullptr) {
+            return 0;
+        }
+    }
+
+    const size_t written = _push_stream->write(stereo, frames);
+    if (written < frames) {
+        _overruns.fetch_add(1, std::memory_order_relaxed);
+    }
+    return written;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   Clients                                  */
+/* -------------------------------------------------------------------------- */
+void AudioService::setCaptureCallback(CaptureCallback_t callback)
+{
+    std::lock_guard<std::mutex> lock(_callback_mutex);
+    _capture_callback = std::move(callback);
+}
+
+void AudioService::setPlaybackCallback(PlaybackCallback_t callback)
+{
+    std::lock_guard<std::mutex> lock(_callback_mutex);
+    _playback_callback = std::move(callback);
+}
+
+void AudioService::setDuplexCallback(DuplexCallback_t callback)
+{
+    std::lock_guard<std::mutex> lock(_callback_mutex);
+    _duplex_callback = std::move(callback);
+    _duplex_active.store(static_cast<bool>(_duplex_callback), std::memory_order_release);
+}
+
+AudioService::Stats_t AudioService::stats() const
+{
+    // One period of accumulation on top of whatever the device and the duplex ring hold
+    Stats_t ret;
+    ret.periods       = _periods.load(std::memory_order_relaxed);
+    ret.underruns     = _underruns.load(std::memory_order_relaxed) + _mixer.streamUnderruns();
+    ret.overruns      = _overruns.load(std::memory_order_relaxed);
+    ret.latencyFrames = _device_latency.load(std::memory_order_relaxed) + kPeriodFrames +
+                        _duplex_ring.size() / kCaptureChannels;
+    return ret;
+}
@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "capture_analyzer.h"
+#include "mixer.h"
+#include "spsc_ring.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace audio {
+
+/**
+ * @brief Platform agnostic core of the full-duplex audio stream
+ *
+ * The platform owns the device and calls onCapture() / onPlayback() from its I/O context with whatever block size
+ * the device uses. Internally everything runs in fixed 10 ms periods: capture is fanned out to one ring per reader
+ * (pullCapture() and readCapture() each get their own, so a recorder and a level poll never take frames from each
+ * other), a duplex ring and an optional callback, playback is the mixer plus the duplex and pull callbacks.
+ */
+class AudioService {
+public:
+    static constexpr uint32_t kSampleRate      = Mixer::kSampleRate;
+    static constexpr size_t kPeriodFrames      = kSampleRate / 100;
+    static constexpr size_t kCaptureChannels   = 4;  // [MIC-L, AEC, MIC-R, MIC-HP]
+    static constexpr size_t kPlaybackChannels  = 2;
+    static constexpr size_t kCaptureRingFrames = 8192;
+    static constexpr size_t kDuplexRingPeriods = 4;
+    static constexpr size_t kPushStreamFrames  = kPeriodFrames * 8;
+    static constexpr uint32_t kReaderTimeoutMs = 100;
+    static constexpr uint32_t kMeterTimeoutMs  = 500;
+
+    // Capture blocks are [MIC-L, AEC, MIC-R, MIC-HP] interleaved, playback blocks are stereo
+    using CaptureCallback_t  = std::function<void(const int16_t* capture, size_t frames)>;
+    using PlaybackCallback_t = std::function<void(int16_t* playback, size_t frames)>;
+    using DuplexCallback_t   = std::function<void(const int16_t* capture, int16_t* playback)>;
+
+    struct Stats_t {
+        uint32_t periods       = 0;
+        uint32_t underruns     = 0;
+        uint32_t overruns      = 0;
+        uint32_t latencyFrames = 0;
+    };
+
+    AudioService();
+
+    Mixer& mixer()
+    {
+        return _mixer;
+    }
+
+    /* ------------------------------- Device side ------------------------------ */
+    /**
+     * @brief Buffering the device adds on each side, only used for the latency estimate
+     *
+     */
+    void setDeviceLatency(size_t captureFrames, size_t playbackFrames);
+
+    void onCapture(const int16_t* capture, size_t frames);
+    void onPlayback(int16_t* playback, size_t frames);
+
+    /* ------------------------------- Client side ------------------------------ */
+    /**
+     * @brief Called from the I/O context with every captured block
+     *
+     */
+    void setCaptureCallback(CaptureCallback_t callback);
+
+    /**
+     * @brief Called once per period, the buffer arrives zeroed and is mixed on top of everything else
+     *
+     */
+    void setPlaybackCallback(PlaybackCallback_t callback);
+
+    /**
+     * @brief Called once per period with a whole capture period and a zeroed playback period
+     *
+     */
+    void setDuplexCallback(DuplexCallback_t callback);
+    bool hasDuplexCallback() const
+    {
+        return _duplex_active.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Queue stereo frames into the mix, never blocks
+     *
+     * @return size_t frames accepted
+     */
+    size_t pushPlayback(const int16_t* stereo, size_t frames);
+
+    /**
+     * @brief Take captured frames in order, never blocks
+     *
+     * Streaming reader, meant for one consumer at a time such as a recorder. readCapture() reads its own copy.
+     *
+     * @return size_t frames read
+     */
+    size_t pullCapture(int16_t* capture, size_t frames);
+
+    /**
+     * @brief Wait for the freshest frames, anything older is dropped first
+     *
+     * @return false on timeout, the missing tail is zeroed
+     */
+    bool readCapture(int16_t* capture, size_t frames, uint32_t timeoutMs);
+
+    /**
+     * @brief Latest mic levels and spectrum, never blocks
+     *
+     * The analysis only runs in the I/O context while someone keeps polling this.
+     */
+    CaptureSnapshot_t captureSnapshot();
+
+    Stats_t stats() const;
+
+private:
+    Mixer _mixer;
+
+    // One ring per reader, the I/O context is the only producer and each reader the only consumer of its ring
+    struct CaptureReader {
+        SpscRing<int16_t> ring;
+        std::mutex mutex;  // serializes callers of the same reader
+        std::atomic<uint64_t> stamp{0};
+    };
+
+    enum CaptureReader_t {
+        ReaderStream,  // pullCapture()
+        ReaderRecord,  // readCapture()
+        ReaderCount,
+    };
+
+    // Capture fan out
+    CaptureReader _readers[ReaderCount];
+    SpscRing<int16_t> _duplex_ring;
+    std::atomic<uint64_t> _captured_frames{0};
+    CaptureAnalyzer _analyzer;
+    std::atomic<uint64_t> _meter_stamp{0};
+
+    // Playback period
+    float _mix[kPeriodFrames * kPlaybackChannels];
+    int16_t _period[kPeriodFrames * kPlaybackChannels];
+    int16_t _scratch[kPeriodFrames * kPlaybackChannels];
+    int16_t _duplex_capture[kPeriodFrames * kCaptureChannels];
+    size_t _period_pos = kPeriodFrames;
+
+    // Clients
+    std::mutex _callback_mutex;
+    CaptureCallback_t _capture_callback;
+    PlaybackCallback_t _playback_callback;
+    DuplexCallback_t _duplex_callback;
+    std::atomic<bool> _duplex_active{false};
+    std::mutex _push_mutex;
+    MixerStream* _push_stream = nullptr;
+
+    // Counters
+    std::atomic<uint32_t> _periods{0};
+    std::atomic<uint32_t> _underruns{0};
+    std::atomic<uint32_t> _overruns{0};
+    std::atomic<uint32_t> _device_latency{0};
+
+    void render_period();
+    bool reader_active(const CaptureReader& reader) const;
+    void touch_reader(CaptureReader& reader);
+    bool meter_active() const;
+};
+
+}  // namespace audio
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "capture_analyzer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace audio;
+
+static constexpr float kFullScale = 32768.0f;
+
+static inline float power_to_db(float power)
+{
+    return std::max(10.0f * std::log10(power + 1e-20f), CaptureAnalyzer::kFloorDb);
+}
+
+static inline float band_edge_hz(size_t edge)
+{
+    return CaptureAnalyzer::kMinHz * std::pow(CaptureAnalyzer::kMaxHz / CaptureAnalyzer::kMinHz,
+                                              static_cast<float>(edge) / CaptureSnapshot_t::kBands);
+}
+
+float CaptureAnalyzer::band_hz(size_t band)
+{
+    return std::sqrt(band_edge_hz(band) * band_edge_hz(band + 1));
+}
+
+CaptureAnalyzer::CaptureAnalyzer()
+{
+    _fft.init(kFftSize);
+
+    // Periodic Hann, its coherent gain is one half
+    for (size_t i = 0; i < kFftSize; i++) {
+        _window[i] = 0.5f - 0.5f * std::cos(2.0f * static_cast<float>(M_PI) * i / kFftSize);
+    }
+
+    // Low bands are narrower than a bin and just repeat the nearest one
+    const float bin_hz = static_cast<float>(kSampleRate) / kFftSize;
+    for (size_t b = 0; b < kBands; b++) {
+        const size_t first = static_cast<size_t>(std::lround(band_edge_hz(b) / bin_hz));
+        const size_t last  = static_cast<size_t>(std::lround(band_edge_hz(b + 1) / bin_hz));
+        _band_first[b]     = static_cast<uint16_t>(std::min(first, kFftSize / 2));
+        _band_last[b]      = static_cast<uint16_t>(std::min(std::max(last, first + 1), kFftSize / 2 + 1));
+    }
+
+    std::fill(&_history[0][0], &_history[0][0] + kChannels * kFftSize, 0.0f);
+    std::fill(&_work.peakDb[0][0], &_work.peakDb[0][0] + CaptureSnapshot_t::kEnvelopePoints * kChannels, kFloorDb);
+    std::fill(&_work.rmsDb[0][0], &_work.rmsDb[0][0] + CaptureSnapshot_t::kEnvelopePoints * kChannels, kFloorDb);
+    std::fill(&_work.spectrumDb[0][0], &_work.spectrumDb[0][0] + kChannels * kBands, kFloorDb);
+    _snapshot.store(_work);
+}
+
+void CaptureAnalyzer::process(const int16_t* capture, size_t frames)
+{
+    bool changed = false;
+    for (size_t i = 0; i < frames; i++) {
+        const int16_t* frame          = capture + i * kCaptureChannels;
+        const int16_t mics[kChannels] = {frame[0], frame[2]};  // MIC-L, MIC-R
+
+        for (size_t c = 0; c < kChannels; c++) {
+            const float s             = mics[c];
+            _point_peak[c]            = std::max(_point_peak[c], std::abs(static_cast<int32_t>(mics[c])));
+            _point_energy[c]         += s * s;
+            _history[c][_history_pos] = s;
+        }
+        _history_pos = (_history_pos + 1) % kFftSize;
+
+        if (++_point_fill == kPointFrames) {
+            finish_point();
+            changed = true;
+        }
+        if (++_hop_fill == kHopFrames) {
+            update_spectrum();
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        _snapshot.store(_work);
+    }
+}
+
+void CaptureAnalyzer::finish_point()
+{
+    const size_t slot = _work.envelopeCount % CaptureSnapshot_t::kEnvelopePoints;
+    for (size_t c = 0; c < kChannels; c++) {
+        const float peak      = _point_peak[c] / kFullScale;
+        const float mean_sq   = _point_energy[c] / (kPointFrames * kFullScale * kFullScale);
+        _work.peakDb[slot][c] = power_to_db(peak * peak);
+        _work.rmsDb[slot][c]  = power_to_db(mean_sq);
+        _point_peak[c]        = 0;
+        _point_energy[c]      = 0.0f;
+    }
+    _point_fill = 0;
+    _work.envelopeCount++;
+}
+
+void CaptureAnalyzer::update_spectrum()
+{
+    // A full scale sine lands at 0 dB in its bin: amplitude times the window sum, halved for the real input
+    const float reference = kFullScale * kFftSize / 4.0f;
+    const float scale     = 1.0f / (reference * reference);
+
+    for (size_t c = 0; c < kChannels; c++) {
+        // Oldest sample first, _history_pos is where the next one would go
+        for (size_t i = 0; i < kFftSize; i++) {
+            _time[i] = _history[c][(_history_pos + i) % kFftSize] * _window[i];
+        }
+        _fft.forward(_time, _spectrum);
+
+        for (size_t b = 0; b < kBands; b++) {
+            float peak = 0.0f;
+            for (size_t k = _band_first[b]; k < _band_last[b]; k++) {
+                peak = std::max(peak, _spectrum[k].re * _spectrum[k].re + _spectrum[k].im * _spectrum[k].im);
+            }
+            // Instant attack, slow release, so the bars read like an analyzer rather than flicker
+            const float db         = power_to_db(peak * scale);
+            _work.spectrumDb[c][b] = std::max(db, _work.spectrumDb[c][b] - kReleaseDb);
+        }
+    }
+    _hop_fill = 0;
+    _work.spectrumCount++;
+}
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "../dsp/fft.h"
+#include "../sync/seqlock.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace audio {
+
+/**
+ * @brief What the UI reads: recent level points and the current spectrum of MIC-L and MIC-R
+ *
+ * Level points are kept in a small ring, so a reader that polls at display rate gets every point as long as it
+ * comes back within kEnvelopePoints periods.
+ */
+struct CaptureSnapshot_t {
+    static constexpr size_t kChannels       = 2;
+    static constexpr size_t kEnvelopePoints = 32;
+    static constexpr size_t kBands          = 64;
+
+    uint32_t envelopeCount = 0;  // points so far, the newest one is at (envelopeCount - 1) % kEnvelopePoints
+    float peakDb[kEnvelopePoints][kChannels];
+    float rmsDb[kEnvelopePoints][kChannels];
+    uint32_t spectrumCount = 0;
+    float spectrumDb[kChannels][kBands];  // log spaced bands, dBFS of a full scale sine
+};
+
+/**
+ * @brief Decimated peak / RMS envelopes and a banded FFT spectrum of the dual mic capture
+ *
+ * Runs in the I/O context on whatever block size the device delivers and publishes through a SeqLock, readers
+ * never block it and it never waits on them.
+ */
+class CaptureAnalyzer {
+public:
+    static constexpr uint32_t kSampleRate    = 48000;
+    static constexpr size_t kCaptureChannels = 4;    // [MIC-L, AEC, MIC-R, MIC-HP]
+    static constexpr size_t kPointFrames     = 480;  // one level point per 10 ms
+    static constexpr size_t kFftSize         = 1024;
+    static constexpr size_t kHopFrames       = 960;  // 50 spectra per second
+    static constexpr float kMinHz            = 50.0f;
+    static constexpr float kMaxHz            = 20000.0f;
+    static constexpr float kFloorDb          = -100.0f;
+    static constexpr float kReleaseDb        = 1.5f;  // per spectrum, bars fall at 75 dB/s
+
+    CaptureAnalyzer();
+
+    void process(const int16_t* capture, size_t frames);
+
+    CaptureSnapshot_t snapshot(uint32_t* generation = nullptr) const
+    {
+        return _snapshot.load(generation);
+    }
+
+    /**
+     * @brief Geometric center of a band
+     *
+     */
+    static float band_hz(size_t band);
+
+private:
+    static constexpr size_t kChannels = CaptureSnapshot_t::kChannels;
+    static constexpr size_t kBands    = CaptureSnapshot_t::kBands;
+
+    app::dsp::RealFft _fft;
+    float _window[kFftSize];
+    uint16_t _band_first[kBands];
+    uint16_t _band_last[kBands];
+    float _history[kChannels][kFftSize];
+    size_t _history_pos = 0;
+    size_t _hop_fill    = 0;
+    float _time[kFftSize];
+    app::dsp::Complex _spectrum[kFftSize / 2 + 1];
+
+    int32_t _point_peak[kChannels] = {};
+    float _point_energy[kChannels] = {};
+    size_t _point_fill             = 0;
+
+    CaptureSnapshot_t _work;
+    app::sync::SeqLock<CaptureSnapshot_t> _snapshot;
+
+    void finish_point();
+    void update_spectrum();
+};
+
+}  // namespace audio
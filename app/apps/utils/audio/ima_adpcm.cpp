@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "ima_adpcm.h"
+#include <algorithm>
+
+using namespace audio;
+
+namespace {
+
+constexpr int16_t kStepTable[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+    544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+    9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+constexpr int8_t kIndexTable[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+inline int16_t decode_sample(int32_t& predictor, int32_t& index, uint8_t code)
+{
+    const int32_t step = kStepTable[index];
+    int32_t delta      = step >> 3;
+    if (code & 4) {
+        delta += step;
+    }
+    if (code & 2) {
+        delta += step >> 1;
+    }
+    if (code & 1) {
+        delta += step >> 2;
+    }
+    predictor = std::clamp(predictor + ((code & 8) ? -delta : delta), -32768, 32767);
+    index     = std::clamp(index + kIndexTable[code & 7], 0, 88);
+    return static_cast<int16_t>(predictor);
+}
+
+}  // namespace
+
+/* -------------------------------------------------------------------------- */
+/*                                   Encoder                                  */
+/* -------------------------------------------------------------------------- */
+bool ImaAdpcmEncoder::init(uint16_t channels, uint16_t blockAlign)
+{
+    if (channels == 0 || channels > kMaxChannels || blockAlign <= 4 * channels || blockAlign % (4 * channels) != 0) {
+        _channels = 0;
+        return false;
+    }
+    _channels    = channels;
+    _block_align = blockAlign;
+    reset();
+    return true;
+}
+
+void ImaAdpcmEncoder::reset()
+{
+    for (auto& ch : _state) {
+        ch = Channel{};
+    }
+}
+
+uint8_t ImaAdpcmEncoder::encode_sample(Channel& ch, int16_t sample)
+{
+    int32_t step  = kStepTable[ch.index];
+    int32_t diff  = sample - ch.predictor;
+    uint8_t code  = 0;
+    int32_t delta = step >> 3;
+
+    if (diff < 0) {
+        code = 8;
+        diff = -diff;
+    }
+    // Successive approximation of diff / step in three bits, delta tracks what the decoder will reconstruct
+    if (diff >= step) {
+        code |= 4;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 2;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 1;
+        delta += step;
+    }
+
+    ch.predictor = std::clamp(ch.predictor + ((code & 8) ? -delta : delta), -32768, 32767);
+    ch.index     = std::clamp(ch.index + kIndexTable[code & 7], 0, 88);
+    return code;
+}
+
+void ImaAdpcmEncoder::encodeBlock(const int16_t* frames, uint8_t* block)
+{
+    const size_t channels = _channels;
+    const size_t samples  = samplesPerBlock();
+
+    // Header, the first frame goes in verbatim and seeds the predictor
+    for (size_t c = 0; c < channels; c++) {
+        Channel& ch  = _state[c];
+        ch.predictor = frames[c];
+
+        uint8_t* header = block + c * 4;
+        header[0]       = static_cast<uint8_t>(frames[c] & 0xff);
+        header[1]       = static_cast<uint8_t>((frames[c] >> 8) & 0xff);
+        header[2]       = static_cast<uint8_t>(ch.index);
+        header[3]       = 0;
+    }
+
+    // Groups of 8 samples per channel, low nibble first
+    uint8_t* out = block + channels * 4;
+    for (size_t group = 1; group < samples; group += 8) {
+        for (size_t c = 0; c < channels; c++) {
+            Channel& ch = _state[c];
+            for (size_t i = 0; i < 8; i += 2) {
+                const uint8_t lo = encode_sample(ch, frames[(group + i) * channels + c]);
+                const uint8_t hi = encode_sample(ch, frames[(group + i + 1) * channels + c]);
+                *out++           = static_cast<uint8_t>(lo | (hi << 4));
+            }
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   Decoder                                  */
+/* -------------------------------------------------------------------------- */
+bool ImaAdpcmDecoder::init(uint16_t channels, uint16_t blockAlign)
+{
+    if (channels == 0 || channels > ImaAdpcmEncoder::kMaxChannels || blockAlign <= 4 * channels ||
+        blockAlign % (4 * channels) != 0) {
+        _channels = 0;
+        return false;
+    }
+    _channels    = channels;
+    _block_align = blockAlign;
+    return true;
+}
+
+size_t ImaAdpcmDecoder::decodeBlock(const uint8_t* block, size_t bytes, int16_t* frames) const
+{
+    const size_t channels = _channels;
+    bytes                 = std::min<size_t>(bytes, _block_align);
+    if (channels == 0 || bytes < 4 * channels) {
+        return 0;
+    }
+
+    int32_t predictor[ImaAdpcmEncoder::kMaxChannels];
+    int32_t index[ImaAdpcmEncoder::kMaxChannels];
+    for (size_t c = 0; c < channels; c++) {
+        const uint8_t* header = block + c * 4;
+        predictor[c]          = static_cast<int16_t>(header[0] | (header[1] << 8));
+        index[c]              = std::clamp<int32_t>(header[2], 0, 88);
+        frames[c]             = static_cast<int16_t>(predictor[c]);
+    }
+
+    // Only whole 8 sample groups of every channel count
+    const size_t groups = (bytes - 4 * channels) / (4 * channels);
+    const uint8_t* in   = block + 4 * channels;
+    for (size_t g = 0; g < groups; g++) {
+        const size_t first = 1 + g * 8;
+        for (size_t c = 0; c < channels; c++) {
+            for (size_t i = 0; i < 8; i += 2) {
+                const uint8_t byte                    = *in++;
+                frames[(first + i) * channels + c]     = decode_sample(predictor[c], index[c], byte & 0x0f);
+                frames[(first + i + 1) * channels + c] = decode_sample(predictor[c], index[c], byte >> 4);
+            }
+        }
+    }
+    return 1 + groups * 8;
+}
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace audio {
+
+/**
+ * @brief IMA ADPCM in the wav (format 0x11) block layout
+ *
+ * Every block starts with a 4 byte header per channel, the first sample verbatim plus the step index, followed by
+ * 4 bit codes interleaved in 4 byte (8 sample) groups per channel. 16-bit PCM shrinks to a bit over a quarter.
+ */
+class ImaAdpcmEncoder {
+public:
+    static constexpr size_t kMaxChannels = 2;
+
+    /**
+     * @brief Set the layout, blockAlign must be a multiple of 4 * channels
+     *
+     * @return false on an unsupported layout
+     */
+    bool init(uint16_t channels, uint16_t blockAlign);
+    void reset();
+
+    uint16_t channels() const
+    {
+        return _channels;
+    }
+    uint16_t blockAlign() const
+    {
+        return _block_align;
+    }
+    size_t samplesPerBlock() const
+    {
+        return samples_per_block(_channels, _block_align);
+    }
+
+    /**
+     * @brief Encode samplesPerBlock() interleaved frames into one blockAlign() byte block
+     *
+     */
+    void encodeBlock(const int16_t* frames, uint8_t* block);
+
+    static size_t samples_per_block(uint16_t channels, uint16_t blockAlign)
+    {
+        return channels == 0 ? 0 : (blockAlign - 4 * channels) * 2 / channels + 1;
+    }
+
+private:
+    struct Channel {
+        int32_t predictor = 0;
+        int32_t index     = 0;
+    };
+
+    uint16_t _channels    = 0;
+    uint16_t _block_align = 0;
+    Channel _state[kMaxChannels];
+
+    static uint8_t encode_sample(Channel& ch, int16_t sample);
+};
+
+/**
+ * @brief Decoder for the same layout, blocks are self contained so any block can be decoded on its own
+ *
+ */
+class ImaAdpcmDecoder {
+public:
+    bool init(uint16_t channels, uint16_t blockAlign);
+
+    size_t samplesPerBlock() const
+    {
+        return ImaAdpcmEncoder::samples_per_block(_channels, _block_align);
+    }
+
+    /**
+     * @brief Decode one block, a short last block yields fewer frames
+     *
+     * @param bytes up to blockAlign
+     * @param frames room for samplesPerBlock() interleaved frames
+     * @return size_t frames decoded
+     */
+    size_t decodeBlock(const uint8_t* block, size_t bytes, int16_t* frames) const;
+
+private:
+    uint16_t _channels    = 0;
+    uint16_t _block_align = 0;
+};
+
+}  // namespace audio
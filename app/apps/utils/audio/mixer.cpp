@@ -0,0 +1,267 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "mixer.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+using namespace audio;
+
+static constexpr uint32_t kPhaseOne = 1 << 16;
+
+/* -------------------------------------------------------------------------- */
+/*                                   Stream                                   */
+/* -------------------------------------------------------------------------- */
+void MixerStream::setFormat(uint32_t sampleRate, uint8_t channels)
+{
+    sampleRate = std::clamp<uint32_t>(sampleRate, 8000, 192000);
+    _step_q16.store(static_cast<uint32_t>((static_cast<uint64_t>(sampleRate) << 16) / Mixer::kSampleRate),
+                    std::memory_order_relaxed);
+    _channels.store(channels == 1 ? 1 : 2, std::memory_order_relaxed);
+}
+
+size_t MixerStream::write(const int16_t* data, size_t frames, uint32_t timeoutMs)
+{
+    const uint8_t channels = _channels.load(std::memory_order_relaxed);
+    const auto deadline    = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    size_t done = 0;
+    while (done < frames) {
+        const size_t room = std::min(_ring.space() / 2, frames - done);
+        if (room > 0) {
+            if (channels == 2) {
+                _ring.write(data + done * 2, room * 2);
+            } else {
+                // Upmix in small chunks so the ring only ever holds stereo
+                int16_t chunk[128];
+                for (size_t i = 0; i < room;) {
+                    const size_t n = std::min<size_t>(64, room - i);
+                    for (size_t j = 0; j < n; j++) {
+                        chunk[j * 2] = chunk[j * 2 + 1] = data[done + i + j];
+                    }
+                    _ring.write(chunk, n * 2);
+                    i += n;
+                }
+            }
+            done += room;
+            continue;
+        }
+        if (std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    return done;
+}
+
+void MixerStream::render(float* stereo, size_t frames)
+{
+    const uint32_t step = _step_q16.load(std::memory_order_relaxed);
+    const float gain    = _gain.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < frames; i++) {
+        while (_phase_q16 >= kPhaseOne) {
+            int16_t frame[2];
+            if (_ring.read(frame, 2) != 2) {
+                // Only a stream that was fed and is still open can underrun, draining to empty is the normal end
+                if (!_starved && _state.load(std::memory_order_relaxed) == STREAM_OPEN) {
+                    _underruns.fetch_add(1, std::memory_order_relaxed);
+                }
+                _starved = true;
+                return;
+            }
+            _prev[0] = _next[0];
+            _prev[1] = _next[1];
+            _next[0] = frame[0];
+            _next[1] = frame[1];
+            _phase_q16 -= kPhaseOne;
+            _starved = false;
+        }
+
+        const float frac = _phase_q16 * (1.0f / kPhaseOne);
+        stereo[i * 2 + 0] += (_prev[0] + (_next[0] - _prev[0]) * frac) * gain;
+        stereo[i * 2 + 1] += (_prev[1] + (_next[1] - _prev[1]) * frac) * gain;
+        _phase_q16 += step;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                    Mixer                                   */
+/* -------------------------------------------------------------------------- */
+int Mixer::play(std::vector<int16_t>&& stereo, float gain)
+{
+    // Finished voices are released here, never on the audio task
+    for (auto& voice : _voices) {
+        uint8_t expected = VOICE_DONE;
+        if (voice.state.compare_exchange_strong(expected, VOICE_LOADING, std::memory_order_acquire)) {
+            std::vector<int16_t>().swap(voice.data);
+            voice.state.store(VOICE_FREE, std::memory_order_release);
+        }
+    }
+
+    for (size_t i = 0; i < kMaxVoices; i++) {
+        auto& voice      = _voices[i];
+        uint8_t expected = VOICE_FREE;
+        if (!voice.state.compare_exchange_strong(expected, VOICE_LOADING, std::memory_order_acquire)) {
+            continue;
+        }
+        voice.data     = std::move(stereo);
+        voice.position = 0;
+        voice.gain     = gain;
+        voice.stopRequest.store(false, std::memory_order_relaxed);
+        voice.state.store(VOICE_PLAYING, std::memory_order_release);
+        return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void Mixer::stop(int voice)
+{
+    if (voice >= 0 && voice < static_cast<int>(kMaxVoices)) {
+        _voices[voice].stopRequest.store(true, std::memory_order_relaxed);
+    }
+}
+
+bool Mixer::isPlaying(int voice) const
+{
+    if (voice < 0 || voice >= static_cast<int>(kMaxVoices)) {
+        return false;
+    }
+    const uint8_t state = _voices[voice].state.load(std::memory_order_acquire);
+    return state == VOICE_LOADING || state == VOICE_PLAYING;
+}
+
+size_t Mixer::activeVoices() const
+{
+    size_t count = 0;
+    for (auto& voice : _voices) {
+        count += voice.state.load(std::memory_order_relaxed) == VOICE_PLAYING;
+    }
+    return count;
+}
+
+MixerStream* Mixer::openStream(size_t capacityFrames)
+{
+    for (auto& stream : _streams) {
+        uint8_t expected = MixerStream::STREAM_FREE;
+        if (!stream._state.compare_exchange_strong(expected, MixerStream::STREAM_OPENING, std::memory_order_acquire)) {
+            continue;
+        }
+        // The audio task skips streams that are not open, so its side of the state is ours until published
+        if (stream._ring.capacity() < capacityFrames * 2) {
+            stream._ring.resize(capacityFrames * 2);
+        } else {
+            stream._ring.discard(stream._ring.size());
+        }
+        stream._phase_q16 = kPhaseOne;
+        stream._prev[0] = stream._prev[1] = 0;
+        stream._next[0] = stream._next[1] = 0;
+        stream._starved                   = true;
+        stream.setFormat(kSampleRate, 2);
+        stream.setGain(1.0f);
+        stream.setPaused(false);
+        stream._state.store(MixerStream::STREAM_OPEN, std::memory_order_release);
+        return &stream;
+    }
+    return nullptr;
+}
+
+void Mixer::closeStream(MixerStream* stream, bool drain)
+{
+    if (stream) {
+        stream->_state.store(drain ? MixerStream::STREAM_DRAINING : MixerStream::STREAM_CLOSING,
+                             std::memory_order_release);
+    }
+}
+
+bool Mixer::addSource(MixerSource* source)
+{
+    for (auto& slot : _sources) {
+        MixerSource* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, source, std::memory_order_release)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Mixer::removeSource(MixerSource* source)
+{
+    for (auto& slot : _sources) {
+        MixerSource* expected = source;
+        slot.compare_exchange_strong(expected, nullptr, std::memory_order_seq_cst);
+    }
+
+    // Wait out a render pass that may have picked the pointer up before it was cleared. Clear slot then read
+    // _render_seq here against bump _render_seq then read slot in render() is store-load on both sides, only
+    // seq_cst keeps one of them from missing the other
+    const uint32_t seq = _render_seq.load(std::memory_order_seq_cst);
+    if (seq & 1) {
+        while (_render_seq.load(std::memory_order_acquire) == seq) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void Mixer::render(float* stereo, size_t frames)
+{
+    _render_seq.fetch_add(1, std::memory_order_seq_cst);
+
+    for (auto& voice : _voices) {
+        if (voice.state.load(std::memory_order_acquire) != VOICE_PLAYING) {
+            continue;
+        }
+        if (voice.stopRequest.load(std::memory_order_relaxed)) {
+            voice.state.store(VOICE_DONE, std::memory_order_release);
+            continue;
+        }
+
+        const size_t remaining = (voice.data.size() - voice.position) / 2;
+        const size_t count     = std::min(frames, remaining);
+        const int16_t* src     = voice.data.data() + voice.position;
+        for (size_t i = 0; i < count * 2; i++) {
+            stereo[i] += src[i] * voice.gain;
+        }
+        voice.position += count * 2;
+        if (voice.position >= voice.data.size()) {
+            voice.state.store(VOICE_DONE, std::memory_order_release);
+        }
+    }
+
+    for (auto& stream : _streams) {
+        const uint8_t state = stream._state.load(std::memory_order_acquire);
+        if (state == MixerStream::STREAM_OPEN) {
+            if (!stream._paused.load(std::memory_order_relaxed)) {
+                stream.render(stereo, frames);
+            }
+        } else if (state == MixerStream::STREAM_DRAINING) {
+            stream.render(stereo, frames);
+            if (stream._starved) {
+                stream._state.store(MixerStream::STREAM_FREE, std::memory_order_release);
+            }
+        } else if (state == MixerStream::STREAM_CLOSING) {
+            stream._state.store(MixerStream::STREAM_FREE, std::memory_order_release);
+        }
+    }
+
+    for (auto& slot : _sources) {
+        MixerSource* source = slot.load(std::memory_order_seq_cst);
+        if (source) {
+            source->render(stereo, frames);
+        }
+    }
+
+    _render_seq.fetch_add(1, std::memory_order_seq_cst);
+}
+
+uint32_t Mixer::streamUnderruns() const
+{
+    uint32_t total = 0;
+    for (auto& stream : _streams) {
+        total += stream.underruns();
+    }
+    return total;
+}
@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "spsc_ring.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace audio {
+
+/**
+ * @brief Something that renders continuously into the mix, e.g. a synthesizer
+ *
+ */
+class MixerSource {
+public:
+    virtual ~MixerSource() = default;
+
+    /**
+     * @brief Add frames into an interleaved stereo float accumulator, called from the audio task
+     *
+     */
+    virtual void render(float* stereo, size_t frames) = 0;
+};
+
+/**
+ * @brief Ring backed input for producers that push at their own pace, like a decoder
+ *
+ * Accepts 16-bit mono or stereo at any rate, the mixer resamples linearly to its own rate.
+ */
+class MixerStream {
+public:
+    /**
+     * @brief Producer side, can be called again mid stream when the decoder learns the real format
+     *
+     */
+    void setFormat(uint32_t sampleRate, uint8_t channels);
+
+    /**
+     * @brief Producer side, blocks up to timeoutMs for room
+     *
+     * @param data interleaved samples in the current format
+     * @param frames
+     * @return size_t frames accepted
+     */
+    size_t write(const int16_t* data, size_t frames, uint32_t timeoutMs = 0);
+
+    uint8_t channels() const
+    {
+        return _channels.load(std::memory_order_relaxed);
+    }
+
+    void setGain(float gain)
+    {
+        _gain.store(gain, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Hold the queued frames instead of mixing them, a paused stream does not count underruns
+     *
+     */
+    void setPaused(bool paused)
+    {
+        _paused.store(paused, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Frames queued but not yet mixed, at the stream rate
+     *
+     */
+    size_t queued() const
+    {
+        return _ring.size() / 2;
+    }
+
+    uint32_t underruns() const
+    {
+        return _underruns.load(std::memory_order_relaxed);
+    }
+
+private:
+    friend class Mixer;
+
+    enum State_t : uint8_t {
+        STREAM_FREE,
+        STREAM_OPENING,
+        STREAM_OPEN,
+        STREAM_DRAINING,
+        STREAM_CLOSING,
+    };
+
+    std::atomic<uint8_t> _state{STREAM_FREE};
+    std::atomic<uint32_t> _step_q16{1 << 16};  // input frames per output frame, 16.16
+    std::atomic<uint8_t> _channels{2};
+    std::atomic<float> _gain{1.0f};
+    std::atomic<bool> _paused{false};
+    std::atomic<uint32_t> _underruns{0};
+    SpscRing<int16_t> _ring;  // always stereo inside
+
+    // Audio task side resampler state
+    uint32_t _phase_q16 = 0;
+    int16_t _prev[2]    = {0, 0};
+    int16_t _next[2]    = {0, 0};
+    bool _starved       = true;
+
+    void render(float* stereo, size_t frames);
+};
+
+/**
+ * @brief Fixed size stereo mixer
+ *
+ * One-shot voices, ring streams and persistent sources all land in a float accumulator. Slots are claimed with
+ * atomics, so UI code can start sounds while the audio task is mixing without taking a lock, and nothing is
+ * allocated or freed on the audio task.
+ */
+class Mixer {
+public:
+    static constexpr uint32_t kSampleRate = 48000;
+    static constexpr size_t kMaxVoices    = 8;
+    static constexpr size_t kMaxStreams   = 4;
+    static constexpr size_t kMaxSources   = 4;
+
+    /**
+     * @brief Start a one-shot voice
+     *
+     * @param stereo interleaved 48 kHz stereo, taken over by the mixer
+     * @param gain
+     * @return int voice id, -1 if every voice is busy
+     */
+    int play(std::vector<int16_t>&& stereo, float gain = 1.0f);
+    void stop(int voice);
+    bool isPlaying(int voice) const;
+    size_t activeVoices() const;
+
+    /**
+     * @brief Claim a stream slot and allocate its ring
+     *
+     * @param capacityFrames ring size in stereo frames
+     * @return MixerStream* nullptr if every slot is busy
+     */
+    MixerStream* openStream(size_t capacityFrames);
+
+    /**
+     * @brief Give the slot back once the audio task lets go of it
+     *
+     * @param drain play out what is still queued instead of dropping it
+     */
+    void closeStream(MixerStream* stream, bool drain = false);
+
+    /**
+     * @brief Register a persistent source, it must outlive its registration
+     *
+     */
+    bool addSource(MixerSource* source);
+
+    /**
+     * @brief Unregister, returns once the audio task is no longer inside the source
+     *
+     */
+    void removeSource(MixerSource* source);
+
+    /**
+     * @brief Audio task side, adds everything into an interleaved stereo accumulator
+     *
+     */
+    void render(float* stereo, size_t frames);
+
+    /**
+     * @brief Summed underruns of all streams
+     *
+     */
+    uint32_t streamUnderruns() const;
+
+private:
+    enum VoiceState_t : uint8_t {
+        VOICE_FREE,
+        VOICE_LOADING,
+        VOICE_PLAYING,
+        VOICE_DONE,
+    };
+
+    struct Voice {
+        std::atomic<uint8_t> state{VOICE_FREE};
+        std::atomic<bool> stopRequest{false};
+        std::vector<int16_t> data;
+        size_t position = 0;
+        float gain      = 1.0f;
+    };
+
+    Voice _voices[kMaxVoices];
+    MixerStream _streams[kMaxStreams];
+    std::atomic<MixerSource*> _sources[kMaxSources] = {};
+    std::atomic<uint32_t> _render_seq{0};
+};
+
+}  // namespace audio
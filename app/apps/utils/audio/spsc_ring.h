@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace audio {
+
+/**
+ * @brief Single producer single consumer ring of trivially copyable items
+ *
+ * Capacity is rounded up to a power of two. Storage is allocated by resize(), read and write never allocate,
+ * so both ends are safe to call from a real-time audio task.
+ *
+ * @tparam T
+ */
+template <typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRing items must be trivially copyable");
+
+public:
+    SpscRing() = default;
+
+    explicit SpscRing(size_t capacity)
+    {
+        resize(capacity);
+    }
+
+    /**
+     * @brief Allocate storage and drop the content, not safe while either end is in use
+     *
+     */
+    void resize(size_t capacity)
+    {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _buffer.assign(size, T{});
+        _mask = size - 1;
+        _head.store(0, std::memory_order_relaxed);
+        _tail.store(0, std::memory_order_relaxed);
+    }
+
+    size_t capacity() const
+    {
+        return _buffer.size();
+    }
+
+    size_t size() const
+    {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    size_t space() const
+    {
+        return capacity() - size();
+    }
+
+    /**
+     * @brief Producer side, copies as many items as fit
+     *
+     * @return size_t items written
+     */
+    size_t write(const T* data, size_t count)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        count             = std::min(count, capacity() - (head - tail));
+        copy_in(head, data, count);
+        _head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Consumer side, copies out as many items as available
+     *
+     * @return size_t items read
+     */
+    size_t read(T* data, size_t count)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        const size_t head = _head.load(std::memory_order_acquire);
+        count             = std::min(count, head - tail);
+        copy_out(tail, data, count);
+        _tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief Consumer side, drop items without copying
+     *
+     */
+    size_t discard(size_t count)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        const size_t head = _head.load(std::memory_order_acquire);
+        count             = std::min(count, head - tail);
+        _tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    std::vector<T> _buffer;
+    size_t _mask = 0;
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+
+    void copy_in(size_t head, const T* data, size_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+        const size_t start = head & _mask;
+        const size_t first = std::min(count, capacity() - start);
+        std::memcpy(&_buffer[start], data, first * sizeof(T));
+        std::memcpy(&_buffer[0], data + first, (count - first) * sizeof(T));
+    }
+
+    void copy_out(size_t tail, T* data, size_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+        const size_t start = tail & _mask;
+        const size_t first = std::min(count, capacity() - start);
+        std::memcpy(data, &_buffer[start], first * sizeof(T));
+        std::memcpy(data + first, &_buffer[0], (count - first) * sizeof(T));
+    }
+};
+
+}  // namespace audio
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "wav_file.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace audio {
+
+/**
+ * @brief File to 16-bit PCM, pulled by the StreamPlayer worker
+ *
+ * Implementations may block on file I/O, they only ever run on the worker.
+ */
+class StreamDecoder {
+public:
+    static constexpr size_t kReadAheadBytes = 32 * 1024;
+
+    virtual ~StreamDecoder() = default;
+
+    virtual bool open(const std::string& path) = 0;
+
+    virtual uint32_t sampleRate() const = 0;
+    virtual uint8_t channels() const    = 0;
+
+    /**
+     * @brief Length in frames, 0 if unknown, may be an estimate for compressed formats
+     *
+     */
+    virtual uint32_t totalFrames() const = 0;
+
+    /**
+     * @brief Decode interleaved frames
+     *
+     * @return size_t frames produced, 0 at the end
+     */
+    virtual size_t decode(int16_t* frames, size_t maxFrames) = 0;
+
+    /**
+     * @brief Continue from a frame, compressed formats may land near it
+     *
+     * @return uint32_t the frame actually landed on
+     */
+    virtual uint32_t seek(uint32_t frame) = 0;
+};
+
+using StreamDecoderFactory_t = std::unique_ptr<StreamDecoder> (*)();
+
+/**
+ * @brief 16-bit PCM and IMA ADPCM wav
+ *
+ */
+class WavStreamDecoder : public StreamDecoder {
+public:
+    bool open(const std::string& path) override
+    {
+        return _reader.open(path, kReadAheadBytes) && _reader.channels() <= 2;
+    }
+    uint32_t sampleRate() const override
+    {
+        return _reader.sampleRate();
+    }
+    uint8_t channels() const override
+    {
+        return static_cast<uint8_t>(_reader.channels());
+    }
+    uint32_t totalFrames() const override
+    {
+        return _reader.totalFrames();
+    }
+    size_t decode(int16_t* frames, size_t maxFrames) override
+    {
+        return _reader.read(frames, maxFrames);
+    }
+    uint32_t seek(uint32_t frame) override
+    {
+        _reader.seek(frame);
+        return _reader.position();
+    }
+
+    static std::unique_ptr<StreamDecoder> create()
+    {
+        return std::make_unique<WavStreamDecoder>();
+    }
+
+private:
+    WavReader _reader;
+};
+
+}  // namespace audio
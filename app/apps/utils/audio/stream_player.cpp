@@ -0,0 +1,304 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "stream_player.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+
+using namespace audio;
+
+static bool ends_with(const std::string& path, const std::string& extension)
+{
+    if (extension.empty() || path.size() < extension.size()) {
+        return false;
+    }
+    return std::equal(extension.rbegin(), extension.rend(), path.rbegin(), [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+    });
+}
+
+StreamPlayer::StreamPlayer(Mixer& mixer) : _mixer(mixer)
+{
+    registerDecoder(".wav", WavStreamDecoder::create);
+}
+
+StreamPlayer::~StreamPlayer()
+{
+    close_stream();
+}
+
+bool StreamPlayer::registerDecoder(const char* extension, StreamDecoderFactory_t factory)
+{
+    for (auto& slot : _extensions) {
+        if (slot.factory == nullptr || slot.extension == extension) {
+            slot.extension = extension;
+            slot.factory   = factory;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::unique_ptr<StreamDecoder> StreamPlayer::open_decoder(const std::string& path) const
+{
+    for (auto& slot : _extensions) {
+        if (slot.factory && ends_with(path, slot.extension)) {
+            auto decoder = slot.factory();
+            if (decoder && decoder->open(path) && decoder->sampleRate() > 0) {
+                return decoder;
+            }
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   UI side                                  */
+/* -------------------------------------------------------------------------- */
+bool StreamPlayer::enqueue(const std::string& path)
+{
+    bool supported = false;
+    for (auto& slot : _extensions) {
+        supported |= slot.factory && ends_with(path, slot.extension);
+    }
+    if (!supported) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_command_mutex);
+    _playlist.push_back(path);
+    _stop_request = false;
+    return true;
+}
+
+void StreamPlayer::stop()
+{
+    std::lock_guard<std::mutex> lock(_command_mutex);
+    _playlist.clear();
+    _stop_request = true;
+    _paused       = false;
+    _seek_ms      = -1;
+}
+
+void StreamPlayer::setPaused(bool paused)
+{
+    std::lock_guard<std::mutex> lock(_command_mutex);
+    _paused = paused;
+}
+
+void StreamPlayer::skip()
+{
+    std::lock_guard<std::mutex> lock(_command_mutex);
+    _skip_request = true;
+    _seek_ms      = -1;
+}
+
+void StreamPlayer::seek(uint32_t positionMs)
+{
+    std::lock_guard<std::mutex> lock(_command_mutex);
+    _seek_ms = positionMs;
+}
+
+StreamPlayer::Status_t StreamPlayer::status() const
+{
+    Status_t status;
+    status.state = _state.load(std::memory_order_relaxed);
+
+    MixerStream* stream  = _stream.load(std::memory_order_acquire);
+    const size_t queued  = stream ? stream->queued() : 0;
+    const int64_t played = _written.load(std::memory_order_acquire) - static_cast<int64_t>(queued);
+
+    std::lock_guard<std::mutex> lock(_command_mutex);
+
+    // Right after a gapless switch the ring still holds the tail of the previous track
+    const bool tail    = played < _current.start && !_previous.path.empty();
+    const Track& track = tail ? _previous : _current;
+    status.path        = track.path;
+    status.queued      = static_cast<uint32_t>(_playlist.size()) + (tail ? 1 : 0);
+    status.underruns   = _underruns.load(std::memory_order_relaxed);
+    if (track.sampleRate > 0) {
+        status.positionMs = static_cast<uint32_t>(std::max<int64_t>(played - track.start, 0) * 1000 /
+                                                  track.sampleRate);
+        status.durationMs = static_cast<uint32_t>(static_cast<uint64_t>(track.totalFrames) * 1000 /
+                                                  track.sampleRate);
+        status.bufferedMs = static_cast<uint32_t>(queued * 1000 / track.sampleRate);
+    }
+
+    const uint64_t decode_us = _decode_us.load(std::memory_order_relaxed);
+    if (decode_us > 0) {
+        status.decodeSpeed = static_cast<float>(_decoded_us.load(std::memory_order_relaxed)) / decode_us;
+    }
+    return status;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                 Worker side                                */
+/* -------------------------------------------------------------------------- */
+bool StreamPlayer::open_stream()
+{
+    MixerStream* stream = _mixer.openStream(kRingFrames);
+    if (!stream) {
+        return false;
+    }
+    stream->setFormat(_decoder->sampleRate(), _decoder->channels());
+    _stream_rate   = _decoder->sampleRate();
+    _underrun_base = stream->underruns();
+    _written.store(0, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(_command_mutex);
+        _previous      = Track{};
+        _current.start = -static_cast<int64_t>(_resume_frame);
+    }
+    _resume_frame = 0;
+    _stream.store(stream, std::memory_order_release);
+    return true;
+}
+
+void StreamPlayer::close_stream()
+{
+    MixerStream* stream = _stream.exchange(nullptr, std::memory_order_acq_rel);
+    if (!stream) {
+        return;
+    }
+    _underrun_total += stream->underruns() - _underrun_base;
+    _underruns.store(_underrun_total, std::memory_order_relaxed);
+    _mixer.closeStream(stream);
+}
+
+bool StreamPlayer::start_next_track()
+{
+    while (true) {
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(_command_mutex);
+            if (_playlist.empty()) {
+                return false;
+            }
+            path = std::move(_playlist.front());
+            _playlist.pop_front();
+        }
+
+        // Opening touches the card, keep it outside the lock. Unreadable entries are dropped.
+        _decoder = open_decoder(path);
+        if (!_decoder) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(_command_mutex);
+        _previous            = std::move(_current);
+        _current.path        = std::move(path);
+        _current.sampleRate  = _decoder->sampleRate();
+        _current.totalFrames = _decoder->totalFrames();
+        _current.start       = _written.load(std::memory_order_relaxed);  // open_stream() rebases a fresh stream
+        return true;
+    }
+}
+
+bool StreamPlayer::service()
+{
+    bool stop_request;
+    bool skip_request;
+    bool paused;
+    int64_t seek_ms;
+    {
+        std::lock_guard<std::mutex> lock(_command_mutex);
+        stop_request  = _stop_request;
+        skip_request  = _skip_request;
+        paused        = _paused;
+        seek_ms       = _seek_ms;
+        _stop_request = false;
+        _skip_request = false;
+        _seek_ms      = -1;
+    }
+
+    if (stop_request) {
+        close_stream();
+        _decoder.reset();
+        _state.store(STATE_IDLE, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(_command_mutex);
+        _current  = Track{};
+        _previous = Track{};
+        return true;
+    }
+
+    // Skipping drops what is queued of the current track, the next one starts on a fresh stream
+    if (skip_request && _decoder) {
+        close_stream();
+        _decoder.reset();
+    }
+
+    if (seek_ms >= 0 && _decoder) {
+        _resume_frame = _decoder->seek(static_cast<uint32_t>(seek_ms * _decoder->sampleRate() / 1000));
+        close_stream();
+    }
+
+    MixerStream* stream = _stream.load(std::memory_order_relaxed);
+    if (stream) {
+        stream->setPaused(paused);
+    }
+
+    if (!_decoder && !start_next_track()) {
+        // End of the playlist, hold the stream until the mixer has played it out. The empty ring it runs into at
+        // the very end is not an underrun.
+        if (stream) {
+            _underrun_base = stream->underruns();
+            if (stream->queued() > 0) {
+                _state.store(paused ? STATE_PAUSED : STATE_PLAYING, std::memory_order_relaxed);
+                return false;
+            }
+            close_stream();
+        }
+        _state.store(STATE_IDLE, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Not idle from here on, even while waiting for a stream slot, a file is open
+    _state.store(paused ? STATE_PAUSED : STATE_PLAYING, std::memory_order_relaxed);
+    if (!stream) {
+        if (!open_stream()) {
+            return false;  // every slot busy, try again next period
+        }
+        stream = _stream.load(std::memory_order_relaxed);
+        stream->setPaused(paused);
+    }
+
+    // Gapless only within a sample rate, otherwise the previous track plays out before the rate changes. The ring
+    // is always stereo inside, so a channel count change applies right away.
+    const uint32_t rate = _decoder->sampleRate();
+    if (rate != _stream_rate) {
+        _underrun_base = stream->underruns();
+        if (stream->queued() > 0) {
+            return false;
+        }
+        _stream_rate = rate;
+    }
+    stream->setFormat(rate, _decoder->channels());
+    _underruns.store(_underrun_total + stream->underruns() - _underrun_base, std::memory_order_relaxed);
+
+    // Top up the read-ahead, one decode chunk at a time so commands stay responsive
+    if (stream->queued() + kDecodeFrames > kRingFrames) {
+        return false;
+    }
+
+    const auto begin     = std::chrono::steady_clock::now();
+    const size_t decoded = _decoder->decode(_pcm, kDecodeFrames);
+    const auto elapsed   = std::chrono::steady_clock::now() - begin;
+    _decode_us.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(),
+                         std::memory_order_relaxed);
+
+    if (decoded == 0) {
+        _underrun_total += stream->underruns() - _underrun_base;
+        _underrun_base = stream->underruns();
+        _decoder.reset();
+        return true;
+    }
+    _decoded_us.fetch_add(static_cast<uint64_t>(decoded) * 1000000 / rate, std::memory_order_relaxed);
+
+    const size_t written = stream->write(_pcm, decoded);
+    _written.fetch_add(static_cast<int64_t>(written), std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "mixer.h"
+#include "stream_decoder.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace audio {
+
+/**
+ * @brief File playlist player decoding ahead into a mixer stream
+ *
+ * Platform agnostic core, the platform owns a worker task that calls service() until it returns false and then
+ * sleeps a little. Everything else is called from the UI and only ever takes a short command lock, never one held
+ * across decoding or file I/O.
+ *
+ * The mixer stream ring is the read-ahead buffer: the worker keeps it topped up with decoded frames, so card
+ * latency and decoder jitter are absorbed up to its depth. Queued tracks follow each other in the same stream
+ * without a gap, only a change of sample rate lets the ring run dry before the next one starts.
+ */
+class StreamPlayer {
+public:
+    static constexpr size_t kRingFrames    = Mixer::kSampleRate / 2;  // 500 ms of read-ahead at 48 kHz
+    static constexpr size_t kDecodeFrames  = 1152;                    // one mp3 frame
+    static constexpr size_t kMaxExtensions = 4;
+
+    enum State_t {
+        STATE_IDLE,
+        STATE_PLAYING,
+        STATE_PAUSED,
+    };
+
+    struct Status_t {
+        State_t state = STATE_IDLE;
+        std::string path;
+        uint32_t positionMs = 0;
+        uint32_t durationMs = 0;  // 0 if unknown
+        uint32_t bufferedMs = 0;
+        uint32_t queued     = 0;  // tracks after the current one
+        uint32_t underruns  = 0;
+        float decodeSpeed   = 0.0f;  // seconds of audio decoded per second of worker time
+    };
+
+    explicit StreamPlayer(Mixer& mixer);
+    ~StreamPlayer();
+
+    /**
+     * @brief Map a file extension (".mp3") to a decoder, ".wav" is built in, call before the worker starts
+     *
+     */
+    bool registerDecoder(const char* extension, StreamDecoderFactory_t factory);
+
+    /* -------------------------------- UI side -------------------------------- */
+    /**
+     * @brief Append to the playlist, starts playing if idle
+     *
+     * @return false if no decoder handles the extension
+     */
+    bool enqueue(const std::string& path);
+
+    /**
+     * @brief Drop the playlist and stop
+     *
+     */
+    void stop();
+    void setPaused(bool paused);
+    void skip();
+    void seek(uint32_t positionMs);
+    Status_t status() const;
+
+    /* ------------------------------ Worker side ------------------------------ */
+    /**
+     * @brief Do one step of work
+     *
+     * @return false if there was nothing to do, the worker can sleep for a period or so
+     */
+    bool service();
+
+private:
+    struct Extension {
+        std::string extension;
+        StreamDecoderFactory_t factory = nullptr;
+    };
+
+    // Where a track begins in the frames written to the stream, so status() can tell which one is audible
+    struct Track {
+        std::string path;
+        uint32_t sampleRate  = 0;
+        uint32_t totalFrames = 0;
+        int64_t start        = 0;
+    };
+
+    Mixer& _mixer;
+    Extension _extensions[kMaxExtensions];
+
+    // Commands and track bookkeeping, guarded by _command_mutex
+    mutable std::mutex _command_mutex;
+    std::deque<std::string> _playlist;
+    bool _stop_request = false;
+    bool _skip_request = false;
+    bool _paused       = false;
+    int64_t _seek_ms   = -1;
+    Track _current;
+    Track _previous;
+
+    // Worker state
+    std::unique_ptr<StreamDecoder> _decoder;
+    uint32_t _stream_rate    = 0;
+    uint32_t _resume_frame   = 0;  // where a seek landed, the next stream starts counting from there
+    uint32_t _underrun_base  = 0;
+    uint32_t _underrun_total = 0;
+    int16_t _pcm[kDecodeFrames * 2];
+
+    // Published for status(), stream slots live as long as the mixer so a stale pointer is still safe to read
+    std::atomic<MixerStream*> _stream{nullptr};
+    std::atomic<State_t> _state{STATE_IDLE};
+    std::atomic<int64_t> _written{0};
+    std::atomic<uint32_t> _underruns{0};
+    std::atomic<uint64_t> _decoded_us{0};  // audio time decoded
+    std::atomic<uint64_t> _decode_us{0};   // worker time spent decoding
+
+    std::unique_ptr<StreamDecoder> open_decoder(const std::string& path) const;
+    bool start_next_track();
+    bool open_stream();
+    void close_stream();
+};
+
+}  // namespace audio
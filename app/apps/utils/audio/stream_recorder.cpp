@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "stream_recorder.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+using namespace audio;
+
+static_assert(StreamRecorder::kAdpcmBlockAlign * ImaAdpcmEncoder::kMaxChannels <= AsyncFileWriter::kChunkBytes,
+              "an adpcm block must fit a writer chunk");
+
+bool StreamRecorder::start(const std::string& path, Format_t format, Source_t source)
+{
+    stop();
+
+    _source                 = source;
+    _format                 = WavFormat_t{};
+    _format.sampleRate      = kSampleRate;
+    _format.channels        = source == SOURCE_DUAL_MIC ? 2 : 1;
+    _format.blockAlign      = _format.channels * sizeof(int16_t);
+    _format.samplesPerBlock = 1;
+    if (format == FORMAT_IMA_ADPCM) {
+        _format.encoding        = WAV_IMA_ADPCM;
+        _format.blockAlign      = kAdpcmBlockAlign * _format.channels;
+        _format.samplesPerBlock = kAdpcmBlockFrames;
+        _encoder.init(_format.channels, _format.blockAlign);
+    }
+    _block_fill = 0;
+    _frames.store(0, std::memory_order_relaxed);
+    _dropped_frames.store(0, std::memory_order_relaxed);
+
+    if (!_writer.open(path)) {
+        return false;
+    }
+
+    // Sizes are patched in stop(), the header length does not depend on them
+    uint8_t header[kWavHeaderMaxSize];
+    _header_size = wav_header(header, _format, 0, 0);
+    _writer.append(header, _header_size);
+    return true;
+}
+
+void StreamRecorder::stop()
+{
+    if (!_writer.isOpen()) {
+        return;
+    }
+
+    // Pad the last ADPCM block with silence, a block is all or nothing in the wav layout. The fact chunk keeps the
+    // real frame count so readers can trim the padding again.
+    if (_format.encoding == WAV_IMA_ADPCM && _block_fill > 0) {
+        const size_t padding = kAdpcmBlockFrames - _block_fill;
+        std::fill(_block_frames + _block_fill * _format.channels,
+                  _block_frames + kAdpcmBlockFrames * _format.channels, 0);
+        _block_fill = kAdpcmBlockFrames;
+        if (emit_block()) {
+            _frames.fetch_sub(padding, std::memory_order_relaxed);
+        }
+    }
+    _writer.flush();
+
+    const uint64_t data_size = _writer.stats().bytesWritten - _header_size;
+    uint8_t header[kWavHeaderMaxSize];
+    wav_header(header, _format, static_cast<uint32_t>(data_size), _frames.load(std::memory_order_relaxed));
+    _writer.writeAt(0, header, _header_size);
+    _writer.close();
+}
+
+size_t StreamRecorder::extract(const int16_t* capture, size_t frames, int16_t* out) const
+{
+    if (_source == SOURCE_DUAL_MIC) {
+        for (size_t i = 0; i < frames; i++) {
+            out[i * 2 + 0] = capture[i * kCaptureChannels + 0];  // MIC-L
+            out[i * 2 + 1] = capture[i * kCaptureChannels + 2];  // MIC-R
+        }
+    } else {
+        for (size_t i = 0; i < frames; i++) {
+            out[i] = capture[i * kCaptureChannels + 3];  // MIC-HP
+        }
+    }
+    return frames;
+}
+
+void StreamRecorder::write(const int16_t* capture, size_t frames)
+{
+    if (!_writer.isOpen()) {
+        return;
+    }
+
+    if (_format.encoding == WAV_IMA_ADPCM) {
+        write_adpcm(capture, frames);
+        return;
+    }
+
+    while (frames > 0) {
+        const size_t n     = std::min(frames, kStageFrames);
+        const size_t bytes = extract(capture, n, _stage) * _format.blockAlign;
+        if (_writer.append(_stage, bytes)) {
+            _frames.fetch_add(n, std::memory_order_relaxed);
+        } else {
+            _dropped_frames.fetch_add(n, std::memory_order_relaxed);
+        }
+        capture += n * kCaptureChannels;
+        frames -= n;
+    }
+}
+
+void StreamRecorder::write_adpcm(const int16_t* capture, size_t frames)
+{
+    while (frames > 0) {
+        const size_t n = std::min(frames, kAdpcmBlockFrames - _block_fill);
+        extract(capture, n, _block_frames + _block_fill * _format.channels);
+        _block_fill += n;
+        capture += n * kCaptureChannels;
+        frames -= n;
+
+        if (_block_fill == kAdpcmBlockFrames) {
+            emit_block();
+        }
+    }
+}
+
+bool StreamRecorder::emit_block()
+{
+    _encoder.encodeBlock(_block_frames, _block);
+    _block_fill = 0;
+    if (!_writer.append(_block, _format.blockAlign)) {
+        _dropped_frames.fetch_add(kAdpcmBlockFrames, std::memory_order_relaxed);
+        return false;
+    }
+    _frames.fetch_add(kAdpcmBlockFrames, std::memory_order_relaxed);
+    return true;
+}
+
+StreamRecorder::Stats_t StreamRecorder::stats() const
+{
+    const auto writer = _writer.stats();
+
+    Stats_t ret;
+    ret.frames         = _frames.load(std::memory_order_relaxed);
+    ret.droppedFrames  = _dropped_frames.load(std::memory_order_relaxed);
+    ret.bytes          = writer.bytesWritten;
+    ret.slowestWriteUs = writer.slowestWriteUs;
+    ret.writeErrors    = writer.writeErrors;
+    return ret;
+}
+
+std::string StreamRecorder::next_free_path(const std::string& dir, const char* prefix)
+{
+    char name[32];
+    for (int i = 1; i < 10000; i++) {
+        snprintf(name, sizeof(name), "%s%04d.wav", prefix, i);
+        std::string path = dir + "/" + name;
+        FILE* probe      = fopen(path.c_str(), "rb");
+        if (probe == nullptr) {
+            return path;
+        }
+        fclose(probe);
+    }
+    return dir + "/" + prefix + "overflow.wav";
+}
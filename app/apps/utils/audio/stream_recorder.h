@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "async_file_writer.h"
+#include "ima_adpcm.h"
+#include "wav_file.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace audio {
+
+/**
+ * @brief Open ended capture to wav recorder
+ *
+ * Platform agnostic core, like AudioService the platform owns the tasks: a capture task feeds write() with blocks
+ * pulled from the capture ring, a low priority writer task calls service() to get them onto the card. The capture
+ * side only converts, encodes and copies, it never touches the file.
+ */
+class StreamRecorder {
+public:
+    static constexpr uint32_t kSampleRate      = 48000;
+    static constexpr size_t kCaptureChannels   = 4;  // [MIC-L, AEC, MIC-R, MIC-HP]
+    static constexpr size_t kStageFrames       = kSampleRate / 100;
+    static constexpr uint16_t kAdpcmBlockAlign = 1024;  // per channel, 2041 frames or about 43 ms
+    static constexpr size_t kAdpcmBlockFrames  = (kAdpcmBlockAlign - 4) * 2 + 1;
+
+    enum Format_t {
+        FORMAT_PCM16,
+        FORMAT_IMA_ADPCM,
+    };
+
+    enum Source_t {
+        SOURCE_DUAL_MIC,     // MIC-L / MIC-R stereo
+        SOURCE_HEADSET_MIC,  // MIC-HP mono
+    };
+
+    struct Stats_t {
+        uint32_t frames         = 0;  // captured into the file, dropped ones excluded
+        uint32_t droppedFrames  = 0;
+        uint64_t bytes          = 0;
+        uint32_t slowestWriteUs = 0;
+        uint32_t writeErrors    = 0;
+    };
+
+    /**
+     * @brief Open the file and write a placeholder header
+     *
+     */
+    bool start(const std::string& path, Format_t format, Source_t source);
+
+    /**
+     * @brief Flush, patch the header and close, only once both tasks have stopped calling in
+     *
+     */
+    void stop();
+
+    bool isRecording() const
+    {
+        return _writer.isOpen();
+    }
+
+    /**
+     * @brief Capture side, interleaved [MIC-L, AEC, MIC-R, MIC-HP] frames of any count
+     *
+     */
+    void write(const int16_t* capture, size_t frames);
+
+    /**
+     * @brief Writer side, see AsyncFileWriter::service()
+     *
+     */
+    bool service()
+    {
+        return _writer.service();
+    }
+
+    Stats_t stats() const;
+
+    /**
+     * @brief First <dir>/<prefix>NNNN.wav that does not exist yet
+     *
+     */
+    static std::string next_free_path(const std::string& dir, const char* prefix);
+
+private:
+    AsyncFileWriter _writer;
+    ImaAdpcmEncoder _encoder;
+    WavFormat_t _format;
+    Source_t _source    = SOURCE_DUAL_MIC;
+    size_t _header_size = 0;
+
+    // Capture side staging, one period of PCM or one ADPCM block worth of frames
+    int16_t _stage[kStageFrames * 2];
+    int16_t _block_frames[kAdpcmBlockFrames * ImaAdpcmEncoder::kMaxChannels];
+    uint8_t _block[kAdpcmBlockAlign * ImaAdpcmEncoder::kMaxChannels];
+    size_t _block_fill = 0;
+
+    std::atomic<uint32_t> _frames{0};
+    std::atomic<uint32_t> _dropped_frames{0};
+
+    size_t extract(const int16_t* capture, size_t frames, int16_t* out) const;
+    void write_adpcm(const int16_t* frames, size_t count);
+    bool emit_block();
+};
+
+}  // namespace audio
@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "tone_synth.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace audio;
+
+ToneSynth::ToneSynth() : _events(kEventQueueSize)
+{
+    for (size_t i = 0; i < kTableSize; i++) {
+        _table[i] = static_cast<int16_t>(std::lrint(std::sin(2.0 * M_PI * i / kTableSize) * 32767.0));
+    }
+}
+
+bool ToneSynth::trigger(const Note_t& note)
+{
+    // Producers serialize among themselves, the audio task side never takes the lock
+    std::lock_guard<std::mutex> lock(_producer_mutex);
+    return _events.write(&note, 1) == 1;
+}
+
+void ToneSynth::start_voice(const Note_t& note)
+{
+    // When the pool is full take the releasing voice closest to its end, never one that is still waiting, attacking
+    // or holding
+    Voice* target       = nullptr;
+    uint32_t least_left = UINT32_MAX;
+    for (auto& voice : _voices) {
+        if (!voice.active) {
+            target = &voice;
+            break;
+        }
+        if (voice.position < voice.releaseStart) {
+            continue;
+        }
+        const uint32_t left = voice.end - voice.position;
+        if (left < least_left) {
+            least_left = left;
+            target     = &voice;
+        }
+    }
+    if (target == nullptr) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const int32_t peak = static_cast<int32_t>(note.amplitude) << 8;
+
+    target->active       = true;
+    target->phase        = 0;
+    target->step         = note.phaseIncrement;
+    target->position     = 0;
+    target->attackStart  = note.delayFrames;
+    target->holdStart    = target->attackStart + note.attackFrames;
+    target->releaseStart = target->holdStart + note.holdFrames;
+    target->end          = target->releaseStart + note.releaseFrames;
+    target->peak         = peak;
+    target->level        = note.attackFrames > 0 ? 0 : peak;
+    target->attackSlope  = note.attackFrames > 0 ? peak / static_cast<int32_t>(note.attackFrames) : 0;
+    target->releaseSlope = note.releaseFrames > 0 ? peak / static_cast<int32_t>(note.releaseFrames) : peak;
+}
+
+void ToneSynth::render(float* stereo, size_t frames)
+{
+    Note_t note;
+    while (_events.read(&note, 1) == 1) {
+        start_voice(note);
+    }
+
+    constexpr uint32_t shift = 32 - kTableBits;
+    for (auto& voice : _voices) {
+        if (!voice.active) {
+            continue;
+        }
+
+        // Still waiting for its slot in a melody
+        size_t i = 0;
+        if (voice.position < voice.attackStart) {
+            i               = std::min<size_t>(voice.attackStart - voice.position, frames);
+            voice.position += i;
+        }
+
+        for (; i < frames; i++) {
+            const uint32_t pos = voice.position++;
+            if (pos >= voice.end) {
+                voice.active = false;
+                break;
+            }
+
+            if (pos < voice.holdStart) {
+                voice.level = std::min(voice.level + voice.attackSlope, voice.peak);
+            } else if (pos >= voice.releaseStart) {
+                voice.level = std::max(voice.level - voice.releaseSlope, 0);
+            }
+
+            const int32_t sample = (_table[voice.phase >> shift] * (voice.level >> 8)) >> 15;
+            voice.phase += voice.step;
+
+            stereo[i * 2 + 0] += sample;
+            stereo[i * 2 + 1] += sample;
+        }
+    }
+}
@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "mixer.h"
+#include "spsc_ring.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace audio {
+
+namespace detail {
+
+// 2^(n/12) for one octave, everything else is a power of two away
+constexpr double kSemitoneRatio[12] = {
+    1.0,
+    1.0594630943592953,
+    1.1224620483093730,
+    1.1892071150027210,
+    1.2599210498948732,
+    1.3348398541700344,
+    1.4142135623730951,
+    1.4983070768766815,
+    1.5874010519681994,
+    1.6817928305074290,
+    1.7817974362806785,
+    1.8877486253633868,
+};
+
+constexpr double midi_to_hz(int midi)
+{
+    int octave   = (midi - 69) / 12;
+    int semitone = (midi - 69) % 12;
+    if (semitone < 0) {
+        semitone += 12;
+        octave -= 1;
+    }
+    double hz = 440.0 * kSemitoneRatio[semitone];
+    for (; octave > 0; octave--) {
+        hz *= 2.0;
+    }
+    for (; octave < 0; octave++) {
+        hz *= 0.5;
+    }
+    return hz;
+}
+
+constexpr std::array<uint32_t, 128> make_midi_phase_table(uint32_t sampleRate)
+{
+    std::array<uint32_t, 128> table = {};
+    for (int i = 0; i < 128; i++) {
+        table[i] = static_cast<uint32_t>(midi_to_hz(i) / sampleRate * 4294967296.0);
+    }
+    return table;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Polyphonic wavetable oscillator for UI feedback sounds
+ *
+ * Notes are queued from any thread and rendered straight into the mixer from the audio task. Voices are a fixed
+ * pool with 32-bit phase accumulators and integer envelopes, so triggering a click costs one queue push. A voice is
+ * claimed when its note is dequeued, delay included, and a new note only ever takes an idle or releasing voice: a
+ * queued melody can't cut off a note that is still sounding, and notes waiting for their slot keep theirs.
+ */
+class ToneSynth : public MixerSource {
+public:
+    static constexpr uint32_t kSampleRate     = Mixer::kSampleRate;
+    static constexpr size_t kMaxVoices        = 16;
+    static constexpr size_t kTableBits        = 10;
+    static constexpr size_t kTableSize        = 1 << kTableBits;
+    static constexpr size_t kEventQueueSize   = 64;
+    static constexpr auto kMidiPhaseIncrement = detail::make_midi_phase_table(kSampleRate);
+
+    struct Note_t {
+        uint32_t phaseIncrement = 0;
+        uint32_t delayFrames    = 0;  // start offset, lets a melody go out as one batch
+        uint32_t attackFrames   = 0;
+        uint32_t holdFrames     = 0;
+        uint32_t releaseFrames  = 0;
+        int16_t amplitude       = 0;  // peak, full scale is 32767
+    };
+
+    ToneSynth();
+
+    static uint32_t phaseIncrementFromHz(float hz)
+    {
+        return static_cast<uint32_t>(hz / kSampleRate * 4294967296.0f);
+    }
+
+    static uint32_t framesFromSeconds(double seconds)
+    {
+        return static_cast<uint32_t>(seconds * kSampleRate);
+    }
+
+    /**
+     * @brief Queue a note, safe from any thread
+     *
+     * @return false if the queue is full
+     */
+    bool trigger(const Note_t& note);
+
+    void render(float* stereo, size_t frames) override;
+
+    /**
+     * @brief Notes dropped because every voice was sounding or waiting to sound
+     *
+     */
+    uint32_t droppedNotes() const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    // Envelope level and slopes are the note amplitude in Q8
+    struct Voice {
+        bool active           = false;
+        uint32_t phase        = 0;
+        uint32_t step         = 0;
+        uint32_t position     = 0;
+        uint32_t attackStart  = 0;
+        uint32_t holdStart    = 0;
+        uint32_t releaseStart = 0;
+        uint32_t end          = 0;
+        int32_t peak          = 0;
+        int32_t level         = 0;
+        int32_t attackSlope   = 0;
+        int32_t releaseSlope  = 0;
+    };
+
+    int16_t _table[kTableSize];
+    Voice _voices[kMaxVoices];
+    SpscRing<Note_t> _events;
+    std::mutex _producer_mutex;
+    std::atomic<uint32_t> _dropped{0};
+
+    void start_voice(const Note_t& note);
+};
+
+}  // namespace audio
@@ -0,0 +1,322 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "wav_file.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace audio;
+
+namespace {
+
+struct RiffHeader_t {
+    char riff[4];
+    uint32_t size;
+    char wave[4];
+};
+
+struct ChunkHeader_t {
+    char id[4];
+    uint32_t size;
+};
+
+struct FmtChunk_t {
+    uint16_t format;
+    uint16_t channels;
+    uint32_t sampleRate;
+    uint32_t byteRate;
+    uint16_t blockAlign;
+    uint16_t bitsPerSample;
+};
+
+constexpr uint16_t kFormatPcm = WAV_PCM16;
+
+template <typename T>
+uint8_t* put(uint8_t* out, const T& value)
+{
+    memcpy(out, &value, sizeof(value));
+    return out + sizeof(value);
+}
+
+}  // namespace
+
+size_t audio::wav_header(uint8_t* header, const WavFormat_t& format, uint32_t dataSize, uint32_t frames)
+{
+    const bool adpcm = format.encoding == WAV_IMA_ADPCM;
+
+    FmtChunk_t fmt;
+    fmt.format        = format.encoding;
+    fmt.channels      = format.channels;
+    fmt.sampleRate    = format.sampleRate;
+    fmt.blockAlign    = format.blockAlign;
+    fmt.bitsPerSample = adpcm ? 4 : 16;
+    fmt.byteRate      = static_cast<uint32_t>(static_cast<uint64_t>(format.sampleRate) * format.blockAlign /
+                                              std::max<uint16_t>(format.samplesPerBlock, 1));
+
+    // ADPCM appends cbSize and samplesPerBlock to fmt, and needs a fact chunk with the frame count
+    const uint32_t fmt_size    = sizeof(FmtChunk_t) + (adpcm ? 4 : 0);
+    const uint32_t fact_size   = adpcm ? sizeof(ChunkHeader_t) + 4 : 0;
+    const uint32_t header_size = sizeof(RiffHeader_t) + sizeof(ChunkHeader_t) + fmt_size + fact_size +
+                                 sizeof(ChunkHeader_t);
+
+    uint8_t* out = header;
+    out          = put(out, RiffHeader_t{{'R', 'I', 'F', 'F'}, header_size - 8 + dataSize, {'W', 'A', 'V', 'E'}});
+    out          = put(out, ChunkHeader_t{{'f', 'm', 't', ' '}, fmt_size});
+    out          = put(out, fmt);
+    if (adpcm) {
+        out = put(out, static_cast<uint16_t>(2));
+        out = put(out, format.samplesPerBlock);
+        out = put(out, ChunkHeader_t{{'f', 'a', 'c', 't'}, 4});
+        out = put(out, frames);
+    }
+    out = put(out, ChunkHeader_t{{'d', 'a', 't', 'a'}, dataSize});
+    return out - header;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   Reader                                   */
+/* -------------------------------------------------------------------------- */
+WavReader::~WavReader()
+{
+    close();
+}
+
+bool WavReader::open(const std::string& path, size_t readAheadBytes)
+{
+    close();
+
+    _file = fopen(path.c_str(), "rb");
+    if (_file == nullptr) {
+        return false;
+    }
+    if (readAheadBytes > 0) {
+        setvbuf(_file, nullptr, _IOFBF, readAheadBytes);
+    }
+
+    RiffHeader_t riff;
+    if (fread(&riff, sizeof(riff), 1, _file) != 1 || memcmp(riff.riff, "RIFF", 4) != 0 ||
+        memcmp(riff.wave, "WAVE", 4) != 0) {
+        close();
+        return false;
+    }
+
+    // Walk chunks until both fmt and data are found, fact is optional and only means something for ADPCM
+    bool got_fmt             = false;
+    uint16_t samples_per_blk = 0;
+    uint32_t fact_frames     = 0;
+    ChunkHeader_t chunk;
+    while (fread(&chunk, sizeof(chunk), 1, _file) == 1) {
+        if (memcmp(chunk.id, "fmt ", 4) == 0) {
+            FmtChunk_t fmt;
+            if (chunk.size < sizeof(fmt) || fread(&fmt, sizeof(fmt), 1, _file) != 1 || fmt.channels == 0) {
+                break;
+            }
+            size_t extra = chunk.size - sizeof(fmt);
+            if (fmt.format == kFormatPcm && fmt.bitsPerSample == 16) {
+                _encoding = WAV_PCM16;
+            } else if (fmt.format == WAV_IMA_ADPCM && fmt.bitsPerSample == 4 && extra >= 4) {
+                uint16_t cb_size = 0;
+                if (fread(&cb_size, 2, 1, _file) != 1 || fread(&samples_per_blk, 2, 1, _file) != 1 ||
+                    !_adpcm.init(fmt.channels, fmt.blockAlign) || _adpcm.samplesPerBlock() != samples_per_blk) {
+                    break;
+                }
+                extra -= 4;
+                _encoding = WAV_IMA_ADPCM;
+            } else {
+                break;
+            }
+            _sample_rate = fmt.sampleRate;
+            _channels    = fmt.channels;
+            _block_align = fmt.blockAlign;
+            got_fmt      = true;
+            fseek(_file, extra + (chunk.size & 1), SEEK_CUR);
+        } else if (memcmp(chunk.id, "fact", 4) == 0 && chunk.size >= 4) {
+            if (fread(&fact_frames, 4, 1, _file) != 1) {
+                break;
+            }
+            fseek(_file, chunk.size - 4 + (chunk.size & 1), SEEK_CUR);
+        } else if (memcmp(chunk.id, "data", 4) == 0) {
+            if (!got_fmt) {
+                break;
+            }
+            _data_offset = ftell(_file);
+            _data_size   = chunk.size;
+            _data_read   = 0;
+            _position    = 0;
+            if (_encoding == WAV_PCM16) {
+                _total_frames = _data_size / (_channels * sizeof(int16_t));
+            } else {
+                const uint32_t blocks = (_data_size + _block_align - 1) / _block_align;
+                _total_frames         = fact_frames > 0 ? fact_frames : blocks * samples_per_blk;
+                _block.resize(_block_align);
+                _block_frames.resize(static_cast<size_t>(samples_per_blk) * _channels);
+                _block_used  = 0;
+                _block_count = 0;
+            }
+            return true;
+        } else {
+            fseek(_file, chunk.size + (chunk.size & 1), SEEK_CUR);
+        }
+    }
+
+    close();
+    return false;
+}
+
+void WavReader::close()
+{
+    if (_file) {
+        fclose(_file);
+        _file = nullptr;
+    }
+    _sample_rate  = 0;
+    _channels     = 0;
+    _data_size    = 0;
+    _data_read    = 0;
+    _total_frames = 0;
+    _position     = 0;
+    _block_used   = 0;
+    _block_count  = 0;
+}
+
+size_t WavReader::read(int16_t* frames, size_t frameCount)
+{
+    if (_file == nullptr) {
+        return 0;
+    }
+    frameCount = std::min<size_t>(frameCount, _total_frames - std::min(_position, _total_frames));
+    if (_encoding == WAV_IMA_ADPCM) {
+        return read_adpcm(frames, frameCount);
+    }
+
+    const size_t frame_bytes = _channels * sizeof(int16_t);
+    size_t bytes             = frameCount * frame_bytes;
+    if (bytes > _data_size - _data_read) {
+        bytes = (_data_size - _data_read) / frame_bytes * frame_bytes;
+    }
+
+    size_t got = fread(frames, 1, bytes, _file);
+    _data_read += got;
+    _position += got / frame_bytes;
+    return got / frame_bytes;
+}
+
+size_t WavReader::read_adpcm(int16_t* frames, size_t frameCount)
+{
+    size_t done = 0;
+    while (done < frameCount) {
+        if (_block_used == _block_count) {
+            const size_t bytes = std::min<size_t>(_block_align, _data_size - _data_read);
+            const size_t got   = bytes > 0 ? fread(_block.data(), 1, bytes, _file) : 0;
+            _data_read += got;
+            _block_count = _adpcm.decodeBlock(_block.data(), got, _block_frames.data());
+            _block_used  = 0;
+            if (_block_count == 0) {
+                break;
+            }
+        }
+        const size_t n = std::min(frameCount - done, _block_count - _block_used);
+        memcpy(frames + done * _channels, &_block_frames[_block_used * _channels], n * _channels * sizeof(int16_t));
+        _block_used += n;
+        done += n;
+    }
+    _position += done;
+    return done;
+}
+
+bool WavReader::seek(uint32_t frame)
+{
+    if (_file == nullptr) {
+        return false;
+    }
+    frame = std::min(frame, _total_frames);
+
+    if (_encoding == WAV_PCM16) {
+        _data_read = frame * _channels * sizeof(int16_t);
+        _position  = frame;
+        return fseek(_file, _data_offset + _data_read, SEEK_SET) == 0;
+    }
+
+    // Blocks are self contained, decode the one holding the frame and skip into it
+    const size_t samples_per_block = _adpcm.samplesPerBlock();
+    const uint32_t block           = frame / samples_per_block;
+    _data_read                     = std::min(block * _block_align, _data_size);
+    _position                      = block * samples_per_block;
+    _block_used                    = 0;
+    _block_count                   = 0;
+    if (fseek(_file, _data_offset + _data_read, SEEK_SET) != 0) {
+        return false;
+    }
+
+    int16_t skip[64 * 2];
+    uint32_t remaining = frame - _position;
+    while (remaining > 0) {
+        const size_t n = read_adpcm(skip, std::min<uint32_t>(remaining, 64));
+        if (n == 0) {
+            break;
+        }
+        remaining -= n;
+    }
+    return true;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   Writer                                   */
+/* -------------------------------------------------------------------------- */
+WavWriter::~WavWriter()
+{
+    close();
+}
+
+bool WavWriter::open(const std::string& path, uint32_t sampleRate, uint16_t channels)
+{
+    close();
+
+    _file = fopen(path.c_str(), "wb");
+    if (_file == nullptr) {
+        return false;
+    }
+    _channels    = channels;
+    _sample_rate = sampleRate;
+    _data_size   = 0;
+
+    uint8_t header[kWavHeaderMaxSize];
+    fwrite(header, 1, make_header(header), _file);
+    return true;
+}
+
+size_t WavWriter::write(const int16_t* frames, size_t frameCount)
+{
+    if (_file == nullptr) {
+        return 0;
+    }
+    size_t written = fwrite(frames, _channels * sizeof(int16_t), frameCount, _file);
+    _data_size += written * _channels * sizeof(int16_t);
+    return written;
+}
+
+size_t WavWriter::make_header(uint8_t* header) const
+{
+    WavFormat_t format;
+    format.sampleRate = _sample_rate;
+    format.channels   = _channels;
+    format.blockAlign = _channels * sizeof(int16_t);
+    return wav_header(header, format, _data_size, 0);
+}
+
+void WavWriter::close()
+{
+    if (_file == nullptr) {
+        return;
+    }
+
+    // Rewrite the header now that the length is known
+    uint8_t header[kWavHeaderMaxSize];
+    fseek(_file, 0, SEEK_SET);
+    fwrite(header, 1, make_header(header), _file);
+
+    fclose(_file);
+    _file = nullptr;
+}
@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <cstddef>
+#include "ima_adpcm.h"
+#include <string>
+#include <vector>
+
+namespace audio {
+
+enum WavEncoding_t : uint16_t {
+    WAV_PCM16     = 0x0001,
+    WAV_IMA_ADPCM = 0x0011,
+};
+
+struct WavFormat_t {
+    WavEncoding_t encoding   = WAV_PCM16;
+    uint32_t sampleRate      = 48000;
+    uint16_t channels        = 2;
+    uint16_t blockAlign      = 4;  // bytes per frame for PCM, per block for ADPCM
+    uint16_t samplesPerBlock = 1;
+};
+
+constexpr size_t kWavHeaderMaxSize = 60;
+
+/**
+ * @brief Serialize a canonical header, ADPCM gets the extended fmt chunk and a fact chunk
+ *
+ * @param header at least kWavHeaderMaxSize bytes
+ * @param dataSize bytes of the data chunk
+ * @param frames sample frames, only stored for ADPCM
+ * @return size_t header size, the data chunk payload starts right after it
+ */
+size_t wav_header(uint8_t* header, const WavFormat_t& format, uint32_t dataSize, uint32_t frames);
+
+/**
+ * @brief Minimal wav reader for 16-bit PCM and IMA ADPCM, ADPCM is decoded to 16-bit on the fly
+ *
+ */
+class WavReader {
+public:
+    ~WavReader();
+
+    /**
+     * @brief Open and parse the header
+     *
+     * @param readAheadBytes stdio buffer size, 0 keeps the default
+     */
+    bool open(const std::string& path, size_t readAheadBytes = 0);
+    void close();
+
+    bool isOpen() const
+    {
+        return _file != nullptr;
+    }
+    uint32_t sampleRate() const
+    {
+        return _sample_rate;
+    }
+    uint16_t channels() const
+    {
+        return _channels;
+    }
+    WavEncoding_t encoding() const
+    {
+        return _encoding;
+    }
+    uint32_t totalFrames() const
+    {
+        return _total_frames;
+    }
+    uint32_t position() const
+    {
+        return _position;
+    }
+
+    /**
+     * @brief Read interleaved 16-bit frames
+     *
+     * @return size_t frames actually read, 0 at end of data
+     */
+    size_t read(int16_t* frames, size_t frameCount);
+
+    /**
+     * @brief Continue from a frame, ADPCM lands on the block boundary and decodes up to the frame
+     *
+     */
+    bool seek(uint32_t frame);
+
+    /**
+     * @brief Jump back to the first frame
+     *
+     */
+    void rewind()
+    {
+        seek(0);
+    }
+
+private:
+    FILE* _file             = nullptr;
+    WavEncoding_t _encoding = WAV_PCM16;
+    uint32_t _sample_rate   = 0;
+    uint16_t _channels      = 0;
+    uint16_t _block_align   = 0;
+    uint32_t _data_offset   = 0;
+    uint32_t _data_size     = 0;
+    uint32_t _data_read     = 0;
+    uint32_t _total_frames  = 0;
+    uint32_t _position      = 0;
+
+    // ADPCM, one decoded block is served from at a time
+    ImaAdpcmDecoder _adpcm;
+    std::vector<uint8_t> _block;
+    std::vector<int16_t> _block_frames;
+    size_t _block_used  = 0;
+    size_t _block_count = 0;
+
+    size_t read_adpcm(int16_t* frames, size_t frameCount);
+};
+
+/**
+ * @brief Minimal 16-bit PCM wav writer, sizes are patched on close
+ *
+ */
+class WavWriter {
+public:
+    ~WavWriter();
+
+    bool open(const std::string& path, uint32_t sampleRate, uint16_t channels);
+    void close();
+
+    bool isOpen() const
+    {
+        return _file != nullptr;
+    }
+
+    size_t write(const int16_t* frames, size_t frameCount);
+
+private:
+    FILE* _file           = nullptr;
+    uint32_t _sample_rate = 0;
+    uint16_t _channels    = 0;
+    uint32_t _data_size   = 0;
+
+    size_t make_header(uint8_t* header) const;
+};
+
+}  // namespace audio
@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "frame_pool.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace camera;
+
+static int64_t steady_clock_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Averages over about eight frames, seeded with the first sample
+static inline uint32_t smooth(uint32_t average, int64_t sample)
+{
+    const uint32_t value = static_cast<uint32_t>(std::max<int64_t>(sample, 0));
+    return average == 0 ? value : (average * 7 + value) / 8;
+}
+
+FramePool::FramePool(const Config_t& config, RequeueCallback_t requeue, Clock_t clock)
+    : _config(config), _requeue(std::move(requeue)), _clock(clock ? clock : steady_clock_us)
+{
+    _config.bufferCount   = std::min(std::max<size_t>(_config.bufferCount, 1), kMaxBuffers);
+    _config.driverReserve = std::min(_config.driverReserve, _config.bufferCount - 1);
+    _buffers.resize(_config.bufferCount);
+    _driver_depth = _config.bufferCount;
+    resetStats();
+}
+
+void FramePool::setBuffer(uint32_t index, uint8_t* data, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (index < _buffers.size()) {
+        _buffers[index].data  = data;
+        _buffers[index].bytes = bytes;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Producer                                  */
+/* -------------------------------------------------------------------------- */
+void FramePool::push(uint32_t index, uint32_t sequence, int64_t timestampUs)
+{
+    GiveBack_t give_back_list;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (index >= _buffers.size() || _buffers[index].state != BUFFER_DRIVER) {
+            return;
+        }
+
+        Buffer_t& buffer   = _buffers[index];
+        buffer.state       = BUFFER_READY;
+        buffer.sequence    = sequence;
+        buffer.timestampUs = timestampUs;
+        buffer.dequeueUs   = _clock();
+        _driver_depth--;
+        _ready[(_ready_head + _ready_count++) % kMaxBuffers] = index;
+
+        _stats.frames++;
+        if (_has_sequence && sequence > _last_sequence + 1) {
+            _stats.sequenceGaps += sequence - _last_sequence - 1;
+        }
+        _has_sequence  = true;
+        _last_sequence = sequence;
+        if (_last_timestamp != 0 && timestampUs > _last_timestamp) {
+            _stats.frameIntervalUs = smooth(_stats.frameIntervalUs, timestampUs - _last_timestamp);
+        }
+        _last_timestamp = timestampUs;
+
+        // Never let the consumer starve the sensor, the oldest waiting frames are the cheapest to lose
+        if (_config.policy == POLICY_DROP_OLDEST) {
+            while (_driver_depth < _config.driverReserve && _ready_count > 0) {
+                to_driver_locked(pop_oldest_locked(), give_back_list);
+                _stats.dropped++;
+            }
+        }
+        retry_idle_locked(give_back_list);
+
+        _stats.maxQueueDepth  = std::max<uint32_t>(_stats.maxQueueDepth, _ready_count);
+        _stats.minDriverDepth = std::min<uint32_t>(_stats.minDriverDepth, _driver_depth);
+    }
+    _ready_cv.notify_one();
+    give_back(give_back_list);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Consumer                                  */
+/* -------------------------------------------------------------------------- */
+bool FramePool::acquire(Frame_t& frame, uint32_t timeoutMs)
+{
+    GiveBack_t give_back_list;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_ready_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return _ready_count > 0; })) {
+            return false;
+        }
+
+        uint32_t index;
+        if (_config.policy == POLICY_DROP_OLDEST) {
+            // Jump to the newest, whatever it skips goes straight back to the sensor
+            index = pop_newest_locked();
+            while (_ready_count > 0) {
+                to_driver_locked(pop_oldest_locked(), give_back_list);
+                _stats.dropped++;
+            }
+        } else {
+            index = pop_oldest_locked();
+        }
+
+        Buffer_t& buffer  = _buffers[index];
+        buffer.state      = BUFFER_CONSUMER;
+        buffer.holders    = 1;
+        frame.index       = index;
+        frame.sequence    = buffer.sequence;
+        frame.timestampUs = buffer.timestampUs;
+        frame.dequeueUs   = buffer.dequeueUs;
+        frame.data        = buffer.data;
+        frame.bytes       = buffer.bytes;
+
+        _stats.delivered++;
+        _stats.queueLatencyUs = smooth(_stats.queueLatencyUs, _clock() - buffer.dequeueUs);
+    }
+    give_back(give_back_list);
+    return true;
+}
+
+bool FramePool::retain(uint32_t index)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (index >= _buffers.size() || _buffers[index].state != BUFFER_CONSUMER) {
+        return false;
+    }
+    _buffers[index].holders++;
+    return true;
+}
+
+void FramePool::release(uint32_t index)
+{
+    GiveBack_t give_back_list;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (index >= _buffers.size() || _buffers[index].state != BUFFER_CONSUMER) {
+            return;
+        }
+        if (--_buffers[index].holders > 0) {
+            return;
+        }
+
+        const int64_t held      = _clock() - _buffers[index].dequeueUs;
+        _stats.holdLatencyUs    = smooth(_stats.holdLatencyUs, held);
+        _stats.maxHoldLatencyUs = std::max<uint32_t>(_stats.maxHoldLatencyUs, std::max<int64_t>(held, 0));
+        to_driver_locked(index, give_back_list);
+        retry_idle_locked(give_back_list);
+    }
+    give_back(give_back_list);
+}
+
+void FramePool::flush()
+{
+    GiveBack_t give_back_list;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        while (_ready_count > 0) {
+            to_driver_locked(pop_oldest_locked(), give_back_list);
+        }
+        retry_idle_locked(give_back_list);
+    }
+    give_back(give_back_list);
+}
+
+FramePool::Stats_t FramePool::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    Stats_t ret     = _stats;
+    ret.queueDepth  = _ready_count;
+    ret.driverDepth = _driver_depth;
+    return ret;
+}
+
+void FramePool::resetStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stats                = {};
+    _stats.minDriverDepth = _driver_depth;
+    _has_sequence         = false;
+    _last_timestamp       = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Internal                                  */
+/* -------------------------------------------------------------------------- */
+uint32_t FramePool::pop_oldest_locked()
+{
+    const uint32_t index = _ready[_ready_head];
+    _ready_head          = (_ready_head + 1) % kMaxBuffers;
+    _ready_count--;
+    return index;
+}
+
+uint32_t FramePool::pop_newest_locked()
+{
+    return _ready[(_ready_head + --_ready_count) % kMaxBuffers];
+}
+
+void FramePool::to_driver_locked(uint32_t index, GiveBack_t& giveBack)
+{
+    _buffers[index].state = BUFFER_DRIVER;
+    _driver_depth++;
+    giveBack.index[giveBack.count++] = index;
+}
+
+void FramePool::retry_idle_locked(GiveBack_t& giveBack)
+{
+    for (uint32_t i = 0; i < _buffers.size(); i++) {
+        if (_buffers[i].state == BUFFER_IDLE) {
+            to_driver_locked(i, giveBack);
+        }
+    }
+}
+
+void FramePool::give_back(const GiveBack_t& giveBack)
+{
+    for (size_t i = 0; i < giveBack.count; i++) {
+        if (_requeue && _requeue(giveBack.index[i])) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        _buffers[giveBack.index[i]].state = BUFFER_IDLE;
+        _driver_depth--;
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace camera {
+
+/**
+ * @brief Ownership bookkeeping of the capture buffers between the driver, the pool and the consumer
+ *
+ * Buffers are identified by their driver index, which doubles as the ownership token: the producer push()es what it
+ * dequeued, the consumer acquire()s and release()s, and release() hands the buffer back to the driver through the
+ * requeue callback. Nothing here touches the driver itself, so the same logic runs against V4L2 or a fake producer.
+ */
+class FramePool {
+public:
+    static constexpr size_t kMaxBuffers = 16;
+
+    enum Policy_t {
+        POLICY_DROP_OLDEST,  // a consumer that falls behind gets the newest frame, the older ones go back to the driver
+        POLICY_BLOCK,        // every frame in order, a slow consumer stalls the sensor instead
+    };
+
+    struct Config_t {
+        size_t bufferCount   = 4;
+        Policy_t policy      = POLICY_DROP_OLDEST;
+        size_t driverReserve = 1;  // drop oldest keeps at least this many buffers with the driver
+    };
+
+    struct Frame_t {
+        uint32_t index      = 0;  // hand back to release()
+        uint32_t sequence   = 0;
+        int64_t timestampUs = 0;  // from the driver, only used for frame intervals
+        int64_t dequeueUs   = 0;
+        uint8_t* data       = nullptr;
+        size_t bytes        = 0;
+    };
+
+    struct Stats_t {
+        uint32_t frames           = 0;  // dequeued from the driver
+        uint32_t delivered        = 0;
+        uint32_t dropped          = 0;  // handed back unseen by the policy
+        uint32_t sequenceGaps     = 0;  // frames the driver had no buffer for
+        uint32_t queueDepth       = 0;  // waiting for the consumer
+        uint32_t maxQueueDepth    = 0;
+        uint32_t driverDepth      = 0;
+        uint32_t minDriverDepth   = 0;  // how close the sensor came to stalling
+        uint32_t frameIntervalUs  = 0;
+        uint32_t queueLatencyUs   = 0;  // dequeue to acquire
+        uint32_t holdLatencyUs    = 0;  // dequeue to release
+        uint32_t maxHoldLatencyUs = 0;
+    };
+
+    using RequeueCallback_t = std::function<bool(uint32_t index)>;
+    using Clock_t           = int64_t (*)();
+
+    /**
+     * @brief All buffers start out with the driver, at most kMaxBuffers
+     *
+     * @param requeue called without the pool lock held, returns false if the driver refused the buffer
+     * @param clock microseconds, defaults to the steady clock
+     */
+    FramePool(const Config_t& config, RequeueCallback_t requeue, Clock_t clock = nullptr);
+
+    void setBuffer(uint32_t index, uint8_t* data, size_t bytes);
+    uint8_t* buffer(uint32_t index) const
+    {
+        return index < _buffers.size() ? _buffers[index].data : nullptr;
+    }
+    const Config_t& config() const
+    {
+        return _config;
+    }
+
+    /* -------------------------------- Producer -------------------------------- */
+    void push(uint32_t index, uint32_t sequence, int64_t timestampUs);
+
+    /* -------------------------------- Consumer -------------------------------- */
+    /**
+     * @brief Next frame per the policy, waits up to timeoutMs for one
+     *
+     */
+    bool acquire(Frame_t& frame, uint32_t timeoutMs);
+
+    /**
+     * @brief Share an acquired frame with another consumer, every retain() needs its own release()
+     *
+     */
+    bool retain(uint32_t index);
+    void release(uint32_t index);
+
+    /**
+     * @brief Hand every waiting frame back to the driver, e.g. on pause
+     *
+     */
+    void flush();
+
+    Stats_t stats() const;
+    void resetStats();
+
+private:
+    enum BufferState_t {
+        BUFFER_DRIVER,
+        BUFFER_READY,
+        BUFFER_CONSUMER,
+        BUFFER_IDLE,  // the driver refused it, retried on the next push or release
+    };
+
+    struct Buffer_t {
+        uint8_t* data       = nullptr;
+        size_t bytes        = 0;
+        BufferState_t state = BUFFER_DRIVER;
+        uint32_t sequence   = 0;
+        int64_t timestampUs = 0;
+        int64_t dequeueUs   = 0;
+        uint32_t holders    = 0;
+    };
+
+    Config_t _config;
+    RequeueCallback_t _requeue;
+    Clock_t _clock;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _ready_cv;
+    std::vector<Buffer_t> _buffers;
+    uint32_t _ready[kMaxBuffers];  // ring of waiting frames, oldest first
+    size_t _ready_head   = 0;
+    size_t _ready_count  = 0;
+    size_t _driver_depth = 0;
+
+    Stats_t _stats;
+    bool _has_sequence      = false;
+    uint32_t _last_sequence = 0;
+    int64_t _last_timestamp = 0;
+
+    // Buffers on their way back to the driver, requeued once the lock is released
+    struct GiveBack_t {
+        uint32_t index[kMaxBuffers];
+        size_t count = 0;
+    };
+
+    uint32_t pop_oldest_locked();
+    uint32_t pop_newest_locked();
+    void to_driver_locked(uint32_t index, GiveBack_t& giveBack);
+    void retry_idle_locked(GiveBack_t& giveBack);
+    void give_back(const GiveBack_t& giveBack);
+};
+
+}  // namespace camera
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "frame_scaler.h"
+#include <algorithm>
+
+using namespace camera;
+
+// Channels widened to 8 bits the way imlib does it, so a flat colour comes out as it would from imlib
+static inline uint32_t red8(uint32_t pixel)
+{
+    const uint32_t r = (pixel >> 8) & 0xF8;
+    return r | (r >> 5);
+}
+
+static inline uint32_t green8(uint32_t pixel)
+{
+    const uint32_t g = (pixel >> 3) & 0xFC;
+    return g | (g >> 6);
+}
+
+static inline uint32_t blue8(uint32_t pixel)
+{
+    const uint32_t b = (pixel << 3) & 0xF8;
+    return b | (b >> 5);
+}
+
+// 0.299R + 0.587G + 0.114B in sevenths of a bit, imlib's COLOR_RGB888_TO_Y
+static inline uint8_t luma8(uint32_t r, uint32_t g, uint32_t b)
+{
+    return static_cast<uint8_t>((r * 38 + g * 75 + b * 15) >> 7);
+}
+
+bool FrameScaler::configure(uint16_t srcWidth, uint16_t srcHeight, const Roi_t& roi, uint16_t dstWidth,
+                            uint16_t dstHeight)
+{
+    if (roi.x >= srcWidth || roi.y >= srcHeight || dstWidth == 0 || dstHeight == 0) {
+        return false;
+    }
+
+    Roi_t clipped  = roi;
+    clipped.width  = roi.width == 0 ? srcWidth - roi.x : std::min<uint16_t>(roi.width, srcWidth - roi.x);
+    clipped.height = roi.height == 0 ? srcHeight - roi.y : std::min<uint16_t>(roi.height, srcHeight - roi.y);
+    if (clipped.width < dstWidth || clipped.height < dstHeight) {
+        return false;
+    }
+
+    _src_width  = srcWidth;
+    _src_height = srcHeight;
+    _dst_width  = dstWidth;
+    _dst_height = dstHeight;
+    _roi        = clipped;
+
+    auto make_spans = [](std::vector<Span_t>& spans, uint32_t from, uint32_t to) {
+        spans.resize(to);
+        for (uint32_t i = 0; i < to; i++) {
+            spans[i].start = static_cast<uint16_t>(i * from / to);
+            spans[i].count = static_cast<uint16_t>((i + 1) * from / to - spans[i].start);
+        }
+    };
+    make_spans(_columns, _roi.width, _dst_width);
+    make_spans(_rows, _roi.height, _dst_height);
+
+    _reciprocals.assign(_dst_width, 0);
+    _sums.assign(static_cast<size_t>(_roi.width) * 3, 0);
+    return true;
+}
+
+void FrameScaler::scale(const uint16_t* src, uint8_t* dst, ImageFormat_t format)
+{
+    if (src == nullptr || dst == nullptr || _columns.empty()) {
+        return;
+    }
+
+    const size_t width = _roi.width;
+    uint32_t* red      = _sums.data();
+    uint32_t* green    = red + width;
+    uint32_t* blue     = green + width;
+    uint32_t rows_in   = 0;  // what the reciprocals were worked out for
+
+    for (uint16_t y = 0; y < _dst_height; y++) {
+        // Down the columns first, a plain add per channel per pixel that the compiler can vectorize
+        const Span_t& span = _rows[y];
+        std::fill(_sums.begin(), _sums.end(), 0);
+        for (uint16_t i = 0; i < span.count; i++) {
+            const uint16_t* row = src + static_cast<size_t>(_roi.y + span.start + i) * _src_width + _roi.x;
+            for (size_t x = 0; x < width; x++) {
+                const uint32_t pixel  = row[x];
+                red[x]               += red8(pixel);
+                green[x]             += green8(pixel);
+                blue[x]              += blue8(pixel);
+            }
+        }
+
+        // Only two row spans ever occur, so this is rarely redone
+        if (span.count != rows_in) {
+            rows_in = span.count;
+            for (uint16_t x = 0; x < _dst_width; x++) {
+                const uint32_t pixels = _columns[x].count * rows_in;
+                _reciprocals[x]       = (65536 + pixels / 2) / pixels;
+            }
+        }
+
+        // Then across, rounded to nearest
+        for (uint16_t x = 0; x < _dst_width; x++) {
+            const Span_t& column = _columns[x];
+            uint32_t r           = 0;
+            uint32_t g           = 0;
+            uint32_t b           = 0;
+            for (uint16_t i = column.start; i < column.start + column.count; i++) {
+                r += red[i];
+                g += green[i];
+                b += blue[i];
+            }
+            r = (r * _reciprocals[x] + 0x8000) >> 16;
+            g = (g * _reciprocals[x] + 0x8000) >> 16;
+            b = (b * _reciprocals[x] + 0x8000) >> 16;
+
+            if (format == IMAGE_GRAY8) {
+                dst[x] = luma8(r, g, b);
+            } else {
+                reinterpret_cast<uint16_t*>(dst)[x] = static_cast<uint16_t>((r >> 3) << 11 | (g >> 2) << 5 | b >> 3);
+            }
+        }
+        dst += image_bytes(_dst_width, 1, format);
+    }
+}
+
+void FrameScaler::rgb565_to_gray8(const uint16_t* src, uint8_t* dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++) {
+        const uint32_t pixel = src[i];
+        dst[i]               = luma8(red8(pixel), green8(pixel), blue8(pixel));
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace camera {
+
+enum ImageFormat_t {
+    IMAGE_GRAY8,   // one byte of luma a pixel, imlib's grayscale
+    IMAGE_RGB565,  // native endian, as captured
+};
+
+inline size_t image_bytes(uint16_t width, uint16_t height, ImageFormat_t format)
+{
+    return static_cast<size_t>(width) * height * (format == IMAGE_GRAY8 ? 1 : 2);
+}
+
+/**
+ * @brief Part of a frame, in its own pixels
+ *
+ */
+struct Roi_t {
+    uint16_t x      = 0;
+    uint16_t y      = 0;
+    uint16_t width  = 0;  // zero takes the rest of the frame
+    uint16_t height = 0;
+};
+
+/**
+ * @brief Shrinks a region of an RGB565 frame by area averaging, for analysis rather than display
+ *
+ * Every output pixel is the mean of the source pixels under it, so fine detail averages out instead of aliasing the way
+ * nearest sampling would. A non-integer ratio gives spans of two alternating sizes rather than fractional weights. The
+ * spans are worked out by configure(), scale() is then integer adds a row at a time and a multiply per channel. This is
+ * the path wherever there is no hardware scaler, and the reference for the one there is.
+ */
+class FrameScaler {
+public:
+    /**
+     * @brief Fix the geometry, the roi is clipped to the frame
+     *
+     * @return false for an empty roi or one smaller than the output, this only scales down
+     */
+    bool configure(uint16_t srcWidth, uint16_t srcHeight, const Roi_t& roi, uint16_t dstWidth, uint16_t dstHeight);
+
+    /**
+     * @brief Scale one frame, src is a whole frame of the configured size
+     *
+     * @param dst image_bytes() of the output size in the given format
+     */
+    void scale(const uint16_t* src, uint8_t* dst, ImageFormat_t format);
+
+    const Roi_t& roi() const
+    {
+        return _roi;
+    }
+    uint16_t width() const
+    {
+        return _dst_width;
+    }
+    uint16_t height() const
+    {
+        return _dst_height;
+    }
+
+    /**
+     * @brief The luma imlib takes from RGB565, dst may alias src as the output never overtakes the input
+     *
+     */
+    static void rgb565_to_gray8(const uint16_t* src, uint8_t* dst, size_t pixels);
+
+private:
+    struct Span_t {
+        uint16_t start = 0;  // in the roi
+        uint16_t count = 0;
+    };
+
+    uint16_t _src_width  = 0;
+    uint16_t _src_height = 0;
+    uint16_t _dst_width  = 0;
+    uint16_t _dst_height = 0;
+    Roi_t _roi;
+
+    std::vector<Span_t> _columns;
+    std::vector<Span_t> _rows;
+    std::vector<uint32_t> _reciprocals;  // 2^16 / pixels under an output pixel, per output column for the current row
+    std::vector<uint32_t> _sums;         // red, green and blue planes, roi columns summed down the current row span
+};
+
+}  // namespace camera
@@ -0,0 +1,208 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "h264_encoder.h"
+#include <algorithm>
+
+using namespace camera;
+
+static bool is_start_code(const uint8_t* p)
+{
+    return p[0] == 0 && p[1] == 0 && p[2] == 1;
+}
+
+bool camera::next_nal_unit(const uint8_t* stream, size_t bytes, size_t& offset, NalUnit_t& nal)
+{
+    while (offset + 3 <= bytes) {
+        size_t begin = offset;
+        while (begin + 3 <= bytes && !is_start_code(stream + begin)) {
+            begin++;
+        }
+        if (begin + 3 > bytes) {
+            break;
+        }
+        begin += 3;
+
+        // A NAL unit never holds 00 00 00 or 00 00 01, emulation prevention sees to that
+        size_t end = begin;
+        while (end + 3 <= bytes && !(stream[end] == 0 && stream[end + 1] == 0 && stream[end + 2] <= 1)) {
+            end++;
+        }
+        if (end + 3 > bytes) {
+            end = bytes;
+        }
+        offset = end;
+
+        // Zeros before the next start code are trailing_zero_8bits, or the first byte of a four byte start code
+        while (end > begin && stream[end - 1] == 0) {
+            end--;
+        }
+        if (end > begin) {
+            nal.data  = stream + begin;
+            nal.bytes = end - begin;
+            return true;
+        }
+    }
+    offset = bytes;
+    return false;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                            Synthetic H264Encoder                           */
+/* -------------------------------------------------------------------------- */
+namespace {
+
+class BitWriter {
+public:
+    std::vector<uint8_t> bytes;
+
+    void bits(uint32_t value, int count)
+    {
+        for (int i = count - 1; i >= 0; i--) {
+            _byte = _byte << 1 | ((value >> i) & 1);
+            if (++_used == 8) {
+                bytes.push_back(_byte);
+                _byte = 0;
+                _used = 0;
+            }
+        }
+    }
+
+    // Exp-Golomb
+    void ue(uint32_t value)
+    {
+        const uint32_t coded = value + 1;
+        int length           = 0;
+        while ((coded >> length) > 1) {
+            length++;
+        }
+        bits(0, length);
+        bits(coded, length + 1);
+    }
+
+    void se(int32_t value)
+    {
+        ue(value > 0 ? value * 2 - 1 : -value * 2);
+    }
+
+    void trailing()
+    {
+        bits(1, 1);
+        while (_used != 0) {
+            bits(0, 1);
+        }
+    }
+
+private:
+    uint8_t _byte = 0;
+    int _used     = 0;
+};
+
+}  // namespace
+
+void SyntheticH264Encoder::configure(const H264Config_t& config)
+{
+    _config = config;
+    _frame  = 0;
+}
+
+void SyntheticH264Encoder::write_nal(uint8_t header, const std::vector<uint8_t>& rbsp)
+{
+    static const uint8_t start_code[4] = {0, 0, 0, 1};
+    _out.insert(_out.end(), start_code, start_code + 4);
+    _out.push_back(header);
+
+    int zeros = 0;
+    for (uint8_t byte : rbsp) {
+        if (zeros == 2 && byte <= 3) {
+            _out.push_back(3);
+            zeros = 0;
+        }
+        _out.push_back(byte);
+        zeros = byte == 0 ? zeros + 1 : 0;
+    }
+}
+
+void SyntheticH264Encoder::write_sps(uint16_t width, uint16_t height)
+{
+    const uint32_t mb_width  = (width + 15) / 16;
+    const uint32_t mb_height = (height + 15) / 16;
+    const bool cropped       = mb_width * 16 != width || mb_height * 16 != height;
+
+    // Constrained baseline level 3.1, what the hardware encoder produces for 720p
+    BitWriter sps;
+    sps.bits(66, 8);
+    sps.bits(0xc0, 8);
+    sps.bits(31, 8);
+    sps.ue(0);  // seq_parameter_set_id
+    sps.ue(0);  // log2_max_frame_num_minus4
+    sps.ue(2);  // pic_order_cnt_type
+    sps.ue(1);  // max_num_ref_frames
+    sps.bits(0, 1);
+    sps.ue(mb_width - 1);
+    sps.ue(mb_height - 1);
+    sps.bits(1, 1);  // frame_mbs_only_flag
+    sps.bits(1, 1);  // direct_8x8_inference_flag
+    sps.bits(cropped, 1);
+    if (cropped) {
+        sps.ue(0);
+        sps.ue((mb_width * 16 - width) / 2);
+        sps.ue(0);
+        sps.ue((mb_height * 16 - height) / 2);
+    }
+    sps.bits(0, 1);  // vui_parameters_present_flag
+    sps.trailing();
+    write_nal(0x67, sps.bytes);
+
+    BitWriter pps;
+    pps.ue(0);       // pic_parameter_set_id
+    pps.ue(0);       // seq_parameter_set_id
+    pps.bits(0, 1);  // CAVLC
+    pps.bits(0, 1);
+    pps.ue(0);  // num_slice_groups_minus1
+    pps.ue(0);  // num_ref_idx_l0_default_active_minus1
+    pps.ue(0);
+    pps.bits(0, 3);  // no weighted prediction
+    pps.se(0);       // pic_init_qp_minus26
+    pps.se(0);
+    pps.se(0);
+    pps.bits(1, 1);  // deblocking_filter_control_present_flag
+    pps.bits(0, 2);
+    pps.trailing();
+    write_nal(0x68, pps.bytes);
+}
+
+const uint8_t* SyntheticH264Encoder::encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes)
+{
+    if (rgb565 == nullptr || width == 0 || height == 0) {
+        return nullptr;
+    }
+
+    // Split the per frame budget so an IDR is four P slices and the GOP averages out to the bitrate
+    const uint32_t gop   = _config.gop > 0 ? _config.gop : 1;
+    const size_t budget  = _config.bitrate / 8 / _fps;
+    const size_t p_bytes = budget * gop / (gop + 3);
+    const bool idr       = _frame == 0;
+    const size_t slice   = std::max<size_t>(idr ? p_bytes * 4 : p_bytes, 16);
+    _frame               = (_frame + 1) % gop;
+
+    _out.clear();
+    if (idr) {
+        write_sps(width, height);
+    }
+
+    // Filler without zero bytes needs no emulation prevention
+    std::vector<uint8_t> payload(slice);
+    for (auto& byte : payload) {
+        _random ^= _random << 13;
+        _random ^= _random >> 17;
+        _random ^= _random << 5;
+        byte = static_cast<uint8_t>(_random) | 1;
+    }
+    write_nal(idr ? 0x65 : 0x41, payload);
+
+    bytes = _out.size();
+    return _out.data();
+}
@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace camera {
+
+struct H264Config_t {
+    uint32_t bitrate = 2000000;  // bits per second
+    uint32_t gop     = 30;       // frames from one IDR to the next
+    uint8_t minQp    = 20;
+    uint8_t maxQp    = 40;
+};
+
+enum H264NalType_t {
+    NAL_SLICE = 1,
+    NAL_IDR   = 5,
+    NAL_SEI   = 6,
+    NAL_SPS   = 7,
+    NAL_PPS   = 8,
+    NAL_AUD   = 9,
+};
+
+/**
+ * @brief One NAL unit of an Annex-B stream, start code excluded
+ *
+ */
+struct NalUnit_t {
+    const uint8_t* data = nullptr;
+    size_t bytes        = 0;
+
+    uint8_t type() const
+    {
+        return bytes > 0 ? data[0] & 0x1f : 0;
+    }
+};
+
+/**
+ * @brief Walk the NAL units of an Annex-B buffer, start with offset 0
+ *
+ * @return false past the last one
+ */
+bool next_nal_unit(const uint8_t* stream, size_t bytes, size_t& offset, NalUnit_t& nal);
+
+/**
+ * @brief Compresses RGB565 frames to H.264 access units, the platform plugs in its hardware encoder
+ *
+ */
+class H264Encoder {
+public:
+    virtual ~H264Encoder() = default;
+
+    /**
+     * @brief Takes effect from the next frame, which is then an IDR
+     *
+     */
+    virtual void configure(const H264Config_t& config) = 0;
+
+    /**
+     * @brief Compress one little endian RGB565 frame
+     *
+     * @return one Annex-B access unit, valid until the next call, nullptr on failure. IDRs carry the SPS and PPS.
+     */
+    virtual const uint8_t* encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes) = 0;
+};
+
+/**
+ * @brief Stands in for the hardware encoder on hosts
+ *
+ * Emits a real baseline SPS and PPS and the GOP structure and sizes the configuration asks for, but the slices are
+ * filler, so the container and writer side can be exercised without a codec. Players will open the files and show
+ * garbage.
+ */
+class SyntheticH264Encoder : public H264Encoder {
+public:
+    void configure(const H264Config_t& config) override;
+    const uint8_t* encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes) override;
+
+    /**
+     * @brief Frame rate the slice sizes are budgeted for
+     *
+     */
+    void setFrameRate(uint32_t fps)
+    {
+        _fps = fps > 0 ? fps : 1;
+    }
+
+private:
+    H264Config_t _config;
+    uint32_t _fps        = 30;
+    uint32_t _frame      = 0;  // within the GOP
+    uint32_t _random     = 0x12345678;
+    std::vector<uint8_t> _out;
+
+    void write_nal(uint8_t header, const std::vector<uint8_t>& rbsp);
+    void write_sps(uint16_t width, uint16_t height);
+};
+
+}  // namespace camera
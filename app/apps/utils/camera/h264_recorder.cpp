@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "h264_recorder.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace camera;
+
+static int64_t steady_clock_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+H264Recorder::H264Recorder(H264Encoder& encoder, Clock_t clock)
+    : _encoder(encoder), _clock(clock ? clock : steady_clock_us)
+{
+}
+
+bool H264Recorder::start(const std::string& path, Container_t container, uint16_t width, uint16_t height,
+                         const H264Config_t& config, uint32_t durationMs)
+{
+    stop();
+
+    _frames.store(0, std::memory_order_relaxed);
+    _dropped_frames.store(0, std::memory_order_relaxed);
+    _key_frames.store(0, std::memory_order_relaxed);
+    _sample_bytes.store(0, std::memory_order_relaxed);
+    _encoded.store(0, std::memory_order_relaxed);
+    _total_encode_us.store(0, std::memory_order_relaxed);
+    _last_encode_us.store(0, std::memory_order_relaxed);
+    _max_encode_us.store(0, std::memory_order_relaxed);
+    _first_pts_us.store(0, std::memory_order_relaxed);
+    _last_pts_us.store(0, std::memory_order_relaxed);
+    _finish_requested.store(false, std::memory_order_relaxed);
+
+    if (!_writer.open(path, kWriterChunks)) {
+        return false;
+    }
+
+    _container = container;
+    if (_container == CONTAINER_MP4) {
+        _muxer.begin(width, height, _sample);
+        _writer.append(_sample.data(), _sample.size());
+    }
+
+    _config = config;
+    _encoder.configure(_config);
+    _resync       = false;
+    _wait_for_key = true;
+    _end_us       = durationMs > 0 ? _clock() + static_cast<int64_t>(durationMs) * 1000 : 0;
+    _done.store(false, std::memory_order_release);
+    return true;
+}
+
+void H264Recorder::stop()
+{
+    if (!_writer.isOpen()) {
+        return;
+    }
+    if (_container == CONTAINER_MP4) {
+        write_index();
+    }
+    _writer.flush();
+    _writer.close();
+    _done.store(true, std::memory_order_release);
+}
+
+void H264Recorder::write_index()
+{
+    _muxer.finish(_sample);
+
+    // The encode side is gone, so this side fills the writer now, servicing it as it goes so there is always room
+    for (size_t offset = 0; offset < _sample.size(); offset += audio::AsyncFileWriter::kChunkBytes) {
+        _writer.service();
+        _writer.append(_sample.data() + offset,
+                       std::min(_sample.size() - offset, audio::AsyncFileWriter::kChunkBytes));
+    }
+    _writer.flush();
+
+    uint8_t size[8];
+    _muxer.mdatSize(size);
+    _writer.writeAt(_muxer.mdatSizeOffset(), size, sizeof(size));
+    _sample.clear();
+    _sample.shrink_to_fit();
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                 Encode side                                */
+/* -------------------------------------------------------------------------- */
+bool H264Recorder::wantsFrame()
+{
+    if (_done.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (_finish_requested.load(std::memory_order_relaxed) || (_end_us > 0 && _clock() >= _end_us)) {
+        _done.store(true, std::memory_order_release);
+        return false;
+    }
+    return true;
+}
+
+bool H264Recorder::write(const uint8_t* rgb565, uint16_t width, uint16_t height, int64_t ptsUs)
+{
+    if (!wantsFrame()) {
+        return false;
+    }
+
+    // Encoding into a full ring only to drop the result would waste the encoder, and asking for the IDR too early
+    // would have it dropped as well
+    if (_resync) {
+        if (_writer.stats().queuedChunks > _writer.chunkCount() / 2) {
+            drop_frame();
+            return false;
+        }
+        _encoder.configure(_config);
+        _resync = false;
+    }
+
+    const int64_t start  = _clock();
+    size_t bytes         = 0;
+    const uint8_t* frame = _encoder.encode(rgb565, width, height, bytes);
+    const int64_t end    = _clock();
+
+    if (frame == nullptr || bytes == 0) {
+        drop_frame();
+        return false;
+    }
+
+    const uint32_t encode_us = static_cast<uint32_t>(std::max<int64_t>(end - start, 0));
+    _last_encode_us.store(encode_us, std::memory_order_relaxed);
+    _total_encode_us.fetch_add(encode_us, std::memory_order_relaxed);
+    _encoded.fetch_add(1, std::memory_order_relaxed);
+    if (encode_us > _max_encode_us.load(std::memory_order_relaxed)) {
+        _max_encode_us.store(encode_us, std::memory_order_relaxed);
+    }
+    return writeAccessUnit(frame, bytes, ptsUs);
+}
+
+bool H264Recorder::writeAccessUnit(const uint8_t* annexb, size_t bytes, int64_t ptsUs)
+{
+    if (_done.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    bool key_frame = false;
+    bool queued    = false;
+    if (_container == CONTAINER_MP4) {
+        queued = _muxer.prepareSample(annexb, bytes, _sample, key_frame);
+        queued = queued && !(_wait_for_key && !key_frame) && _writer.append(_sample.data(), _sample.size());
+        if (queued) {
+            _muxer.commitSample(_sample.size(), ptsUs, key_frame);
+            bytes = _sample.size();
+        }
+    } else {
+        size_t offset = 0;
+        NalUnit_t nal;
+        while (!key_frame && next_nal_unit(annexb, bytes, offset, nal)) {
+            key_frame = nal.type() == NAL_IDR;
+        }
+        queued = !(_wait_for_key && !key_frame) && _writer.append(annexb, bytes);
+    }
+
+    if (!queued) {
+        drop_frame(key_frame);
+        return false;
+    }
+
+    _wait_for_key = false;
+    _sample_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    if (key_frame) {
+        _key_frames.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (_frames.fetch_add(1, std::memory_order_relaxed) == 0) {
+        _first_pts_us.store(ptsUs, std::memory_order_relaxed);
+    }
+    _last_pts_us.store(ptsUs, std::memory_order_relaxed);
+    return true;
+}
+
+void H264Recorder::drop_frame(bool keyFrame)
+{
+    _dropped_frames.fetch_add(1, std::memory_order_relaxed);
+
+    // The frames after a drop are dropped too while they wait for the key frame, they need not ask for another one
+    if (!_wait_for_key || keyFrame) {
+        _wait_for_key = true;
+        _resync       = true;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                    Stats                                   */
+/* -------------------------------------------------------------------------- */
+H264Recorder::Stats_t H264Recorder::stats() const
+{
+    const auto writer = _writer.stats();
+
+    Stats_t ret;
+    ret.frames          = _frames.load(std::memory_order_relaxed);
+    ret.droppedFrames   = _dropped_frames.load(std::memory_order_relaxed);
+    ret.keyFrames       = _key_frames.load(std::memory_order_relaxed);
+    ret.bytes           = writer.bytesWritten;
+    ret.lastEncodeUs    = _last_encode_us.load(std::memory_order_relaxed);
+    ret.maxEncodeUs     = _max_encode_us.load(std::memory_order_relaxed);
+    ret.queuedChunks    = writer.queuedChunks;
+    ret.maxQueuedChunks = writer.maxQueuedChunks;
+    ret.chunks          = static_cast<uint32_t>(_writer.chunkCount());
+    ret.slowestWriteUs  = writer.slowestWriteUs;
+    ret.writeErrors     = writer.writeErrors;
+
+    const uint32_t encoded = _encoded.load(std::memory_order_relaxed);
+    if (encoded > 0) {
+        ret.avgEncodeUs = static_cast<uint32_t>(_total_encode_us.load(std::memory_order_relaxed) / encoded);
+    }
+
+    // The span covers all frames but the last, scale it up so the bitrate counts every frame's bytes over its time
+    const int64_t span = _last_pts_us.load(std::memory_order_relaxed) - _first_pts_us.load(std::memory_order_relaxed);
+    if (ret.frames > 1 && span > 0) {
+        const double seconds = span / 1000000.0 * ret.frames / (ret.frames - 1);
+        ret.fps              = (ret.frames - 1) * 1000000.0f / span;
+        ret.bitrate          = static_cast<uint32_t>(_sample_bytes.load(std::memory_order_relaxed) * 8 / seconds);
+    }
+    return ret;
+}
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "h264_encoder.h"
+#include "mp4_muxer.h"
+#include "../audio/async_file_writer.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace camera {
+
+/**
+ * @brief Camera frames to an H.264 recording on the card, as MP4 or a raw Annex-B stream
+ *
+ * Same split as JpegCapture: an encode task offers frames to write(), which compresses them with the platform's
+ * encoder, muxes the access unit and queues it, a low priority writer task calls service() to get the queue onto the
+ * card. The writer's chunks are the encoder output ring, sized for a few seconds of card stall.
+ *
+ * The encode side never waits for the writer. When the ring is full the frame is dropped, and since the frames after
+ * it reference what was lost, everything up to the next IDR goes too. Once the writer has drained the ring to half
+ * its size the encoder is reconfigured, which makes its next frame an IDR, so a stall costs a gap in the recording
+ * rather than a corrupt one.
+ */
+class H264Recorder {
+public:
+    static constexpr size_t kWriterChunks = 32;  // 2 MB, about eight seconds at 2 Mbit/s
+
+    enum Container_t {
+        CONTAINER_MP4,
+        CONTAINER_ANNEX_B,
+    };
+
+    struct Stats_t {
+        uint32_t frames          = 0;  // in the file, dropped ones excluded
+        uint32_t droppedFrames   = 0;  // the encoder failed, the writer had no room, or waiting for an IDR after that
+        uint32_t keyFrames       = 0;
+        uint64_t bytes           = 0;  // on the card
+        uint32_t bitrate         = 0;  // bits per second, sustained, first to last frame in the file
+        float fps                = 0.0f;
+        uint32_t lastEncodeUs    = 0;
+        uint32_t avgEncodeUs     = 0;
+        uint32_t maxEncodeUs     = 0;
+        uint32_t queuedChunks    = 0;  // writer ring occupancy
+        uint32_t maxQueuedChunks = 0;
+        uint32_t chunks          = 0;
+        uint32_t slowestWriteUs  = 0;
+        uint32_t writeErrors     = 0;
+    };
+
+    using Clock_t = int64_t (*)();
+
+    /**
+     * @param clock microseconds, defaults to the steady clock
+     */
+    explicit H264Recorder(H264Encoder& encoder, Clock_t clock = nullptr);
+
+    /**
+     * @brief Open the file and configure the encoder
+     *
+     * @param durationMs 0 records until finish()
+     */
+    bool start(const std::string& path, Container_t container, uint16_t width, uint16_t height,
+               const H264Config_t& config, uint32_t durationMs = 0);
+
+    /**
+     * @brief Write the MP4 index, flush and close, only once both tasks have stopped calling in
+     *
+     */
+    void stop();
+
+    /**
+     * @brief End the recording, from any thread, it takes effect on the encode side
+     *
+     */
+    void finish()
+    {
+        _finish_requested.store(true, std::memory_order_relaxed);
+    }
+
+    bool isRecording() const
+    {
+        return _writer.isOpen();
+    }
+
+    /**
+     * @brief The encode side is done with the file, the writer side can stop() once it sees this
+     *
+     */
+    bool isDone() const
+    {
+        return _done.load(std::memory_order_acquire);
+    }
+
+    /* ------------------------------ Encode side ------------------------------- */
+    /**
+     * @brief Whether the next frame would be taken, also where finish() and the duration take effect
+     *
+     */
+    bool wantsFrame();
+
+    /**
+     * @brief Encode and queue one little endian RGB565 frame
+     *
+     * @param ptsUs capture time, frame durations in the file come from it
+     * @return false if the frame was not taken or dropped
+     */
+    bool write(const uint8_t* rgb565, uint16_t width, uint16_t height, int64_t ptsUs);
+
+    /**
+     * @brief Queue an already encoded Annex-B access unit, write() ends up here
+     *
+     */
+    bool writeAccessUnit(const uint8_t* annexb, size_t bytes, int64_t ptsUs);
+
+    /* ------------------------------ Writer side ------------------------------- */
+    /**
+     * @brief See AsyncFileWriter::service()
+     *
+     */
+    bool service()
+    {
+        return _writer.service();
+    }
+
+    Stats_t stats() const;
+
+private:
+    H264Encoder& _encoder;
+    Clock_t _clock;
+    audio::AsyncFileWriter _writer;
+    Mp4Muxer _muxer;
+    std::vector<uint8_t> _sample;
+
+    Container_t _container = CONTAINER_MP4;
+    H264Config_t _config;
+    int64_t _end_us    = 0;
+    bool _resync       = false;  // dropped, waiting for the writer to drain before asking for an IDR
+    bool _wait_for_key = true;
+    std::atomic<bool> _finish_requested{false};
+    std::atomic<bool> _done{true};
+
+    std::atomic<uint32_t> _frames{0};
+    std::atomic<uint32_t> _dropped_frames{0};
+    std::atomic<uint32_t> _key_frames{0};
+    std::atomic<uint64_t> _sample_bytes{0};
+    std::atomic<uint32_t> _encoded{0};
+    std::atomic<uint64_t> _total_encode_us{0};
+    std::atomic<uint32_t> _last_encode_us{0};
+    std::atomic<uint32_t> _max_encode_us{0};
+    std::atomic<int64_t> _first_pts_us{0};
+    std::atomic<int64_t> _last_pts_us{0};
+
+    void drop_frame(bool keyFrame = false);
+    void write_index();
+};
+
+}  // namespace camera
@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "jpeg_capture.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+using namespace camera;
+
+static int64_t steady_clock_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+JpegCapture::JpegCapture(JpegEncoder& encoder, Clock_t clock)
+    : _encoder(encoder), _clock(clock ? clock : steady_clock_us)
+{
+}
+
+bool JpegCapture::start(const std::string& path, Mode_t mode, uint32_t durationMs, uint32_t intervalMs)
+{
+    stop();
+
+    _frames.store(0, std::memory_order_relaxed);
+    _dropped_frames.store(0, std::memory_order_relaxed);
+    _encoded.store(0, std::memory_order_relaxed);
+    _total_encode_us.store(0, std::memory_order_relaxed);
+    _last_encode_us.store(0, std::memory_order_relaxed);
+    _max_encode_us.store(0, std::memory_order_relaxed);
+    _first_frame_us.store(0, std::memory_order_relaxed);
+    _last_frame_us.store(0, std::memory_order_relaxed);
+    _finish_requested.store(false, std::memory_order_relaxed);
+
+    if (!_writer.open(path, kWriterChunks)) {
+        return false;
+    }
+
+    const int64_t now = _clock();
+    _mode             = mode;
+    _end_us           = now + static_cast<int64_t>(durationMs) * 1000;
+    _interval_us      = static_cast<int64_t>(intervalMs) * 1000;
+    _next_frame_us    = now;
+    _done.store(false, std::memory_order_release);
+    return true;
+}
+
+void JpegCapture::stop()
+{
+    if (!_writer.isOpen()) {
+        return;
+    }
+    _writer.flush();
+    _writer.close();
+    _done.store(true, std::memory_order_release);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                 Encode side                                */
+/* -------------------------------------------------------------------------- */
+bool JpegCapture::wantsFrame()
+{
+    if (_done.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    const int64_t now = _clock();
+    if (_finish_requested.load(std::memory_order_relaxed) || (_mode == MODE_BURST && now >= _end_us)) {
+        mark_done();
+        return false;
+    }
+    return now >= _next_frame_us;
+}
+
+bool JpegCapture::write(const uint8_t* rgb565, uint16_t width, uint16_t height)
+{
+    if (!wantsFrame()) {
+        return false;
+    }
+
+    const int64_t start = _clock();
+    size_t bytes        = 0;
+    const uint8_t* jpeg = _encoder.encode(rgb565, width, height, bytes);
+    const int64_t end   = _clock();
+
+    // Never faster than the interval, but a late frame does not make the next one early
+    _next_frame_us = std::max(_next_frame_us + _interval_us, start);
+
+    bool written = false;
+    if (jpeg != nullptr && bytes > 0) {
+        const uint32_t encode_us = static_cast<uint32_t>(std::max<int64_t>(end - start, 0));
+        _last_encode_us.store(encode_us, std::memory_order_relaxed);
+        _total_encode_us.fetch_add(encode_us, std::memory_order_relaxed);
+        _encoded.fetch_add(1, std::memory_order_relaxed);
+        if (encode_us > _max_encode_us.load(std::memory_order_relaxed)) {
+            _max_encode_us.store(encode_us, std::memory_order_relaxed);
+        }
+        written = _writer.append(jpeg, bytes);
+    }
+
+    if (written) {
+        if (_frames.fetch_add(1, std::memory_order_relaxed) == 0) {
+            _first_frame_us.store(start, std::memory_order_relaxed);
+        }
+        _last_frame_us.store(start, std::memory_order_relaxed);
+    } else {
+        _dropped_frames.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // A snapshot that failed is still over, the caller sees it in the stats
+    if (_mode == MODE_SNAPSHOT) {
+        mark_done();
+    }
+    return written;
+}
+
+void JpegCapture::mark_done()
+{
+    _done.store(true, std::memory_order_release);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                    Stats                                   */
+/* -------------------------------------------------------------------------- */
+JpegCapture::Stats_t JpegCapture::stats() const
+{
+    const auto writer = _writer.stats();
+
+    Stats_t ret;
+    ret.frames         = _frames.load(std::memory_order_relaxed);
+    ret.droppedFrames  = _dropped_frames.load(std::memory_order_relaxed);
+    ret.bytes          = writer.bytesWritten;
+    ret.lastEncodeUs   = _last_encode_us.load(std::memory_order_relaxed);
+    ret.maxEncodeUs    = _max_encode_us.load(std::memory_order_relaxed);
+    ret.slowestWriteUs = writer.slowestWriteUs;
+    ret.writeErrors    = writer.writeErrors;
+
+    const uint32_t encoded = _encoded.load(std::memory_order_relaxed);
+    if (encoded > 0) {
+        ret.avgEncodeUs = static_cast<uint32_t>(_total_encode_us.load(std::memory_order_relaxed) / encoded);
+    }
+    const int64_t span =
+        _last_frame_us.load(std::memory_order_relaxed) - _first_frame_us.load(std::memory_order_relaxed);
+    if (ret.frames > 1 && span > 0) {
+        ret.fps = (ret.frames - 1) * 1000000.0f / span;
+    }
+    return ret;
+}
+
+std::string JpegCapture::next_free_path(const std::string& dir, const char* prefix, const char* extension)
+{
+    char name[48];
+    for (int i = 1; i < 10000; i++) {
+        snprintf(name, sizeof(name), "%s%04d.%s", prefix, i, extension);
+        std::string path = dir + "/" + name;
+        FILE* probe      = fopen(path.c_str(), "rb");
+        if (probe == nullptr) {
+            return path;
+        }
+        fclose(probe);
+    }
+    return dir + "/" + prefix + "overflow." + extension;
+}
@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "jpeg_encoder.h"
+#include "../audio/async_file_writer.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace camera {
+
+/**
+ * @brief Camera frames to a jpeg snapshot or a timed mjpeg burst on the card
+ *
+ * Same split as the audio StreamRecorder, the platform owns the tasks: an encode task offers frames to write(), which
+ * compresses them with the platform's encoder and queues the result, a low priority writer task calls service() to
+ * get them onto the card. A burst is the frames back to back, which is what most players expect of a .mjpeg file.
+ */
+class JpegCapture {
+public:
+    static constexpr size_t kWriterChunks = 16;  // about 1 MB, a card stall of several frames before one is dropped
+
+    enum Mode_t {
+        MODE_SNAPSHOT,
+        MODE_BURST,
+    };
+
+    struct Stats_t {
+        uint32_t frames         = 0;  // in the file, dropped ones excluded
+        uint32_t droppedFrames  = 0;  // the encoder failed or the writer had no room
+        uint64_t bytes          = 0;
+        uint32_t lastEncodeUs   = 0;
+        uint32_t avgEncodeUs    = 0;
+        uint32_t maxEncodeUs    = 0;
+        float fps               = 0.0f;  // sustained, first to last frame in the file
+        uint32_t slowestWriteUs = 0;
+        uint32_t writeErrors    = 0;
+    };
+
+    using Clock_t = int64_t (*)();
+
+    /**
+     * @param clock microseconds, defaults to the steady clock
+     */
+    explicit JpegCapture(JpegEncoder& encoder, Clock_t clock = nullptr);
+
+    /**
+     * @brief Open the file, a snapshot takes the next frame, a burst runs for durationMs
+     *
+     * @param intervalMs minimum spacing of burst frames, 0 takes every frame the encoder keeps up with
+     */
+    bool start(const std::string& path, Mode_t mode, uint32_t durationMs = 0, uint32_t intervalMs = 0);
+
+    /**
+     * @brief Flush and close, only once both tasks have stopped calling in
+     *
+     */
+    void stop();
+
+    /**
+     * @brief End a burst early, from any thread, it takes effect on the encode side
+     *
+     */
+    void finish()
+    {
+        _finish_requested.store(true, std::memory_order_relaxed);
+    }
+
+    bool isCapturing() const
+    {
+        return _writer.isOpen();
+    }
+
+    /**
+     * @brief The encode side is done with the file, the writer side can stop() once it sees this
+     *
+     */
+    bool isDone() const
+    {
+        return _done.load(std::memory_order_acquire);
+    }
+
+    /* ------------------------------ Encode side ------------------------------- */
+    /**
+     * @brief Whether the next frame would be taken, also where the end of a burst takes effect
+     *
+     * Call it regularly even without frames, so a burst still ends if the camera stops.
+     */
+    bool wantsFrame();
+
+    /**
+     * @brief Encode and queue one little endian RGB565 frame
+     *
+     * @return false if the frame was not taken or dropped
+     */
+    bool write(const uint8_t* rgb565, uint16_t width, uint16_t height);
+
+    /* ------------------------------ Writer side ------------------------------- */
+    /**
+     * @brief See AsyncFileWriter::service()
+     *
+     */
+    bool service()
+    {
+        return _writer.service();
+    }
+
+    Stats_t stats() const;
+
+    /**
+     * @brief First <dir>/<prefix>NNNN.<extension> that does not exist yet
+     *
+     */
+    static std::string next_free_path(const std::string& dir, const char* prefix, const char* extension);
+
+private:
+    JpegEncoder& _encoder;
+    Clock_t _clock;
+    audio::AsyncFileWriter _writer;
+
+    Mode_t _mode           = MODE_SNAPSHOT;
+    int64_t _end_us        = 0;
+    int64_t _interval_us   = 0;
+    int64_t _next_frame_us = 0;
+    std::atomic<bool> _finish_requested{false};
+    std::atomic<bool> _done{true};
+
+    std::atomic<uint32_t> _frames{0};
+    std::atomic<uint32_t> _dropped_frames{0};
+    std::atomic<uint32_t> _encoded{0};
+    std::atomic<uint64_t> _total_encode_us{0};
+    std::atomic<uint32_t> _last_encode_us{0};
+    std::atomic<uint32_t> _max_encode_us{0};
+    std::atomic<int64_t> _first_frame_us{0};
+    std::atomic<int64_t> _last_frame_us{0};
+
+    void mark_done();
+};
+
+}  // namespace camera
@@ -0,0 +1,307 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "jpeg_encoder.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace camera;
+
+/* -------------------------------------------------------------------------- */
+/*                               Standard tables                              */
+/* -------------------------------------------------------------------------- */
+static const uint8_t _zigzag[64] = {0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,
+                                    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6,  7,  14, 21, 28,
+                                    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+                                    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+
+static const uint8_t _base_quant[2][64] = {
+    {16, 11, 10, 16, 24,  40,  51,  61,  12, 12, 14, 19, 26,  58,  60,  55,  14, 13, 16, 24, 40,  57,
+     69, 56, 14, 17, 22, 29,  51,  87,  80, 62, 18, 22, 37, 56, 68,  109, 103, 77, 24, 35, 55, 64,
+     81, 104, 113, 92, 49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99},
+    {17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99, 24, 26, 56, 99, 99, 99,
+     99, 99, 47, 66, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+     99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99}};
+
+static const uint8_t _dc_bits[2][16] = {{0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0},
+                                        {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0}};
+static const uint8_t _dc_values[12]  = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+static const uint8_t _ac_bits[2][16] = {{0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d},
+                                        {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77}};
+static const uint8_t _ac_values[2][162] = {
+    {0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71,
+     0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72,
+     0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37,
+     0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+     0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83,
+     0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3,
+     0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+     0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+     0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa},
+    {0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22,
+     0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1,
+     0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36,
+     0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+     0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+     0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a,
+     0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba,
+     0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+     0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa}};
+
+// AAN row / column scale factors
+static const float _aan_scale[8] = {1.0f, 1.387039845f, 1.306562965f, 1.175875602f,
+                                    1.0f, 0.785694958f, 0.541196100f, 0.275899379f};
+
+template <size_t N>
+static void build_codes(const uint8_t* bits, const uint8_t (&values)[N], uint16_t* codes, uint8_t* sizes)
+{
+    uint16_t code = 0;
+    size_t k      = 0;
+    for (int length = 1; length <= 16; length++) {
+        for (int i = 0; i < bits[length - 1]; i++, k++) {
+            codes[values[k]] = code++;
+            sizes[values[k]] = length;
+        }
+        code <<= 1;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   Encoder                                  */
+/* -------------------------------------------------------------------------- */
+SoftJpegEncoder::SoftJpegEncoder(int quality)
+{
+    // IJG quality scaling
+    quality           = std::clamp(quality, 1, 100);
+    const int percent = quality < 50 ? 5000 / quality : 200 - quality * 2;
+    for (int t = 0; t < 2; t++) {
+        for (int i = 0; i < 64; i++) {
+            _quant[t][i]    = std::clamp((_base_quant[t][i] * percent + 50) / 100, 1, 255);
+            _divisors[t][i] = 1.0f / (_quant[t][i] * _aan_scale[i / 8] * _aan_scale[i % 8] * 8.0f);
+        }
+    }
+
+    for (int t = 0; t < 2; t++) {
+        uint16_t codes[256] = {};
+        uint8_t sizes[256]  = {};
+        build_codes(_dc_bits[t], _dc_values, codes, sizes);
+        for (int i = 0; i < 12; i++) {
+            _dc_codes[t][i] = {codes[i], sizes[i]};
+        }
+        build_codes(_ac_bits[t], _ac_values[t], codes, sizes);
+        for (int i = 0; i < 256; i++) {
+            _ac_codes[t][i] = {codes[i], sizes[i]};
+        }
+    }
+}
+
+const uint8_t* SoftJpegEncoder::encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes)
+{
+    if (rgb565 == nullptr || width == 0 || height == 0) {
+        return nullptr;
+    }
+
+    _out.clear();
+    _out.reserve(static_cast<size_t>(width) * height / 2);
+    _bit_buffer = 0;
+    _bit_count  = 0;
+    write_headers(width, height);
+
+    const uint16_t* pixels = reinterpret_cast<const uint16_t*>(rgb565);
+    int dc[3]              = {0, 0, 0};
+    float y[4][64];
+    float cb[64];
+    float cr[64];
+
+    // 16x16 MCUs, four luma blocks and one block of each chroma averaged over 2x2, edges repeat the last pixel
+    for (int mcu_y = 0; mcu_y < height; mcu_y += 16) {
+        for (int mcu_x = 0; mcu_x < width; mcu_x += 16) {
+            std::fill(cb, cb + 64, 0.0f);
+            std::fill(cr, cr + 64, 0.0f);
+            for (int row = 0; row < 16; row++) {
+                const int py = std::min(mcu_y + row, height - 1);
+                for (int col = 0; col < 16; col++) {
+                    const int px     = std::min(mcu_x + col, width - 1);
+                    const uint16_t p = pixels[py * width + px];
+                    const float r    = ((p >> 11) & 0x1f) * (255.0f / 31.0f);
+                    const float g    = ((p >> 5) & 0x3f) * (255.0f / 63.0f);
+                    const float b    = (p & 0x1f) * (255.0f / 31.0f);
+
+                    y[(row / 8) * 2 + col / 8][(row % 8) * 8 + col % 8] = 0.299f * r + 0.587f * g + 0.114f * b - 128.0f;
+                    const int c = (row / 2) * 8 + col / 2;
+                    cb[c] += 0.25f * (-0.168736f * r - 0.331264f * g + 0.5f * b);
+                    cr[c] += 0.25f * (0.5f * r - 0.418688f * g - 0.081312f * b);
+                }
+            }
+            for (auto& block : y) {
+                encode_block(block, 0, dc[0]);
+            }
+            encode_block(cb, 1, dc[1]);
+            encode_block(cr, 1, dc[2]);
+        }
+    }
+
+    flush_bits();
+    _out.push_back(0xff);
+    _out.push_back(0xd9);
+    bytes = _out.size();
+    return _out.data();
+}
+
+void SoftJpegEncoder::write_headers(uint16_t width, uint16_t height)
+{
+    static const uint8_t jfif[] = {0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 'J', 'F', 'I', 'F', 0x00,
+                                   0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00};
+    _out.insert(_out.end(), jfif, jfif + sizeof(jfif));
+
+    // Quant tables go out in zigzag order
+    const uint8_t dqt[] = {0xff, 0xdb, 0x00, 0x84};
+    _out.insert(_out.end(), dqt, dqt + sizeof(dqt));
+    for (int t = 0; t < 2; t++) {
+        _out.push_back(t);
+        for (int k = 0; k < 64; k++) {
+            _out.push_back(_quant[t][_zigzag[k]]);
+        }
+    }
+
+    // Y at 2x2, Cb and Cr at 1x1
+    const uint8_t sof[] = {0xff, 0xc0, 0x00, 0x11, 0x08, static_cast<uint8_t>(height >> 8),
+                           static_cast<uint8_t>(height), static_cast<uint8_t>(width >> 8), static_cast<uint8_t>(width),
+                           0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01};
+    _out.insert(_out.end(), sof, sof + sizeof(sof));
+
+    const uint8_t dht[] = {0xff, 0xc4, 0x01, 0xa2};
+    _out.insert(_out.end(), dht, dht + sizeof(dht));
+    for (int t = 0; t < 2; t++) {
+        _out.push_back(0x00 | t);
+        _out.insert(_out.end(), _dc_bits[t], _dc_bits[t] + 16);
+        _out.insert(_out.end(), _dc_values, _dc_values + 12);
+        _out.push_back(0x10 | t);
+        _out.insert(_out.end(), _ac_bits[t], _ac_bits[t] + 16);
+        _out.insert(_out.end(), _ac_values[t], _ac_values[t] + 162);
+    }
+
+    const uint8_t sos[] = {0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00};
+    _out.insert(_out.end(), sos, sos + sizeof(sos));
+}
+
+void SoftJpegEncoder::write_bits(uint32_t bits, int count)
+{
+    _bit_buffer = (_bit_buffer << count) | (bits & ((1u << count) - 1));
+    _bit_count += count;
+    while (_bit_count >= 8) {
+        const uint8_t byte = static_cast<uint8_t>(_bit_buffer >> (_bit_count - 8));
+        _out.push_back(byte);
+        if (byte == 0xff) {
+            _out.push_back(0x00);  // stuffing, a marker never appears in the entropy coded data
+        }
+        _bit_count -= 8;
+    }
+}
+
+void SoftJpegEncoder::flush_bits()
+{
+    if (_bit_count > 0) {
+        write_bits(0x7f, 8 - _bit_count);  // pad with ones
+    }
+}
+
+static inline void fdct_1d(float* d, int stride)
+{
+    const float tmp0 = d[0] + d[7 * stride];
+    const float tmp7 = d[0] - d[7 * stride];
+    const float tmp1 = d[stride] + d[6 * stride];
+    const float tmp6 = d[stride] - d[6 * stride];
+    const float tmp2 = d[2 * stride] + d[5 * stride];
+    const float tmp5 = d[2 * stride] - d[5 * stride];
+    const float tmp3 = d[3 * stride] + d[4 * stride];
+    const float tmp4 = d[3 * stride] - d[4 * stride];
+
+    // Even part
+    float tmp10    = tmp0 + tmp3;
+    float tmp13    = tmp0 - tmp3;
+    float tmp11    = tmp1 + tmp2;
+    float tmp12    = tmp1 - tmp2;
+    d[0]           = tmp10 + tmp11;
+    d[4 * stride]  = tmp10 - tmp11;
+    const float z1 = (tmp12 + tmp13) * 0.707106781f;
+    d[2 * stride]  = tmp13 + z1;
+    d[6 * stride]  = tmp13 - z1;
+
+    // Odd part
+    tmp10           = tmp4 + tmp5;
+    tmp11           = tmp5 + tmp6;
+    tmp12           = tmp6 + tmp7;
+    const float z5  = (tmp10 - tmp12) * 0.382683433f;
+    const float z2  = tmp10 * 0.541196100f + z5;
+    const float z4  = tmp12 * 1.306562965f + z5;
+    const float z3  = tmp11 * 0.707106781f;
+    const float z11 = tmp7 + z3;
+    const float z13 = tmp7 - z3;
+    d[5 * stride]   = z13 + z2;
+    d[3 * stride]   = z13 - z2;
+    d[stride]       = z11 + z4;
+    d[7 * stride]   = z11 - z4;
+}
+
+void SoftJpegEncoder::encode_block(float* block, int table, int& previousDc)
+{
+    for (int i = 0; i < 8; i++) {
+        fdct_1d(block + i * 8, 1);
+    }
+    for (int i = 0; i < 8; i++) {
+        fdct_1d(block + i, 8);
+    }
+
+    int coefficients[64];
+    for (int k = 0; k < 64; k++) {
+        const int i     = _zigzag[k];
+        coefficients[k] = static_cast<int>(std::lround(block[i] * _divisors[table][i]));
+    }
+
+    // Magnitude category and the bits that follow its code, negative values go out as one's complement
+    auto category = [](int value, uint32_t& bits) {
+        const int magnitude = value < 0 ? -value : value;
+        int size            = 0;
+        while ((magnitude >> size) != 0) {
+            size++;
+        }
+        bits = value < 0 ? static_cast<uint32_t>(value - 1) : static_cast<uint32_t>(value);
+        return size;
+    };
+
+    uint32_t bits;
+    const int dc_size = category(coefficients[0] - previousDc, bits);
+    previousDc        = coefficients[0];
+    write_bits(_dc_codes[table][dc_size].code, _dc_codes[table][dc_size].size);
+    if (dc_size > 0) {
+        write_bits(bits, dc_size);
+    }
+
+    int last = 63;
+    while (last > 0 && coefficients[last] == 0) {
+        last--;
+    }
+    int run = 0;
+    for (int k = 1; k <= last; k++) {
+        if (coefficients[k] == 0) {
+            run++;
+            continue;
+        }
+        while (run >= 16) {
+            write_bits(_ac_codes[table][0xf0].code, _ac_codes[table][0xf0].size);
+            run -= 16;
+        }
+        const int size       = category(coefficients[k], bits);
+        const uint8_t symbol = static_cast<uint8_t>((run << 4) | size);
+        write_bits(_ac_codes[table][symbol].code, _ac_codes[table][symbol].size);
+        write_bits(bits, size);
+        run = 0;
+    }
+    if (last < 63) {
+        write_bits(_ac_codes[table][0x00].code, _ac_codes[table][0x00].size);
+    }
+}
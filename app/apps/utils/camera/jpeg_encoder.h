@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace camera {
+
+/**
+ * @brief Compresses RGB565 frames to JFIF, the platform plugs in its hardware encoder
+ *
+ */
+class JpegEncoder {
+public:
+    virtual ~JpegEncoder() = default;
+
+    /**
+     * @brief Compress one little endian RGB565 frame
+     *
+     * @return the JFIF bytes, valid until the next call, nullptr on failure
+     */
+    virtual const uint8_t* encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes) = 0;
+};
+
+/**
+ * @brief Baseline 4:2:0 encoder with the standard tables
+ *
+ * Stands in for the hardware encoder on hosts, fast enough for previews and tests rather than a production codec.
+ */
+class SoftJpegEncoder : public JpegEncoder {
+public:
+    explicit SoftJpegEncoder(int quality = 80);
+
+    const uint8_t* encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes) override;
+
+private:
+    struct HuffmanCode_t {
+        uint16_t code = 0;
+        uint8_t size  = 0;
+    };
+
+    uint8_t _quant[2][64];    // natural order
+    float _divisors[2][64];   // quant tables folded with the AAN scale factors
+    HuffmanCode_t _dc_codes[2][12];
+    HuffmanCode_t _ac_codes[2][256];
+
+    std::vector<uint8_t> _out;
+    uint32_t _bit_buffer = 0;
+    int _bit_count       = 0;
+
+    void write_headers(uint16_t width, uint16_t height);
+    void write_bits(uint32_t bits, int count);
+    void flush_bits();
+    void encode_block(float* block, int table, int& previousDc);
+};
+
+}  // namespace camera
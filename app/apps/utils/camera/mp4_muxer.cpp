@@ -0,0 +1,369 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "mp4_muxer.h"
+#include "h264_encoder.h"
+#include <algorithm>
+
+using namespace camera;
+
+namespace {
+
+class BoxWriter {
+public:
+    explicit BoxWriter(std::vector<uint8_t>& out) : _out(out)
+    {
+    }
+
+    void u8(uint8_t value)
+    {
+        _out.push_back(value);
+    }
+    void u16(uint16_t value)
+    {
+        u8(value >> 8);
+        u8(value);
+    }
+    void u32(uint32_t value)
+    {
+        u16(value >> 16);
+        u16(value);
+    }
+    void u64(uint64_t value)
+    {
+        u32(value >> 32);
+        u32(value);
+    }
+    void zeros(size_t count)
+    {
+        _out.insert(_out.end(), count, 0);
+    }
+    void bytes(const std::vector<uint8_t>& data)
+    {
+        _out.insert(_out.end(), data.begin(), data.end());
+    }
+    void fourcc(const char* type)
+    {
+        _out.insert(_out.end(), type, type + 4);
+    }
+
+    // Open a box, end() patches in its size
+    size_t begin(const char* type)
+    {
+        const size_t start = _out.size();
+        u32(0);
+        fourcc(type);
+        return start;
+    }
+    size_t beginFull(const char* type, uint8_t version = 0, uint32_t flags = 0)
+    {
+        const size_t start = begin(type);
+        u32(static_cast<uint32_t>(version) << 24 | flags);
+        return start;
+    }
+    void end(size_t start)
+    {
+        const uint32_t size = static_cast<uint32_t>(_out.size() - start);
+        for (int i = 0; i < 4; i++) {
+            _out[start + i] = size >> (24 - i * 8);
+        }
+    }
+
+    // Identity, 16.16 and 2.30 fixed point
+    void matrix()
+    {
+        static const uint32_t identity[9] = {0x10000, 0, 0, 0, 0x10000, 0, 0, 0, 0x40000000};
+        for (uint32_t value : identity) {
+            u32(value);
+        }
+    }
+
+private:
+    std::vector<uint8_t>& _out;
+};
+
+}  // namespace
+
+void Mp4Muxer::begin(uint16_t width, uint16_t height, std::vector<uint8_t>& out)
+{
+    _width  = width;
+    _height = height;
+    _sps.clear();
+    _pps.clear();
+    _sizes.clear();
+    _durations.clear();
+    _sync_samples.clear();
+
+    out.clear();
+    BoxWriter box(out);
+
+    const size_t ftyp = box.begin("ftyp");
+    box.fourcc("isom");
+    box.u32(0x200);
+    box.fourcc("isom");
+    box.fourcc("iso2");
+    box.fourcc("avc1");
+    box.fourcc("mp41");
+    box.end(ftyp);
+
+    // 64 bit size from the start, so a long recording never has to move its samples
+    _mdat_offset = out.size();
+    box.u32(1);
+    box.fourcc("mdat");
+    box.u64(0);
+    _mdat_bytes = out.size() - _mdat_offset;
+}
+
+bool Mp4Muxer::prepareSample(const uint8_t* annexb, size_t bytes, std::vector<uint8_t>& sample, bool& keyFrame)
+{
+    sample.clear();
+    keyFrame       = false;
+    bool has_slice = false;
+    size_t offset  = 0;
+    NalUnit_t nal;
+    while (next_nal_unit(annexb, bytes, offset, nal)) {
+        switch (nal.type()) {
+            case NAL_SPS:
+                _sps.assign(nal.data, nal.data + nal.bytes);
+                continue;
+            case NAL_PPS:
+                _pps.assign(nal.data, nal.data + nal.bytes);
+                continue;
+            case NAL_AUD:
+            case 12:  // filler
+                continue;
+            case NAL_IDR:
+                keyFrame  = true;
+                has_slice = true;
+                break;
+            case NAL_SLICE:
+                has_slice = true;
+                break;
+            default:
+                break;
+        }
+
+        const uint32_t length   = static_cast<uint32_t>(nal.bytes);
+        const uint8_t prefix[4] = {static_cast<uint8_t>(length >> 24), static_cast<uint8_t>(length >> 16),
+                                   static_cast<uint8_t>(length >> 8), static_cast<uint8_t>(length)};
+        sample.insert(sample.end(), prefix, prefix + 4);
+        sample.insert(sample.end(), nal.data, nal.data + nal.bytes);
+    }
+
+    // The avcC needs the first SPS, and the stream has to open on a sync sample
+    if (_sizes.empty() && (!keyFrame || _sps.size() < 4 || _pps.empty())) {
+        return false;
+    }
+    return has_slice;
+}
+
+void Mp4Muxer::commitSample(size_t bytes, int64_t ptsUs, bool keyFrame)
+{
+    // From the first sample's time rather than the previous one's, so the rounding does not add up over an hour
+    if (_sizes.empty()) {
+        _first_pts_us = ptsUs;
+        _last_ticks   = 0;
+    } else {
+        const int64_t ticks = ((ptsUs - _first_pts_us) * kTimescale + 500000) / 1000000;
+        _durations.push_back(static_cast<uint32_t>(std::max<int64_t>(ticks - _last_ticks, 1)));
+        _last_ticks = std::max(ticks, _last_ticks + 1);
+    }
+
+    _sizes.push_back(static_cast<uint32_t>(bytes));
+    if (keyFrame) {
+        _sync_samples.push_back(static_cast<uint32_t>(_sizes.size()));
+    }
+    _mdat_bytes += bytes;
+}
+
+void Mp4Muxer::mdatSize(uint8_t out[8]) const
+{
+    for (int i = 0; i < 8; i++) {
+        out[i] = static_cast<uint8_t>(_mdat_bytes >> (56 - i * 8));
+    }
+}
+
+void Mp4Muxer::finish(std::vector<uint8_t>& out)
+{
+    out.clear();
+    BoxWriter box(out);
+
+    // The last sample lasts as long as the one before it, or a 30 fps frame
+    const uint32_t last_duration = _durations.empty() ? kTimescale / 30 : _durations.back();
+    uint64_t duration            = _sizes.empty() ? 0 : last_duration;
+    for (uint32_t delta : _durations) {
+        duration += delta;
+    }
+    const uint64_t movie_duration = duration * 1000 / kTimescale;
+
+    const size_t moov = box.begin("moov");
+
+    const size_t mvhd = box.beginFull("mvhd");
+    box.u32(0);  // creation_time
+    box.u32(0);  // modification_time
+    box.u32(1000);
+    box.u32(static_cast<uint32_t>(movie_duration));
+    box.u32(0x10000);  // rate
+    box.u16(0x100);    // volume
+    box.zeros(10);
+    box.matrix();
+    box.zeros(24);
+    box.u32(2);  // next_track_ID
+    box.end(mvhd);
+
+    const size_t trak = box.begin("trak");
+
+    const size_t tkhd = box.beginFull("tkhd", 0, 0x3);  // enabled, in movie
+    box.u32(0);
+    box.u32(0);
+    box.u32(1);  // track_ID
+    box.u32(0);
+    box.u32(static_cast<uint32_t>(movie_duration));
+    box.zeros(8);
+    box.u16(0);  // layer
+    box.u16(0);  // alternate_group
+    box.u16(0);  // volume
+    box.u16(0);
+    box.matrix();
+    box.u32(static_cast<uint32_t>(_width) << 16);
+    box.u32(static_cast<uint32_t>(_height) << 16);
+    box.end(tkhd);
+
+    const size_t mdia = box.begin("mdia");
+
+    const size_t mdhd = box.beginFull("mdhd");
+    box.u32(0);
+    box.u32(0);
+    box.u32(kTimescale);
+    box.u32(static_cast<uint32_t>(duration));
+    box.u16(0x55c4);  // "und"
+    box.u16(0);
+    box.end(mdhd);
+
+    const size_t hdlr = box.beginFull("hdlr");
+    box.u32(0);
+    box.fourcc("vide");
+    box.zeros(12);
+    box.bytes({'V', 'i', 'd', 'e', 'o', 'H', 'a', 'n', 'd', 'l', 'e', 'r', 0});
+    box.end(hdlr);
+
+    const size_t minf = box.begin("minf");
+
+    const size_t vmhd = box.beginFull("vmhd", 0, 1);
+    box.zeros(8);
+    box.end(vmhd);
+
+    const size_t dinf = box.begin("dinf");
+    const size_t dref = box.beginFull("dref");
+    box.u32(1);
+    const size_t url = box.beginFull("url ", 0, 1);  // samples are in this file
+    box.end(url);
+    box.end(dref);
+    box.end(dinf);
+
+    const size_t stbl = box.begin("stbl");
+
+    const size_t stsd = box.beginFull("stsd");
+    box.u32(1);
+    const size_t avc1 = box.begin("avc1");
+    box.zeros(6);
+    box.u16(1);  // data_reference_index
+    box.zeros(16);
+    box.u16(_width);
+    box.u16(_height);
+    box.u32(0x480000);  // 72 dpi
+    box.u32(0x480000);
+    box.u32(0);
+    box.u16(1);  // frame_count
+    box.zeros(32);
+    box.u16(0x18);  // depth
+    box.u16(0xffff);
+    const size_t avcc = box.begin("avcC");
+    box.u8(1);
+    box.u8(_sps.size() > 3 ? _sps[1] : 66);
+    box.u8(_sps.size() > 3 ? _sps[2] : 0);
+    box.u8(_sps.size() > 3 ? _sps[3] : 31);
+    box.u8(0xff);  // four byte lengths
+    box.u8(0xe0 | (_sps.empty() ? 0 : 1));
+    if (!_sps.empty()) {
+        box.u16(static_cast<uint16_t>(_sps.size()));
+        box.bytes(_sps);
+    }
+    box.u8(_pps.empty() ? 0 : 1);
+    if (!_pps.empty()) {
+        box.u16(static_cast<uint16_t>(_pps.size()));
+        box.bytes(_pps);
+    }
+    box.end(avcc);
+    box.end(avc1);
+    box.end(stsd);
+
+    // Decode time to sample, run length coded
+    std::vector<uint32_t> runs;
+    for (size_t i = 0; i < _sizes.size(); i++) {
+        const uint32_t delta = i < _durations.size() ? _durations[i] : last_duration;
+        if (!runs.empty() && runs.back() == delta) {
+            runs[runs.size() - 2]++;
+        } else {
+            runs.push_back(1);
+            runs.push_back(delta);
+        }
+    }
+    const size_t stts = box.beginFull("stts");
+    box.u32(static_cast<uint32_t>(runs.size() / 2));
+    for (uint32_t value : runs) {
+        box.u32(value);
+    }
+    box.end(stts);
+
+    // Without an stss every sample is a sync sample
+    if (_sync_samples.size() != _sizes.size()) {
+        const size_t stss = box.beginFull("stss");
+        box.u32(static_cast<uint32_t>(_sync_samples.size()));
+        for (uint32_t sample : _sync_samples) {
+            box.u32(sample);
+        }
+        box.end(stss);
+    }
+
+    // One sample per chunk, so the chunk offsets are the sample offsets
+    const size_t stsc = box.beginFull("stsc");
+    box.u32(_sizes.empty() ? 0 : 1);
+    if (!_sizes.empty()) {
+        box.u32(1);
+        box.u32(1);
+        box.u32(1);
+    }
+    box.end(stsc);
+
+    const size_t stsz = box.beginFull("stsz");
+    box.u32(0);
+    box.u32(static_cast<uint32_t>(_sizes.size()));
+    for (uint32_t size : _sizes) {
+        box.u32(size);
+    }
+    box.end(stsz);
+
+    const uint64_t data_start = _mdat_offset + 16;
+    const bool large          = _mdat_offset + _mdat_bytes > UINT32_MAX;
+    const size_t stco         = box.beginFull(large ? "co64" : "stco");
+    box.u32(static_cast<uint32_t>(_sizes.size()));
+    uint64_t offset = data_start;
+    for (uint32_t size : _sizes) {
+        if (large) {
+            box.u64(offset);
+        } else {
+            box.u32(static_cast<uint32_t>(offset));
+        }
+        offset += size;
+    }
+    box.end(stco);
+
+    box.end(stbl);
+    box.end(minf);
+    box.end(mdia);
+    box.end(trak);
+    box.end(moov);
+}
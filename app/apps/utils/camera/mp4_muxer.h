@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace camera {
+
+/**
+ * @brief Lays out a single H.264 track MP4, without doing any I/O itself
+ *
+ * The file is written front to back: begin() gives the ftyp and an mdat header whose size is not known yet, samples
+ * follow as they come, and finish() gives the moov to append plus the mdat size to patch in. The sample tables stay
+ * in memory at eight bytes a frame, about 860 KB for an hour at 30 fps. Until finish() the file is not playable, so a
+ * recording cut short by power loss keeps its samples but needs its index rebuilt.
+ */
+class Mp4Muxer {
+public:
+    static constexpr uint32_t kTimescale = 90000;
+
+    /**
+     * @brief Start a file, replaces the bytes in out with its head
+     *
+     */
+    void begin(uint16_t width, uint16_t height, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Rewrite an Annex-B access unit as a length prefixed sample
+     *
+     * Parameter sets are kept for the avcC instead, delimiters and filler are dropped.
+     * @return false if there is no slice in it, or it cannot be decoded yet because no SPS and PPS came before it
+     */
+    bool prepareSample(const uint8_t* annexb, size_t bytes, std::vector<uint8_t>& sample, bool& keyFrame);
+
+    /**
+     * @brief Index a prepared sample once it is in the file
+     *
+     * @param ptsUs capture time, only differences matter
+     */
+    void commitSample(size_t bytes, int64_t ptsUs, bool keyFrame);
+
+    /**
+     * @brief Build the moov, replaces the bytes in out
+     *
+     */
+    void finish(std::vector<uint8_t>& out);
+
+    /**
+     * @brief Where the mdat size goes and what to write there, big endian
+     *
+     */
+    uint64_t mdatSizeOffset() const
+    {
+        return _mdat_offset + 8;
+    }
+    void mdatSize(uint8_t out[8]) const;
+
+    uint32_t sampleCount() const
+    {
+        return static_cast<uint32_t>(_sizes.size());
+    }
+
+private:
+    uint16_t _width       = 0;
+    uint16_t _height      = 0;
+    uint64_t _mdat_offset = 0;
+    uint64_t _mdat_bytes  = 0;  // header included
+    int64_t _first_pts_us = 0;
+    int64_t _last_ticks   = 0;  // end of the last complete duration
+
+    std::vector<uint8_t> _sps;
+    std::vector<uint8_t> _pps;
+    std::vector<uint32_t> _sizes;
+    std::vector<uint32_t> _durations;  // of all but the last sample, in kTimescale
+    std::vector<uint32_t> _sync_samples;
+};
+
+}  // namespace camera
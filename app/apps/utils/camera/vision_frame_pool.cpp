@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "vision_frame_pool.h"
+#include <algorithm>
+#include <chrono>
+
+using namespace camera;
+
+bool VisionFramePool::configure(const Config_t& config)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < kMaxSlots; i++) {
+        if (_slots[i].state == SLOT_WRITING || _slots[i].state == SLOT_READING) {
+            return false;
+        }
+    }
+
+    _config           = config;
+    _config.slotCount = std::min(std::max<size_t>(_config.slotCount, 1), kMaxSlots);
+    for (size_t i = 0; i < kMaxSlots; i++) {
+        _slots[i].state = SLOT_FREE;
+    }
+    return true;
+}
+
+void VisionFramePool::setBuffer(uint32_t slot, uint8_t* data, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (slot < kMaxSlots) {
+        _slots[slot].data  = data;
+        _slots[slot].bytes = bytes;
+    }
+}
+
+void VisionFramePool::fill_frame_locked(uint32_t slot, Frame_t& frame) const
+{
+    frame.slot      = slot;
+    frame.data      = _slots[slot].data;
+    frame.width     = _config.width;
+    frame.height    = _config.height;
+    frame.format    = _config.format;
+    frame.sequence  = _slots[slot].sequence;
+    frame.captureUs = _slots[slot].captureUs;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Producer                                  */
+/* -------------------------------------------------------------------------- */
+bool VisionFramePool::acquireWrite(Frame_t& frame)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t bytes = image_bytes(_config.width, _config.height, _config.format);
+
+    // Publishing retires the older frame, so at most one is ever waiting to be given up here
+    int slot = -1;
+    for (size_t i = 0; i < _config.slotCount; i++) {
+        if (_slots[i].data == nullptr || _slots[i].bytes < bytes) {
+            continue;
+        }
+        if (_slots[i].state == SLOT_FREE) {
+            slot = i;
+            break;
+        }
+        if (_slots[i].state == SLOT_READY) {
+            slot = i;
+        }
+    }
+    if (slot < 0) {
+        _stats.skipped++;
+        return false;
+    }
+    if (_slots[slot].state == SLOT_READY) {
+        _stats.superseded++;
+    }
+
+    _slots[slot].state = SLOT_WRITING;
+    fill_frame_locked(slot, frame);
+    return true;
+}
+
+void VisionFramePool::publish(const Frame_t& frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (frame.slot >= kMaxSlots || _slots[frame.slot].state != SLOT_WRITING) {
+            return;
+        }
+        for (size_t i = 0; i < kMaxSlots; i++) {
+            if (_slots[i].state == SLOT_READY) {
+                _slots[i].state = SLOT_FREE;
+                _stats.superseded++;
+            }
+        }
+
+        Slot_t& slot   = _slots[frame.slot];
+        slot.state     = SLOT_READY;
+        slot.sequence  = frame.sequence;
+        slot.captureUs = frame.captureUs;
+        _stats.published++;
+    }
+    _ready_cv.notify_one();
+}
+
+void VisionFramePool::cancel(const Frame_t& frame)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (frame.slot < kMaxSlots && _slots[frame.slot].state == SLOT_WRITING) {
+        _slots[frame.slot].state = SLOT_FREE;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Consumer                                  */
+/* -------------------------------------------------------------------------- */
+bool VisionFramePool::acquire(Frame_t& frame, uint32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    int slot        = -1;
+    auto find_ready = [&]() {
+        for (size_t i = 0; i < kMaxSlots; i++) {
+            if (_slots[i].state == SLOT_READY) {
+                slot = i;
+                return true;
+            }
+        }
+        return false;
+    };
+    if (!find_ready() &&
+        (timeoutMs == 0 || !_ready_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), find_ready))) {
+        return false;
+    }
+
+    _slots[slot].state = SLOT_READING;
+    _stats.consumed++;
+    fill_frame_locked(slot, frame);
+    return true;
+}
+
+void VisionFramePool::release(const Frame_t& frame)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (frame.slot < kMaxSlots && _slots[frame.slot].state == SLOT_READING) {
+        _slots[frame.slot].state = SLOT_FREE;
+    }
+}
+
+void VisionFramePool::flush()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < kMaxSlots; i++) {
+        if (_slots[i].state == SLOT_READY) {
+            _slots[i].state = SLOT_FREE;
+            _stats.superseded++;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                    Stats                                   */
+/* -------------------------------------------------------------------------- */
+VisionFramePool::Stats_t VisionFramePool::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+void VisionFramePool::resetStats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stats = Stats_t();
+}
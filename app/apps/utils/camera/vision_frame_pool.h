@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "frame_scaler.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace camera {
+
+/**
+ * @brief Small analysis frames between the camera side that fills them and the one consumer that reads them
+ *
+ * Analysis only ever wants the latest frame: publishing a frame retires any older one still waiting, and the reader
+ * always gets the newest. With three slots one can be read, one can wait and one can be filled, so the camera side
+ * never waits on analysis. Slot memory comes from the caller, so it can be DMA capable where a scaler writes it.
+ */
+class VisionFramePool {
+public:
+    static constexpr size_t kMaxSlots = 4;
+
+    struct Config_t {
+        uint16_t width       = 320;
+        uint16_t height      = 180;
+        ImageFormat_t format = IMAGE_GRAY8;
+        size_t slotCount     = 3;
+    };
+
+    struct Frame_t {
+        uint32_t slot        = 0;  // hand back to release()
+        uint8_t* data        = nullptr;
+        uint16_t width       = 0;
+        uint16_t height      = 0;
+        ImageFormat_t format = IMAGE_GRAY8;
+        uint32_t sequence    = 0;
+        int64_t captureUs    = 0;
+    };
+
+    struct Stats_t {
+        uint32_t published  = 0;
+        uint32_t consumed   = 0;
+        uint32_t superseded = 0;  // replaced by a newer frame before anyone read it
+        uint32_t skipped    = 0;  // no slot to fill, the reader held them all
+    };
+
+    /**
+     * @brief Change the frame size, only while the reader holds no slot
+     *
+     * Slots keep their memory, which must then fit image_bytes() of the new size.
+     */
+    bool configure(const Config_t& config);
+    const Config_t& config() const
+    {
+        return _config;
+    }
+    void setBuffer(uint32_t slot, uint8_t* data, size_t bytes);
+
+    /* -------------------------------- Producer -------------------------------- */
+    /**
+     * @brief A slot to fill, the oldest waiting frame is given up if nothing else is free
+     *
+     */
+    bool acquireWrite(Frame_t& frame);
+    void publish(const Frame_t& frame);
+    void cancel(const Frame_t& frame);
+
+    /* -------------------------------- Consumer -------------------------------- */
+    /**
+     * @brief Newest frame not read yet, waits up to timeoutMs for one
+     *
+     */
+    bool acquire(Frame_t& frame, uint32_t timeoutMs);
+    void release(const Frame_t& frame);
+
+    /**
+     * @brief Retire any waiting frame, e.g. when the producer stops
+     *
+     */
+    void flush();
+
+    Stats_t stats() const;
+    void resetStats();
+
+private:
+    enum SlotState_t {
+        SLOT_FREE,
+        SLOT_WRITING,
+        SLOT_READY,
+        SLOT_READING,
+    };
+
+    struct Slot_t {
+        uint8_t* data     = nullptr;
+        size_t bytes      = 0;
+        SlotState_t state = SLOT_FREE;
+        uint32_t sequence = 0;
+        int64_t captureUs = 0;
+    };
+
+    Config_t _config;
+    mutable std::mutex _mutex;
+    std::condition_variable _ready_cv;
+    Slot_t _slots[kMaxSlots];
+    Stats_t _stats;
+
+    void fill_frame_locked(uint32_t slot, Frame_t& frame) const;
+};
+
+}  // namespace camera
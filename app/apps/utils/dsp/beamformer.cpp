@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "beamformer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace app::dsp;
+
+static constexpr float kPowerSmoothing = 0.995f;
+static constexpr float kPowerFloor     = 1e-6f;
+
+void Beamformer::FractionalDelay::set(float delay)
+{
+    // Lagrange is best behaved with the fractional point between the two middle taps
+    delay         = std::max(delay, 1.0f);
+    whole         = static_cast<size_t>(delay) - 1;
+    const float d = delay - static_cast<float>(whole);
+    for (size_t k = 0; k < kFractionalTaps; k++) {
+        float h = 1.0f;
+        for (size_t j = 0; j < kFractionalTaps; j++) {
+            if (j != k) {
+                h *= (d - static_cast<float>(j)) / (static_cast<float>(k) - static_cast<float>(j));
+            }
+        }
+        taps[k] = h;
+    }
+}
+
+Beamformer::Beamformer()
+{
+    reset();
+    configure(0.0f, 1.0f);
+}
+
+void Beamformer::reset()
+{
+    std::memset(_input, 0, sizeof(_input));
+    std::memset(_sum, 0, sizeof(_sum));
+    std::memset(_blocking, 0, sizeof(_blocking));
+    std::memset(_weights, 0, sizeof(_weights));
+    _power = 0.0f;
+}
+
+void Beamformer::configure(float steerDeg, float width)
+{
+    // Positive angles reach MIC-R first, so MIC-R waits for MIC-L. One sample of base delay keeps Lagrange centered
+    const float theta = std::clamp(steerDeg, -90.0f, 90.0f) * static_cast<float>(M_PI) / 180.0f;
+    const float delay = kMicSpacingM * std::sin(theta) * kSampleRate / kSpeedOfSound;
+    _delay[0].set(1.0f + std::max(0.0f, -delay));
+    _delay[1].set(1.0f + std::max(0.0f, delay));
+
+    _cancel = 1.0f - std::clamp(width, 0.0f, 1.0f);
+}
+
+void Beamformer::align(size_t channel, const float* in, float* out)
+{
+    float* history = _input[channel];
+    std::memcpy(history + kHistory, in, kBlockSize * sizeof(float));
+
+    const FractionalDelay& fd = _delay[channel];
+    const float* x            = history + kHistory - fd.whole;
+    for (size_t i = 0; i < kBlockSize; i++) {
+        out[i] = fd.taps[0] * x[i] + fd.taps[1] * x[i - 1] + fd.taps[2] * x[i - 2] + fd.taps[3] * x[i - 3];
+    }
+
+    std::memmove(history, history + kBlockSize, kHistory * sizeof(float));
+}
+
+void Beamformer::process(const float* left, const float* right, float* out)
+{
+    align(0, left, _aligned[0]);
+    align(1, right, _aligned[1]);
+
+    // Sum carries the look direction, the blocking signal is the same pair with the look direction cancelled
+    float* sum      = _sum + kCausalDelay;
+    float* blocking = _blocking + kAdaptiveTaps - 1;
+    for (size_t i = 0; i < kBlockSize; i++) {
+        sum[i]      = 0.5f * (_aligned[0][i] + _aligned[1][i]);
+        blocking[i] = 0.5f * (_aligned[0][i] - _aligned[1][i]);
+    }
+
+    // The sum path runs kCausalDelay behind so the canceller can reach both sides of an interferer's delay
+    float power = _power;
+    for (size_t i = 0; i < kBlockSize; i++) {
+        const float* b = blocking + i - (kAdaptiveTaps - 1);
+
+        float estimate = 0.0f;
+        for (size_t k = 0; k < kAdaptiveTaps; k++) {
+            estimate += _weights[k] * b[k];
+        }
+
+        const float reference = sum[i - kCausalDelay];
+        const float error     = reference - estimate;
+        power                 = kPowerSmoothing * power + (1.0f - kPowerSmoothing) * blocking[i] * blocking[i];
+
+        const float step = kAdaptiveStep * error / (kAdaptiveTaps * power + kPowerFloor);
+        for (size_t k = 0; k < kAdaptiveTaps; k++) {
+            _weights[k] += step * b[k];
+        }
+
+        out[i] = reference - _cancel * estimate;
+    }
+    _power = power;
+
+    // Bounded canceller norm, the cheap equivalent of a white noise gain constraint
+    float norm = 0.0f;
+    for (size_t k = 0; k < kAdaptiveTaps; k++) {
+        norm += _weights[k] * _weights[k];
+    }
+    if (norm > kMaxWeightNorm) {
+        const float scale = std::sqrt(kMaxWeightNorm / norm);
+        for (size_t k = 0; k < kAdaptiveTaps; k++) {
+            _weights[k] *= scale;
+        }
+    }
+
+    std::memmove(_sum, _sum + kBlockSize, kCausalDelay * sizeof(float));
+    std::memmove(_blocking, _blocking + kBlockSize, (kAdaptiveTaps - 1) * sizeof(float));
+}
@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace app::dsp {
+
+/**
+ * @brief Two mic beamformer over MIC-L / MIC-R
+ *
+ * Fractional delay-and-sum towards the look direction, followed by a small generalized sidelobe canceller: the
+ * difference of the aligned mics has the look direction nulled out, an NLMS filter predicts from it whatever in
+ * the sum did not come from the front, and that gets subtracted. The filter norm is capped so a steering mismatch
+ * can only cost a bounded amount of target, a cheap stand-in for a constrained MVDR solution.
+ *
+ * Width 1 is plain delay-and-sum (broad), width 0 applies the full canceller (narrowest). Works on planar blocks of
+ * kBlockSize samples at kSampleRate, nothing is allocated after construction.
+ */
+class Beamformer {
+public:
+    static constexpr uint32_t kSampleRate   = 48000;
+    static constexpr size_t kBlockSize      = kSampleRate / 100;
+    static constexpr float kSpeedOfSound    = 343.0f;
+    static constexpr float kMicSpacingM     = 0.05f;  // MIC-L to MIC-R on the Tab5 front panel
+    static constexpr size_t kFractionalTaps = 4;      // 3rd order Lagrange
+    static constexpr size_t kAdaptiveTaps   = 32;
+    static constexpr float kAdaptiveStep    = 0.05f;
+    static constexpr float kMaxWeightNorm   = 4.0f;  // squared L2 norm of the canceller
+
+    Beamformer();
+
+    void reset();
+
+    /**
+     * @brief Update look direction and width, cheap enough to call on every settings change
+     *
+     * @param steerDeg -90 (MIC-L side) .. 90 (MIC-R side), 0 is straight ahead
+     * @param width 0..1, narrow to wide
+     */
+    void configure(float steerDeg, float width);
+
+    /**
+     * @brief Beamform one block
+     *
+     * @param left kBlockSize MIC-L samples
+     * @param right kBlockSize MIC-R samples
+     * @param out kBlockSize samples, may alias left or right
+     */
+    void process(const float* left, const float* right, float* out);
+
+private:
+    static constexpr size_t kMaxSteerDelay = static_cast<size_t>(kMicSpacingM * kSampleRate / kSpeedOfSound) + 1;
+    static constexpr size_t kHistory       = kMaxSteerDelay + kFractionalTaps;
+    static constexpr size_t kCausalDelay   = kAdaptiveTaps / 2;
+
+    struct FractionalDelay {
+        size_t whole                = 0;
+        float taps[kFractionalTaps] = {};
+
+        void set(float delay);
+    };
+
+    // Block input behind its own history so the delay lines never wrap
+    alignas(16) float _input[2][kHistory + kBlockSize];
+    alignas(16) float _sum[kCausalDelay + kBlockSize];
+    alignas(16) float _blocking[kAdaptiveTaps - 1 + kBlockSize];
+    alignas(16) float _aligned[2][kBlockSize];
+    alignas(16) float _weights[kAdaptiveTaps];
+    FractionalDelay _delay[2];
+    float _cancel = 0.0f;
+    float _power  = 0.0f;
+
+    void align(size_t channel, const float* in, float* out);
+};
+
+}  // namespace app::dsp
@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+namespace app::dsp {
+
+/**
+ * @brief Second order IIR section, transposed direct form II
+ *
+ * Coefficients follow the RBJ audio EQ cookbook, normalized so that a0 == 1.
+ */
+struct Biquad {
+    float b0 = 1.0f;
+    float b1 = 0.0f;
+    float b2 = 0.0f;
+    float a1 = 0.0f;
+    float a2 = 0.0f;
+    float z1 = 0.0f;
+    float z2 = 0.0f;
+
+    void reset()
+    {
+        z1 = 0.0f;
+        z2 = 0.0f;
+    }
+
+    void setBypass()
+    {
+        b0 = 1.0f;
+        b1 = b2 = a1 = a2 = 0.0f;
+    }
+
+    void setLowPass(float fs, float hz, float q = 0.7071f)
+    {
+        const Prewarp w(fs, hz, q);
+        set((1.0f - w.cos) * 0.5f, 1.0f - w.cos, (1.0f - w.cos) * 0.5f, 1.0f + w.alpha, -2.0f * w.cos,
+            1.0f - w.alpha);
+    }
+
+    void setHighPass(float fs, float hz, float q = 0.7071f)
+    {
+        const Prewarp w(fs, hz, q);
+        set((1.0f + w.cos) * 0.5f, -(1.0f + w.cos), (1.0f + w.cos) * 0.5f, 1.0f + w.alpha, -2.0f * w.cos,
+            1.0f - w.alpha);
+    }
+
+    void setPeaking(float fs, float hz, float q, float gainDb)
+    {
+        const Prewarp w(fs, hz, q);
+        const float a = std::pow(10.0f, gainDb / 40.0f);
+        set(1.0f + w.alpha * a, -2.0f * w.cos, 1.0f - w.alpha * a, 1.0f + w.alpha / a, -2.0f * w.cos,
+            1.0f - w.alpha / a);
+    }
+
+    void setLowShelf(float fs, float hz, float gainDb)
+    {
+        const Prewarp w(fs, hz, 0.7071f);
+        const float a  = std::pow(10.0f, gainDb / 40.0f);
+        const float k  = 2.0f * std::sqrt(a) * w.alpha;
+        const float ap = a + 1.0f;
+        const float am = a - 1.0f;
+        set(a * (ap - am * w.cos + k), 2.0f * a * (am - ap * w.cos), a * (ap - am * w.cos - k), ap + am * w.cos + k,
+            -2.0f * (am + ap * w.cos), ap + am * w.cos - k);
+    }
+
+    void setHighShelf(float fs, float hz, float gainDb)
+    {
+        const Prewarp w(fs, hz, 0.7071f);
+        const float a  = std::pow(10.0f, gainDb / 40.0f);
+        const float k  = 2.0f * std::sqrt(a) * w.alpha;
+        const float ap = a + 1.0f;
+        const float am = a - 1.0f;
+        set(a * (ap + am * w.cos + k), -2.0f * a * (am + ap * w.cos), a * (ap + am * w.cos - k), ap - am * w.cos + k,
+            2.0f * (am - ap * w.cos), ap - am * w.cos - k);
+    }
+
+    inline float process(float x)
+    {
+        const float y = b0 * x + z1;
+        z1            = b1 * x - a1 * y + z2;
+        z2            = b2 * x - a2 * y;
+        return y;
+    }
+
+    void process(float* data, size_t count)
+    {
+        // Keep state in registers for the whole block
+        float s1 = z1;
+        float s2 = z2;
+        for (size_t i = 0; i < count; i++) {
+            const float x = data[i];
+            const float y = b0 * x + s1;
+            s1            = b1 * x - a1 * y + s2;
+            s2            = b2 * x - a2 * y;
+            data[i]       = y;
+        }
+        z1 = s1;
+        z2 = s2;
+    }
+
+private:
+    struct Prewarp {
+        float cos;
+        float alpha;
+        Prewarp(float fs, float hz, float q)
+        {
+            // Keep the corner frequency inside (0, nyquist) so the design stays stable
+            hz            = std::fmin(std::fmax(hz, 10.0f), fs * 0.45f);
+            const float w = 2.0f * 3.14159265f * hz / fs;
+            cos           = std::cos(w);
+            alpha         = std::sin(w) / (2.0f * q);
+        }
+    };
+
+    void set(float nb0, float nb1, float nb2, float na0, float na1, float na2)
+    {
+        const float inv = 1.0f / na0;
+        b0              = nb0 * inv;
+        b1              = nb1 * inv;
+        b2              = nb2 * inv;
+        a1              = na1 * inv;
+        a2              = na2 * inv;
+    }
+};
+
+}  // namespace app::dsp
@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "boost_engine.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace app::dsp;
+
+static_assert(Beamformer::kBlockSize == BoostEngine::kFrameSamples, "beamformer must run on whole frames");
+static_assert(EchoCanceller::kBlockSize == BoostEngine::kFrameSamples, "echo canceller must run on whole frames");
+static_assert(NoiseSuppressor::kBlockSize == BoostEngine::kFrameSamples, "noise suppressor must run on whole frames");
+
+static inline float db_to_linear(float db)
+{
+    return std::pow(10.0f, db / 20.0f);
+}
+
+// Only the fields that feed filter coefficients, the rest is read per frame
+static bool coefficients_changed(const BoostSettings& a, const BoostSettings& b)
+{
+    return a.hpf_hz != b.hpf_hz || a.lpf_hz != b.lpf_hz || a.eq_low_db != b.eq_low_db ||
+           a.eq_mid_db != b.eq_mid_db || a.eq_high_db != b.eq_high_db ||
+           a.limiter_threshold_dbfs != b.limiter_threshold_dbfs || a.limiter_release_ms != b.limiter_release_ms ||
+           a.beam_width != b.beam_width || a.beam_steer_deg != b.beam_steer_deg || a.aec_tail_ms != b.aec_tail_ms ||
+           a.noise_reduction != b.noise_reduction || a.speech_boost != b.speech_boost || a.dereverb != b.dereverb;
+}
+
+void BoostEngine::reset()
+{
+    for (auto& ch : _channels) {
+        ch.hpf.reset();
+        ch.lpf.reset();
+        ch.eqLow.reset();
+        ch.eqMid.reset();
+        ch.eqHigh.reset();
+    }
+    _beamformer.reset();
+    _echo_canceller.reset();
+    _noise_suppressor.reset();
+    _limiter.reset();
+    _configured = false;
+}
+
+void BoostEngine::configure(const BoostSettings& settings)
+{
+    const float fs = static_cast<float>(kSampleRate);
+    for (auto& ch : _channels) {
+        if (settings.hpf_hz > 0.0f) {
+            ch.hpf.setHighPass(fs, settings.hpf_hz);
+        } else {
+            ch.hpf.setBypass();
+        }
+        if (settings.lpf_hz > 0.0f && settings.lpf_hz < fs * 0.45f) {
+            ch.lpf.setLowPass(fs, settings.lpf_hz);
+        } else {
+            ch.lpf.setBypass();
+        }
+        ch.eqLow.setLowShelf(fs, kEqLowShelfHz, settings.eq_low_db);
+        ch.eqMid.setPeaking(fs, kEqMidHz, kEqMidQ, settings.eq_mid_db);
+        ch.eqHigh.setHighShelf(fs, kEqHighShelfHz, settings.eq_high_db);
+    }
+    _beamformer.configure(settings.beam_steer_deg, settings.beam_width);
+    _echo_canceller.setTailMs(static_cast<uint32_t>(settings.aec_tail_ms));
+    _noise_suppressor.configure(settings.noise_reduction, settings.speech_boost, settings.dereverb);
+    _limiter.configure(fs, settings.limiter_threshold_dbfs, settings.limiter_release_ms);
+
+    _settings   = settings;
+    _configured = true;
+}
+
+void BoostEngine::process(const int16_t* capture, int16_t* playback)
+{
+    // A single atomic load per frame, the snapshot is only copied again after a UI write. The copy is bounded, if
+    // the UI keeps writing through it this frame runs on the previous settings and the next one tries again.
+    auto& store = BoostSettingsStore::instance();
+    if (!_configured) {
+        configure(store.get(&_generation));
+    } else if (store.generation() != _generation) {
+        BoostSettings live;
+        if (store.tryGet(live, &_generation)) {
+            if (coefficients_changed(live, _settings)) {
+                configure(live);
+            }
+            _settings = live;
+        }
+    }
+    process_frame(_settings, capture, playback);
+}
+
+void BoostEngine::process(const BoostSettings& settings, const int16_t* capture, int16_t* playback)
+{
+    if (!_configured || coefficients_changed(settings, _settings)) {
+        configure(settings);
+    }
+    process_frame(settings, capture, playback);
+}
+
+void BoostEngine::process_frame(const BoostSettings& settings, const int16_t* capture, int16_t* playback)
+{
+    ScopedCycles measure(_stats);
+
+    // A single mic source only needs one channel of work, the beam needs both mics but yields one channel
+    const bool beamform        = settings.enabled && settings.beamform_enable && !settings.headset_mic_only;
+    const size_t mic_count     = (settings.headset_mic_only || (settings.mono_mix && !beamform)) ? 1 : 2;
+    const size_t channel_count = beamform ? 1 : mic_count;
+
+    deinterleave(settings, capture, mic_count);
+    if (settings.enabled) {
+        // The headset mic does not hear the speaker, and echo has to go before the beamformer adapts on it
+        if (settings.aes_enable && !settings.headset_mic_only) {
+            float* mics[kPlaybackChannels] = {_channels[0].buffer, _channels[1].buffer};
+            _echo_canceller.process(_reference, mics, mic_count);
+        }
+        if (beamform) {
+            _beamformer.process(_channels[0].buffer, _channels[1].buffer, _channels[0].buffer);
+        }
+        if (!_noise_suppressor.bypassed()) {
+            float* planes[kPlaybackChannels] = {_channels[0].buffer, _channels[1].buffer};
+            _noise_suppressor.process(planes, channel_count);
+        }
+        run_chain(settings, channel_count);
+    }
+    interleave(playback, channel_count);
+}
+
+void BoostEngine::deinterleave(const BoostSettings& settings, const int16_t* capture, size_t channelCount)
+{
+    constexpr float scale = 1.0f / 32768.0f;
+    float* left           = _channels[0].buffer;
+    float* right          = _channels[1].buffer;
+
+    if (settings.headset_mic_only) {
+        for (size_t i = 0; i < kFrameSamples; i++) {
+            left[i] = capture[i * kCaptureChannels + 3] * scale;
+        }
+    } else if (channelCount == 1) {
+        for (size_t i = 0; i < kFrameSamples; i++) {
+            const int32_t sum = capture[i * kCaptureChannels + 0] + capture[i * kCaptureChannels + 2];
+            left[i]           = sum * (scale * 0.5f);
+        }
+    } else {
+        for (size_t i = 0; i < kFrameSamples; i++) {
+            left[i]  = capture[i * kCaptureChannels + 0] * scale;
+            right[i] = capture[i * kCaptureChannels + 2] * scale;
+        }
+    }
+
+    if (settings.aes_enable) {
+        for (size_t i = 0; i < kFrameSamples; i++) {
+            _reference[i] = capture[i * kCaptureChannels + 1] * scale;
+        }
+    }
+}
+
+void BoostEngine::run_chain(const BoostSettings& settings, size_t channelCount)
+{
+    // Ramp gains across the frame so slider drags don't produce zipper noise
+    const float pre_target  = db_to_linear(settings.pre_gain_db);
+    const float post_target = db_to_linear(settings.post_gain_db);
+    const float pre_step    = (pre_target - _pre_gain) / kFrameSamples;
+    const float post_step   = (post_target - _post_gain) / kFrameSamples;
+
+    float* planes[kPlaybackChannels];
+    for (size_t c = 0; c < channelCount; c++) {
+        auto& ch  = _channels[c];
+        planes[c] = ch.buffer;
+
+        float g = _pre_gain;
+        for (size_t i = 0; i < kFrameSamples; i++) {
+            g += pre_step;
+            ch.buffer[i] *= g;
+        }
+
+        ch.hpf.process(ch.buffer, kFrameSamples);
+        ch.lpf.process(ch.buffer, kFrameSamples);
+        ch.eqLow.process(ch.buffer, kFrameSamples);
+        ch.eqMid.process(ch.buffer, kFrameSamples);
+        ch.eqHigh.process(ch.buffer, kFrameSamples);
+
+        g = _post_gain;
+        for (size_t i = 0; i < kFrameSamples; i++) {
+            g += post_step;
+            ch.buffer[i] *= g;
+        }
+    }
+    _pre_gain  = pre_target;
+    _post_gain = post_target;
+
+    _limiter.process(planes, channelCount, kFrameSamples);
+}
+
+void BoostEngine::interleave(int16_t* playback, size_t channelCount)
+{
+    const float* left  = _channels[0].buffer;
+    const float* right = channelCount == 1 ? _channels[0].buffer : _channels[1].buffer;
+
+    for (size_t i = 0; i < kFrameSamples; i++) {
+        const int32_t l     = static_cast<int32_t>(std::lrintf(left[i] * 32767.0f));
+        const int32_t r     = static_cast<int32_t>(std::lrintf(right[i] * 32767.0f));
+        playback[i * 2 + 0] = static_cast<int16_t>(std::clamp(l, -32768, 32767));
+        playback[i * 2 + 1] = static_cast<int16_t>(std::clamp(r, -32768, 32767));
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "boost_settings.h"
+#include "beamformer.h"
+#include "echo_canceller.h"
+#include "noise_suppressor.h"
+#include "biquad.h"
+#include "limiter.h"
+#include "cycle_counter.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace app::dsp {
+
+/**
+ * @brief Block based processing graph driven by BoostSettings
+ *
+ * [echo canceller] -> [beamformer] -> [noise suppressor] -> pre gain -> HPF -> LPF -> 3-band EQ -> post gain -> limiter
+ *
+ * Works on fixed 10 ms frames at 48 kHz. All state lives inside the object, nothing is allocated
+ * after construction, so it is safe to run from a real-time audio task.
+ */
+class BoostEngine {
+public:
+    static constexpr uint32_t kSampleRate      = 48000;
+    static constexpr size_t kFrameSamples      = kSampleRate / 100;
+    static constexpr size_t kCaptureChannels   = 4;  // [MIC-L, AEC, MIC-R, MIC-HP]
+    static constexpr size_t kPlaybackChannels  = 2;
+    static constexpr size_t kCaptureFrameSize  = kFrameSamples * kCaptureChannels;
+    static constexpr size_t kPlaybackFrameSize = kFrameSamples * kPlaybackChannels;
+    static constexpr float kEqLowShelfHz       = 250.0f;
+    static constexpr float kEqMidHz            = 1500.0f;
+    static constexpr float kEqMidQ             = 0.9f;
+    static constexpr float kEqHighShelfHz      = 4000.0f;
+
+    void reset();
+
+    /**
+     * @brief Process one frame with the live settings from BoostSettingsStore
+     *
+     * Polls the store generation, coefficients are only recomputed after a write that touched them.
+     *
+     * @param capture kCaptureFrameSize interleaved samples
+     * @param playback kPlaybackFrameSize interleaved samples
+     */
+    void process(const int16_t* capture, int16_t* playback);
+
+    /**
+     * @brief Process one frame with explicit settings
+     *
+     */
+    void process(const BoostSettings& settings, const int16_t* capture, int16_t* playback);
+
+    CycleStats& stats()
+    {
+        return _stats;
+    }
+
+    EchoCanceller& echoCanceller()
+    {
+        return _echo_canceller;
+    }
+
+    NoiseSuppressor& noiseSuppressor()
+    {
+        return _noise_suppressor;
+    }
+
+private:
+    struct Channel {
+        Biquad hpf;
+        Biquad lpf;
+        Biquad eqLow;
+        Biquad eqMid;
+        Biquad eqHigh;
+        float buffer[kFrameSamples];
+    };
+
+    Channel _channels[kPlaybackChannels];
+    Beamformer _beamformer;
+    EchoCanceller _echo_canceller;
+    float _reference[kFrameSamples];
+    NoiseSuppressor _noise_suppressor;
+    Limiter _limiter;
+    BoostSettings _settings;
+    uint32_t _generation = 0;
+    bool _configured     = false;
+    float _pre_gain  = 1.0f;
+    float _post_gain = 1.0f;
+    CycleStats _stats;
+
+    void configure(const BoostSettings& settings);
+    void process_frame(const BoostSettings& settings, const int16_t* capture, int16_t* playback);
+    void deinterleave(const BoostSettings& settings, const int16_t* capture, size_t channelCount);
+    void run_chain(const BoostSettings& settings, size_t channelCount);
+    void interleave(int16_t* playback, size_t channelCount);
+};
+
+}  // namespace app::dsp
@@ -1,5 +1,7 @@
 #pragma once
 #include <stdint.h>
+#include <mutex>
+#include "../sync/seqlock.h"
 
 namespace app::dsp {
 
@@ -26,22 +28,24 @@ struct BoostSettings
     float hpf_hz = 120.0f;               // High-pass cutoff
     float lpf_hz = 7000.0f;              // Low-pass cutoff
 
-    // "How much" controls (0..1)
+    // "How much" controls (0..1), all three drive the noise suppressor
     float noise_reduction = 0.35f;
     float speech_boost = 0.35f;
     float dereverb = 0.0f;
 
-    // Beamforming (future)
+    // Beamforming
     bool beamform_enable = false;
     float beam_width = 0.6f;             // 0..1 (narrow->wide)
+    float beam_steer_deg = 0.0f;         // -90 (MIC-L side) .. 90 (MIC-R side)
 
     // EQ (future)
     float eq_low_db = 0.0f;
     float eq_mid_db = 0.0f;
     float eq_high_db = 0.0f;
 
-    // I/O routing (future)
-    bool aes_enable = false;
+    // I/O routing
+    bool aes_enable = false;             // cancel speaker echo using the codec AEC reference
+    float aec_tail_ms = 100.0f;          // echo path length to model, 10..200
     bool headset_mic_only = false;       // prefer headset mic, suppress local playback
 };
 
@@ -49,16 +53,35 @@ struct BoostSettings
  * Thread-safe access to the runtime settings.
  *
  * This avoids coupling the UI directly to the processing implementation.
- * The backend can poll or subscribe to changes later.
+ * Readers go through a seqlock and never block; the audio task uses tryGet()
+ * so a burst of UI writes can't hold it past its deadline. Writers are
+ * serialized by a mutex that readers never touch. Every write bumps the
+ * generation, so the backend can poll it once per block and only re-derive
+ * coefficients when something actually changed.
  */
 class BoostSettingsStore
 {
 public:
     static BoostSettingsStore& instance();
 
-    BoostSettings get() const;
+    BoostSettings get(uint32_t* generation = nullptr) const { return _snapshot.load(generation); }
+    // Bounded time, false when writes kept overlapping the copy and the caller should keep what it has
+    bool tryGet(BoostSettings& out, uint32_t* generation = nullptr) const
+    {
+        return _snapshot.tryLoad(out, generation);
+    }
+    uint32_t generation() const { return _snapshot.generation(); }
     void set(const BoostSettings& s);
 
+    // Read-modify-write under a single writer lock
+    template <typename Fn>
+    void update(Fn&& fn)
+    {
+        std::lock_guard<std::mutex> lock(_write_mutex);
+        fn(_s);
+        _snapshot.store(_s);
+    }
+
     // Convenience helpers
     void set_enabled(bool v);
     void set_mono(bool v);
@@ -75,12 +98,14 @@ public:
 
     void set_beamform_enable(bool v);
     void set_beam_width(float v01);
+    void set_beam_steer_deg(float deg);
 
     void set_eq_low_db(float db);
     void set_eq_mid_db(float db);
     void set_eq_high_db(float db);
 
     void set_aes_enable(bool v);
+    void set_aec_tail_ms(float ms);
     void set_headset_mic_only(bool v);
 
 private:
@@ -88,8 +113,9 @@ private:
     BoostSettingsStore(const BoostSettingsStore&) = delete;
     BoostSettingsStore& operator=(const BoostSettingsStore&) = delete;
 
-    BoostSettings _s{};
-    mutable void* _mutex = nullptr; // created lazily to keep this header IDF-agnostic
+    BoostSettings _s{};                          // writer side copy, guarded by _write_mutex
+    std::mutex _write_mutex;
+    app::sync::SeqLock<BoostSettings> _snapshot; // what readers see
 };
 
 } // namespace app::dsp
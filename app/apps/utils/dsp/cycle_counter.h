@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <atomic>
+#include <cstdint>
+#if defined(ESP_PLATFORM)
+#include <esp_cpu.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace app::dsp {
+
+/**
+ * @brief Free running cycle counter, only deltas are meaningful
+ *
+ * CPU cycles on the ESP32-P4 and x86 hosts, nanoseconds elsewhere.
+ */
+inline uint32_t read_cycles()
+{
+#if defined(ESP_PLATFORM)
+    return esp_cpu_get_cycle_count();
+#elif defined(__x86_64__) || defined(__i386__)
+    return static_cast<uint32_t>(__rdtsc());
+#else
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+}
+
+/**
+ * @brief Per-frame cost counters, written by the processing thread and read from anywhere
+ *
+ */
+struct CycleStats {
+    std::atomic<uint32_t> frames{0};
+    std::atomic<uint32_t> last{0};
+    std::atomic<uint32_t> peak{0};
+    std::atomic<uint64_t> total{0};
+
+    void add(uint32_t cycles)
+    {
+        frames.fetch_add(1, std::memory_order_relaxed);
+        last.store(cycles, std::memory_order_relaxed);
+        total.fetch_add(cycles, std::memory_order_relaxed);
+        if (cycles > peak.load(std::memory_order_relaxed)) {
+            peak.store(cycles, std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t average() const
+    {
+        uint32_t n = frames.load(std::memory_order_relaxed);
+        return n == 0 ? 0 : static_cast<uint32_t>(total.load(std::memory_order_relaxed) / n);
+    }
+
+    void reset()
+    {
+        frames.store(0, std::memory_order_relaxed);
+        last.store(0, std::memory_order_relaxed);
+        peak.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Measures the scope it lives in and adds it to a CycleStats
+ *
+ */
+class ScopedCycles {
+public:
+    explicit ScopedCycles(CycleStats& stats) : _stats(stats), _start(read_cycles())
+    {
+    }
+    ~ScopedCycles()
+    {
+        _stats.add(read_cycles() - _start);
+    }
+
+private:
+    CycleStats& _stats;
+    uint32_t _start;
+};
+
+}  // namespace app::dsp
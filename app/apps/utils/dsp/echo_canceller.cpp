@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "echo_canceller.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace app::dsp;
+
+static constexpr float kPowerFloor      = 1e-3f;
+static constexpr float kEnergySmoothing = 0.9f;
+static constexpr float kErleSmoothing   = 0.95f;
+static constexpr float kCopyRatio       = 0.5f;  // background error 3 dB under the foreground replaces it
+static constexpr float kRevertRatio     = 4.0f;  // background error 6 dB over the foreground is thrown away
+
+EchoCanceller::EchoCanceller()
+    : _reference_spectra(kMaxPartitions * kBins),
+      _background(kMaxChannels * kMaxPartitions * kBins),
+      _foreground(kMaxChannels * kMaxPartitions * kBins)
+{
+    _fft.init(kFftSize);
+    _partitions = kMaxPartitions / 2;
+    reset();
+}
+
+void EchoCanceller::reset()
+{
+    std::fill(_reference_spectra.begin(), _reference_spectra.end(), Complex{});
+    std::fill(_background.begin(), _background.end(), Complex{});
+    std::fill(_foreground.begin(), _foreground.end(), Complex{});
+    std::memset(_reference_peaks, 0, sizeof(_reference_peaks));
+    std::memset(_reference_time, 0, sizeof(_reference_time));
+    std::memset(_foreground_energy, 0, sizeof(_foreground_energy));
+    std::memset(_background_energy, 0, sizeof(_background_energy));
+    _head       = 0;
+    _constrain  = 0;
+    _hangover   = 0;
+    _erle_mic   = 0.0f;
+    _erle_error = 0.0f;
+    _erle_db.store(0.0f, std::memory_order_relaxed);
+}
+
+void EchoCanceller::setTailMs(uint32_t tailMs)
+{
+    const size_t block_ms   = kBlockSize * 1000 / kSampleRate;
+    const size_t partitions = std::clamp<size_t>((tailMs + block_ms - 1) / block_ms, 1, kMaxPartitions);
+
+    // Partitions falling off the end must not come back with stale taps when the tail grows again
+    for (size_t c = 0; c < kMaxChannels; c++) {
+        for (size_t p = partitions; p < _partitions; p++) {
+            std::fill(background(c, p), background(c, p) + kBins, Complex{});
+            std::fill(foreground(c, p), foreground(c, p) + kBins, Complex{});
+        }
+    }
+    _partitions = partitions;
+    _constrain  = 0;
+}
+
+void EchoCanceller::estimate(const Complex* weights)
+{
+    // Sum over partitions of filter times delayed reference, the echo lands in the second half of _time
+    std::fill(std::begin(_spectrum), std::end(_spectrum), Complex{});
+    for (size_t p = 0; p < _partitions; p++) {
+        const Complex* x = reference_spectrum(p);
+        const Complex* w = weights + p * kBins;
+        for (size_t k = 0; k < kBins; k++) {
+            _spectrum[k].re += w[k].re * x[k].re - w[k].im * x[k].im;
+            _spectrum[k].im += w[k].re * x[k].im + w[k].im * x[k].re;
+        }
+    }
+    _fft.inverse(_spectrum, _time);
+}
+
+void EchoCanceller::adapt(Complex* weights)
+{
+    // _time holds [zeros, error], every partition takes the same normalized error step
+    _fft.forward(_time, _spectrum);
+
+    float mean_power = 0.0f;
+    for (size_t k = 0; k < kBins; k++) {
+        mean_power += _power[k];
+    }
+    const float regularization = kRegularization * mean_power / kBins + kPowerFloor;
+
+    for (size_t k = 0; k < kBins; k++) {
+        const float g    = kStepSize / (_power[k] + regularization);
+        _spectrum[k].re *= g;
+        _spectrum[k].im *= g;
+    }
+    for (size_t p = 0; p < _partitions; p++) {
+        const Complex* x = reference_spectrum(p);
+        Complex* w       = weights + p * kBins;
+        for (size_t k = 0; k < kBins; k++) {
+            w[k].re += x[k].re * _spectrum[k].re + x[k].im * _spectrum[k].im;
+            w[k].im += x[k].re * _spectrum[k].im - x[k].im * _spectrum[k].re;
+        }
+    }
+    constrain(weights + _constrain * kBins);
+}
+
+void EchoCanceller::constrain(Complex* partition)
+{
+    // Overlap-save only wants the first half of the impulse response, the rest is circular wrap
+    _fft.inverse(partition, _time);
+    std::memset(_time + kBlockSize, 0, kBlockSize * sizeof(float));
+    _fft.forward(_time, partition);
+}
+
+void EchoCanceller::process(const float* reference, float* const* mics, size_t channelCount)
+{
+    ScopedCycles measure(_stats);
+    channelCount = std::min(channelCount, kMaxChannels);
+
+    // Newest reference partition, the window is the previous block followed by this one
+    std::memmove(_reference_time, _reference_time + kBlockSize, kBlockSize * sizeof(float));
+    std::memcpy(_reference_time + kBlockSize, reference, kBlockSize * sizeof(float));
+    _head = (_head + 1) % kMaxPartitions;
+    _fft.forward(_reference_time, reference_spectrum(0));
+
+    float peak = 0.0f;
+    for (size_t i = 0; i < kBlockSize; i++) {
+        peak = std::max(peak, std::fabs(reference[i]));
+    }
+    _reference_peaks[_head] = peak;
+
+    // Normalize by the reference power across the whole tail, a loud partition that is about to leave the tail
+    // still counts while the newest one is quiet
+    float far_peak = 0.0f;
+    std::fill(std::begin(_power), std::end(_power), 0.0f);
+    for (size_t p = 0; p < _partitions; p++) {
+        far_peak         = std::max(far_peak, _reference_peaks[(_head + kMaxPartitions - p) % kMaxPartitions]);
+        const Complex* x = reference_spectrum(p);
+        for (size_t k = 0; k < kBins; k++) {
+            _power[k] += x[k].re * x[k].re + x[k].im * x[k].im;
+        }
+    }
+
+    // Geigel: anything on the mics louder than the far end itself is the near end talking
+    float near_peak = 0.0f;
+    for (size_t c = 0; c < channelCount; c++) {
+        for (size_t i = 0; i < kBlockSize; i++) {
+            near_peak = std::max(near_peak, std::fabs(mics[c][i]));
+        }
+    }
+    if (near_peak > far_peak * kGeigelRatio) {
+        _hangover = kHangoverFrames;
+    } else if (_hangover > 0) {
+        _hangover--;
+    }
+    const bool far_active = far_peak > kReferenceFloor;
+    const bool adapting   = far_active && _hangover == 0;
+
+    float mic_energy   = 0.0f;
+    float error_energy = 0.0f;
+    for (size_t c = 0; c < channelCount; c++) {
+        float* mic = mics[c];
+
+        estimate(foreground(c));
+        float foreground_error = 0.0f;
+        for (size_t i = 0; i < kBlockSize; i++) {
+            _output[i]        = mic[i] - _time[kBlockSize + i];
+            foreground_error += _output[i] * _output[i];
+        }
+
+        estimate(background(c));
+        float background_error = 0.0f;
+        float channel_mic      = 0.0f;
+        for (size_t i = 0; i < kBlockSize; i++) {
+            const float e     = mic[i] - _time[kBlockSize + i];
+            background_error += e * e;
+            channel_mic      += mic[i] * mic[i];
+
+            _time[i]              = 0.0f;
+            _time[kBlockSize + i] = e;
+        }
+        std::memcpy(mic, _output, kBlockSize * sizeof(float));
+        mic_energy   += channel_mic;
+        error_energy += foreground_error;
+
+        if (adapting) {
+            adapt(background(c));
+        }
+        if (!far_active) {
+            continue;
+        }
+
+        // Hand over whichever filter has been doing better lately
+        float& fg = _foreground_energy[c];
+        float& bg = _background_energy[c];
+        fg        = kEnergySmoothing * fg + (1.0f - kEnergySmoothing) * foreground_error;
+        bg        = kEnergySmoothing * bg + (1.0f - kEnergySmoothing) * background_error;
+        if (bg < fg * kCopyRatio) {
+            std::copy(background(c), background(c) + _partitions * kBins, foreground(c));
+            fg = bg;
+        } else if (bg > fg * kRevertRatio) {
+            std::copy(foreground(c), foreground(c) + _partitions * kBins, background(c));
+            bg = fg;
+        }
+    }
+
+    if (adapting) {
+        _constrain  = (_constrain + 1) % _partitions;
+        _erle_mic   = kErleSmoothing * _erle_mic + (1.0f - kErleSmoothing) * mic_energy;
+        _erle_error = kErleSmoothing * _erle_error + (1.0f - kErleSmoothing) * error_energy;
+        _erle_db.store(10.0f * std::log10((_erle_mic + 1e-12f) / (_erle_error + 1e-12f)), std::memory_order_relaxed);
+    }
+}
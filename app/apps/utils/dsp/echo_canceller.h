@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "fft.h"
+#include "cycle_counter.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace app::dsp {
+
+/**
+ * @brief Partitioned block frequency domain NLMS echo canceller
+ *
+ * The codec AEC channel is the reference: it is split into 10 ms partitions, each with its own filter spectrum, and
+ * the echo estimate is subtracted from every mic channel by overlap-save. The reference history is shared, only the
+ * filters are per channel. Adaptation is per bin normalized over the whole tail, and one partition per frame gets
+ * its gradient constraint re-applied in rotation.
+ *
+ * Double talk is handled twice. A Geigel detector freezes adaptation while the mics are louder than the far end
+ * could make them, and the adapting (background) filter only feeds the output through a foreground copy that is
+ * refreshed when the background does clearly better. Quieter near end speech that gets past Geigel therefore
+ * throws off the background for a moment, never the output.
+ *
+ * Buffers are sized for kMaxTailMs and allocated in the constructor, a shorter tail only does less work.
+ */
+class EchoCanceller {
+public:
+    static constexpr uint32_t kSampleRate     = 48000;
+    static constexpr size_t kBlockSize        = kSampleRate / 100;
+    static constexpr size_t kFftSize          = kBlockSize * 2;
+    static constexpr size_t kBins             = kFftSize / 2 + 1;
+    static constexpr size_t kMaxChannels      = 2;
+    static constexpr uint32_t kMaxTailMs      = 200;
+    static constexpr size_t kMaxPartitions    = kMaxTailMs * kSampleRate / 1000 / kBlockSize;
+    static constexpr float kStepSize          = 0.8f;
+    static constexpr float kRegularization    = 1.0f;   // of the mean bin power, keeps sparse spectra from blowing up
+    static constexpr float kGeigelRatio       = 1.0f;   // near end peak over far end peak that counts as double talk
+    static constexpr uint32_t kHangoverFrames = 5;
+    static constexpr float kReferenceFloor    = 1e-4f;  // about -80 dBFS, below that there is nothing to learn
+
+    EchoCanceller();
+
+    void reset();
+
+    /**
+     * @brief Echo tail to model, rounded up to whole 10 ms partitions
+     *
+     */
+    void setTailMs(uint32_t tailMs);
+    uint32_t tailMs() const
+    {
+        return static_cast<uint32_t>(_partitions * kBlockSize * 1000 / kSampleRate);
+    }
+
+    /**
+     * @brief Cancel one block in place
+     *
+     * @param reference kBlockSize far end samples
+     * @param mics planar mic channels, kBlockSize samples each
+     * @param channelCount up to kMaxChannels
+     */
+    void process(const float* reference, float* const* mics, size_t channelCount);
+
+    bool doubleTalk() const
+    {
+        return _hangover > 0;
+    }
+
+    /**
+     * @brief Smoothed echo return loss enhancement of the output over far end only blocks
+     *
+     */
+    float erleDb() const
+    {
+        return _erle_db.load(std::memory_order_relaxed);
+    }
+
+    CycleStats& stats()
+    {
+        return _stats;
+    }
+
+private:
+    RealFft _fft;
+    size_t _partitions = 0;
+    size_t _head       = 0;  // newest slot of the reference ring
+    size_t _constrain  = 0;  // partition whose gradient constraint is due
+    uint32_t _hangover = 0;
+
+    std::vector<Complex> _reference_spectra;  // [kMaxPartitions][kBins] ring
+    std::vector<Complex> _background;         // [kMaxChannels][kMaxPartitions][kBins], adapts
+    std::vector<Complex> _foreground;         // same layout, produces the output
+    float _reference_peaks[kMaxPartitions];
+    float _reference_time[kFftSize];
+    float _power[kBins];
+    float _foreground_energy[kMaxChannels];
+    float _background_energy[kMaxChannels];
+
+    // Scratch
+    float _time[kFftSize];
+    float _output[kBlockSize];
+    Complex _spectrum[kBins];
+
+    float _erle_mic   = 0.0f;
+    float _erle_error = 0.0f;
+    std::atomic<float> _erle_db{0.0f};
+    CycleStats _stats;
+
+    Complex* reference_spectrum(size_t age)
+    {
+        return &_reference_spectra[((_head + kMaxPartitions - age) % kMaxPartitions) * kBins];
+    }
+    Complex* background(size_t channel, size_t partition = 0)
+    {
+        return &_background[(channel * kMaxPartitions + partition) * kBins];
+    }
+    Complex* foreground(size_t channel, size_t partition = 0)
+    {
+        return &_foreground[(channel * kMaxPartitions + partition) * kBins];
+    }
+
+    void estimate(const Complex* weights);
+    void adapt(Complex* weights);
+    void constrain(Complex* partition);
+};
+
+}  // namespace app::dsp
@@ -0,0 +1,279 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "fft.h"
+#include <cmath>
+
+using namespace app::dsp;
+
+static inline Complex operator+(Complex a, Complex b)
+{
+    return {a.re + b.re, a.im + b.im};
+}
+
+static inline Complex operator-(Complex a, Complex b)
+{
+    return {a.re - b.re, a.im - b.im};
+}
+
+static inline Complex operator*(Complex a, Complex b)
+{
+    return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+}
+
+static inline Complex scale(Complex a, float s)
+{
+    return {a.re * s, a.im * s};
+}
+
+static inline Complex conj(Complex a)
+{
+    return {a.re, -a.im};
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                     Fft                                    */
+/* -------------------------------------------------------------------------- */
+bool Fft::init(size_t size, bool inverse)
+{
+    _size    = 0;
+    _inverse = inverse;
+    if (size == 0) {
+        return false;
+    }
+
+    // Radix 4 first, it has the cheapest butterfly per point
+    size_t n     = size;
+    size_t p     = 4;
+    size_t stage = 0;
+    while (n > 1) {
+        while (n % p != 0) {
+            if (p == 4) {
+                p = 2;
+            } else if (p == 2) {
+                p = 3;
+            } else if (p == 3) {
+                p = 5;
+            } else {
+                return false;
+            }
+        }
+        if (stage == kMaxStages) {
+            return false;
+        }
+        n /= p;
+        _factors[stage * 2 + 0] = p;
+        _factors[stage * 2 + 1] = n;
+        stage++;
+    }
+
+    const double sign = inverse ? 1.0 : -1.0;
+    _twiddles.resize(size);
+    for (size_t i = 0; i < size; i++) {
+        const double phase = sign * 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(size);
+        _twiddles[i]       = {static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase))};
+    }
+
+    _size = size;
+    return true;
+}
+
+void Fft::transform(const Complex* in, Complex* out) const
+{
+    if (_size == 1) {
+        out[0] = in[0];
+        return;
+    }
+    work(out, in, 1, _factors);
+}
+
+void Fft::work(Complex* out, const Complex* in, size_t stride, const size_t* factors) const
+{
+    const size_t p   = factors[0];
+    const size_t m   = factors[1];
+    Complex* begin   = out;
+    const Complex* f = in;
+
+    // Gather the p interleaved sub sequences, then combine them in place
+    if (m == 1) {
+        for (size_t i = 0; i < p; i++) {
+            out[i] = *f;
+            f += stride;
+        }
+    } else {
+        for (size_t i = 0; i < p; i++) {
+            work(out + i * m, f, stride * p, factors + 2);
+            f += stride;
+        }
+    }
+
+    switch (p) {
+        case 2:
+            butterfly2(begin, stride, m);
+            break;
+        case 3:
+            butterfly3(begin, stride, m);
+            break;
+        case 4:
+            butterfly4(begin, stride, m);
+            break;
+        default:
+            butterfly5(begin, stride, m);
+            break;
+    }
+}
+
+void Fft::butterfly2(Complex* out, size_t stride, size_t m) const
+{
+    Complex* out2 = out + m;
+    for (size_t k = 0; k < m; k++) {
+        const Complex t = out2[k] * _twiddles[k * stride];
+        out2[k]         = out[k] - t;
+        out[k]          = out[k] + t;
+    }
+}
+
+void Fft::butterfly3(Complex* out, size_t stride, size_t m) const
+{
+    const float epi3 = _twiddles[stride * m].im;
+    for (size_t k = 0; k < m; k++) {
+        const Complex s1 = out[k + m] * _twiddles[k * stride];
+        const Complex s2 = out[k + 2 * m] * _twiddles[k * stride * 2];
+        const Complex s3 = s1 + s2;
+        const Complex s0 = scale(s1 - s2, epi3);
+
+        const Complex mid = out[k] - scale(s3, 0.5f);
+        out[k]            = out[k] + s3;
+        out[k + 2 * m]    = {mid.re + s0.im, mid.im - s0.re};
+        out[k + m]        = {mid.re - s0.im, mid.im + s0.re};
+    }
+}
+
+void Fft::butterfly4(Complex* out, size_t stride, size_t m) const
+{
+    for (size_t k = 0; k < m; k++) {
+        const Complex s0 = out[k + m] * _twiddles[k * stride];
+        const Complex s1 = out[k + 2 * m] * _twiddles[k * stride * 2];
+        const Complex s2 = out[k + 3 * m] * _twiddles[k * stride * 3];
+        const Complex s5 = out[k] - s1;
+        const Complex s6 = out[k] + s1;
+        const Complex s3 = s0 + s2;
+        const Complex s4 = s0 - s2;
+
+        out[k]         = s6 + s3;
+        out[k + 2 * m] = s6 - s3;
+        if (_inverse) {
+            out[k + m]     = {s5.re - s4.im, s5.im + s4.re};
+            out[k + 3 * m] = {s5.re + s4.im, s5.im - s4.re};
+        } else {
+            out[k + m]     = {s5.re + s4.im, s5.im - s4.re};
+            out[k + 3 * m] = {s5.re - s4.im, s5.im + s4.re};
+        }
+    }
+}
+
+void Fft::butterfly5(Complex* out, size_t stride, size_t m) const
+{
+    const Complex ya = _twiddles[stride * m];
+    const Complex yb = _twiddles[stride * 2 * m];
+    for (size_t u = 0; u < m; u++) {
+        const Complex s0 = out[u];
+        const Complex s1 = out[u + m] * _twiddles[u * stride];
+        const Complex s2 = out[u + 2 * m] * _twiddles[u * stride * 2];
+        const Complex s3 = out[u + 3 * m] * _twiddles[u * stride * 3];
+        const Complex s4 = out[u + 4 * m] * _twiddles[u * stride * 4];
+
+        const Complex s7  = s1 + s4;
+        const Complex s10 = s1 - s4;
+        const Complex s8  = s2 + s3;
+        const Complex s9  = s2 - s3;
+
+        const Complex s5  = {s0.re + s7.re * ya.re + s8.re * yb.re, s0.im + s7.im * ya.re + s8.im * yb.re};
+        const Complex s6  = {s10.im * ya.im + s9.im * yb.im, -s10.re * ya.im - s9.re * yb.im};
+        const Complex s11 = {s0.re + s7.re * yb.re + s8.re * ya.re, s0.im + s7.im * yb.re + s8.im * ya.re};
+        const Complex s12 = {-s10.im * yb.im + s9.im * ya.im, s10.re * yb.im - s9.re * ya.im};
+
+        out[u]         = s0 + s7 + s8;
+        out[u + m]     = s5 - s6;
+        out[u + 4 * m] = s5 + s6;
+        out[u + 2 * m] = s11 + s12;
+        out[u + 3 * m] = s11 - s12;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                   RealFft                                  */
+/* -------------------------------------------------------------------------- */
+bool RealFft::init(size_t size)
+{
+    _size = 0;
+    if (size < 2 || size % 2 != 0) {
+        return false;
+    }
+
+    const size_t half = size / 2;
+    if (!_forward.init(half, false) || !_inverse.init(half, true)) {
+        return false;
+    }
+
+    _twiddles.resize(half / 2 + 1);
+    for (size_t i = 0; i < _twiddles.size(); i++) {
+        const double phase = -M_PI * (static_cast<double>(i + 1) / static_cast<double>(half) + 0.5);
+        _twiddles[i]       = {static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase))};
+    }
+    _packed.resize(half);
+    _spectrum.resize(half);
+
+    _size = size;
+    return true;
+}
+
+void RealFft::forward(const float* in, Complex* out)
+{
+    // Even samples go in the real part, odd ones in the imaginary part, then the two spectra are split apart
+    const size_t half = _size / 2;
+    for (size_t i = 0; i < half; i++) {
+        _packed[i] = {in[i * 2 + 0], in[i * 2 + 1]};
+    }
+    _forward.transform(_packed.data(), _spectrum.data());
+
+    const Complex dc = _spectrum[0];
+    out[0]           = {dc.re + dc.im, 0.0f};
+    out[half]        = {dc.re - dc.im, 0.0f};
+
+    for (size_t k = 1; k <= half / 2; k++) {
+        const Complex fpk  = _spectrum[k];
+        const Complex fpnk = conj(_spectrum[half - k]);
+        const Complex f1k  = fpk + fpnk;
+        const Complex f2k  = fpk - fpnk;
+        const Complex tw   = f2k * _twiddles[k - 1];
+
+        out[k]        = scale(f1k + tw, 0.5f);
+        out[half - k] = {(f1k.re - tw.re) * 0.5f, (tw.im - f1k.im) * 0.5f};
+    }
+}
+
+void RealFft::inverse(const Complex* in, float* out)
+{
+    const size_t half = _size / 2;
+    _packed[0]        = {in[0].re + in[half].re, in[0].re - in[half].re};
+
+    for (size_t k = 1; k <= half / 2; k++) {
+        const Complex fk   = in[k];
+        const Complex fnkc = conj(in[half - k]);
+        const Complex fek  = fk + fnkc;
+        const Complex fok  = (fk - fnkc) * conj(_twiddles[k - 1]);
+
+        _packed[k]        = fek + fok;
+        _packed[half - k] = conj(fek - fok);
+    }
+    _inverse.transform(_packed.data(), _spectrum.data());
+
+    const float norm = 1.0f / static_cast<float>(_size);
+    for (size_t i = 0; i < half; i++) {
+        out[i * 2 + 0] = _spectrum[i].re * norm;
+        out[i * 2 + 1] = _spectrum[i].im * norm;
+    }
+}
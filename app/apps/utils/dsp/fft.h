@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace app::dsp {
+
+struct Complex {
+    float re = 0.0f;
+    float im = 0.0f;
+};
+
+/**
+ * @brief Mixed radix complex FFT for sizes of the form 2^a * 3^b * 5^c
+ *
+ * Decimation in time with radix 4, 2, 3 and 5 butterflies, so the 10 ms (480) and 20 ms (960) blocks used at 48 kHz
+ * need no padding. Twiddles and the factor plan are built once, transforms never allocate. Unscaled in both
+ * directions.
+ */
+class Fft {
+public:
+    Fft() = default;
+    Fft(size_t size, bool inverse)
+    {
+        init(size, inverse);
+    }
+
+    /**
+     * @brief Build the plan
+     *
+     * @return false if the size has a prime factor above 5
+     */
+    bool init(size_t size, bool inverse);
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief Out of place transform, in and out must not overlap
+     *
+     */
+    void transform(const Complex* in, Complex* out) const;
+
+private:
+    static constexpr size_t kMaxStages = 32;
+
+    size_t _size  = 0;
+    bool _inverse = false;
+    size_t _factors[kMaxStages * 2];
+    std::vector<Complex> _twiddles;
+
+    void work(Complex* out, const Complex* in, size_t stride, const size_t* factors) const;
+    void butterfly2(Complex* out, size_t stride, size_t m) const;
+    void butterfly3(Complex* out, size_t stride, size_t m) const;
+    void butterfly4(Complex* out, size_t stride, size_t m) const;
+    void butterfly5(Complex* out, size_t stride, size_t m) const;
+};
+
+/**
+ * @brief Real input FFT built on a half size complex FFT
+ *
+ * forward() takes size real samples and yields size / 2 + 1 bins, inverse() goes back and scales by 1 / size, so
+ * a round trip is the identity.
+ */
+class RealFft {
+public:
+    RealFft() = default;
+    explicit RealFft(size_t size)
+    {
+        init(size);
+    }
+
+    /**
+     * @brief Build the plan
+     *
+     * @return false if size is odd or size / 2 is not 2^a * 3^b * 5^c
+     */
+    bool init(size_t size);
+
+    size_t size() const
+    {
+        return _size;
+    }
+    size_t bins() const
+    {
+        return _size / 2 + 1;
+    }
+
+    void forward(const float* in, Complex* out);
+    void inverse(const Complex* in, float* out);
+
+private:
+    size_t _size = 0;
+    Fft _forward;
+    Fft _inverse;
+    std::vector<Complex> _twiddles;  // forward split twiddles, the inverse uses their conjugates
+    std::vector<Complex> _packed;
+    std::vector<Complex> _spectrum;
+};
+
+}  // namespace app::dsp
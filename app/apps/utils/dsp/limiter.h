@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+namespace app::dsp {
+
+/**
+ * @brief Peak limiter with instant attack and exponential release
+ *
+ * Gain is shared across channels so the stereo image does not shift while limiting.
+ */
+class Limiter {
+public:
+    void configure(float sampleRate, float thresholdDbfs, float releaseMs)
+    {
+        _threshold = std::pow(10.0f, std::fmin(thresholdDbfs, 0.0f) / 20.0f);
+        releaseMs  = std::fmax(releaseMs, 1.0f);
+        _release   = std::exp(-1.0f / (releaseMs * 0.001f * sampleRate));
+    }
+
+    void reset()
+    {
+        _gain = 1.0f;
+    }
+
+    float gain() const
+    {
+        return _gain;
+    }
+
+    /**
+     * @brief Limit planar channels in place
+     *
+     * @param channels array of channel pointers
+     * @param channelCount
+     * @param count samples per channel
+     */
+    void process(float* const* channels, size_t channelCount, size_t count)
+    {
+        float g = _gain;
+        for (size_t i = 0; i < count; i++) {
+            float peak = 0.0f;
+            for (size_t c = 0; c < channelCount; c++) {
+                peak = std::fmax(peak, std::fabs(channels[c][i]));
+            }
+
+            const float target = peak > _threshold ? _threshold / peak : 1.0f;
+            if (target < g) {
+                g = target;
+            } else {
+                g = target + (g - target) * _release;
+            }
+
+            for (size_t c = 0; c < channelCount; c++) {
+                channels[c][i] *= g;
+            }
+        }
+        _gain = g;
+    }
+
+private:
+    float _threshold = 1.0f;
+    float _release   = 0.0f;
+    float _gain      = 1.0f;
+};
+
+}  // namespace app::dsp
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "noise_suppressor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace app::dsp;
+
+static constexpr float kPowerSmoothing = 0.85f;
+static constexpr float kMinimumBias    = 1.5f;   // the minimum of a smoothed periodogram sits under the mean
+static constexpr float kPriorSmoothing = 0.98f;  // decision directed weight of the previous frame
+static constexpr float kPowerFloor     = 1e-10f;
+
+static inline float db_to_linear(float db)
+{
+    return std::pow(10.0f, db / 20.0f);
+}
+
+NoiseSuppressor::NoiseSuppressor()
+{
+    _fft.init(kFrameSize);
+
+    // Periodic sqrt-Hann on both sides, the squares of two frames half a frame apart sum to one
+    for (size_t i = 0; i < kFrameSize; i++) {
+        _window[i] = std::sin(static_cast<float>(M_PI) * static_cast<float>(i) / static_cast<float>(kFrameSize));
+    }
+
+    // Flat between the band edges, half an octave raised cosine skirt on either side
+    const float bin_hz = static_cast<float>(kSampleRate) / static_cast<float>(kFrameSize);
+    for (size_t k = 0; k < kBins; k++) {
+        const float hz = std::max(static_cast<float>(k) * bin_hz, 1.0f);
+        float octaves  = 0.0f;
+        if (hz < kSpeechBandLowHz) {
+            octaves = std::log2(kSpeechBandLowHz / hz);
+        } else if (hz > kSpeechBandHighHz) {
+            octaves = std::log2(hz / kSpeechBandHighHz);
+        }
+        _emphasis[k] = octaves >= 0.5f ? 0.0f : 0.5f + 0.5f * std::cos(static_cast<float>(M_PI) * octaves * 2.0f);
+    }
+
+    for (auto& ch : _channels) {
+        ch.history.resize(kSubWindows * kBins);
+        ch.reverb.resize(kReverbDelayFrames * kBins);
+    }
+    reset();
+}
+
+void NoiseSuppressor::reset()
+{
+    for (auto& ch : _channels) {
+        reset_channel(ch);
+    }
+}
+
+void NoiseSuppressor::reset_channel(Channel& ch)
+{
+    std::memset(ch.input, 0, sizeof(ch.input));
+    std::memset(ch.overlap, 0, sizeof(ch.overlap));
+    std::memset(ch.clean, 0, sizeof(ch.clean));
+    std::fill(ch.reverb.begin(), ch.reverb.end(), 0.0f);
+    ch.subWindow  = 0;
+    ch.subFrame   = 0;
+    ch.reverbHead = 0;
+    ch.primed     = false;
+}
+
+void NoiseSuppressor::configure(float noiseReduction, float speechBoost, float dereverb)
+{
+    noiseReduction = std::clamp(noiseReduction, 0.0f, 1.0f);
+    speechBoost    = std::clamp(speechBoost, 0.0f, 1.0f);
+    dereverb       = std::clamp(dereverb, 0.0f, 1.0f);
+
+    // Power left after kReverbDelayFrames of an exponential decay reaching -60 dB at kAssumedT60
+    const float delay_s = static_cast<float>(kReverbDelayFrames * kBlockSize) / static_cast<float>(kSampleRate);
+    const float decay   = std::pow(10.0f, -6.0f * delay_s / kAssumedT60);
+
+    _gain_floor   = db_to_linear(-kMaxAttenuationDb * std::max(noiseReduction, dereverb));
+    _noise_weight = noiseReduction > 0.0f ? 1.0f : 0.0f;
+    _reverb_scale = dereverb * decay;
+    _boost        = db_to_linear(kMaxSpeechBoostDb * speechBoost) - 1.0f;
+
+    // Coming out of bypass the overlap buffers hold audio from whenever it was last active
+    const bool bypassed = noiseReduction == 0.0f && speechBoost == 0.0f && dereverb == 0.0f;
+    if (_bypassed && !bypassed) {
+        reset();
+    }
+    _bypassed = bypassed;
+}
+
+void NoiseSuppressor::track_noise(Channel& ch)
+{
+    // Minimum statistics: the noise floor is the smallest smoothed power seen over the last kSubWindows sub windows.
+    // Speech pauses come often enough that the minimum always lands on noise only bins.
+    if (!ch.primed) {
+        std::memcpy(ch.smoothed, _power, sizeof(_power));
+        std::memcpy(ch.minimum, _power, sizeof(_power));
+        for (size_t w = 0; w < kSubWindows; w++) {
+            std::memcpy(&ch.history[w * kBins], _power, sizeof(_power));
+        }
+        ch.primed = true;
+    }
+
+    for (size_t k = 0; k < kBins; k++) {
+        ch.smoothed[k] = kPowerSmoothing * ch.smoothed[k] + (1.0f - kPowerSmoothing) * _power[k];
+        ch.minimum[k]  = std::min(ch.minimum[k], ch.smoothed[k]);
+    }
+
+    for (size_t k = 0; k < kBins; k++) {
+        float m = ch.minimum[k];
+        for (size_t w = 0; w < kSubWindows; w++) {
+            m = std::min(m, ch.history[w * kBins + k]);
+        }
+        ch.noise[k] = kMinimumBias * m;
+    }
+
+    if (++ch.subFrame == kSubWindowFrames) {
+        std::memcpy(&ch.history[ch.subWindow * kBins], ch.minimum, sizeof(ch.minimum));
+        std::memcpy(ch.minimum, ch.smoothed, sizeof(ch.minimum));
+        ch.subWindow = (ch.subWindow + 1) % kSubWindows;
+        ch.subFrame  = 0;
+    }
+}
+
+void NoiseSuppressor::apply_gain(Channel& ch)
+{
+    // The oldest ring slot is the smoothed power of kReverbDelayFrames ago, swap in the current one
+    float* late = &ch.reverb[ch.reverbHead * kBins];
+    ch.reverbHead = (ch.reverbHead + 1) % kReverbDelayFrames;
+
+    for (size_t k = 0; k < kBins; k++) {
+        const float interference = _noise_weight * ch.noise[k] + _reverb_scale * late[k] + kPowerFloor;
+        late[k]                  = ch.smoothed[k];
+
+        // Decision directed a priori SNR, a Wiener gain on it, then the floor
+        const float posterior = _power[k] / interference;
+        const float prior =
+            kPriorSmoothing * ch.clean[k] / interference + (1.0f - kPriorSmoothing) * std::max(posterior - 1.0f, 0.0f);
+        const float wiener = prior / (1.0f + prior);
+        const float gain   = std::max(wiener, _gain_floor) * (1.0f + _boost * _emphasis[k] * wiener);
+
+        ch.clean[k] = wiener * wiener * _power[k];
+        _spectrum[k].re *= gain;
+        _spectrum[k].im *= gain;
+    }
+}
+
+void NoiseSuppressor::process(float* const* channels, size_t channelCount)
+{
+    ScopedCycles measure(_stats);
+    channelCount = std::min(channelCount, kMaxChannels);
+
+    for (size_t c = 0; c < channelCount; c++) {
+        Channel& ch = _channels[c];
+        float* io   = channels[c];
+
+        std::memmove(ch.input, ch.input + kBlockSize, kBlockSize * sizeof(float));
+        std::memcpy(ch.input + kBlockSize, io, kBlockSize * sizeof(float));
+        for (size_t i = 0; i < kFrameSize; i++) {
+            _time[i] = ch.input[i] * _window[i];
+        }
+        _fft.forward(_time, _spectrum);
+        for (size_t k = 0; k < kBins; k++) {
+            _power[k] = _spectrum[k].re * _spectrum[k].re + _spectrum[k].im * _spectrum[k].im;
+        }
+
+        track_noise(ch);
+        apply_gain(ch);
+
+        // Synthesis window and overlap-add, the first half completes the previous frame
+        _fft.inverse(_spectrum, _time);
+        for (size_t i = 0; i < kBlockSize; i++) {
+            io[i]         = _time[i] * _window[i] + ch.overlap[i];
+            ch.overlap[i] = _time[kBlockSize + i] * _window[kBlockSize + i];
+        }
+    }
+}
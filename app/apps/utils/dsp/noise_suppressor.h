@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "fft.h"
+#include "cycle_counter.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace app::dsp {
+
+/**
+ * @brief STFT noise suppressor with speech band emphasis and late reverb suppression
+ *
+ * 20 ms sqrt-Hann frames at a 10 ms hop, so one kBlockSize block in gives one block out, 10 ms late. The noise floor
+ * is tracked by minimum statistics over about 1.5 s and the suppression gain is a decision directed Wiener gain,
+ * floored by the noise reduction amount. Dereverb adds a late reverb estimate, the smoothed power of 50 ms ago decayed
+ * by an assumed T60, to what the Wiener gain treats as interference. Speech boost lifts 1..4 kHz, weighted by the
+ * Wiener gain so it only lifts bins that carry speech.
+ *
+ * Buffers are allocated in the constructor, process() never allocates.
+ */
+class NoiseSuppressor {
+public:
+    static constexpr uint32_t kSampleRate      = 48000;
+    static constexpr size_t kBlockSize         = kSampleRate / 100;
+    static constexpr size_t kFrameSize         = kBlockSize * 2;
+    static constexpr size_t kBins              = kFrameSize / 2 + 1;
+    static constexpr size_t kMaxChannels       = 2;
+    static constexpr size_t kSubWindows        = 8;
+    static constexpr size_t kSubWindowFrames   = 19;  // hops, the minimum is searched over about 1.5 s
+    static constexpr size_t kReverbDelayFrames = 5;   // late reverb starts 50 ms after the direct sound
+    static constexpr float kAssumedT60         = 0.5f;
+    static constexpr float kMaxAttenuationDb   = 25.0f;
+    static constexpr float kMaxSpeechBoostDb   = 6.0f;
+    static constexpr float kSpeechBandLowHz    = 1000.0f;
+    static constexpr float kSpeechBandHighHz   = 4000.0f;
+
+    NoiseSuppressor();
+
+    void reset();
+
+    /**
+     * @brief Map the 0..1 amounts from BoostSettings
+     *
+     */
+    void configure(float noiseReduction, float speechBoost, float dereverb);
+
+    /**
+     * @brief True when the amounts leave nothing to do, callers can skip process()
+     *
+     */
+    bool bypassed() const
+    {
+        return _bypassed;
+    }
+
+    /**
+     * @brief Process one block in place
+     *
+     * @param channels planar channels, kBlockSize samples each
+     * @param channelCount up to kMaxChannels
+     */
+    void process(float* const* channels, size_t channelCount);
+
+    CycleStats& stats()
+    {
+        return _stats;
+    }
+
+private:
+    struct Channel {
+        float input[kFrameSize];     // previous block followed by the current one
+        float overlap[kBlockSize];   // second half of the last synthesis frame
+        float smoothed[kBins];       // recursively smoothed power, what the minimum search runs on
+        float noise[kBins];
+        float clean[kBins];          // last frame's speech power estimate, for the decision directed SNR
+        float minimum[kBins];        // running minimum of the current sub window
+        std::vector<float> history;  // [kSubWindows][kBins] minima of the finished sub windows
+        std::vector<float> reverb;   // [kReverbDelayFrames][kBins] ring of past smoothed power
+        size_t subWindow  = 0;
+        size_t subFrame   = 0;
+        size_t reverbHead = 0;
+        bool primed       = false;
+    };
+
+    RealFft _fft;
+    Channel _channels[kMaxChannels];
+    float _window[kFrameSize];
+    float _emphasis[kBins];  // 0..1 speech band weight
+    float _gain_floor   = 1.0f;
+    float _noise_weight = 0.0f;
+    float _reverb_scale = 0.0f;
+    float _boost        = 0.0f;  // linear speech boost minus one
+    bool _bypassed      = true;
+
+    // Scratch
+    float _time[kFrameSize];
+    float _power[kBins];
+    Complex _spectrum[kBins];
+
+    CycleStats _stats;
+
+    void reset_channel(Channel& ch);
+    void track_noise(Channel& ch);
+    void apply_gain(Channel& ch);
+};
+
+}  // namespace app::dsp
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "attitude_estimator.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+using namespace imu;
+
+static constexpr float kDegToRad = 0.0174532925f;
+static constexpr float kRadToDeg = 57.2957795f;
+
+static bool usable_accel(const float accel[3], float& norm)
+{
+    norm = std::sqrt((accel[0] * accel[0]) + (accel[1] * accel[1]) + (accel[2] * accel[2]));
+    return norm > 0.0f && std::fabs(norm - 1.0f) <= MahonyFilter::kAccelTolerance;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Mahony filter                               */
+/* -------------------------------------------------------------------------- */
+void MahonyFilter::reset(const float accel[3])
+{
+    _q[0] = 1.0f;
+    _q[1] = 0.0f;
+    _q[2] = 0.0f;
+    _q[3] = 0.0f;
+    std::fill(std::begin(_integral), std::end(_integral), 0.0f);
+
+    float norm = 0.0f;
+    if (accel == nullptr || !usable_accel(accel, norm)) {
+        return;
+    }
+
+    // Level with the reading, yaw zero
+    const float roll  = std::atan2(accel[1], accel[2]);
+    const float pitch = std::atan2(-accel[0], std::sqrt((accel[1] * accel[1]) + (accel[2] * accel[2])));
+    const float cr    = std::cos(roll * 0.5f);
+    const float sr    = std::sin(roll * 0.5f);
+    const float cp    = std::cos(pitch * 0.5f);
+    const float sp    = std::sin(pitch * 0.5f);
+    _q[0]             = cr * cp;
+    _q[1]             = sr * cp;
+    _q[2]             = cr * sp;
+    _q[3]             = -sr * sp;
+}
+
+void MahonyFilter::update(const float gyro[3], const float accel[3], float dt)
+{
+    float gx = gyro[0];
+    float gy = gyro[1];
+    float gz = gyro[2];
+    float w  = _q[0];
+    float x  = _q[1];
+    float y  = _q[2];
+    float z  = _q[3];
+
+    float norm = 0.0f;
+    if (usable_accel(accel, norm)) {
+        const float ax = accel[0] / norm;
+        const float ay = accel[1] / norm;
+        const float az = accel[2] / norm;
+
+        // Error is the rotation from the estimated to the measured up vector
+        const float vx = 2.0f * ((x * z) - (w * y));
+        const float vy = 2.0f * ((w * x) + (y * z));
+        const float vz = (w * w) - (x * x) - (y * y) + (z * z);
+        const float ex = (ay * vz) - (az * vy);
+        const float ey = (az * vx) - (ax * vz);
+        const float ez = (ax * vy) - (ay * vx);
+
+        if (_ki > 0.0f) {
+            _integral[0] = std::clamp(_integral[0] + (_ki * ex * dt), -kMaxBias, kMaxBias);
+            _integral[1] = std::clamp(_integral[1] + (_ki * ey * dt), -kMaxBias, kMaxBias);
+            _integral[2] = std::clamp(_integral[2] + (_ki * ez * dt), -kMaxBias, kMaxBias);
+        }
+        gx += (_kp * ex);
+        gy += (_kp * ey);
+        gz += (_kp * ez);
+    }
+    gx += _integral[0];
+    gy += _integral[1];
+    gz += _integral[2];
+
+    // q' = q * (0, g) / 2
+    const float h = 0.5f * dt;
+    _q[0]         = w + (h * (-(x * gx) - (y * gy) - (z * gz)));
+    _q[1]         = x + (h * ((w * gx) + (y * gz) - (z * gy)));
+    _q[2]         = y + (h * ((w * gy) - (x * gz) + (z * gx)));
+    _q[3]         = z + (h * ((w * gz) + (x * gy) - (y * gx)));
+
+    const float inv = 1.0f / std::sqrt((_q[0] * _q[0]) + (_q[1] * _q[1]) + (_q[2] * _q[2]) + (_q[3] * _q[3]));
+    for (float& c : _q) {
+        c *= inv;
+    }
+}
+
+void MahonyFilter::gravity(float out[3]) const
+{
+    const float w = _q[0];
+    const float x = _q[1];
+    const float y = _q[2];
+    const float z = _q[3];
+    out[0]        = 2.0f * ((x * z) - (w * y));
+    out[1]        = 2.0f * ((w * x) + (y * z));
+    out[2]        = (w * w) - (x * x) - (y * y) + (z * z);
+}
+
+void MahonyFilter::bias(float out[3]) const
+{
+    for (int i = 0; i < 3; i++) {
+        out[i] = -_integral[i];
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                             Attitude estimator                             */
+/* -------------------------------------------------------------------------- */
+void AttitudeEstimator::process(const ImuSample_t* samples, size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const ImuSample_t& sample = samples[i];
+        // Signed difference, so the 32 bit microsecond clock may wrap
+        const float dt = static_cast<int32_t>(sample.timestampUs - _work.sample.timestampUs) * 1e-6f;
+
+        if (!_started || dt < 0.0f || dt > kMaxDt) {
+            _filter.reset(sample.accel);
+            _started = true;
+        } else if (dt > 0.0f) {
+            const float gyro[3] = {sample.gyro[0] * kDegToRad, sample.gyro[1] * kDegToRad, sample.gyro[2] * kDegToRad};
+            _filter.update(gyro, sample.accel, dt);
+        }
+        _work.sample = sample;
+        _work.sampleCount++;
+    }
+
+    const float* q = _filter.quaternion();
+    std::copy(q, q + 4, _work.quaternion);
+    _filter.gravity(_work.gravity);
+    _filter.bias(_work.gyroBias);
+    for (float& b : _work.gyroBias) {
+        b *= kRadToDeg;
+    }
+
+    const float* g = _work.gravity;
+    _work.roll     = std::atan2(g[1], g[2]) * kRadToDeg;
+    _work.pitch    = std::atan2(-g[0], std::sqrt((g[1] * g[1]) + (g[2] * g[2]))) * kRadToDeg;
+    _work.yaw =
+        std::atan2(2.0f * ((q[0] * q[3]) + (q[1] * q[2])), 1.0f - (2.0f * ((q[2] * q[2]) + (q[3] * q[3])))) *
+        kRadToDeg;
+
+    _attitude.store(_work);
+}
@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "../sync/seqlock.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace imu {
+
+/**
+ * @brief One accel + gyro sample, in any right-handed frame as long as both sensors share it
+ *
+ */
+struct ImuSample_t {
+    uint32_t timestampUs = 0;
+    float accel[3]       = {};  // g, reads +1 along up at rest
+    float gyro[3]        = {};  // °/s
+};
+
+/**
+ * @brief What the UI reads: the fused orientation and the sample it was last updated with
+ *
+ */
+struct Attitude_t {
+    float quaternion[4] = {1.0f, 0.0f, 0.0f, 0.0f};  // w, x, y, z, sensor frame to earth frame (z up)
+    float gravity[3]    = {0.0f, 0.0f, 1.0f};        // unit up vector in the sensor frame, what accel reads at rest
+    float roll          = 0.0f;                      // degrees, from gravity
+    float pitch         = 0.0f;
+    float yaw           = 0.0f;  // degrees, relative to the first sample, drifts without a magnetometer
+    float gyroBias[3]   = {};    // °/s, estimated
+    ImuSample_t sample;
+    uint32_t sampleCount = 0;
+};
+
+/**
+ * @brief Mahony complementary filter, gyro integration corrected towards the measured gravity
+ *
+ * The integral term of the correction converges to the gyro bias on the roll and pitch axes, so a resting device
+ * stays level instead of drifting. Accel samples too far from 1 g (shakes, taps) are left out of the correction.
+ */
+class MahonyFilter {
+public:
+    static constexpr float kDefaultKp      = 1.0f;
+    static constexpr float kDefaultKi      = 0.05f;
+    static constexpr float kAccelTolerance = 0.15f;  // g away from 1 g beyond which accel is ignored
+    static constexpr float kMaxBias        = 0.1f;   // rad/s, integral clamp
+
+    void setGains(float kp, float ki)
+    {
+        _kp = kp;
+        _ki = ki;
+    }
+
+    /**
+     * @brief Start over, level with the given gravity reading if it is usable, identity otherwise
+     *
+     */
+    void reset(const float accel[3] = nullptr);
+
+    /**
+     * @brief One step, gyro in rad/s, accel in g, dt in seconds
+     *
+     */
+    void update(const float gyro[3], const float accel[3], float dt);
+
+    const float* quaternion() const
+    {
+        return _q;
+    }
+    /**
+     * @brief Gyro bias the integral term has settled on, rad/s
+     *
+     */
+    void bias(float out[3]) const;
+
+    /**
+     * @brief Unit up vector in the sensor frame
+     *
+     */
+    void gravity(float out[3]) const;
+
+private:
+    float _q[4]        = {1.0f, 0.0f, 0.0f, 0.0f};
+    float _integral[3] = {};  // rad/s added to the gyro, the negated bias
+    float _kp          = kDefaultKp;
+    float _ki          = kDefaultKi;
+};
+
+/**
+ * @brief Timestamped sample batches in, a SeqLock published attitude out
+ *
+ * Runs in whatever context drains the IMU, one publish per batch, readers never block it.
+ */
+class AttitudeEstimator {
+public:
+    static constexpr float kMaxDt = 0.05f;  // s, longer gaps restart from the accel reading
+
+    void process(const ImuSample_t* samples, size_t count);
+
+    Attitude_t attitude(uint32_t* generation = nullptr) const
+    {
+        return _attitude.load(generation);
+    }
+
+    MahonyFilter& filter()
+    {
+        return _filter;
+    }
+
+private:
+    MahonyFilter _filter;
+    Attitude_t _work;
+    bool _started = false;
+    app::sync::SeqLock<Attitude_t> _attitude;
+};
+
+}  // namespace imu
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace app::sync {
+
+/**
+ * @brief Sequence lock protected snapshot of a trivially copyable value
+ *
+ * One writer at a time (callers serialize writers), any number of readers. Readers never block the writer and
+ * retry only if a write landed in the middle of their copy, so load() is lock-free but not wait-free: a writer
+ * storing back to back can keep a reader spinning. Readers with a deadline use tryLoad(), which gives up after a
+ * bounded number of attempts so the caller can keep its last good copy. The payload is stored as relaxed atomic
+ * words so concurrent access is well defined under the C++ memory model, no platform primitives involved.
+ *
+ * @tparam T
+ */
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+
+public:
+    SeqLock()
+    {
+        store_words(T{});
+    }
+
+    explicit SeqLock(const T& value)
+    {
+        store_words(value);
+    }
+
+    /**
+     * @brief Publish a new value, must not be called concurrently with another store
+     *
+     */
+    void store(const T& value)
+    {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        store_words(value);
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Read a consistent copy, retrying for as long as writes keep landing mid-copy
+     *
+     * @param generation optional, receives the generation the copy belongs to
+     * @return T
+     */
+    T load(uint32_t* generation = nullptr) const
+    {
+        T value;
+        while (!tryLoad(value, generation, kDefaultAttempts)) {
+        }
+        return value;
+    }
+
+    /**
+     * @brief Read a consistent copy in bounded time
+     *
+     * @param value receives the copy, left untouched on failure
+     * @param generation optional, receives the generation the copy belongs to, untouched on failure
+     * @param maxAttempts copies tried before giving up, each one costs a payload copy
+     * @return false if every attempt overlapped a write
+     */
+    bool tryLoad(T& value, uint32_t* generation = nullptr, uint32_t maxAttempts = kDefaultAttempts) const
+    {
+        uint32_t words[kWords];
+        for (uint32_t attempt = 0; attempt < maxAttempts; attempt++) {
+            const uint32_t seq_begin = _seq.load(std::memory_order_acquire);
+            if (seq_begin & 1) {
+                continue;
+            }
+            for (size_t i = 0; i < kWords; i++) {
+                words[i] = _words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_seq.load(std::memory_order_relaxed) != seq_begin) {
+                continue;
+            }
+
+            if (generation) {
+                *generation = seq_begin / 2;
+            }
+            std::memcpy(&value, words, sizeof(T));
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Number of completed stores, cheap enough to poll once per audio block
+     *
+     * @return uint32_t
+     */
+    uint32_t generation() const
+    {
+        return _seq.load(std::memory_order_acquire) / 2;
+    }
+
+    static constexpr uint32_t kDefaultAttempts = 8;
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> _seq{0};
+    std::atomic<uint32_t> _words[kWords];
+
+    void store_words(const T& value)
+    {
+        uint32_t words[kWords] = {};
+        std::memcpy(words, &value, sizeof(T));
+        for (size_t i = 0; i < kWords; i++) {
+            _words[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+};
+
+}  // namespace app::sync
@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "alpha_raster.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace ui;
+
+void AlphaRaster::Area_t::join(const Area_t& other)
+{
+    if (other.empty()) {
+        return;
+    }
+    if (empty()) {
+        *this = other;
+        return;
+    }
+    x1 = std::min(x1, other.x1);
+    y1 = std::min(y1, other.y1);
+    x2 = std::max(x2, other.x2);
+    y2 = std::max(y2, other.y2);
+}
+
+void AlphaRaster::init(int width, int height, size_t stride)
+{
+    _width  = std::max(width, 0);
+    _height = std::max(height, 0);
+    _stride = std::max<size_t>(stride, _width);
+    _buffer.assign(_stride * _height, 0);
+    _drawn = Area_t();
+}
+
+AlphaRaster::Area_t AlphaRaster::clear()
+{
+    Area_t cleared = _drawn;
+    if (!cleared.empty()) {
+        for (int y = cleared.y1; y <= cleared.y2; y++) {
+            std::memset(_buffer.data() + (y * _stride) + cleared.x1, 0, cleared.x2 - cleared.x1 + 1);
+        }
+    }
+    _drawn = Area_t();
+    return cleared;
+}
+
+void AlphaRaster::drawLine(float x0, float y0, float x1, float y1, float lineWidth)
+{
+    if (_buffer.empty()) {
+        return;
+    }
+
+    // Coverage falls from full to none over the pixel either side of the edge of the stroke
+    const float reach      = std::max(lineWidth, 1.0f) * 0.5f + 0.5f;
+    const float reach_sq   = reach * reach;
+    const float solid      = std::max(reach - 1.0f, 0.0f);
+    const float solid_sq   = solid * solid;
+    const float dx         = x1 - x0;
+    const float dy         = y1 - y0;
+    const float length_sq  = (dx * dx) + (dy * dy);
+    const float inv_length = (length_sq > 0.0f) ? (1.0f / length_sq) : 0.0f;
+
+    // Walk the major axis. Within one major step every pixel closer than reach to the segment, round caps included,
+    // lies within reach * length / |major delta| of the line, so that is all there is to test.
+    const bool x_major  = std::fabs(dx) >= std::fabs(dy);
+    const float m0      = x_major ? x0 : y0;
+    const float n0      = x_major ? y0 : x0;
+    const float dm      = x_major ? dx : dy;
+    const float dn      = x_major ? dy : dx;
+    const float slope   = (dm != 0.0f) ? (dn / dm) : 0.0f;
+    const float half    = (dm != 0.0f) ? (reach * std::sqrt(length_sq) / std::fabs(dm)) : reach;
+    const int major_end = x_major ? _width - 1 : _height - 1;
+    const int minor_end = x_major ? _height - 1 : _width - 1;
+
+    const int m_first = std::max(static_cast<int>(std::floor(std::min(m0, m0 + dm) - reach)), 0);
+    const int m_last  = std::min(static_cast<int>(std::ceil(std::max(m0, m0 + dm) + reach)), major_end);
+
+    Area_t area;
+    for (int m = m_first; m <= m_last; m++) {
+        const float centre = n0 + ((m - m0) * slope);
+        const int n_first  = std::max(static_cast<int>(std::floor(centre - half)), 0);
+        const int n_last   = std::min(static_cast<int>(std::ceil(centre + half)), minor_end);
+        if (n_first > n_last) {
+            continue;
+        }
+
+        for (int n = n_first; n <= n_last; n++) {
+            const int x = x_major ? m : n;
+            const int y = x_major ? n : m;
+
+            // Distance to the closest point of the segment
+            const float px = x - x0;
+            const float py = y - y0;
+            const float t  = std::clamp(((px * dx) + (py * dy)) * inv_length, 0.0f, 1.0f);
+            const float ex = px - (t * dx);
+            const float ey = py - (t * dy);
+            const float sq = (ex * ex) + (ey * ey);
+            if (sq >= reach_sq) {
+                continue;
+            }
+
+            const uint8_t alpha = (sq <= solid_sq) ? 255 : static_cast<uint8_t>((reach - std::sqrt(sq)) * 255.0f);
+            uint8_t& pixel      = _buffer[(y * _stride) + x];
+            pixel               = std::max(pixel, alpha);
+        }
+
+        Area_t column;
+        column.x1 = x_major ? m : n_first;
+        column.x2 = x_major ? m : n_last;
+        column.y1 = x_major ? n_first : m;
+        column.y2 = x_major ? n_last : m;
+        area.join(column);
+    }
+    _drawn.join(area);
+}
@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ui {
+
+/**
+ * @brief Anti-aliased lines rasterized into an owned 8-bit alpha buffer
+ *
+ * Meant as the buffer of an A8 canvas, which LVGL draws in the canvas' image recolor, so one canvas can stand in for
+ * any number of line objects. Lines are round capped and overlapping lines keep the higher coverage. Only the area
+ * drawn since the last clear() is ever touched again, so a small drawing in a large buffer stays cheap.
+ */
+class AlphaRaster {
+public:
+    struct Area_t {
+        int x1 = 0;
+        int y1 = 0;
+        int x2 = -1;  // inclusive, x2 < x1 is empty
+        int y2 = -1;
+
+        bool empty() const
+        {
+            return x2 < x1 || y2 < y1;
+        }
+        void join(const Area_t& other);
+    };
+
+    /**
+     * @brief Allocate a cleared buffer, stride in bytes, 0 for the width
+     *
+     */
+    void init(int width, int height, size_t stride = 0);
+
+    uint8_t* data()
+    {
+        return _buffer.data();
+    }
+    int width() const
+    {
+        return _width;
+    }
+    int height() const
+    {
+        return _height;
+    }
+    size_t stride() const
+    {
+        return _stride;
+    }
+
+    /**
+     * @brief Line between two pixel centres, coordinates may be fractional and outside the buffer
+     *
+     */
+    void drawLine(float x0, float y0, float x1, float y1, float lineWidth);
+
+    /**
+     * @brief Clear what was drawn and return the area it covered, for invalidating
+     *
+     */
+    Area_t clear();
+
+    /**
+     * @brief Area drawn since the last clear()
+     *
+     */
+    const Area_t& drawnArea() const
+    {
+        return _drawn;
+    }
+
+private:
+    std::vector<uint8_t> _buffer;
+    int _width     = 0;
+    int _height    = 0;
+    size_t _stride = 0;
+    Area_t _drawn;
+};
+
+}  // namespace ui
@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "render_bench.h"
+#include <hal/hal.h>
+#include <mooncake_log.h>
+#include <smooth_ui_toolkit.h>
+#include <smooth_lvgl.h>
+#include <algorithm>
+#include <vector>
+
+using namespace ui;
+using namespace smooth_ui_toolkit::lvgl_cpp;
+
+static const std::string _tag = "render-bench";
+
+static const Window::KeyFrame_t _kf_bench_close = {436, -219, 75, 75, 0};
+static const Window::KeyFrame_t _kf_bench_open  = {214, 85, 800, 480, 255};
+
+// A window with some text and shapes in it, so the open animation draws more than a flat rectangle
+class BenchWindow : public Window {
+public:
+    BenchWindow()
+    {
+        config.title        = "Render Bench";
+        config.kfClosed     = _kf_bench_close;
+        config.kfOpened     = _kf_bench_open;
+        config.clickBgClose = false;
+    }
+
+    void onInit() override
+    {
+        _window->setScrollbarMode(LV_SCROLLBAR_MODE_OFF);
+
+        for (int i = 0; i < 6; i++) {
+            auto bar = std::make_unique<Container>(_window->get());
+            bar->setSize(120, 40 + i * 40);
+            bar->align(LV_ALIGN_BOTTOM_LEFT, 40 + i * 124, -40);
+            bar->setRadius(12);
+            bar->setBorderWidth(0);
+            bar->setBgColor(lv_color_hex(i % 2 ? 0xE58C6B : 0x4FA3C7));
+            bar->removeFlag(LV_OBJ_FLAG_CLICKABLE);
+            _bars.push_back(std::move(bar));
+        }
+
+        _label = std::make_unique<Label>(_window->get());
+        _label->align(LV_ALIGN_TOP_LEFT, 40, 60);
+        _label->setTextFont(&lv_font_montserrat_24);
+        _label->setTextColor(lv_color_hex(0xECEBEB));
+        _label->setText("The quick brown fox\njumps over the lazy dog\n0123456789");
+    }
+
+private:
+    std::vector<std::unique_ptr<Container>> _bars;
+    std::unique_ptr<Label> _label;
+};
+
+RenderBench::~RenderBench()
+{
+    if (_display) {
+        lv_display_remove_event_cb_with_user_data(_display, on_display_event, this);
+    }
+}
+
+void RenderBench::start(lv_obj_t* parent)
+{
+    if (isRunning()) {
+        return;
+    }
+
+    _display = lv_obj_get_display(parent);
+    lv_display_add_event_cb(_display, on_display_event, LV_EVENT_REFR_START, this);
+    lv_display_add_event_cb(_display, on_display_event, LV_EVENT_REFR_READY, this);
+
+    _window = std::make_unique<BenchWindow>();
+    _window->init(parent);
+
+    mclog::tagInfo(_tag, "start, {} ms full redraw, {} window cycles", config.redrawMs, config.windowCycles);
+    begin_phase(Redraw);
+}
+
+void RenderBench::update()
+{
+    if (_phase == Idle) {
+        return;
+    }
+
+    _window->update();
+
+    if (_phase == Redraw) {
+        // Keep the whole screen dirty, every refresh renders and flushes a full frame
+        lv_obj_invalidate(lv_display_get_screen_active(_display));
+        if (GetHAL()->millis() - _phase_start_ms >= config.redrawMs) {
+            end_phase("redraw");
+            begin_phase(WindowAnim);
+            _window->open();
+        }
+        return;
+    }
+
+    auto state = _window->getState();
+    if (state == Window::Opened) {
+        _window->close();
+    } else if (state == Window::Closed) {
+        if (++_cycles < config.windowCycles) {
+            _window->open();
+        } else {
+            end_phase("window");
+            finish();
+        }
+    }
+}
+
+void RenderBench::on_display_event(lv_event_t* e)
+{
+    auto* self = static_cast<RenderBench*>(lv_event_get_user_data(e));
+    if (self->_phase == Idle) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        self->_refresh_start = now;
+        return;
+    }
+
+    uint32_t us = std::chrono::duration_cast<std::chrono::microseconds>(now - self->_refresh_start).count();
+    self->_sums.frames++;
+    self->_sums.refreshUs += us;
+    self->_sums.maxRefreshUs = std::max(self->_sums.maxRefreshUs, us);
+}
+
+void RenderBench::begin_phase(Phase_t phase)
+{
+    // Restart the interval the hal averages over
+    GetHAL()->getDisplayFlushStats();
+    GetHAL()->getCpuCoreLoads();
+
+    _phase          = phase;
+    _cycles         = 0;
+    _sums           = {};
+    _phase_start_ms = GetHAL()->millis();
+}
+
+void RenderBench::end_phase(const std::string& name)
+{
+    const uint32_t elapsed_ms = std::max<uint32_t>(GetHAL()->millis() - _phase_start_ms, 1);
+    const auto flush          = GetHAL()->getDisplayFlushStats();
+    const auto loads          = GetHAL()->getCpuCoreLoads();
+
+    std::string cores;
+    for (size_t i = 0; i < loads.size(); i++) {
+        cores += " " + std::to_string(i) + ":" + std::to_string(static_cast<int>(loads[i] + 0.5f)) + "%";
+    }
+    if (cores.empty()) {
+        cores = " n/a";
+    }
+
+    const uint32_t frames = std::max<uint32_t>(_sums.frames, 1);
+    mclog::tagInfo(_tag, "{}: {} frames in {} ms, {:.1f} fps, refresh {} us avg {} us max", name, _sums.frames,
+                   elapsed_ms, _sums.frames * 1000.0f / elapsed_ms, _sums.refreshUs / frames, _sums.maxRefreshUs);
+    mclog::tagInfo(_tag, "{}: render {} us, flush latency {} us per area, core load{}", name, flush.renderUs,
+                   flush.latencyUs, cores);
+}
+
+void RenderBench::finish()
+{
+    _phase = Idle;
+    lv_display_remove_event_cb_with_user_data(_display, on_display_event, this);
+    _display = nullptr;
+    _window.reset();
+    mclog::tagInfo(_tag, "done");
+}
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include "window.h"
+#include <lvgl.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ui {
+
+/**
+ * @brief Repeatable render load on top of whatever screen is showing, logs frame timing and per core load
+ *
+ * Two phases: the whole screen redrawn every frame, then a window opened and closed a fixed number of times. Both
+ * run through the normal display path, so the numbers include the draw units, the flush and the panel. start() and
+ * update() must be called with the lvgl lock held.
+ */
+class RenderBench {
+public:
+    struct Config_t {
+        uint32_t redrawMs     = 3000;
+        uint32_t windowCycles = 5;  // open + close
+    };
+
+    Config_t config;
+
+    ~RenderBench();
+
+    void start(lv_obj_t* parent);
+    void update();
+    inline bool isRunning() const
+    {
+        return _phase != Idle;
+    }
+
+private:
+    enum Phase_t {
+        Idle,
+        Redraw,
+        WindowAnim,
+    };
+
+    struct Sums_t {
+        uint32_t frames       = 0;
+        uint64_t refreshUs    = 0;  // refresh start to ready, drawing and flushing
+        uint32_t maxRefreshUs = 0;
+    };
+
+    Phase_t _phase           = Idle;
+    lv_display_t* _display   = nullptr;
+    uint32_t _cycles         = 0;
+    uint32_t _phase_start_ms = 0;
+    std::unique_ptr<Window> _window;
+    Sums_t _sums;
+    std::chrono::steady_clock::time_point _refresh_start;
+
+    static void on_display_event(lv_event_t* e);
+    void begin_phase(Phase_t phase);
+    void end_phase(const std::string& name);
+    void finish();
+};
+
+}  // namespace ui
@@ -1,54 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_CHG_ARROW_DOWN
-#define LV_ATTRIBUTE_IMAGE_CHG_ARROW_DOWN
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_CHG_ARROW_DOWN uint8_t chg_arrow_down_map[] = {
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7e, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x3c, 0xef, 0x3c, 0xf7, 0x3c, 0xff, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xf7, 0x3c, 0xf7, 0x1b, 0xff, 0x1b, 0xff, 0x1a, 0xff, 0xb9, 0xfe, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x1b, 0xff, 0xfa, 0xfe, 0x36, 0xfe, 0xf1, 0xdc, 0xcc, 0xb3, 0xc9, 0x92, 0xe9, 0x9a, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xba, 0xde, 0xb6, 0xb5, 0xdb, 0xd6, 0x5d, 0xef, 0x3c, 0xf7, 0x95, 0xcd, 0x4b, 0xa3, 0xa8, 0x92, 0xed, 0xbb, 0x32, 0xdd, 0x36, 0xfe, 0xf9, 0xfe, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xde, 0xb6, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x1c, 0xe7, 0x3c, 0xf7, 0x95, 0xcd, 0x95, 0xd5, 0xfa, 0xfe, 0x1b, 0xff, 0x1b, 0xf7, 0x3c, 0xf7, 0x5c, 0xf7, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb7, 0xb5, 0x18, 0xc6, 0x3c, 0xf7, 0x3c, 0xf7, 0x1b, 0xff, 0x1c, 0xf7, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xe7, 0x7e, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x18, 0xc6, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x9a, 0xd6, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x59, 0xce, 0xb6, 0xb5, 0xb6, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x1c, 0xdf, 0x5d, 0xe7, 0x5d, 0xe7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb7, 0xbd, 0x79, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfb, 0xde, 0xb7, 0xbd, 0xb7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x18, 0xc6, 0x9a, 0xd6, 0x3c, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xf8, 0xc5, 0x9a, 0xd6, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x3d, 0xef, 0xf8, 0xc5, 0xb6, 0xb5, 0xd7, 0xbd, 0x79, 0xce, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x59, 0xce, 0x59, 0xce, 0xfb, 0xde, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-};
-
-const lv_image_dsc_t chg_arrow_down = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 20,
-  .header.h = 20,
-  .data_size = 400 * 2,
-  .data = chg_arrow_down_map,
-};
@@ -1,54 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_CHG_ARROW_UP
-#define LV_ATTRIBUTE_IMAGE_CHG_ARROW_UP
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_CHG_ARROW_UP uint8_t chg_arrow_up_map[] = {
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xdb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x9a, 0xd6, 0x59, 0xce, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xb6, 0xbd, 0xbb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xb6, 0xb5, 0xb6, 0xb5, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x9a, 0xd6, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0xb7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0x39, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xba, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x79, 0xd6, 0xb6, 0xbd, 0xb6, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x79, 0xce, 0xb6, 0xbd, 0xb6, 0xbd, 0xb6, 0xbd, 0xb7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x79, 0xd6, 0xb6, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb7, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x38, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x59, 0xce, 0xb7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x9a, 0xd6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xfc, 0xe6, 0x38, 0xce, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3c, 0xf7, 0xfb, 0xf6, 0x1b, 0xf7, 0x3c, 0xef, 0xfb, 0xde, 0x18, 0xc6, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3b, 0xf7, 0x1a, 0xff, 0xcd, 0xab, 0xf2, 0xc4, 0x3c, 0xf7, 0x5d, 0xe7, 0x5d, 0xef, 0xfb, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3c, 0xf7, 0xfa, 0xfe, 0xb0, 0xcc, 0x4a, 0xa3, 0xd9, 0xfe, 0x3c, 0xf7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xf7, 0x1b, 0xff, 0xf1, 0xdc, 0xe9, 0x9a, 0x78, 0xf6, 0x1b, 0xff, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3c, 0xf7, 0x1b, 0xff, 0xd1, 0xcc, 0xc9, 0x9a, 0x16, 0xfe, 0x1b, 0xff, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xf7, 0xda, 0xf6, 0xed, 0xbb, 0x0a, 0xa3, 0x58, 0xf6, 0x1b, 0xff, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x9d, 0xff, 0xd6, 0xdd, 0x0d, 0xcc, 0xd8, 0xfe, 0x5c, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-};
-
-const lv_image_dsc_t chg_arrow_up = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 20,
-  .header.h = 20,
-  .data_size = 400 * 2,
-  .data = chg_arrow_up_map,
-};
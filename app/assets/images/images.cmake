@@ -0,0 +1,43 @@
+# Image assets, converted from PNG to LZ4 compressed LVGL C arrays at build time
+#
+# app_generate_images(<target>) adds the generated sources to <target>, declarations stay in <assets/assets.h>. Add an
+# image by dropping its PNG next to this file and adding another app_add_image() line below.
+
+set(APP_IMAGES_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+function(app_add_image target name)
+    set(png ${APP_IMAGES_DIR}/${name}.png)
+    set(source ${CMAKE_CURRENT_BINARY_DIR}/generated/assets/images/${name}.c)
+    add_custom_command(
+        OUTPUT ${source}
+        COMMAND ${Python3_EXECUTABLE} ${APP_IMAGES_DIR}/png_to_lvgl.py ${png} ${source} --name ${name}
+        DEPENDS ${APP_IMAGES_DIR}/png_to_lvgl.py ${png}
+        COMMENT "Generating image ${name}.c"
+        VERBATIM
+    )
+    target_sources(${target} PRIVATE ${source})
+endfunction()
+
+function(app_generate_images target)
+    if(NOT Python3_EXECUTABLE)
+        find_package(Python3 REQUIRED COMPONENTS Interpreter)
+    endif()
+
+    app_add_image(${target} arrow_state_on)
+    app_add_image(${target} chg_arrow_down)
+    app_add_image(${target} chg_arrow_up)
+    app_add_image(${target} internal_i2c_dev_chart)
+    app_add_image(${target} logo_5)
+    app_add_image(${target} logo_tab)
+    app_add_image(${target} mouse_cursor)
+    app_add_image(${target} porta_i2c_dev_chart)
+    app_add_image(${target} porta_i2c_ext5v_on)
+    app_add_image(${target} sw_chg_off)
+    app_add_image(${target} sw_chg_on)
+    app_add_image(${target} sw_off)
+    app_add_image(${target} sw_on)
+    app_add_image(${target} sw_qc_off)
+    app_add_image(${target} sw_qc_on)
+    app_add_image(${target} sw_rf_h)
+    app_add_image(${target} sw_rf_l)
+endfunction()
@@ -1,155 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_MOUSE_CURSOR
-#define LV_ATTRIBUTE_IMAGE_MOUSE_CURSOR
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MOUSE_CURSOR uint8_t mouse_cursor_map[] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0xae, 0xfc, 0x72, 0xfd, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0xae, 0xfc, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0xea, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0x46, 0xfb, 0xea, 0xfb, 0xae, 0xfc, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x72, 0xfd, 0x72, 0xfd, 0xae, 0xfc, 0xae, 0xfc, 0x72, 0xfd, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x36, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x80, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-const lv_image_dsc_t mouse_cursor = {
-  .header.cf = LV_COLOR_FORMAT_RGB565A8,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 60,
-  .header.h = 60,
-  .data_size = 3600 * 3,
-  .data = mouse_cursor_map,
-};
@@ -0,0 +1,265 @@
+"""
+SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+
+SPDX-License-Identifier: MIT
+
+Convert a PNG into an LVGL 9 C array image, LZ4 compressed.
+
+8-bit RGB and RGBA PNGs are supported. Opaque images become RGB565, images with any transparency RGB565A8. The pixel
+data is LZ4 block compressed behind LVGL's 12-byte compressed image header, so LVGL decodes it on first draw and keeps
+the result in its image cache. Images that compress by less than --min-saving stay raw.
+
+    python png_to_lvgl.py sw_on.png sw_on.c --name sw_on
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+LV_IMAGE_COMPRESS_LZ4 = 2
+
+LZ4_MIN_MATCH = 4
+LZ4_LAST_LITERALS = 5  # the block always ends with at least this many literals
+LZ4_MF_LIMIT = 12  # no match may start closer than this to the end of the block
+LZ4_MAX_OFFSET = 65535
+LZ4_HASH_LOG = 16
+LZ4_CHAIN_DEPTH = 32
+
+
+def read_png(path):
+    """Return (width, height, channels, pixel bytes row by row without filter bytes)"""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("{}: not a png".format(path))
+
+    pos = 8
+    idat = bytearray()
+    header = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos : pos + 8])
+        chunk = data[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    width, height, depth, color_type, _, _, interlace = header
+    channels = {2: 3, 6: 4}.get(color_type)
+    if depth != 8 or channels is None or interlace != 0:
+        raise ValueError("{}: only 8-bit non-interlaced RGB and RGBA pngs are supported".format(path))
+
+    raw = zlib.decompress(bytes(idat))
+    stride = width * channels
+    pixels = bytearray(stride * height)
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1 : (y + 1) * (stride + 1)])
+        for x in range(stride):
+            a = line[x - channels] if x >= channels else 0
+            b = prev[x]
+            c = prev[x - channels] if x >= channels else 0
+            if kind == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif kind == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif kind == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[x] = (line[x] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        pixels[y * stride : (y + 1) * stride] = line
+        prev = line
+    return width, height, channels, bytes(pixels)
+
+
+def to_lvgl(width, height, channels, pixels):
+    """Return (color format, stride, data) in LVGL's little-endian RGB565, alpha plane after the color plane"""
+    count = width * height
+    color = bytearray(count * 2)
+    alpha = bytearray(count)
+    for i in range(count):
+        r, g, b = pixels[i * channels : i * channels + 3]
+        value = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        color[i * 2] = value & 0xFF
+        color[i * 2 + 1] = value >> 8
+        alpha[i] = pixels[i * channels + 3] if channels == 4 else 0xFF
+
+    if all(a == 0xFF for a in alpha):
+        return "LV_COLOR_FORMAT_RGB565", width * 2, bytes(color)
+    return "LV_COLOR_FORMAT_RGB565A8", width * 2, bytes(color + alpha)
+
+
+def lz4_compress(data):
+    """LZ4 block format, greedy matching over hash chains"""
+    out = bytearray()
+    n = len(data)
+    head = {}
+    chain = [-1] * n
+    anchor = 0
+    pos = 0
+    match_limit = n - LZ4_MF_LIMIT
+
+    def emit(literal_end, offset, match_len):
+        literals = literal_end - anchor
+        token_pos = len(out)
+        out.append(0)
+        token = min(literals, 15) << 4
+        if literals >= 15:
+            rest = literals - 15
+            while rest >= 255:
+                out.append(255)
+                rest -= 255
+            out.append(rest)
+        out.extend(data[anchor:literal_end])
+        if match_len:
+            out.extend(struct.pack("<H", offset))
+            extra = match_len - LZ4_MIN_MATCH
+            token |= min(extra, 15)
+            if extra >= 15:
+                rest = extra - 15
+                while rest >= 255:
+                    out.append(255)
+                    rest -= 255
+                out.append(rest)
+        out[token_pos] = token
+
+    def insert(i):
+        key = data[i : i + LZ4_MIN_MATCH]
+        chain[i] = head.get(key, -1)
+        head[key] = i
+
+    while pos < match_limit:
+        best_len = 0
+        best_pos = -1
+        candidate = head.get(data[pos : pos + LZ4_MIN_MATCH], -1)
+        depth = 0
+        while candidate >= 0 and pos - candidate <= LZ4_MAX_OFFSET and depth < LZ4_CHAIN_DEPTH:
+            length = 0
+            limit = n - LZ4_LAST_LITERALS - pos
+            while length < limit and data[candidate + length] == data[pos + length]:
+                length += 1
+            if length > best_len:
+                best_len = length
+                best_pos = candidate
+            candidate = chain[candidate]
+            depth += 1
+
+        if best_len < LZ4_MIN_MATCH:
+            insert(pos)
+            pos += 1
+            continue
+
+        emit(pos, pos - best_pos, best_len)
+        for i in range(pos, min(pos + best_len, match_limit)):
+            insert(i)
+        pos += best_len
+        anchor = pos
+
+    emit(n, 0, 0)
+    return bytes(out)
+
+
+def c_bytes(data, indent="  ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x{:02x}".format(b) for b in data[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_c(path, name, source, cf, width, height, stride, data, compressed):
+    attribute = "LV_ATTRIBUTE_IMAGE_" + name.upper()
+    if compressed is not None:
+        payload = struct.pack("<III", LV_IMAGE_COMPRESS_LZ4, len(compressed), len(data)) + compressed
+        flags = "  .header.flags = LV_IMAGE_FLAGS_COMPRESSED,\n"
+        note = "LZ4, {} -> {} bytes".format(len(data), len(payload))
+    else:
+        payload = data
+        flags = ""
+        note = "raw, {} bytes".format(len(data))
+
+    text = """/* Generated by png_to_lvgl.py from {source}, {note}. Do not edit. */
+#ifdef __has_include
+    #if __has_include("lvgl.h")
+        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+            #define LV_LVGL_H_INCLUDE_SIMPLE
+        #endif
+    #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+    #include "lvgl.h"
+#else
+    #include "lvgl/lvgl.h"
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attribute}
+#define {attribute}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t {name}_map[] = {{
+{bytes}
+}};
+
+const lv_image_dsc_t {name} = {{
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = {cf},
+{flags}  .header.w = {width},
+  .header.h = {height},
+  .header.stride = {stride},
+  .data_size = sizeof({name}_map),
+  .data = {name}_map,
+}};
+""".format(
+        source=source,
+        note=note,
+        attribute=attribute,
+        name=name,
+        bytes=c_bytes(payload),
+        cf=cf,
+        flags=flags,
+        width=width,
+        height=height,
+        stride=stride,
+    )
+
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("png")
+    parser.add_argument("output")
+    parser.add_argument("--name", required=True, help="C symbol of the image descriptor")
+    parser.add_argument("--min-saving", type=float, default=0.1, help="keep the image raw below this saving")
+    args = parser.parse_args()
+
+    try:
+        width, height, channels, pixels = read_png(args.png)
+    except (OSError, ValueError, zlib.error) as e:
+        print("png_to_lvgl: {}".format(e), file=sys.stderr)
+        return 1
+
+    cf, stride, data = to_lvgl(width, height, channels, pixels)
+    compressed = lz4_compress(data)
+    if len(compressed) + 12 > len(data) * (1.0 - args.min_saving):
+        compressed = None
+
+    write_c(args.output, args.name, os.path.basename(args.png), cf, width, height, stride, data, compressed)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,89 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_PORTA_I2C_EXT5V_ON
-#define LV_ATTRIBUTE_IMAGE_PORTA_I2C_EXT5V_ON
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PORTA_I2C_EXT5V_ON uint8_t porta_i2c_ext5v_on_map[] = {
-  0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 
-  0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x20, 0xc3, 0x20, 0xa3, 0x28, 0xa3, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa2, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa2, 0x28, 0xa2, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa2, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xa2, 0x28, 0xa3, 0x28, 0xa3, 0x28, 0xc3, 0x28, 0xc3, 0x20, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x20, 0x6a, 0x72, 0x6e, 0xa3, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6e, 0xa3, 0x6e, 0xa3, 0x8e, 0xa3, 0x8e, 0xa3, 0x6e, 0xa3, 0x6e, 0xa3, 0x6e, 0xa3, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xa3, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xa3, 0x6d, 0xa3, 0x6d, 0xab, 0x6d, 0xab, 0x6e, 0xa3, 0x6e, 0xa3, 0x8e, 0xa3, 0x6e, 0xa3, 0x6e, 0xa3, 0x6e, 0xa3, 0x6e, 0xa3, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x4d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xab, 0x6d, 0xa3, 0x8e, 0xa3, 0x45, 0x49, 0xc3, 0x20, 0xe3, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x8e, 0xa3, 0x14, 0xed, 0x14, 0xf5, 0xf3, 0xfc, 0x14, 0xfd, 0x14, 0xf5, 0x35, 0xed, 0x35, 0xe5, 0x35, 0xed, 0x35, 0xed, 0x35, 0xe5, 0x35, 0xed, 0x35, 0xed, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x14, 0xf5, 0xf3, 0xf4, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0x14, 0xf5, 0x35, 0xed, 0x35, 0xed, 0x35, 0xed, 0x35, 0xed, 0x35, 0xed, 0x34, 0xed, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xed, 0x14, 0xed, 0x14, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xfc, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xed, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0x14, 0xf5, 0x35, 0xed, 0x86, 0x59, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x6e, 0xab, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf0, 0xcb, 0x00, 0x28, 0x00, 0x20, 0x00, 0x28, 0x00, 0x30, 0x00, 0x28, 0x00, 0x28, 0x00, 0x38, 0x8e, 0xcb, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x14, 0xf5, 0x45, 0x61, 0x00, 0x20, 0x00, 0x28, 0x00, 0x28, 0x00, 0x30, 0x00, 0x30, 0x8e, 0xcb, 0x14, 0xf5, 0x45, 0x69, 0x45, 0x69, 0x14, 0xf5, 0xf3, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xed, 0x41, 0x48, 0x69, 0x9a, 0xf4, 0xf4, 0xf3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x6e, 0xab, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf0, 0xcb, 0x00, 0x20, 0x34, 0xd5, 0x35, 0xed, 0x14, 0xf5, 0x35, 0xed, 0x14, 0xed, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x4d, 0xbb, 0x49, 0x9a, 0x14, 0xf5, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x00, 0x28, 0xec, 0x92, 0x35, 0xed, 0x14, 0xed, 0x14, 0xed, 0x14, 0xf5, 0xf3, 0xfc, 0xf4, 0xfc, 0x6e, 0xab, 0x00, 0x28, 0x31, 0xd4, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x10, 0xc4, 0x00, 0x28, 0x31, 0xd4, 0xf3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x6e, 0xab, 0xf4, 0xf4, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf0, 0xcb, 0x00, 0x20, 0x14, 0xdd, 0xf4, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0xf4, 0xf4, 0x14, 0xf5, 0xf4, 0xf4, 0xd3, 0xfc, 0xd3, 0xfc, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xfc, 0xf4, 0xf4, 0x35, 0xe5, 0xec, 0x8a, 0x04, 0x49, 0x55, 0xdd, 0x14, 0xed, 0xf4, 0xf4, 0xf4, 0xfc, 0x14, 0xf5, 0x00, 0x28, 0xcf, 0xb3, 0x14, 0xf5, 0xd3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x34, 0xed, 0x41, 0x48, 0x8a, 0x8a, 0x14, 0xf5, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0xc7, 0x71, 0xc7, 0x71, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x6e, 0xab, 0x14, 0xfd, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf0, 0xcb, 0x00, 0x20, 0x14, 0xdd, 0xf4, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0xec, 0xb2, 0x00, 0x30, 0xd3, 0xe4, 0xf4, 0xfc, 0xf4, 0xfc, 0x10, 0xcc, 0x00, 0x30, 0xcf, 0xd3, 0x14, 0xf5, 0x00, 0x28, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x8e, 0xcb, 0x14, 0xf5, 0x14, 0xed, 0x00, 0x28, 0xcf, 0xb3, 0x14, 0xf5, 0xf3, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0xcb, 0x9a, 0x00, 0x28, 0x35, 0xe5, 0xf3, 0xfc, 0xd3, 0xfc, 0xf4, 0xf4, 0xb2, 0xdc, 0x00, 0x28, 0xcf, 0xbb, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x6e, 0xab, 0xf4, 0xf4, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf0, 0xcb, 0x00, 0x20, 0x34, 0xcd, 0x34, 0xed, 0x14, 0xf5, 0x34, 0xed, 0x14, 0xed, 0xf4, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xf4, 0xf4, 0xa7, 0x79, 0xc3, 0x58, 0x35, 0xed, 0xf4, 0xe4, 0x00, 0x28, 0x2c, 0xa3, 0xf4, 0xfc, 0xf4, 0xfc, 0x14, 0xed, 0xcb, 0x9a, 0xe4, 0x50, 0x55, 0xe5, 0xf4, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x10, 0xc4, 0x00, 0x20, 0x92, 0xc4, 0x35, 0xed, 0x14, 0xf5, 0xf4, 0xf4, 0xf4, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x92, 0xdc, 0x00, 0x20, 0x2d, 0x9b, 0xf4, 0xfc, 0xd3, 0xfc, 0x14, 0xed, 0x8a, 0x8a, 0x41, 0x40, 0xf3, 0xe4, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa2, 0x28, 0x6e, 0xab, 0xf4, 0xf4, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x10, 0xcc, 0x00, 0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x49, 0xa2, 0xf3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0xd3, 0xe4, 0x41, 0x40, 0xaa, 0x82, 0x65, 0x61, 0x08, 0x82, 0xd3, 0xec, 0xf3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0xab, 0xa2, 0xc3, 0x58, 0x14, 0xed, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0xf0, 0xcb, 0x00, 0x28, 0x00, 0x28, 0x00, 0x30, 0x00, 0x30, 0x86, 0x79, 0xae, 0xc3, 0xf4, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xf4, 0xf4, 0x28, 0x7a, 0x61, 0x40, 0x14, 0xf5, 0xf4, 0xfc, 0xf4, 0xe4, 0x00, 0x28, 0x2c, 0xa3, 0x14, 0xf5, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa2, 0x28, 0x6e, 0xab, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xef, 0xcb, 0x00, 0x20, 0x14, 0xd5, 0x14, 0xf5, 0xf3, 0xfc, 0x14, 0xf5, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x51, 0xcc, 0x00, 0x18, 0x04, 0x49, 0x92, 0xdc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0x14, 0xf5, 0xab, 0xa2, 0xc3, 0x58, 0x14, 0xf5, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf4, 0xfc, 0x14, 0xf5, 0xf4, 0xf4, 0x92, 0xdc, 0x2c, 0xa3, 0x00, 0x30, 0x4d, 0xb3, 0xf4, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x10, 0xc4, 0x00, 0x28, 0xaf, 0xc3, 0x14, 0xf5, 0x8e, 0xab, 0x00, 0x28, 0x92, 0xdc, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa2, 0x28, 0x6e, 0xab, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf0, 0xcb, 0x00, 0x20, 0x14, 0xd5, 0x14, 0xf5, 0xf3, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf4, 0xfc, 0xcf, 0xbb, 0x00, 0x18, 0x00, 0x18, 0x92, 0xdc, 0xf3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0xcb, 0xa2, 0xc3, 0x58, 0x14, 0xed, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x35, 0xe5, 0x8a, 0x8a, 0x45, 0x69, 0x14, 0xf5, 0xd3, 0xfc, 0xd3, 0xfc, 0x14, 0xed, 0xe3, 0x58, 0xc7, 0x71, 0x55, 0xe5, 0x62, 0x40, 0x08, 0x82, 0xf4, 0xf4, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa2, 0x28, 0x6e, 0xab, 0x14, 0xf5, 0xf4, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x10, 0xcc, 0x00, 0x20, 0x14, 0xd5, 0xf4, 0xf4, 0xf3, 0xfc, 0xf4, 0xfc, 0x14, 0xfd, 0xf4, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0x14, 0xf5, 0xb3, 0xd4, 0x00, 0x28, 0x4d, 0x9b, 0x29, 0x72, 0x41, 0x40, 0x35, 0xed, 0xf4, 0xfc, 0xf4, 0xfc, 0x14, 0xf5, 0xcb, 0x9a, 0xe4, 0x50, 0x55, 0xe5, 0xf4, 0xf4, 0xf3, 0xfc, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xfc, 0xf4, 0xf4, 0x35, 0xe5, 0x8a, 0x8a, 0x45, 0x69, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0x14, 0xf5, 0x6e, 0xab, 0x00, 0x18, 0xcf, 0x93, 0x00, 0x20, 0x51, 0xcc, 0xf4, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xf3, 0xfc, 0xf4, 0xfc, 0x14, 0xed, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa2, 0x28, 0x6e, 0xab, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0xf0, 0xcb, 0x00, 0x20, 0x14, 0xd5, 0x14, 0xf5, 0xf4, 0xfc, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xfc, 0xf4, 0xfc, 0xf4, 0xfc, 0xd3, 0xec, 0xc3, 0x58, 0x08, 0x82, 0xf4, 0xe4, 0xf4, 0xe4, 0xe3, 0x50, 0xa7, 0x71, 0xf4, 0xf4, 0xf3, 0xfc, 0xf4, 0xf4, 0x4d, 0xb3, 0x00, 0x28, 0xb3, 0xd4, 0xd3, 0xec, 0x71, 0xec, 0x14, 0xf5, 0xa3, 0x60, 0x86, 0x79, 0x51, 0xd4, 0xf4, 0xf4, 0x14, 0xf5, 0x6e, 0xb3, 0x00, 0x28, 0x6d, 0xb3, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x14, 0xed, 0x00, 0x18, 0x00, 0x18, 0x65, 0x61, 0x14, 0xed, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x6d, 0xab, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xcf, 0xd3, 0x00, 0x30, 0x00, 0x28, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x49, 0xa2, 0xf3, 0xfc, 0xc7, 0x91, 0xa2, 0x60, 0xd3, 0xec, 0xd3, 0xfc, 0xd3, 0xfc, 0x30, 0xd4, 0x00, 0x38, 0xeb, 0xba, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x08, 0x8a, 0x00, 0x30, 0x00, 0x38, 0xeb, 0xb2, 0xf3, 0xfc, 0x71, 0xec, 0xe7, 0x89, 0x21, 0x48, 0x00, 0x30, 0x00, 0x30, 0xc3, 0x58, 0x4d, 0xbb, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0xcb, 0x9a, 0x00, 0x30, 0xae, 0xc3, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe4, 0x18, 0xa3, 0x28, 0x6e, 0xab, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xfc, 0x14, 0xed, 0x35, 0xed, 0x35, 0xed, 0x35, 0xed, 0x35, 0xed, 0x34, 0xed, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xfc, 0xf3, 0xfc, 0xf4, 0xf4, 0xf4, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf4, 0xf4, 0x14, 0xf5, 0xf3, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0xf3, 0xfc, 0xf4, 0xfc, 0x14, 0xf5, 0x14, 0xed, 0x34, 0xed, 0x34, 0xed, 0x14, 0xed, 0x14, 0xf5, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xfc, 0xf3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xd3, 0xfc, 0xf3, 0xfc, 0x14, 0xf5, 0x86, 0x61, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xc3, 0x18, 0xe3, 0x18, 0xa3, 0x28, 0x8e, 0xa3, 0x35, 0xed, 0x14, 0xf5, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xf5, 0x15, 0xf5, 0x15, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0x14, 0xf5, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0xf4, 0x15, 0xf5, 0x35, 0xed, 0x86, 0x59, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x28, 0x2c, 0x93, 0x92, 0xd4, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x51, 0xdc, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xdc, 0x51, 0xdc, 0x51, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x51, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x51, 0xdc, 0x51, 0xdc, 0x71, 0xdc, 0x51, 0xdc, 0x71, 0xdc, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xe4, 0x51, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x51, 0xdc, 0x51, 0xdc, 0x51, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xdc, 0x71, 0xd4, 0x92, 0xcc, 0x86, 0x59, 0xc3, 0x20, 0xe3, 0x18, 0xc3, 0x18, 
-  0xe3, 0x18, 0xe4, 0x18, 0xc3, 0x28, 0x80, 0x40, 0x40, 0x48, 0x20, 0x50, 0x20, 0x58, 0x20, 0x58, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x50, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x50, 0x40, 0x48, 0x81, 0x38, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xe3, 0x18, 0xe4, 0x18, 0xa2, 0x28, 0xa4, 0x71, 0x25, 0x9a, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x24, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x04, 0xaa, 0x25, 0xa2, 0x46, 0x9a, 0xe1, 0x50, 0xc3, 0x20, 0xe4, 0x18, 0xe3, 0x18, 
-  0xe3, 0x18, 0xe4, 0x18, 0xa1, 0x30, 0x62, 0x81, 0xe2, 0xb9, 0xc1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc9, 0xc1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc2, 0xc1, 0x03, 0xb2, 0xc0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0x81, 0x30, 0x61, 0x89, 0xc1, 0xc1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0xa0, 0xc9, 0xe2, 0xb9, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc9, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xb9, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xc1, 0xc9, 0xc1, 0xc1, 0xc2, 0xb9, 0xe2, 0xb9, 0xe3, 0xb9, 0xe3, 0xb1, 0xe2, 0xb9, 0xe2, 0xb9, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa1, 0xc9, 0xc1, 0xc1, 0xe2, 0xb9, 0xe3, 0xb9, 0xc2, 0xb9, 0xc1, 0xc1, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xc1, 0xc9, 0xc2, 0xb9, 0xe3, 0xb9, 0xe3, 0xb9, 0xe2, 0xb9, 0xc1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xc1, 0xc1, 0xe2, 0xb9, 0x86, 0xba, 0x0d, 0xdc, 0x11, 0xed, 0xf5, 0xfd, 0xf5, 0xfd, 0xf5, 0xfd, 0xd0, 0xe4, 0xcb, 0xd3, 0x44, 0xb2, 0xe2, 0xb9, 0xc1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa1, 0xc9, 0xc2, 0xc1, 0x8e, 0xfc, 0xd5, 0xfd, 0xf5, 0xfd, 0x72, 0xfd, 0x24, 0xb2, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xe2, 0xb9, 0xb3, 0xfd, 0xf5, 0xfd, 0xf5, 0xfd, 0xb3, 0xfd, 0xa6, 0xd2, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe2, 0xc1, 0x86, 0xba, 0x72, 0xfd, 0x9c, 0xff, 0xbd, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbd, 0xff, 0x9b, 0xff, 0xaf, 0xec, 0x24, 0xba, 0xc2, 0xc1, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0x80, 0xd1, 0xa1, 0xc9, 0xe3, 0xb9, 0xd3, 0xfd, 0xbe, 0xff, 0xfe, 0xff, 0xbd, 0xff, 0x36, 0xfe, 0xe3, 0xb1, 0xc1, 0xc9, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xe3, 0xb1, 0x9c, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbc, 0xff, 0x08, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc9, 0xe2, 0xb9, 0xab, 0xd3, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xf9, 0xfe, 0xe8, 0xba, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0x80, 0xd9, 0xa0, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x11, 0xf5, 0xe3, 0xb1, 0xa1, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0x03, 0xb2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xc2, 0xb9, 0xcb, 0xd3, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xde, 0xff, 0xbd, 0xff, 0xbd, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0xc6, 0xc2, 0xc1, 0xc1, 0xc1, 0xc9, 0xa0, 0xd1, 0x80, 0xd9, 0xa1, 0xc9, 0x03, 0xb2, 0xd5, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xcb, 0xd3, 0xe2, 0xb9, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0x03, 0xb2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xc1, 0xc1, 0xc7, 0xc2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0x11, 0xf5, 0xc7, 0xc2, 0xe3, 0xb1, 0x03, 0xb2, 0x03, 0xaa, 0x69, 0xd3, 0xd4, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xd8, 0xfe, 0x45, 0xb2, 0xc1, 0xc1, 0xa0, 0xd1, 0x80, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xe8, 0xba, 0xe2, 0xb9, 0xa0, 0xd1, 0x80, 0xd1, 0xa1, 0xc9, 0x03, 0xaa, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x08, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc9, 0xe3, 0xb9, 0xd3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x49, 0xbb, 0xe3, 0xb1, 0xc1, 0xc9, 0xa0, 0xd1, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc9, 0xe3, 0xb1, 0x6f, 0xdc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x6f, 0xdc, 0xe2, 0xb9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0x45, 0xaa, 0xc1, 0xc1, 0xa0, 0xd1, 0xa1, 0xc9, 0x03, 0xb2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x08, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xc7, 0xba, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x2d, 0xd4, 0xe3, 0xb1, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xc1, 0xc1, 0x03, 0xb2, 0x93, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0x03, 0xb2, 0xa1, 0xc9, 0x80, 0xd1, 0xa0, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x57, 0xfe, 0xe3, 0xb1, 0xa1, 0xc9, 0xa1, 0xc9, 0xe3, 0xb1, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc2, 0xb9, 0x6e, 0xe4, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xfe, 0x04, 0xaa, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xc1, 0xc1, 0xa6, 0xb2, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x11, 0xf5, 0xe3, 0xb1, 0xc1, 0xc1, 0x03, 0xb2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xe2, 0xb9, 0x93, 0xf5, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xf5, 0xe3, 0xb9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xe3, 0xb1, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x0c, 0xe4, 0xc2, 0xc1, 0xa0, 0xd1, 0xa0, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x12, 0xcd, 0x99, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xcc, 0xcb, 0xe2, 0xb9, 0x03, 0xb2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xe2, 0xb9, 0xf5, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x4e, 0xe4, 0xc2, 0xb9, 0xa0, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xe2, 0xb9, 0xf5, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x4d, 0xe4, 0xc2, 0xc1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x8f, 0xd4, 0x2a, 0xa3, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xe8, 0xba, 0x25, 0xa2, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x08, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xe2, 0xb9, 0xf4, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x6e, 0xe4, 0xe2, 0xb9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xe2, 0xb9, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x4d, 0xe4, 0xc2, 0xc1, 0xa0, 0xd1, 0xa0, 0xc9, 0xe3, 0xb9, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x6f, 0xdc, 0x04, 0xaa, 0x6a, 0xcb, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xa8, 0x8a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xe2, 0xb9, 0xd0, 0xe4, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xfd, 0xe3, 0xb1, 0xc1, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa1, 0xc9, 0x03, 0xaa, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x69, 0xd3, 0xc1, 0xc1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x6e, 0xdc, 0xe2, 0xb9, 0xe2, 0xb9, 0x6f, 0xdc, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xb9, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc2, 0xc1, 0xcb, 0xd3, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0xa6, 0xb2, 0xc1, 0xc1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0xa0, 0xd1, 0xe2, 0xb9, 0xcc, 0xcb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x86, 0xba, 0xa1, 0xc9, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x6e, 0xdc, 0xc2, 0xb9, 0xc1, 0xc9, 0xe3, 0xb1, 0x72, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0x44, 0xb2, 0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x56, 0xfe, 0x03, 0xaa, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xd1, 0xc2, 0xc1, 0xa7, 0xb2, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xf5, 0xfd, 0xe3, 0xb9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x6e, 0xdc, 0xc2, 0xb9, 0xa0, 0xc9, 0xa1, 0xc9, 0x24, 0xba, 0x77, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc9, 0xc2, 0xc1, 0x4d, 0xec, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xf5, 0xfd, 0xa7, 0xaa, 0x03, 0xb2, 0xe2, 0xb9, 0xe2, 0xb9, 0xe3, 0xb1, 0x04, 0xaa, 0x4a, 0xbb, 0xfa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xff, 0x29, 0xc3, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x6e, 0xdc, 0xc2, 0xb9, 0xa0, 0xd1, 0xa0, 0xc9, 0xc2, 0xc1, 0x86, 0xba, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa1, 0xc9, 0xe3, 0xb1, 0x56, 0xfe, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbd, 0xff, 0x93, 0xf5, 0x6e, 0xe4, 0x6e, 0xe4, 0x6e, 0xdc, 0x57, 0xfe, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0xaf, 0xec, 0xe3, 0xb9, 0xa1, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff, 0x6e, 0xdc, 0xc2, 0xb9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xc2, 0xc1, 0x28, 0xc3, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xc1, 0xc1, 0x45, 0xb2, 0x36, 0xfe, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xde, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x11, 0xed, 0xe3, 0xb9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xd4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x6f, 0xdc, 0xe2, 0xb9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xe2, 0xb9, 0x2d, 0xd4, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0x28, 0xcb, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xc1, 0xc1, 0x44, 0xb2, 0xd0, 0xe4, 0xbd, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff, 0xbc, 0xff, 0x2d, 0xd4, 0x03, 0xb2, 0xc1, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xe3, 0xb9, 0xd4, 0xfd, 0xde, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x6e, 0xe4, 0xc2, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc9, 0x03, 0xb2, 0x11, 0xed, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x08, 0xcb, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa1, 0xc9, 0xe2, 0xb9, 0xc7, 0xc2, 0x11, 0xf5, 0x9c, 0xff, 0xbc, 0xff, 0xbd, 0xff, 0xbc, 0xff, 0xbd, 0xff, 0xbc, 0xff, 0xd8, 0xfe, 0x4e, 0xe4, 0x85, 0xba, 0xc2, 0xc1, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xc2, 0xb9, 0xb2, 0xfd, 0xbc, 0xff, 0xbd, 0xff, 0x7b, 0xff, 0x4d, 0xec, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xc1, 0xc9, 0x24, 0xba, 0x36, 0xfe, 0xbc, 0xff, 0xbd, 0xff, 0x9b, 0xff, 0x07, 0xd3, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc9, 0xe3, 0xb1, 0x04, 0xaa, 0xa7, 0xb2, 0x29, 0xbb, 0x29, 0xc3, 0x29, 0xc3, 0x45, 0xaa, 0x03, 0xaa, 0xe2, 0xb9, 0xc1, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xc1, 0xc1, 0xa6, 0xca, 0x29, 0xc3, 0x49, 0xc3, 0x08, 0xcb, 0x64, 0xca, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0x24, 0xba, 0x28, 0xc3, 0x29, 0xc3, 0x28, 0xcb, 0x03, 0xc2, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc9, 0xc1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xc0, 0xc9, 0xa1, 0xc9, 0xc1, 0xc9, 0xc1, 0xc1, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc9, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc1, 0xc1, 0xa0, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x89, 0xc2, 0xc1, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0xe3, 0xb1, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa1, 0x30, 0x62, 0x81, 0xe2, 0xb9, 0xc1, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc1, 0x03, 0xb2, 0xa0, 0x60, 0xc2, 0x28, 0xe4, 0x10, 0xc3, 0x20, 
-  0xe3, 0x18, 0xe3, 0x18, 0xa2, 0x28, 0x83, 0x71, 0x04, 0xa2, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0xe3, 0xa9, 0x04, 0xa2, 0x25, 0x9a, 0xe1, 0x50, 0xc3, 0x20, 0xe4, 0x18, 0xc3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x20, 0xa2, 0x30, 0x81, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x80, 0x38, 0x81, 0x38, 0xa1, 0x30, 0xa2, 0x28, 0xc3, 0x20, 0xe4, 0x18, 0xe4, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xe3, 0x18, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xc3, 0x20, 0xe3, 0x20, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 
-  0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xc3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe4, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 0xe3, 0x18, 
-};
-
-const lv_image_dsc_t porta_i2c_ext5v_on = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 62,
-  .header.h = 55,
-  .data_size = 3410 * 2,
-  .data = porta_i2c_ext5v_on_map,
-};
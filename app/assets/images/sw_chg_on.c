@@ -1,76 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_SW_CHG_ON
-#define LV_ATTRIBUTE_IMAGE_SW_CHG_ON
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_SW_CHG_ON uint8_t sw_chg_on_map[] = {
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xfc, 0xe6, 0xfb, 0xe6, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xfb, 0xde, 0x55, 0xad, 0xef, 0x7b, 0xeb, 0x5a, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x08, 0x42, 0xeb, 0x5a, 0xef, 0x7b, 0x55, 0xad, 0xfb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0x87, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0x87, 0x39, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xe8, 0x41, 0x8e, 0x73, 0xd3, 0x9c, 0xb7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xde, 0xba, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xbb, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x59, 0xce, 0xb7, 0xbd, 0xd3, 0x9c, 0x8e, 0x73, 0xe8, 0x41, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xaa, 0x52, 0x55, 0xa5, 0x3c, 0xdf, 0x7d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x35, 0xad, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0x34, 0xa5, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xf7, 0x1d, 0xf7, 0xfd, 0xfe, 0xdd, 0xfe, 0xdd, 0xfe, 0xdd, 0xfe, 0xbe, 0xfe, 0xdd, 0xfe, 0xfd, 0xfe, 0x1d, 0xf7, 0x3d, 0xf7, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x34, 0xa5, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0x0c, 0x63, 0xba, 0xd6, 0x5d, 0xe7, 0x3d, 0xef, 0xfd, 0xfe, 0xbe, 0xfe, 0xfd, 0xfd, 0xb9, 0xfc, 0xd7, 0xf3, 0x55, 0xeb, 0x34, 0xeb, 0x35, 0xeb, 0xb6, 0xf3, 0x78, 0xfc, 0xbc, 0xfd, 0x9e, 0xfe, 0xfd, 0xfe, 0x3d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x3d, 0xef, 0x1d, 0xf7, 0xdd, 0xfe, 0x9b, 0xfd, 0x95, 0xe3, 0x72, 0xd2, 0x32, 0xe2, 0x13, 0xea, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0x13, 0xf2, 0x32, 0xea, 0x52, 0xda, 0x34, 0xdb, 0x3a, 0xfd, 0xbe, 0xfe, 0xfd, 0xf6, 0x3d, 0xf7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0x2d, 0x6b, 0x3c, 0xe7, 0x3d, 0xef, 0xfd, 0xfe, 0x7d, 0xfe, 0xd6, 0xf3, 0x32, 0xe2, 0xf3, 0xf1, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0xf3, 0xf1, 0x32, 0xe2, 0x55, 0xe3, 0xfc, 0xfd, 0xfd, 0xfe, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x2d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x69, 0x52, 0xfc, 0xe6, 0x5d, 0xef, 0xfd, 0xfe, 0x1d, 0xfe, 0x34, 0xdb, 0x12, 0xea, 0xd3, 0xf9, 0xb3, 0xf9, 0x94, 0xf9, 0x94, 0xf9, 0x94, 0xf9, 0x93, 0xf9, 0x94, 0xf9, 0x94, 0xf9, 0x94, 0xf9, 0x94, 0xf9, 0x94, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xf3, 0xf1, 0xb3, 0xda, 0xbb, 0xfd, 0xfd, 0xfe, 0x1d, 0xf7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0xf4, 0xa4, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0x17, 0xbe, 0x3d, 0xef, 0x1d, 0xff, 0x3d, 0xfe, 0xf4, 0xe2, 0xf3, 0xf1, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xf3, 0xf1, 0x93, 0xda, 0x9b, 0xfd, 0xfd, 0xfe, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa6, 0x39, 0xaf, 0x7b, 0x5d, 0xef, 0x1d, 0xf7, 0x9e, 0xfe, 0x95, 0xe3, 0x13, 0xf2, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0xb3, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xf3, 0xf1, 0xd3, 0xe2, 0x5d, 0xfe, 0x1d, 0xf7, 0x3d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xaf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xb7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0x7a, 0xd6, 0x5d, 0xef, 0xfd, 0xfe, 0xb9, 0xfc, 0x32, 0xe2, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0x13, 0xea, 0xf6, 0xeb, 0xbe, 0xfe, 0x3d, 0xf7, 0x7d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x79, 0xce, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x39, 0xa6, 0x31, 0x2c, 0x63, 0x3d, 0xef, 0x3d, 0xf7, 0x9e, 0xfe, 0xb3, 0xe2, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0x52, 0xda, 0xbc, 0xfd, 0x1d, 0xf7, 0x7d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x39, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xd7, 0xbd, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xd7, 0xbd, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xd7, 0xbd, 0x9a, 0xd6, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x2c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0xa6, 0x39, 0xa6, 0x39, 0x14, 0x9d, 0x3d, 0xef, 0xfd, 0xfe, 0x19, 0xf5, 0x32, 0xea, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xd3, 0xf9, 0x13, 0xea, 0xf7, 0xf3, 0xfd, 0xfe, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x96, 0xb5, 0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0xfc, 0xe6, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x14, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0xa7, 0x39, 0x49, 0x4a, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xba, 0xce, 0x3d, 0xef, 0xbe, 0xfe, 0xb5, 0xe3, 0x13, 0xf2, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0xb3, 0xe2, 0xbe, 0xfe, 0x3d, 0xef, 0x3d, 0xef, 0x76, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0x51, 0x8c, 0x4d, 0x6b, 0x00, 0x00, 0xcf, 0x7b, 0x3d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0xc7, 0x39, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x51, 0x8c, 0x49, 0x4a, 0x00, 0x00, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xbb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x39, 0xe8, 0x41, 0x7d, 0xe7, 0x3d, 0xf7, 0x9e, 0xfe, 0xb3, 0xd2, 0xd3, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x32, 0xe2, 0xfc, 0xfd, 0x1d, 0xf7, 0x3d, 0xef, 0x24, 0x21, 0x00, 0x00, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x14, 0xa5, 0x00, 0x00, 0x04, 0x21, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x76, 0xb5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x34, 0xa5, 0xa6, 0x31, 0xa7, 0x39, 0xab, 0x5a, 0x7d, 0xe7, 0x1d, 0xf7, 0x1d, 0xfe, 0x72, 0xda, 0xd3, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x32, 0xea, 0x5a, 0xfd, 0xfd, 0xfe, 0x39, 0xce, 0x20, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0xcb, 0x5a, 0x00, 0x00, 0x51, 0x8c, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xf3, 0x9c, 0xa6, 0x31, 0xa7, 0x39, 0x0c, 0x63, 0x7d, 0xe7, 0x1d, 0xf7, 0xbc, 0xfd, 0x52, 0xda, 0xd3, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x12, 0xea, 0x19, 0xf5, 0xfd, 0xfe, 0xd7, 0xbd, 0x20, 0x00, 0x04, 0x21, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x49, 0x4a, 0x00, 0x00, 0x14, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xf3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xf3, 0x9c, 0xa6, 0x31, 0x87, 0x39, 0x0c, 0x63, 0x5d, 0xe7, 0x1d, 0xf7, 0xdc, 0xfd, 0x52, 0xda, 0xd3, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x13, 0xea, 0x19, 0xf5, 0xfd, 0xfe, 0xfc, 0xe6, 0x20, 0x00, 0x00, 0x00, 0x39, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0xcf, 0x7b, 0x00, 0x00, 0xcb, 0x5a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa7, 0x39, 0xf3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x34, 0xa5, 0xa6, 0x31, 0x87, 0x39, 0xab, 0x5a, 0x7d, 0xe7, 0x1d, 0xf7, 0x1d, 0xfe, 0x72, 0xda, 0xd3, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x33, 0xea, 0x5a, 0xfd, 0xfd, 0xfe, 0x3d, 0xef, 0x6d, 0x6b, 0x00, 0x00, 0x04, 0x21, 0x39, 0xc6, 0x5d, 0xef, 0x9a, 0xd6, 0xc7, 0x39, 0x14, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x9a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x9a, 0xd6, 0x5d, 0xef, 0x14, 0xa5, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0x87, 0x39, 0xe8, 0x41, 0x7d, 0xe7, 0x3d, 0xf7, 0x9e, 0xfe, 0xb2, 0xd2, 0xd3, 0xf9, 0x93, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x32, 0xe2, 0xfc, 0xfd, 0x1d, 0xf7, 0x3d, 0xef, 0x1b, 0xdf, 0xc7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0x5a, 0xfc, 0xde, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xba, 0xce, 0x3d, 0xef, 0xbe, 0xfe, 0xb5, 0xe3, 0xf3, 0xf1, 0x93, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0x93, 0xe2, 0xbe, 0xfe, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0xcb, 0x5a, 0x49, 0x4a, 0x4d, 0x6b, 0x14, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0x49, 0x4a, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0x49, 0x4a, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xcf, 0x7b, 0x49, 0x4a, 0x49, 0x4a, 0xcf, 0x7b, 0x76, 0xb5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xba, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0xa6, 0x39, 0xa6, 0x39, 0x34, 0xa5, 0x3d, 0xef, 0xfd, 0xfe, 0x19, 0xf5, 0x32, 0xe2, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb4, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0xf3, 0xe9, 0xf7, 0xfb, 0xdd, 0xfe, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x2c, 0x6b, 0x3d, 0xef, 0x3d, 0xf7, 0x9e, 0xfe, 0xb3, 0xe2, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0x52, 0xda, 0xbc, 0xfd, 0x1d, 0xf7, 0x7d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x2d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xb7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0x7a, 0xd6, 0x5d, 0xef, 0xfd, 0xfe, 0xb9, 0xfc, 0x32, 0xe2, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x13, 0xea, 0xf6, 0xeb, 0xbe, 0xfe, 0x3d, 0xef, 0x7d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x79, 0xce, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x39, 0xaf, 0x7b, 0x5d, 0xe7, 0x1d, 0xf7, 0x9e, 0xfe, 0x95, 0xe3, 0xf3, 0xf1, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0x94, 0xf9, 0xb3, 0xf9, 0xf3, 0xf1, 0xd3, 0xe2, 0x5d, 0xfe, 0x1d, 0xf7, 0x3d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xaf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf4, 0x9c, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x17, 0xbe, 0x3d, 0xef, 0x1d, 0xf7, 0x3d, 0xfe, 0xf4, 0xe2, 0xf3, 0xf1, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xf3, 0xf9, 0x92, 0xda, 0x9b, 0xfd, 0xfd, 0xfe, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xf8, 0xc5, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x69, 0x4a, 0xfc, 0xe6, 0x3d, 0xef, 0xfd, 0xfe, 0x3c, 0xfe, 0x34, 0xdb, 0x13, 0xea, 0xd3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0x13, 0xea, 0xb3, 0xda, 0xbb, 0xfd, 0xfd, 0xfe, 0x3d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3c, 0xe7, 0x3d, 0xef, 0xfd, 0xfe, 0x7d, 0xfe, 0xd7, 0xf3, 0x32, 0xe2, 0x13, 0xea, 0xf3, 0xf1, 0xd3, 0xf9, 0xd3, 0xf9, 0xd3, 0xf9, 0xd3, 0xf9, 0xb3, 0xf9, 0xd3, 0xf9, 0xd3, 0xf9, 0xf3, 0xf1, 0xf3, 0xf1, 0x32, 0xe2, 0x55, 0xe3, 0xfc, 0xfd, 0xfd, 0xfe, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x2d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xef, 0x3d, 0xf7, 0x1d, 0xff, 0xbd, 0xfe, 0x9b, 0xfd, 0x95, 0xe3, 0x52, 0xda, 0x13, 0xea, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0xf3, 0xf1, 0x13, 0xea, 0x52, 0xda, 0x34, 0xdb, 0x1a, 0xfd, 0xbe, 0xfe, 0xfd, 0xfe, 0x3d, 0xf7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xec, 0x62, 0xbb, 0xde, 0x3d, 0xef, 0x3d, 0xf7, 0xfd, 0xfe, 0x9e, 0xfe, 0xfd, 0xfd, 0x99, 0xfc, 0xd7, 0xf3, 0x55, 0xeb, 0x35, 0xeb, 0x35, 0xeb, 0xb6, 0xf3, 0x79, 0xfc, 0x9c, 0xfd, 0x9e, 0xfe, 0xdd, 0xfe, 0x3d, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbb, 0xde, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0x35, 0xad, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x1d, 0xf7, 0xfd, 0xfe, 0xdd, 0xfe, 0xde, 0xfe, 0xde, 0xfe, 0xde, 0xfe, 0xdd, 0xfe, 0xfd, 0xfe, 0x1d, 0xf7, 0x3d, 0xf7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x35, 0xad, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0xab, 0x5a, 0x55, 0xad, 0x3c, 0xdf, 0x7d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x7d, 0xe7, 0x7d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x55, 0xad, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xe8, 0x41, 0x6e, 0x73, 0xd3, 0xa4, 0xb7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0x9b, 0xde, 0xbb, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x59, 0xce, 0xb7, 0xbd, 0xd3, 0x9c, 0x6e, 0x73, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0x86, 0x39, 0x87, 0x39, 0x87, 0x39, 0xa7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0x86, 0x39, 0x87, 0x39, 0x87, 0x39, 0x87, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfb, 0xde, 0x55, 0xad, 0xef, 0x7b, 0xeb, 0x5a, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0xeb, 0x5a, 0xef, 0x7b, 0x55, 0xad, 0xfb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0xfc, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-};
-
-const lv_image_dsc_t sw_chg_on = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 75,
-  .header.h = 42,
-  .data_size = 3150 * 2,
-  .data = sw_chg_on_map,
-};
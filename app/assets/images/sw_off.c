@@ -1,76 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_SW_OFF
-#define LV_ATTRIBUTE_IMAGE_SW_OFF
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_SW_OFF uint8_t sw_off_map[] = {
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xfc, 0xe6, 0xfb, 0xde, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfb, 0xde, 0x55, 0xad, 0xef, 0x7b, 0xeb, 0x5a, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x08, 0x42, 0xcb, 0x5a, 0xf0, 0x83, 0x55, 0xad, 0xfc, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xe8, 0x41, 0x8e, 0x73, 0xd3, 0x9c, 0xb7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x59, 0xce, 0xd6, 0xbd, 0xd3, 0x9c, 0x8e, 0x73, 0xe7, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xaa, 0x52, 0x35, 0xad, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0xfc, 0xe6, 0x35, 0xad, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6d, 0x73, 0x1c, 0xe7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x7c, 0xe7, 0x9b, 0xdf, 0xbb, 0xdf, 0xba, 0xd7, 0xba, 0xd7, 0xba, 0xd7, 0xbb, 0xdf, 0x9b, 0xdf, 0x7c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x34, 0xa5, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0xba, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5c, 0xe7, 0x9b, 0xdf, 0xda, 0xd7, 0x76, 0xb7, 0x12, 0x97, 0x8f, 0x7e, 0x4d, 0x6e, 0x4d, 0x6e, 0x6d, 0x6e, 0xaf, 0x7e, 0x13, 0x9f, 0xb7, 0xbf, 0xda, 0xd7, 0x9b, 0xdf, 0x5d, 0xef, 0x3d, 0xef, 0xba, 0xd6, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x7c, 0xe7, 0xda, 0xd7, 0x14, 0xa7, 0x0d, 0x6e, 0xca, 0x55, 0x09, 0x4e, 0x28, 0x46, 0x28, 0x46, 0x28, 0x46, 0x28, 0x46, 0x28, 0x46, 0xe9, 0x4d, 0xca, 0x55, 0x4f, 0x7e, 0x56, 0xb7, 0xbb, 0xdf, 0x7c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5c, 0xe7, 0x9b, 0xdf, 0x97, 0xbf, 0x4d, 0x6e, 0x09, 0x4e, 0x28, 0x46, 0x47, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x47, 0x3e, 0x47, 0x3e, 0x28, 0x46, 0xe9, 0x4d, 0x8f, 0x7e, 0xd8, 0xc7, 0x7c, 0xdf, 0x5d, 0xef, 0x3c, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x69, 0x4a, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x9b, 0xdf, 0x56, 0xb7, 0xeb, 0x5d, 0x28, 0x46, 0x67, 0x3e, 0x86, 0x36, 0x86, 0x36, 0x86, 0x36, 0x86, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x86, 0x36, 0x66, 0x36, 0x86, 0x36, 0x47, 0x3e, 0x08, 0x46, 0x2d, 0x6e, 0x98, 0xc7, 0x9b, 0xdf, 0x5c, 0xe7, 0xfc, 0xde, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xf4, 0xa4, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf8, 0xc5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xe7, 0x9b, 0xdf, 0x76, 0xb7, 0xea, 0x55, 0x48, 0x46, 0x47, 0x3e, 0x67, 0x3e, 0x67, 0x36, 0x67, 0x36, 0x66, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x28, 0x46, 0x0d, 0x66, 0xb8, 0xc7, 0x7c, 0xe7, 0x3d, 0xef, 0xf8, 0xc5, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0xaf, 0x7b, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x7c, 0xe7, 0xb8, 0xc7, 0xec, 0x65, 0x47, 0x46, 0x86, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x3e, 0x66, 0x3e, 0x67, 0x3e, 0x67, 0x36, 0x86, 0x36, 0x66, 0x36, 0x08, 0x4e, 0x4e, 0x76, 0xba, 0xd7, 0x5c, 0xe7, 0x5d, 0xef, 0xaf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xb7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0xba, 0xd7, 0xaf, 0x7e, 0x08, 0x46, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x47, 0x3e, 0xe9, 0x4d, 0x13, 0x9f, 0xbb, 0xd7, 0x5d, 0xe7, 0x5a, 0xd6, 0xa6, 0x31, 0xc6, 0x31, 0xa7, 0x39, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x2c, 0x63, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x76, 0xb5, 0x31, 0x8c, 0x51, 0x8c, 0x14, 0xa5, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x14, 0xa5, 0x5d, 0xef, 0xd7, 0xbd, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x31, 0x8c, 0x9a, 0xd6, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x7c, 0xe7, 0x77, 0xbf, 0xe9, 0x4d, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x28, 0x46, 0x0b, 0x66, 0xf8, 0xc7, 0x5c, 0xe7, 0x3d, 0xef, 0x2c, 0x63, 0xa6, 0x31, 0xa7, 0x39, 0xaf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x14, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xce, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x76, 0xb5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x3d, 0xef, 0x5c, 0xe7, 0xbb, 0xdf, 0x91, 0x8e, 0x08, 0x46, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x47, 0x3e, 0xe9, 0x4d, 0x53, 0x9f, 0x9b, 0xdf, 0x3d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0x86, 0x31, 0x49, 0x4a, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x39, 0xd7, 0xbd, 0xd7, 0xbd, 0xcb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x39, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5c, 0xe7, 0xf9, 0xcf, 0xcc, 0x65, 0x47, 0x46, 0x86, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x47, 0x3e, 0x28, 0x46, 0x8e, 0x76, 0xbb, 0xdf, 0x3d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa6, 0x39, 0x86, 0x31, 0xbb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xe8, 0x41, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xb2, 0x94, 0x00, 0x00, 0xc7, 0x39, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xcb, 0x5a, 0x00, 0x00, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x7c, 0xe7, 0x96, 0xb7, 0xea, 0x55, 0x47, 0x3e, 0x86, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x47, 0x3e, 0x0a, 0x56, 0xda, 0xd7, 0x5c, 0xe7, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x34, 0xa5, 0xa6, 0x31, 0xa7, 0x39, 0xab, 0x5a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0x00, 0x00, 0xb2, 0x94, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x76, 0xb5, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x7b, 0xe7, 0x54, 0xa7, 0xe9, 0x4d, 0x67, 0x3e, 0x86, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x66, 0x3e, 0x67, 0x3e, 0xe9, 0x4d, 0x98, 0xc7, 0x5c, 0xe7, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xf3, 0x9c, 0xa6, 0x31, 0xa7, 0x39, 0x0c, 0x63, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0x00, 0x00, 0xb2, 0x94, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x76, 0xb5, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x9b, 0xdf, 0x33, 0x9f, 0x09, 0x4e, 0x47, 0x3e, 0x86, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x3e, 0x66, 0x3e, 0xe9, 0x4d, 0x77, 0xbf, 0x7c, 0xe7, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xf3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xf3, 0x9c, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xb2, 0x94, 0x00, 0x00, 0x49, 0x4a, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcb, 0x5a, 0x00, 0x00, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x51, 0x8c, 0x51, 0x8c, 0x51, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x04, 0x21, 0x51, 0x8c, 0x51, 0x8c, 0x31, 0x8c, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x9b, 0xdf, 0x13, 0x9f, 0x09, 0x4e, 0x47, 0x3e, 0x86, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x3e, 0x67, 0x3e, 0xe9, 0x4d, 0x77, 0xbf, 0x7c, 0xe7, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xd3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x34, 0xa5, 0xa6, 0x31, 0xa6, 0x31, 0xab, 0x5a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0x76, 0xb5, 0xd7, 0xbd, 0xcb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x7b, 0xe7, 0x54, 0xa7, 0xe9, 0x4d, 0x47, 0x3e, 0x86, 0x36, 0x66, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0xe9, 0x4d, 0x98, 0xc7, 0x7c, 0xe7, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xad, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xe8, 0x41, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xce, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x6d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x7c, 0xe7, 0x96, 0xb7, 0xca, 0x55, 0x47, 0x3e, 0x86, 0x36, 0x66, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x3e, 0x66, 0x3e, 0x66, 0x36, 0x67, 0x3e, 0x47, 0x3e, 0x0b, 0x56, 0xda, 0xd7, 0x5c, 0xe7, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x76, 0xb5, 0x51, 0x8c, 0x51, 0x8c, 0x76, 0xb5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0x51, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x31, 0x8c, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xf7, 0x5c, 0xe7, 0xf9, 0xcf, 0xec, 0x65, 0x48, 0x46, 0x86, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x47, 0x3e, 0x28, 0x46, 0x8e, 0x76, 0xbb, 0xdf, 0x3d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xba, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x14, 0xa5, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5c, 0xe7, 0xbb, 0xd7, 0x91, 0x8e, 0x28, 0x46, 0x66, 0x36, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x47, 0x3e, 0x09, 0x4e, 0x53, 0x9f, 0x7b, 0xdf, 0x3d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0xa6, 0x39, 0x49, 0x4a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x2c, 0x63, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5c, 0xef, 0x7c, 0xe7, 0x77, 0xbf, 0xe9, 0x4d, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x67, 0x3e, 0x87, 0x36, 0x47, 0x46, 0xeb, 0x65, 0xd8, 0xcf, 0x7c, 0xe7, 0x3d, 0xef, 0x2c, 0x63, 0xa6, 0x31, 0xa7, 0x39, 0xaf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xb7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbb, 0xdf, 0x8f, 0x7e, 0x08, 0x46, 0x47, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x67, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x47, 0x3e, 0x09, 0x4e, 0x13, 0x9f, 0xbb, 0xdf, 0x5d, 0xef, 0x5a, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x7c, 0xe7, 0xb8, 0xc7, 0xec, 0x65, 0x47, 0x46, 0x86, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x66, 0x36, 0x86, 0x36, 0x66, 0x36, 0x08, 0x46, 0x4e, 0x76, 0xda, 0xd7, 0x7c, 0xe7, 0x5d, 0xef, 0xaf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf4, 0xa4, 0xa7, 0x39, 0xa6, 0x31, 0xa7, 0x39, 0xf8, 0xc5, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xe7, 0x9b, 0xdf, 0x76, 0xb7, 0x0a, 0x56, 0x47, 0x46, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x67, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x28, 0x46, 0x0c, 0x66, 0xb8, 0xc7, 0x7b, 0xe7, 0x3d, 0xef, 0x18, 0xc6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x9b, 0xdf, 0x56, 0xb7, 0xcb, 0x5d, 0x28, 0x46, 0x66, 0x3e, 0x67, 0x3e, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x36, 0x66, 0x3e, 0x66, 0x3e, 0x66, 0x36, 0x47, 0x3e, 0x09, 0x4e, 0x0d, 0x6e, 0x98, 0xc7, 0x7b, 0xe7, 0x5c, 0xe7, 0xfc, 0xe6, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x8a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5c, 0xe7, 0x9b, 0xdf, 0x97, 0xbf, 0x4d, 0x6e, 0x09, 0x4e, 0x28, 0x46, 0x47, 0x46, 0x47, 0x3e, 0x47, 0x3e, 0x47, 0x3e, 0x67, 0x3e, 0x67, 0x3e, 0x47, 0x3e, 0x47, 0x3e, 0x47, 0x46, 0x28, 0x46, 0xe9, 0x4d, 0x8f, 0x86, 0xd9, 0xcf, 0x7b, 0xe7, 0x5d, 0xef, 0x3c, 0xe7, 0x2d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x9b, 0xdf, 0xda, 0xd7, 0x14, 0xa7, 0x0d, 0x6e, 0xe9, 0x55, 0x08, 0x46, 0x28, 0x46, 0x47, 0x46, 0x47, 0x46, 0x48, 0x46, 0x28, 0x46, 0x09, 0x4e, 0xea, 0x55, 0x4e, 0x76, 0x56, 0xb7, 0xba, 0xd7, 0x7c, 0xe7, 0x5c, 0xe7, 0x3c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x0c, 0x63, 0xbb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7c, 0xe7, 0x9b, 0xdf, 0xf9, 0xcf, 0x95, 0xaf, 0x11, 0x8f, 0xae, 0x76, 0x6d, 0x6e, 0x4d, 0x66, 0x6d, 0x6e, 0xaf, 0x7e, 0x32, 0x97, 0xd7, 0xbf, 0xda, 0xd7, 0x9b, 0xdf, 0x5c, 0xe7, 0x5d, 0xef, 0xbb, 0xde, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0x35, 0xad, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5c, 0xe7, 0x7c, 0xe7, 0x9b, 0xdf, 0xbb, 0xdf, 0xba, 0xd7, 0xba, 0xd7, 0xba, 0xd7, 0xbb, 0xdf, 0x9c, 0xdf, 0x7c, 0xe7, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x35, 0xad, 0x08, 0x42, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xab, 0x5a, 0x55, 0xad, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xf7, 0x3d, 0xf7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0xfd, 0xee, 0x35, 0xad, 0xab, 0x5a, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xe8, 0x41, 0x8e, 0x73, 0xd3, 0x9c, 0xd7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xbb, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x79, 0xce, 0xd7, 0xbd, 0xd3, 0x9c, 0x8e, 0x73, 0x07, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa7, 0x39, 0xa7, 0x39, 0xa6, 0x39, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfb, 0xde, 0x55, 0xad, 0xef, 0x7b, 0xeb, 0x5a, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x86, 0x31, 0xa7, 0x39, 0x87, 0x39, 0xa7, 0x39, 0x87, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0x08, 0x42, 0xcc, 0x62, 0xd0, 0x83, 0x55, 0xad, 0xfb, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-};
-
-const lv_image_dsc_t sw_off = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 75,
-  .header.h = 42,
-  .data_size = 3150 * 2,
-  .data = sw_off_map,
-};
@@ -1,76 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_SW_ON
-#define LV_ATTRIBUTE_IMAGE_SW_ON
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_SW_ON uint8_t sw_on_map[] = {
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xfc, 0xe6, 0xfb, 0xde, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xdb, 0xde, 0x55, 0xad, 0xf0, 0x7b, 0xec, 0x5a, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x08, 0x42, 0xeb, 0x5a, 0xef, 0x7b, 0x55, 0xad, 0xfb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xe8, 0x41, 0x8e, 0x73, 0xd3, 0x9c, 0xb7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xbb, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x59, 0xce, 0xb7, 0xbd, 0xd3, 0x9c, 0x8e, 0x73, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa7, 0x39, 0xaa, 0x52, 0x35, 0xa5, 0x1c, 0xdf, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x35, 0xad, 0xaa, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0x14, 0xa5, 0x5d, 0xef, 0x3c, 0xef, 0x3c, 0xf7, 0x3c, 0xf7, 0x1b, 0xff, 0x1b, 0xff, 0x1a, 0xff, 0xfa, 0xfe, 0xfa, 0xfe, 0x1b, 0xff, 0x1b, 0xff, 0x3c, 0xf7, 0x3c, 0xf7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0x0c, 0x63, 0xbb, 0xd6, 0x5d, 0xef, 0x3c, 0xef, 0x3b, 0xff, 0xfa, 0xfe, 0x36, 0xfe, 0xd0, 0xec, 0xcb, 0xd3, 0x29, 0xc3, 0x08, 0xc3, 0x28, 0xc3, 0xab, 0xd3, 0x8f, 0xe4, 0xf4, 0xfd, 0xf9, 0xfe, 0x1b, 0xff, 0x3c, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0xec, 0x62, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6d, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x3c, 0xf7, 0xfa, 0xfe, 0xb4, 0xf5, 0x6a, 0xbb, 0x04, 0xaa, 0xe3, 0xb1, 0xe2, 0xb9, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc2, 0xc1, 0xe2, 0xb1, 0x03, 0xaa, 0xe8, 0xb2, 0x32, 0xed, 0xfa, 0xfe, 0x1c, 0xf7, 0x3c, 0xf7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0x4d, 0x6b, 0x3c, 0xe7, 0x3c, 0xef, 0x1b, 0xff, 0xb8, 0xfe, 0xcb, 0xd3, 0x03, 0xb2, 0xc2, 0xc1, 0xc1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xc2, 0xc1, 0xe3, 0xb9, 0x08, 0xc3, 0x36, 0xfe, 0x1b, 0xff, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x69, 0x4a, 0xfb, 0xe6, 0x5d, 0xef, 0x1b, 0xff, 0x57, 0xfe, 0xe8, 0xb2, 0xe2, 0xb9, 0xa1, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0x80, 0xd1, 0xa1, 0xc9, 0xc2, 0xc1, 0x45, 0xb2, 0xd5, 0xed, 0x1b, 0xff, 0x3c, 0xf7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xf4, 0x9c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf8, 0xbd, 0x5d, 0xef, 0x3c, 0xf7, 0x78, 0xfe, 0xa6, 0xba, 0xc2, 0xc1, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xc1, 0xc1, 0x25, 0xb2, 0xd4, 0xfd, 0x1b, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0xaf, 0x7b, 0x5d, 0xe7, 0x3c, 0xf7, 0xfa, 0xfe, 0x6a, 0xbb, 0xc2, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa0, 0xd1, 0x80, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0x86, 0xb2, 0x98, 0xfe, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xaf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xb7, 0xbd, 0xa7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0x79, 0xd6, 0x5d, 0xef, 0x1b, 0xff, 0xd0, 0xec, 0xe3, 0xb1, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xe2, 0xb9, 0xcc, 0xd3, 0xf9, 0xfe, 0x3c, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0xa7, 0x39, 0xa6, 0x31, 0xa7, 0x39, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x39, 0xa6, 0x31, 0x2c, 0x63, 0x5d, 0xef, 0x3c, 0xf7, 0xd9, 0xfe, 0x65, 0xba, 0xc1, 0xc9, 0xa0, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xc1, 0xc1, 0x03, 0xb2, 0xf5, 0xfd, 0x3c, 0xf7, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xd7, 0xbd, 0xd7, 0xbd, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0xd7, 0xbd, 0x39, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0xd7, 0xbd, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x2c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0xa6, 0x39, 0xa6, 0x31, 0x14, 0xa5, 0x3c, 0xef, 0x1b, 0xff, 0x32, 0xe5, 0xe3, 0xb9, 0xa0, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xc2, 0xb9, 0xec, 0xdb, 0x1b, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xce, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0xfb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xbb, 0xd6, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0x9a, 0xce, 0x3c, 0xef, 0xfa, 0xfe, 0x8b, 0xc3, 0xc2, 0xc1, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xc1, 0xc9, 0x65, 0xb2, 0xfa, 0xfe, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x39, 0x51, 0x8c, 0xcf, 0x7b, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0xfc, 0xe6, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xbb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x39, 0xe8, 0x41, 0x5d, 0xe7, 0x3c, 0xf7, 0xd9, 0xfe, 0x45, 0xaa, 0xc1, 0xc9, 0x80, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xe3, 0xb1, 0x36, 0xfe, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x4d, 0x6b, 0x00, 0x00, 0xcb, 0x5a, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x38, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0xfc, 0xe6, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x35, 0xa5, 0xa6, 0x31, 0xa6, 0x39, 0xaa, 0x5a, 0x5d, 0xe7, 0x3c, 0xf7, 0x57, 0xfe, 0x04, 0xaa, 0xc1, 0xc9, 0x80, 0xd9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xe2, 0xb9, 0x53, 0xed, 0x1b, 0xff, 0x5d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x6d, 0x6b, 0x00, 0x00, 0xcf, 0x7b, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xf4, 0x9c, 0xa6, 0x31, 0xa6, 0x39, 0x0c, 0x63, 0x5d, 0xe7, 0x1c, 0xf7, 0xf5, 0xfd, 0x03, 0xaa, 0xa1, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xe2, 0xb9, 0x11, 0xe5, 0x1b, 0xff, 0x3d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x76, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xf3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xf4, 0x9c, 0xa6, 0x31, 0x86, 0x39, 0x0c, 0x63, 0x5d, 0xe7, 0x3c, 0xf7, 0xf5, 0xfd, 0x03, 0xaa, 0xa1, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xe2, 0xb9, 0x11, 0xe5, 0x1b, 0xff, 0x3d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xc7, 0x39, 0x00, 0x00, 0xb2, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xc7, 0x39, 0x00, 0x00, 0xb2, 0x94, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xf3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x35, 0xa5, 0xa6, 0x31, 0xa6, 0x39, 0xab, 0x5a, 0x5d, 0xe7, 0x3c, 0xf7, 0x77, 0xfe, 0x04, 0xaa, 0xa1, 0xc9, 0x80, 0xd9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xe2, 0xb9, 0x73, 0xed, 0x1b, 0xff, 0x5d, 0xef, 0x5d, 0xe7, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x76, 0xb5, 0x5d, 0xef, 0xfc, 0xe6, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0xcb, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x39, 0xe8, 0x41, 0x5d, 0xe7, 0x3c, 0xf7, 0xd9, 0xfe, 0x65, 0xaa, 0xc1, 0xc9, 0x80, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xe3, 0xb1, 0x36, 0xfe, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0xc7, 0x39, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa7, 0x39, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xbb, 0xd6, 0xa7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0x9a, 0xce, 0x3c, 0xef, 0xfa, 0xfe, 0x8a, 0xc3, 0xc1, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa1, 0xc9, 0x45, 0xba, 0xfa, 0xfe, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0x4d, 0x6b, 0x49, 0x4a, 0x49, 0x4a, 0xb2, 0x94, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xce, 0x49, 0x4a, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xce, 0x49, 0x4a, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xba, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0xa6, 0x39, 0xa6, 0x31, 0x15, 0xa5, 0x3d, 0xef, 0x1b, 0xff, 0x12, 0xe5, 0xe2, 0xb9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xc2, 0xc1, 0xec, 0xdb, 0x1b, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x2c, 0x63, 0x5d, 0xef, 0x3c, 0xf7, 0xd9, 0xfe, 0x65, 0xba, 0xc1, 0xc1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xc1, 0xc1, 0x03, 0xaa, 0xf5, 0xfd, 0x3c, 0xf7, 0x5d, 0xe7, 0x3c, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x2c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xb7, 0xbd, 0xa7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0x7a, 0xd6, 0x5d, 0xef, 0x1b, 0xff, 0xd0, 0xec, 0xe3, 0xb1, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xe2, 0xb9, 0xcb, 0xcb, 0xfa, 0xfe, 0x3c, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0xaf, 0x7b, 0x5d, 0xe7, 0x3c, 0xf7, 0xfa, 0xfe, 0x4a, 0xbb, 0xc2, 0xc1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0x80, 0xd9, 0xa0, 0xd1, 0xc1, 0xc1, 0x86, 0xb2, 0x98, 0xfe, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xae, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf4, 0x9c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x18, 0xc6, 0x5d, 0xef, 0x3c, 0xf7, 0x78, 0xfe, 0xa6, 0xba, 0xc1, 0xc1, 0xa1, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xc1, 0xc1, 0x24, 0xaa, 0xd4, 0xfd, 0x1b, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0xfc, 0xe6, 0x5d, 0xef, 0x1b, 0xff, 0x57, 0xfe, 0xe8, 0xb2, 0xe2, 0xb9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa0, 0xd1, 0xa1, 0xc9, 0xc2, 0xb9, 0x45, 0xb2, 0xd5, 0xed, 0x1b, 0xff, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xe7, 0x3d, 0xef, 0x1c, 0xf7, 0xb8, 0xfe, 0xcb, 0xd3, 0xe3, 0xb1, 0xe2, 0xb9, 0xc1, 0xc1, 0xa1, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xa0, 0xc9, 0xa0, 0xc9, 0xa1, 0xc9, 0xa1, 0xc9, 0xc1, 0xc1, 0xc1, 0xc1, 0xe3, 0xb1, 0x09, 0xc3, 0x36, 0xfe, 0x1b, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x2d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x3d, 0xef, 0x3c, 0xf7, 0xfa, 0xfe, 0xb4, 0xf5, 0x4a, 0xc3, 0x04, 0xaa, 0xe3, 0xb9, 0xc2, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xe2, 0xb9, 0x03, 0xb2, 0xe8, 0xba, 0x32, 0xed, 0xfa, 0xfe, 0x1b, 0xff, 0x3c, 0xf7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xec, 0x62, 0xbb, 0xd6, 0x5d, 0xef, 0x3c, 0xef, 0x1b, 0xff, 0xf9, 0xfe, 0x36, 0xfe, 0xaf, 0xec, 0xab, 0xdb, 0x28, 0xcb, 0xe7, 0xc2, 0x08, 0xcb, 0x8a, 0xd3, 0x6e, 0xe4, 0xd4, 0xfd, 0xf9, 0xfe, 0x1b, 0xff, 0x3c, 0xf7, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbb, 0xde, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x08, 0x42, 0x35, 0xad, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x3c, 0xf7, 0x1c, 0xff, 0x1b, 0xff, 0x1a, 0xff, 0xfa, 0xfe, 0xfa, 0xfe, 0x1b, 0xff, 0x1b, 0xff, 0x3c, 0xf7, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x35, 0xad, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xab, 0x52, 0x55, 0xad, 0x3d, 0xdf, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x55, 0xad, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xe7, 0x41, 0x8e, 0x73, 0xd3, 0x9c, 0xd7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x59, 0xce, 0xb7, 0xbd, 0xd3, 0x9c, 0x6e, 0x73, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xde, 0x55, 0xad, 0xf0, 0x7b, 0xcb, 0x5a, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0xeb, 0x5a, 0xef, 0x7b, 0x55, 0xad, 0xfb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-};
-
-const lv_image_dsc_t sw_on = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 75,
-  .header.h = 42,
-  .data_size = 3150 * 2,
-  .data = sw_on_map,
-};
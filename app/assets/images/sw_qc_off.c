@@ -1,76 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMAGE_SW_QC_OFF
-#define LV_ATTRIBUTE_IMAGE_SW_QC_OFF
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_SW_QC_OFF uint8_t sw_qc_off_map[] = {
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xfc, 0xe6, 0xfb, 0xde, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfb, 0xde, 0x55, 0xad, 0xef, 0x83, 0xeb, 0x5a, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0x08, 0x42, 0xeb, 0x5a, 0xef, 0x7b, 0x55, 0xad, 0xfb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0x86, 0x31, 0xe8, 0x41, 0x8e, 0x73, 0xd3, 0x9c, 0xb7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xba, 0xd6, 0xba, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xbb, 0xde, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x59, 0xce, 0xb7, 0xbd, 0xd3, 0x9c, 0x8e, 0x73, 0xe8, 0x41, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xaa, 0x52, 0x34, 0xad, 0x1b, 0xe7, 0x5c, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x3c, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x35, 0xad, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5e, 0xe7, 0x7f, 0xdf, 0x7f, 0xd7, 0x7f, 0xd7, 0x9f, 0xd7, 0x7f, 0xd7, 0x7f, 0xd7, 0x7f, 0xdf, 0x7e, 0xdf, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x34, 0xa5, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7, 0x4d, 0x6b, 0xa6, 0x39, 0xa6, 0x39, 0xa7, 0x31, 0xec, 0x62, 0xba, 0xde, 0x5d, 0xef, 0x5d, 0xe7, 0x7f, 0xdf, 0x9f, 0xcf, 0x3f, 0xb7, 0x3d, 0x86, 0x7b, 0x5d, 0x1a, 0x4d, 0xf9, 0x44, 0x19, 0x45, 0x7b, 0x5d, 0x1c, 0x7e, 0xff, 0xa6, 0x9f, 0xcf, 0x7f, 0xdf, 0x5d, 0xe7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x84, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x39, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5e, 0xe7, 0x9f, 0xd7, 0xbe, 0xa6, 0xf9, 0x54, 0x36, 0x24, 0x58, 0x1c, 0x79, 0x14, 0x79, 0x14, 0x79, 0x0c, 0x79, 0x14, 0x79, 0x14, 0x38, 0x1c, 0x37, 0x24, 0xb8, 0x44, 0x5d, 0x96, 0x9f, 0xd7, 0x5e, 0xdf, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3c, 0xef, 0x5d, 0xe7, 0x7f, 0xdf, 0x7f, 0xc7, 0x7b, 0x5d, 0x58, 0x1c, 0x79, 0x14, 0x7a, 0x0c, 0x7a, 0x0c, 0x9a, 0x04, 0x7b, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x7b, 0x04, 0x9b, 0x0c, 0x7a, 0x0c, 0x79, 0x0c, 0x58, 0x1c, 0xf9, 0x4c, 0x3f, 0xaf, 0x7f, 0xdf, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x2d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x69, 0x4a, 0x1c, 0xe7, 0x5d, 0xef, 0x7f, 0xdf, 0x3f, 0xbf, 0xb8, 0x44, 0x58, 0x1c, 0x9a, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x0c, 0x59, 0x14, 0x57, 0x34, 0xbe, 0xa6, 0x7f, 0xdf, 0x5e, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0xf4, 0xa4, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf7, 0xc5, 0x5d, 0xef, 0x7e, 0xdf, 0x5f, 0xbf, 0xb8, 0x3c, 0x59, 0x14, 0x7a, 0x0c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x9b, 0x04, 0x7a, 0x14, 0x57, 0x2c, 0xdf, 0xa6, 0x7f, 0xdf, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa7, 0x31, 0xcf, 0x7b, 0x3d, 0xef, 0x5e, 0xe7, 0x9f, 0xcf, 0xf9, 0x54, 0x59, 0x14, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9a, 0x04, 0x7b, 0x04, 0x9c, 0x04, 0x9b, 0x04, 0x59, 0x14, 0x98, 0x3c, 0x5f, 0xc7, 0x5e, 0xe7, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xaf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xb7, 0xbd, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0x7a, 0xce, 0x5d, 0xef, 0x7f, 0xdf, 0x3d, 0x86, 0x58, 0x1c, 0x7a, 0x0c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x58, 0x1c, 0x7a, 0x65, 0x9f, 0xcf, 0x5d, 0xe7, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x79, 0xce, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x2c, 0x63, 0x5d, 0xef, 0x5d, 0xe7, 0x7f, 0xcf, 0x98, 0x34, 0x7a, 0x0c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x37, 0x24, 0x3f, 0xa7, 0x5e, 0xe7, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x38, 0xce, 0xd7, 0xbd, 0x9a, 0xd6, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xce, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x39, 0xce, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0xd7, 0xbd, 0xd7, 0xbd, 0xfc, 0xe6, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x2c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x13, 0xa5, 0x5d, 0xe7, 0x7f, 0xdf, 0x5d, 0x96, 0x58, 0x1c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x59, 0x14, 0x9b, 0x65, 0x7f, 0xdf, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xc7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xc7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xb2, 0x94, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0x99, 0xd6, 0x5d, 0xe7, 0x9f, 0xcf, 0x39, 0x5d, 0x79, 0x14, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x7a, 0x0c, 0x98, 0x34, 0x9f, 0xcf, 0x5d, 0xe7, 0x5d, 0xef, 0xc7, 0x39, 0x00, 0x00, 0x49, 0x4a, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x94, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x39, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xbb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x39, 0xa7, 0x31, 0x08, 0x42, 0x3c, 0xf7, 0x5d, 0xe7, 0xbf, 0xc7, 0x57, 0x34, 0x7a, 0x0c, 0x9c, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x58, 0x1c, 0x1f, 0xb7, 0x5e, 0xe7, 0x39, 0xc6, 0x00, 0x00, 0x04, 0x21, 0xfc, 0xe6, 0x5d, 0xef, 0x76, 0xb5, 0x00, 0x00, 0xc7, 0x39, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x04, 0x21, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x76, 0xb5, 0x00, 0x00, 0x49, 0x4a, 0x04, 0x21, 0x00, 0x00, 0x39, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x34, 0xad, 0xa6, 0x39, 0xa7, 0x31, 0xab, 0x5a, 0x3c, 0xf7, 0x5e, 0xe7, 0x5f, 0xb7, 0x37, 0x24, 0x7a, 0x0c, 0x9c, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x58, 0x1c, 0x7d, 0x9e, 0x7f, 0xdf, 0x51, 0x8c, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0xcb, 0x5a, 0x14, 0xa5, 0xfc, 0xe6, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x49, 0x4a, 0x00, 0x00, 0x76, 0xb5, 0xb2, 0x94, 0x00, 0x00, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xf3, 0x9c, 0xa6, 0x39, 0xa7, 0x31, 0x0c, 0x63, 0x5c, 0xef, 0x5e, 0xe7, 0x1f, 0xaf, 0x37, 0x24, 0x7a, 0x0c, 0x9c, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x58, 0x1c, 0x3c, 0x8e, 0x7f, 0xdf, 0x51, 0x8c, 0x00, 0x08, 0x4d, 0x6b, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xce, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0xcb, 0x5a, 0x5d, 0xef, 0x5d, 0xef, 0x9a, 0xd6, 0x00, 0x00, 0x04, 0x21, 0xfc, 0xe6, 0xfc, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xf3, 0x9c, 0x3d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xf3, 0x9c, 0xa6, 0x39, 0xa7, 0x31, 0x0c, 0x63, 0x3c, 0xef, 0x5e, 0xe7, 0x1f, 0xaf, 0x37, 0x24, 0x7a, 0x0c, 0x9c, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x58, 0x1c, 0x3c, 0x8e, 0x7f, 0xdf, 0x14, 0xa5, 0x00, 0x08, 0x49, 0x4a, 0x5d, 0xef, 0x3d, 0xef, 0x9a, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0x5d, 0xef, 0x4d, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xf3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x34, 0xad, 0xa6, 0x39, 0xa7, 0x31, 0xcb, 0x5a, 0x3c, 0xf7, 0x5e, 0xe7, 0x5f, 0xb7, 0x36, 0x24, 0x7a, 0x0c, 0x9c, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x58, 0x1c, 0x7d, 0x9e, 0x7f, 0xdf, 0xfc, 0xde, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x5d, 0xef, 0x4d, 0x6b, 0x00, 0x00, 0xcb, 0x5a, 0x5d, 0xef, 0xfb, 0xde, 0x4d, 0x6b, 0x14, 0xa5, 0x5d, 0xef, 0xd7, 0xbd, 0x51, 0x8c, 0x9a, 0xd6, 0x5d, 0xef, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe6, 0xfc, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x49, 0x4a, 0x00, 0x00, 0xc7, 0x39, 0xfc, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0x34, 0xa5, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa6, 0x39, 0xa7, 0x31, 0x08, 0x42, 0x3c, 0xf7, 0x5e, 0xe7, 0xbf, 0xc7, 0x57, 0x34, 0x7a, 0x0c, 0x9c, 0x04, 0x9b, 0x04, 0x9a, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x58, 0x1c, 0x1f, 0xb7, 0x5e, 0xe7, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x5d, 0xef, 0x51, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xd6, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x7b, 0x5d, 0xef, 0xb2, 0x94, 0x00, 0x00, 0xcb, 0x5a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x04, 0x21, 0x00, 0x00, 0x76, 0xb5, 0x3d, 0xef, 0x5d, 0xef, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x5d, 0xef, 0xba, 0xd6, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0x99, 0xd6, 0x5d, 0xe7, 0x9f, 0xcf, 0x39, 0x5d, 0x79, 0x14, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9a, 0x04, 0x7a, 0x0c, 0x98, 0x2c, 0x9f, 0xcf, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x76, 0xb5, 0xcb, 0x5a, 0x49, 0x4a, 0xcf, 0x7b, 0x9a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xde, 0xcb, 0x5a, 0xb2, 0x94, 0x3d, 0xef, 0xfc, 0xe6, 0xb2, 0x94, 0xcb, 0x5a, 0x49, 0x4a, 0x4d, 0x6b, 0x76, 0xb5, 0x5d, 0xef, 0x5d, 0xef, 0x4d, 0x6b, 0x49, 0x4a, 0x39, 0xce, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0x49, 0x4a, 0x51, 0x8c, 0x5d, 0xef, 0x9a, 0xd6, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xba, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa7, 0x31, 0xa6, 0x31, 0x14, 0xa5, 0x5d, 0xe7, 0x7f, 0xdf, 0x5d, 0x96, 0x58, 0x1c, 0x7b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x59, 0x14, 0x9c, 0x65, 0x7f, 0xdf, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x14, 0xa5, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xcf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x2c, 0x63, 0x5d, 0xef, 0x5d, 0xe7, 0x7f, 0xcf, 0x98, 0x34, 0x7a, 0x0c, 0x7b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7b, 0x04, 0x7b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x37, 0x24, 0x1f, 0xa7, 0x5e, 0xe7, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x2c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0xb7, 0xbd, 0xa6, 0x39, 0xa6, 0x31, 0xa7, 0x31, 0x7a, 0xce, 0x5d, 0xef, 0x7f, 0xdf, 0x3d, 0x86, 0x58, 0x1c, 0x7a, 0x0c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x58, 0x1c, 0x7a, 0x65, 0x9f, 0xcf, 0x5d, 0xe7, 0x3c, 0xf7, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x79, 0xce, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xb7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x49, 0x4a, 0xa6, 0x31, 0xa7, 0x31, 0xcf, 0x7b, 0x5d, 0xef, 0x5e, 0xe7, 0x9f, 0xcf, 0xf9, 0x54, 0x79, 0x14, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9c, 0x04, 0x9b, 0x04, 0x79, 0x14, 0x98, 0x3c, 0x5f, 0xbf, 0x7e, 0xdf, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xaf, 0x7b, 0xa6, 0x31, 0xa6, 0x31, 0x49, 0x4a, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf4, 0xa4, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xf7, 0xc5, 0x5d, 0xef, 0x7e, 0xdf, 0x5f, 0xbf, 0xb9, 0x3c, 0x79, 0x14, 0x7a, 0x0c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x57, 0x2c, 0xdf, 0xa6, 0x7f, 0xdf, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xf8, 0xc5, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xf4, 0xa4, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6a, 0x52, 0xa6, 0x31, 0xa6, 0x31, 0x69, 0x4a, 0xfc, 0xe6, 0x5d, 0xef, 0x7e, 0xdf, 0x3f, 0xbf, 0xb7, 0x4c, 0x58, 0x1c, 0x7a, 0x0c, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x9b, 0x04, 0x7a, 0x0c, 0x59, 0x14, 0x57, 0x34, 0xbe, 0xa6, 0x7f, 0xdf, 0x5e, 0xe7, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfc, 0xe6, 0x69, 0x4a, 0xa6, 0x31, 0xa6, 0x31, 0x6a, 0x52, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd7, 0xbd, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3c, 0xef, 0x5d, 0xe7, 0x5e, 0xdf, 0x5f, 0xc7, 0x7b, 0x5d, 0x58, 0x1c, 0x59, 0x14, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x9a, 0x04, 0x7b, 0x04, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x79, 0x14, 0x58, 0x1c, 0xf9, 0x4c, 0x3f, 0xb7, 0x7f, 0xdf, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x2d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xd7, 0xbd, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x31, 0x8c, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xe7, 0x7e, 0xdf, 0x9f, 0xd7, 0xbe, 0xa6, 0x19, 0x55, 0x37, 0x24, 0x58, 0x1c, 0x59, 0x14, 0x7a, 0x0c, 0x7a, 0x0c, 0x7a, 0x0c, 0x79, 0x14, 0x59, 0x14, 0x37, 0x24, 0xb8, 0x44, 0x5d, 0x96, 0x9f, 0xd7, 0x7e, 0xdf, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6e, 0x73, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x31, 0x8c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7, 0x4d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0x0c, 0x63, 0xba, 0xde, 0x5d, 0xef, 0x5d, 0xe7, 0x7f, 0xdf, 0x9f, 0xcf, 0x5f, 0xaf, 0x5e, 0x7e, 0x9b, 0x5d, 0x1a, 0x4d, 0xfa, 0x44, 0x1a, 0x45, 0x7b, 0x55, 0x1d, 0x76, 0xff, 0xa6, 0x9f, 0xcf, 0x7f, 0xd7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xbb, 0xde, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x0c, 0x63, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0x35, 0xad, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5e, 0xe7, 0x7f, 0xdf, 0x7f, 0xd7, 0x7f, 0xd7, 0x9f, 0xd7, 0x9f, 0xd7, 0x7f, 0xd7, 0x7f, 0xdf, 0x5e, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x35, 0xad, 0x08, 0x42, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x0c, 0x63, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x6d, 0x6b, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xaa, 0x5a, 0x54, 0xad, 0x1b, 0xef, 0x3c, 0xf7, 0x3c, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x3c, 0xf7, 0x3c, 0xf7, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1c, 0xe7, 0x55, 0xad, 0xab, 0x5a, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x6e, 0x73, 0x1c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xd3, 0x9c, 0xc7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xe8, 0x41, 0x8e, 0x73, 0xd3, 0x9c, 0xd7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xbb, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0x9a, 0xd6, 0x59, 0xce, 0xb7, 0xbd, 0xd3, 0x9c, 0x6e, 0x73, 0xe8, 0x41, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xd3, 0x9c, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x7a, 0xd6, 0x4d, 0x6b, 0xa6, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x4d, 0x6b, 0x7a, 0xd6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x18, 0xc6, 0x8e, 0x73, 0xc7, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x31, 0xa7, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0x8e, 0x73, 0x18, 0xc6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0xfb, 0xde, 0x55, 0xad, 0xef, 0x83, 0xeb, 0x5a, 0x08, 0x42, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa6, 0x39, 0xa7, 0x31, 0xa7, 0x39, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0xa6, 0x31, 0x08, 0x42, 0xeb, 0x5a, 0xef, 0x7b, 0x55, 0xad, 0xfb, 0xde, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0xfc, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xe6, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0xfc, 0xe6, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-  0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 
-};
-
-const lv_image_dsc_t sw_qc_off = {
-  .header.cf = LV_COLOR_FORMAT_RGB565,
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.w = 75,
-  .header.h = 42,
-  .data_size = 3150 * 2,
-  .data = sw_qc_off_map,
-};
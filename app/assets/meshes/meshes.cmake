@@ -0,0 +1,27 @@
+# Wireframe meshes, converted from OBJ to constexpr headers at build time
+#
+# app_generate_meshes(<target>) adds the generated headers to <target> and the directory holding them to its include
+# path, so sources include them as <assets/meshes/<name>.h>. Add a model with another app_add_mesh() line below.
+
+set(APP_MESHES_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+function(app_add_mesh target name obj)
+    set(header ${CMAKE_CURRENT_BINARY_DIR}/generated/assets/meshes/${name}.h)
+    add_custom_command(
+        OUTPUT ${header}
+        COMMAND ${Python3_EXECUTABLE} ${APP_MESHES_DIR}/obj_to_header.py ${obj} ${header} --name ${name}
+        DEPENDS ${APP_MESHES_DIR}/obj_to_header.py ${obj}
+        COMMENT "Generating mesh header ${name}.h"
+        VERBATIM
+    )
+    target_sources(${target} PRIVATE ${header})
+endfunction()
+
+function(app_generate_meshes target)
+    if(NOT Python3_EXECUTABLE)
+        find_package(Python3 REQUIRED COMPONENTS Interpreter)
+    endif()
+    target_include_directories(${target} PRIVATE ${CMAKE_CURRENT_BINARY_DIR}/generated)
+
+    app_add_mesh(${target} space_ship ${APP_MESHES_DIR}/../../../LowPolySpaceShip/SpaceShip.obj)
+endfunction()
@@ -0,0 +1,146 @@
+"""
+SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+
+SPDX-License-Identifier: MIT
+
+Convert a Wavefront OBJ into a constexpr wireframe header.
+
+Vertices closer than the weld distance are merged, every face outline and line element becomes an edge, and edges
+that collapse to a point or repeat another are dropped. Positions are quantized to int16 with one scale per mesh.
+
+    python obj_to_header.py SpaceShip.obj space_ship.h --name space_ship
+"""
+import argparse
+import os
+import sys
+
+
+def parse_obj(path):
+    vertices = []
+    polylines = []
+    with open(path, "r") as f:
+        for line in f:
+            tokens = line.split()
+            if not tokens:
+                continue
+            if tokens[0] == "v":
+                vertices.append(tuple(float(t) for t in tokens[1:4]))
+            elif tokens[0] in ("f", "l"):
+                # f 1/2/3 ..., negative indices count back from the latest vertex
+                indices = []
+                for t in tokens[1:]:
+                    i = int(t.split("/")[0])
+                    indices.append(i - 1 if i > 0 else len(vertices) + i)
+                if tokens[0] == "f":
+                    indices.append(indices[0])
+                polylines.append(indices)
+    return vertices, polylines
+
+
+def weld(vertices, distance):
+    welded = []
+    remap = []
+    for v in vertices:
+        for j, w in enumerate(welded):
+            if max(abs(a - b) for a, b in zip(v, w)) <= distance:
+                remap.append(j)
+                break
+        else:
+            remap.append(len(welded))
+            welded.append(v)
+    return welded, remap
+
+
+def build_edges(polylines, remap):
+    edges = set()
+    for polyline in polylines:
+        for a, b in zip(polyline, polyline[1:]):
+            a, b = remap[a], remap[b]
+            if a != b:
+                edges.add((min(a, b), max(a, b)))
+    return sorted(edges)
+
+
+def quantize(vertices):
+    extent = max(abs(c) for v in vertices for c in v) or 1.0
+    scale = extent / 32767.0
+    return [tuple(int(round(c / scale)) for c in v) for v in vertices], scale
+
+
+def write_header(path, name, source, vertices, edges, scale, stats):
+    index_type = "uint8_t" if len(vertices) <= 256 else "uint16_t"
+    lo = tuple(min(v[i] for v in vertices) for i in range(3))
+    hi = tuple(max(v[i] for v in vertices) for i in range(3))
+
+    lines = []
+    lines.append("// Generated by app/assets/meshes/obj_to_header.py from {}, do not edit".format(source))
+    lines.append("// {} vertices welded to {}, {} edges kept of {}".format(*stats))
+    lines.append("#pragma once")
+    lines.append("#include <cstdint>")
+    lines.append("")
+    lines.append("namespace meshes {")
+    lines.append("namespace {} {{".format(name))
+    lines.append("")
+    lines.append("struct Vertex_t {")
+    lines.append("    int16_t x;")
+    lines.append("    int16_t y;")
+    lines.append("    int16_t z;")
+    lines.append("};")
+    lines.append("")
+    lines.append("struct Edge_t {")
+    lines.append("    {} a;".format(index_type))
+    lines.append("    {} b;".format(index_type))
+    lines.append("};")
+    lines.append("")
+    lines.append("// Model units per step of a quantized position")
+    lines.append("constexpr float kScale = {!r}f;".format(float("{:.9g}".format(scale))))
+    lines.append("")
+    lines.append("constexpr Vertex_t kMin = {{{}, {}, {}}};".format(*lo))
+    lines.append("constexpr Vertex_t kMax = {{{}, {}, {}}};".format(*hi))
+    lines.append("")
+    lines.append("constexpr Vertex_t kVertices[] = {")
+    for v in vertices:
+        lines.append("    {{{}, {}, {}}},".format(*v))
+    lines.append("};")
+    lines.append("")
+    lines.append("constexpr Edge_t kEdges[] = {")
+    for e in edges:
+        lines.append("    {{{}, {}}},".format(*e))
+    lines.append("};")
+    lines.append("")
+    lines.append("}}  // namespace {}".format(name))
+    lines.append("}  // namespace meshes")
+    lines.append("")
+
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a Wavefront OBJ into a constexpr wireframe header")
+    parser.add_argument("input", help="OBJ file, export FBX or blend models to OBJ first")
+    parser.add_argument("output", help="header to write")
+    parser.add_argument("--name", required=True, help="namespace of the mesh in the header")
+    parser.add_argument("--weld", type=float, default=1e-4, help="merge vertices closer than this, in model units")
+    args = parser.parse_args()
+
+    vertices, polylines = parse_obj(args.input)
+    if not vertices:
+        sys.exit("{}: no vertices".format(args.input))
+
+    welded, remap = weld(vertices, args.weld)
+    quantized, scale = quantize(welded)
+    # Points that only quantizing brought together are welded as well
+    quantized, requantized = weld(quantized, 0)
+    remap = [requantized[i] for i in remap]
+
+    edges = build_edges(polylines, remap)
+    raw_edges = len(build_edges(polylines, list(range(len(vertices)))))
+    stats = (len(vertices), len(quantized), len(edges), raw_edges)
+
+    write_header(args.output, args.name, os.path.basename(args.input), quantized, edges, scale, stats)
+
+
+if __name__ == "__main__":
+    main()
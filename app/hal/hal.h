@@ -5,6 +5,7 @@
  */
 #pragma once
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <queue>
 #include <string>
@@ -12,6 +13,15 @@
 #include <mutex>
 #include <vector>
 
+namespace audio {
+class MixerSource;
+struct CaptureSnapshot_t;
+}
+
+namespace imu {
+struct Attitude_t;
+}
+
 /**
  * @brief Hardware abstraction layer
  *
@@ -56,6 +66,11 @@ public:
     {
         return 0.0f;
     }
+    // Busy percentage of each core since the previous call, empty where the platform can't tell
+    virtual std::vector<float> getCpuCoreLoads()
+    {
+        return {};
+    }
 
     /* --------------------------------- Display -------------------------------- */
     virtual int getDisplayWidth()
@@ -73,9 +88,28 @@ public:
     {
         return 0;
     }
+    // Per flushed area averages, render overlapping rotate and transfer shows as frameUs below renderUs + latencyUs
+    struct DisplayFlushStats_t {
+        uint32_t flushes          = 0;
+        uint32_t renderUs         = 0;  // lvgl drawing into the buffer
+        uint32_t waitUs           = 0;  // flush waiting for a free rotate buffer
+        uint32_t rotateUs         = 0;
+        uint32_t queueUs          = 0;  // rotated, waiting for the panel
+        uint32_t transferUs       = 0;
+        uint32_t latencyUs        = 0;  // flush to on the panel
+        uint32_t frameUs          = 0;  // wall clock per area since the previous call
+        uint32_t bytesPerSecond   = 0;  // pixel data written to the panel
+        uint32_t partialRefreshes = 0;  // direct mode refreshes sent as dirty bands
+        uint32_t fullRefreshes    = 0;
+    };
+    virtual DisplayFlushStats_t getDisplayFlushStats()
+    {
+        return {};
+    }
 
     /* ---------------------------------- Lvgl ---------------------------------- */
     lv_indev_t* lvTouchpad = nullptr;
+    // Recursive, and held together with lv_lock(), so it also excludes code that only knows LVGL's own lock
     virtual void lvglLock()
     {
     }
@@ -148,6 +182,11 @@ public:
     virtual void updateImuData()
     {
     }
+    // Orientation fused from every IMU sample by a background task, never blocks, axes documented by the platform
+    virtual bool getImuAttitude(imu::Attitude_t& attitude)
+    {
+        return false;
+    }
     virtual void clearImuIrq()
     {
     }
@@ -174,6 +213,129 @@ public:
     {
         return false;
     }
+    struct CameraStats_t {
+        float fps          = 0.0f;  // frames that reached the screen
+        uint32_t latencyMs = 0;     // capture to refreshed on screen
+        uint32_t frames    = 0;
+        uint32_t dropped   = 0;     // captured but never shown
+        // Capture buffer pool
+        uint32_t bufferCount      = 0;
+        uint32_t queueDepth       = 0;  // most frames ever waiting for the display
+        uint32_t minDriverBuffers = 0;  // fewest buffers ever left with the sensor
+        uint32_t frameIntervalUs  = 0;
+    };
+    virtual CameraStats_t getCameraStats()
+    {
+        return {};
+    }
+    // Frames to jpeg on the sd card (a local directory on desktop), a snapshot or a timed mjpeg burst
+    struct CameraCaptureStatus_t {
+        bool isCapturing     = false;
+        std::string path;
+        uint32_t frames      = 0;
+        uint32_t dropped     = 0;  // the encoder or the card fell behind
+        uint64_t bytes       = 0;
+        uint32_t encodeUs    = 0;  // last frame
+        uint32_t avgEncodeUs = 0;
+        uint32_t maxEncodeUs = 0;
+        float fps            = 0.0f;  // sustained over the capture
+    };
+    virtual bool cameraSnapshot()
+    {
+        return false;
+    }
+    virtual bool startCameraBurst(uint32_t durationMs)
+    {
+        return false;
+    }
+    virtual void stopCameraBurst()
+    {
+    }
+    virtual CameraCaptureStatus_t getCameraCaptureStatus()
+    {
+        return {};
+    }
+    // Frames to H.264 on the sd card, an .mp4 or a raw .h264 stream, until stopped
+    struct CameraRecordConfig_t {
+        uint32_t bitrate = 2000000;
+        uint32_t gop     = 30;  // frames between IDRs
+        bool mp4         = true;
+    };
+    struct CameraRecordStatus_t {
+        bool isRecording     = false;
+        std::string path;
+        uint32_t frames      = 0;
+        uint32_t dropped     = 0;  // the encoder or the card fell behind, up to the next IDR
+        uint64_t bytes       = 0;
+        uint32_t bitrate     = 0;  // bits per second, sustained over the recording
+        float fps            = 0.0f;
+        uint32_t encodeUs    = 0;  // last frame
+        uint32_t avgEncodeUs = 0;
+        uint32_t queued      = 0;  // writer queue occupancy, in chunks
+        uint32_t maxQueued   = 0;
+        uint32_t queueSize   = 0;
+    };
+    virtual bool startCameraRecord(const CameraRecordConfig_t& config)
+    {
+        return false;
+    }
+    virtual void stopCameraRecord()
+    {
+    }
+    virtual CameraRecordStatus_t getCameraRecordStatus()
+    {
+        return {};
+    }
+    // A small copy of each frame for analysis, scaled down from a region of the capture rather than from the preview
+    struct CameraVisionConfig_t {
+        uint16_t roiX      = 0;  // in capture pixels
+        uint16_t roiY      = 0;
+        uint16_t roiWidth  = 0;  // zero takes the rest of the frame
+        uint16_t roiHeight = 0;
+        uint16_t width     = 320;
+        uint16_t height    = 180;
+        bool gray          = true;  // one byte of luma a pixel, RGB565 otherwise
+    };
+    struct CameraVisionFrame_t {
+        uint8_t* data     = nullptr;  // the holder's own until released, imlib may draw on it
+        uint16_t width    = 0;
+        uint16_t height   = 0;
+        bool gray         = true;
+        uint32_t sequence = 0;
+        int64_t captureUs = 0;
+        uint32_t slot     = 0;
+    };
+    struct CameraVisionStatus_t {
+        bool isRunning      = false;
+        bool hardware       = false;  // scaled by the PPA, in software otherwise
+        uint32_t frames     = 0;
+        uint32_t consumed   = 0;
+        uint32_t superseded = 0;  // frames not read before a newer one came
+        uint32_t scaleUs    = 0;  // last frame
+        float fps           = 0.0f;
+    };
+    virtual bool startCameraVision(const CameraVisionConfig_t& config)
+    {
+        return false;
+    }
+    virtual void stopCameraVision()
+    {
+    }
+    /**
+     * @brief Newest frame not taken yet, waits up to timeoutMs for one, hand it back with releaseCameraVisionFrame()
+     *
+     */
+    virtual bool acquireCameraVisionFrame(CameraVisionFrame_t& frame, uint32_t timeoutMs)
+    {
+        return false;
+    }
+    virtual void releaseCameraVisionFrame(const CameraVisionFrame_t& frame)
+    {
+    }
+    virtual CameraVisionStatus_t getCameraVisionStatus()
+    {
+        return {};
+    }
 
     /* ---------------------------------- USB-A --------------------------------- */
     struct HidMouseData_t {
@@ -201,6 +363,52 @@ public:
     {
     }
 
+    // Audio service, persistent full-duplex 48 kHz stream in 10 ms periods
+    // Capture blocks are [MIC-L, AEC, MIC-R, MIC-HP], playback blocks are stereo and mixed with everything else
+    struct AudioIoStats_t {
+        uint32_t periods   = 0;
+        uint32_t underruns = 0;
+        uint32_t overruns  = 0;
+        uint32_t latencyUs = 0;
+    };
+    using AudioCaptureCallback_t  = std::function<void(const int16_t* capture, size_t frames)>;
+    using AudioPlaybackCallback_t = std::function<void(int16_t* playback, size_t frames)>;
+    virtual void setAudioCaptureCallback(AudioCaptureCallback_t callback)
+    {
+    }
+    virtual void setAudioPlaybackCallback(AudioPlaybackCallback_t callback)
+    {
+    }
+    virtual size_t audioPushPlayback(const int16_t* data, size_t frames)
+    {
+        return 0;
+    }
+    virtual size_t audioPullCapture(int16_t* data, size_t frames)
+    {
+        return 0;
+    }
+    virtual AudioIoStats_t getAudioIoStats()
+    {
+        return {};
+    }
+    // Codec input gain for the service's capture, in dB, set once by whoever starts listening
+    virtual void setMicGain(float gain)
+    {
+    }
+    // Mic levels and spectrum for meters, never blocks and has no side effects, analysis keeps running while polled
+    virtual bool getAudioCaptureSnapshot(audio::CaptureSnapshot_t& snapshot)
+    {
+        return false;
+    }
+    // Persistent generators rendered by the playback mixer, e.g. the UI tone synth
+    virtual bool audioAddSource(audio::MixerSource* source)
+    {
+        return false;
+    }
+    virtual void audioRemoveSource(audio::MixerSource* source)
+    {
+    }
+
     // Mic record test
     enum MicTestState_t {
         MIC_TEST_IDLE,
@@ -222,6 +430,38 @@ public:
         return MIC_TEST_IDLE;
     }
 
+    // Streaming recorder, capture ring -> wav on the sd card (a local directory on desktop), runs until stopped
+    enum AudioRecordFormat_t {
+        AUDIO_RECORD_PCM,
+        AUDIO_RECORD_IMA_ADPCM,  // a quarter of the card bandwidth
+    };
+    struct AudioRecordStats_t {
+        uint32_t frames         = 0;
+        uint32_t droppedFrames  = 0;  // the writer fell behind the card, whole blocks lost
+        uint32_t overruns       = 0;  // the capture ring overflowed, the capture task fell behind
+        uint64_t bytes          = 0;
+        uint32_t slowestWriteUs = 0;
+    };
+    virtual bool startAudioRecord(AudioRecordFormat_t format, bool dualMic = true)
+    {
+        return false;
+    }
+    virtual void stopAudioRecord()
+    {
+    }
+    virtual bool isAudioRecording()
+    {
+        return false;
+    }
+    virtual std::string getAudioRecordPath()
+    {
+        return "";
+    }
+    virtual AudioRecordStats_t getAudioRecordStats()
+    {
+        return {};
+    }
+
     // Play music test
     enum MusicPlayState_t {
         MUSIC_PLAY_IDLE,
@@ -238,6 +478,44 @@ public:
     {
     }
 
+    // Streaming player, files from the sd card (a local directory on desktop) are decoded ahead into the mixer by a
+    // worker task, queued tracks follow each other without a gap
+    enum AudioPlayerState_t {
+        AUDIO_PLAYER_IDLE,
+        AUDIO_PLAYER_PLAYING,
+        AUDIO_PLAYER_PAUSED,
+    };
+    struct AudioPlayerStatus_t {
+        AudioPlayerState_t state = AUDIO_PLAYER_IDLE;
+        std::string path;
+        uint32_t positionMs = 0;
+        uint32_t durationMs = 0;  // 0 if unknown, an estimate for vbr mp3
+        uint32_t bufferedMs = 0;
+        uint32_t queued     = 0;
+        uint32_t underruns  = 0;
+        float decodeSpeed   = 0.0f;  // x realtime
+    };
+    virtual bool audioPlayerEnqueue(const std::string& path)
+    {
+        return false;
+    }
+    virtual void audioPlayerStop()
+    {
+    }
+    virtual void audioPlayerPause(bool pause)
+    {
+    }
+    virtual void audioPlayerSkip()
+    {
+    }
+    virtual void audioPlayerSeek(uint32_t positionMs)
+    {
+    }
+    virtual AudioPlayerStatus_t getAudioPlayerStatus()
+    {
+        return {};
+    }
+
     // Sfx
     virtual void playStartupSfx()
     {
@@ -246,6 +524,33 @@ public:
     {
     }
 
+    // Boost DSP, live mic -> BoostEngine -> playback, runs as the audio service duplex callback
+    struct AudioDspStats_t {
+        uint32_t frames        = 0;
+        uint32_t lastCycles    = 0;
+        uint32_t avgCycles     = 0;
+        uint32_t peakCycles    = 0;
+        uint32_t aecAvgCycles  = 0;  // echo canceller share of the above
+        uint32_t aecPeakCycles = 0;
+        float aecErleDb        = 0.0f;
+        uint32_t nsAvgCycles   = 0;  // noise suppressor share
+        uint32_t nsPeakCycles  = 0;
+    };
+    virtual void startAudioDsp()
+    {
+    }
+    virtual void stopAudioDsp()
+    {
+    }
+    virtual bool isAudioDspRunning()
+    {
+        return false;
+    }
+    virtual AudioDspStats_t getAudioDspStats()
+    {
+        return {};
+    }
+
     /* --------------------------------- Network -------------------------------- */
     virtual void setExtAntennaEnable(bool enable)
     {
@@ -10,12 +10,194 @@
 #include <SDL2/SDL.h>
 #include <thread>
 #include <iostream>
+#include <cstdlib>
+#include <apps/utils/dsp/boost_engine.h>
+#include <apps/utils/audio/wav_file.h>
+#include <apps/utils/audio/audio_service.h>
+#include <apps/utils/audio/stream_recorder.h>
+#include <apps/utils/audio/stream_player.h>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
 
 static const std::string _tag = "audio";
 
+using AudioService = audio::AudioService;
+
+// Spread a wav or mic block onto the codec layout [MIC-L, AEC, MIC-R, MIC-HP]
+static void expand_to_capture_layout(const int16_t* in, uint16_t channels, int16_t* out, size_t frames)
+{
+    for (size_t i = 0; i < frames; i++) {
+        int16_t* o = out + i * AudioService::kCaptureChannels;
+        if (channels >= 4) {
+            o[0] = in[i * channels + 0];
+            o[1] = in[i * channels + 1];
+            o[2] = in[i * channels + 2];
+            o[3] = in[i * channels + 3];
+        } else if (channels >= 2) {
+            o[0] = in[i * channels + 0];
+            o[1] = 0;
+            o[2] = in[i * channels + 1];
+            o[3] = in[i * channels + 0];
+        } else {
+            o[0] = o[2] = o[3] = in[i * channels];
+            o[1]               = 0;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Audio service                               */
+/* -------------------------------------------------------------------------- */
+// Playback is driven by the SDL callback. Capture comes from the default SDL recording device, without one, or
+// with BOOST_DSP_INPUT=<wav> set, a source is synthesized in lockstep with playback instead.
+struct AudioIoData_t {
+    std::once_flag startFlag;
+    SDL_AudioDeviceID playbackDevice = 0;
+    SDL_AudioDeviceID captureDevice  = 0;
+    uint16_t captureChannels         = 0;
+    size_t blockFrames               = 0;
+    audio::WavReader input;
+    std::vector<int16_t> source;
+    std::vector<int16_t> capture;
+    float tonePhase = 0.0f;
+    std::atomic<uint8_t> volume{20};
+};
+static AudioIoData_t _audio_io_data;
+static AudioService _audio_service;
+
+static void synthesize_capture(size_t frames)
+{
+    auto& io = _audio_io_data;
+    while (frames > 0) {
+        const size_t count = std::min(frames, io.blockFrames);
+        if (io.input.isOpen()) {
+            size_t got = io.input.read(io.source.data(), count);
+            if (got < count) {
+                io.input.rewind();
+                got += io.input.read(io.source.data() + got * io.input.channels(), count - got);
+            }
+            std::fill(io.source.begin() + got * io.input.channels(), io.source.end(), 0);
+            expand_to_capture_layout(io.source.data(), io.input.channels(), io.capture.data(), count);
+        } else {
+            // The same 500 Hz test tone audioRecord used to return
+            const float step = 2.0f * static_cast<float>(M_PI) * 500.0f / AudioService::kSampleRate;
+            for (size_t i = 0; i < count; i++) {
+                const int16_t s = static_cast<int16_t>(std::sin(io.tonePhase) * 32767.0f);
+                std::fill_n(&io.capture[i * AudioService::kCaptureChannels], AudioService::kCaptureChannels, s);
+                io.tonePhase += step;
+                if (io.tonePhase > 2.0f * static_cast<float>(M_PI)) {
+                    io.tonePhase -= 2.0f * static_cast<float>(M_PI);
+                }
+            }
+        }
+        _audio_service.onCapture(io.capture.data(), count);
+        frames -= count;
+    }
+}
+
+static void _sdl_playback_callback(void* userdata, Uint8* stream, int len)
+{
+    auto* out           = reinterpret_cast<int16_t*>(stream);
+    const size_t frames = len / (AudioService::kPlaybackChannels * sizeof(int16_t));
+
+    if (_audio_io_data.captureDevice == 0) {
+        synthesize_capture(frames);
+    }
+    _audio_service.onPlayback(out, frames);
+
+    const float scale = _audio_io_data.volume.load(std::memory_order_relaxed) / 100.0f;
+    for (size_t i = 0; i < frames * AudioService::kPlaybackChannels; i++) {
+        out[i] = static_cast<int16_t>(out[i] * scale);
+    }
+}
+
+static void _sdl_capture_callback(void* userdata, Uint8* stream, int len)
+{
+    auto& io       = _audio_io_data;
+    const auto* in = reinterpret_cast<const int16_t*>(stream);
+    size_t frames  = len / (io.captureChannels * sizeof(int16_t));
+    while (frames > 0) {
+        const size_t count = std::min(frames, io.blockFrames);
+        expand_to_capture_layout(in, io.captureChannels, io.capture.data(), count);
+        _audio_service.onCapture(io.capture.data(), count);
+        in += count * io.captureChannels;
+        frames -= count;
+    }
+}
+
+static void open_audio_devices()
+{
+    auto& io = _audio_io_data;
+    if (!(SDL_WasInit(SDL_INIT_AUDIO) & SDL_INIT_AUDIO)) {
+        if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
+            mclog::tagError(_tag, "init sdl audio failed: {}", SDL_GetError());
+            return;
+        }
+    }
+
+    const char* input_path = std::getenv("BOOST_DSP_INPUT");
+    if (input_path && !io.input.open(input_path)) {
+        mclog::tagError(_tag, "open capture input {} failed", input_path);
+    }
+    if (io.input.isOpen() && io.input.sampleRate() != AudioService::kSampleRate) {
+        mclog::tagWarn(_tag, "capture input is {} Hz, using it as {} Hz", io.input.sampleRate(),
+                       AudioService::kSampleRate);
+    }
+
+    SDL_AudioSpec want, have;
+    SDL_memset(&want, 0, sizeof(want));
+    want.freq     = AudioService::kSampleRate;
+    want.format   = AUDIO_S16SYS;
+    want.channels = AudioService::kPlaybackChannels;
+    want.samples  = AudioService::kPeriodFrames;
+    want.callback = _sdl_playback_callback;
+
+    io.playbackDevice = SDL_OpenAudioDevice(nullptr, 0, &want, &have, 0);
+    if (io.playbackDevice == 0) {
+        mclog::tagError(_tag, "open playback device failed: {}", SDL_GetError());
+        return;
+    }
+    const size_t playback_frames = have.samples;
+
+    size_t capture_frames = 0;
+    if (!io.input.isOpen()) {
+        want.callback    = _sdl_capture_callback;
+        io.captureDevice = SDL_OpenAudioDevice(nullptr, 1, &want, &have, SDL_AUDIO_ALLOW_CHANNELS_CHANGE);
+        if (io.captureDevice != 0) {
+            io.captureChannels = have.channels;
+            capture_frames     = have.samples;
+        } else {
+            mclog::tagWarn(_tag, "no capture device ({}), using test tone", SDL_GetError());
+        }
+    }
+
+    // Scratch for one device block, sized before either callback can run
+    io.blockFrames = std::max({playback_frames, capture_frames, AudioService::kPeriodFrames});
+    io.capture.resize(io.blockFrames * AudioService::kCaptureChannels);
+    io.source.resize(io.blockFrames * std::max<size_t>(io.input.channels(), 1));
+    io.volume = GetHAL()->getSpeakerVolume();
+
+    _audio_service.setDeviceLatency(capture_frames, playback_frames);
+    mclog::tagInfo(_tag, "audio io open, playback block {} frames, capture block {} frames", playback_frames,
+                   capture_frames);
+
+    SDL_PauseAudioDevice(io.playbackDevice, 0);
+    if (io.captureDevice != 0) {
+        SDL_PauseAudioDevice(io.captureDevice, 0);
+    }
+}
+
+static AudioService& audio_service()
+{
+    std::call_once(_audio_io_data.startFlag, open_audio_devices);
+    return _audio_service;
+}
+
 void HalDesktop::setSpeakerVolume(uint8_t volume)
 {
     _current_speaker_volume = std::clamp((int)volume, 0, 100);
+    _audio_io_data.volume   = _current_speaker_volume;
     mclog::tagInfo(_tag, "set speaker volume: {}%", _current_speaker_volume);
 }
 
@@ -26,81 +208,74 @@ uint8_t HalDesktop::getSpeakerVolume()
 
 void HalDesktop::audioPlay(std::vector<int16_t>& data, bool async)
 {
-    static std::once_flag initFlag;
-    static SDL_AudioDeviceID deviceId = 0;
-    static std::mutex audioMutex;
+    auto& mixer = audio_service().mixer();
 
-    // 音频初始化 & 打开设备（只执行一次）
-    std::call_once(initFlag, []() {
-        if (!(SDL_WasInit(SDL_INIT_AUDIO) & SDL_INIT_AUDIO)) {
-            if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
-                std::cerr << "Failed to init SDL audio: " << SDL_GetError() << std::endl;
-                return;
-            }
-        }
+    int voice = mixer.play(std::vector<int16_t>(data));
+    if (voice < 0) {
+        mclog::tagWarn(_tag, "no free mixer voice");
+        return;
+    }
 
-        SDL_AudioSpec want, have;
-        SDL_memset(&want, 0, sizeof(want));
-        want.freq     = 48000;
-        want.format   = AUDIO_S16SYS;
-        want.channels = 2;
-        want.samples  = 4096;
-        want.callback = nullptr;
-
-        deviceId = SDL_OpenAudioDevice(nullptr, 0, &want, &have, 0);
-        if (deviceId == 0) {
-            std::cerr << "SDL_OpenAudioDevice failed: " << SDL_GetError() << std::endl;
-        } else {
-            SDL_PauseAudioDevice(deviceId, 0);  // 开启播放
+    if (!async) {
+        while (mixer.isPlaying(voice)) {
+            SDL_Delay(5);
         }
-    });
+    }
+}
 
-    // 若设备打开失败，直接返回
-    if (deviceId == 0) return;
-
-    // 异步线程提交音频数据
-    auto volume = getSpeakerVolume();
-    std::thread([data, volume]() {
-        std::vector<int16_t> adjustedData = data;
-
-        // 音量缩放
-        float scale = volume / 100.0f;
-        for (size_t i = 0; i < adjustedData.size(); ++i) {
-            int sample = static_cast<int>(adjustedData[i] * scale);
-            if (sample > INT16_MAX) sample = INT16_MAX;
-            if (sample < INT16_MIN) sample = INT16_MIN;
-            adjustedData[i] = static_cast<int16_t>(sample);
-        }
+void HalDesktop::audioRecord(std::vector<int16_t>& data, uint16_t durationMs, float gain)
+{
+    const size_t frames = AudioService::kSampleRate * durationMs / 1000;
+    data.resize(frames * AudioService::kCaptureChannels);
+    audio_service().readCapture(data.data(), frames, durationMs + 100);
+}
 
-        // 加锁提交数据（线程安全）
-        {
-            std::lock_guard<std::mutex> lock(audioMutex);
-            int byteSize = adjustedData.size() * sizeof(int16_t);
-            if (SDL_QueueAudio(deviceId, adjustedData.data(), byteSize) < 0) {
-                std::cerr << "SDL_QueueAudio failed: " << SDL_GetError() << std::endl;
-            }
-        }
-    }).detach();
+void HalDesktop::setAudioCaptureCallback(AudioCaptureCallback_t callback)
+{
+    audio_service().setCaptureCallback(std::move(callback));
 }
 
-void HalDesktop::audioRecord(std::vector<int16_t>& data, uint16_t durationMs, float gain)
+void HalDesktop::setAudioPlaybackCallback(AudioPlaybackCallback_t callback)
 {
-    const uint32_t sampleRate   = 48000;
-    const uint32_t channels     = 4;
-    const float frequency       = 500.0f;
-    const uint32_t totalSamples = (sampleRate * durationMs) / 1000;
+    audio_service().setPlaybackCallback(std::move(callback));
+}
 
-    data.clear();
-    data.reserve(totalSamples * channels);
+size_t HalDesktop::audioPushPlayback(const int16_t* data, size_t frames)
+{
+    return audio_service().pushPlayback(data, frames);
+}
 
-    for (uint32_t i = 0; i < totalSamples; ++i) {
-        float t             = static_cast<float>(i) / sampleRate;
-        float sample        = std::sin(2.0f * M_PI * frequency * t);
-        int16_t sampleInt16 = static_cast<int16_t>(sample * 32767);
-        for (int ch = 0; ch < channels; ++ch) {
-            data.push_back(sampleInt16);
-        }
-    }
+size_t HalDesktop::audioPullCapture(int16_t* data, size_t frames)
+{
+    return audio_service().pullCapture(data, frames);
+}
+
+hal::HalBase::AudioIoStats_t HalDesktop::getAudioIoStats()
+{
+    auto stats = _audio_service.stats();
+    AudioIoStats_t ret;
+    ret.periods   = stats.periods;
+    ret.underruns = stats.underruns;
+    ret.overruns  = stats.overruns;
+    ret.latencyUs = static_cast<uint64_t>(stats.latencyFrames) * 1000000 / AudioService::kSampleRate;
+    return ret;
+}
+
+bool HalDesktop::getAudioCaptureSnapshot(audio::CaptureSnapshot_t& snapshot)
+{
+    // Fed by SDL capture, or the BOOST_DSP_INPUT file / test tone when there is no device
+    snapshot = audio_service().captureSnapshot();
+    return true;
+}
+
+bool HalDesktop::audioAddSource(audio::MixerSource* source)
+{
+    return audio_service().mixer().addSource(source);
+}
+
+void HalDesktop::audioRemoveSource(audio::MixerSource* source)
+{
+    _audio_service.mixer().removeSource(source);
 }
 
 struct DualMicRecordTestData_t {
@@ -143,6 +318,210 @@ hal::HalBase::MicTestState_t HalDesktop::getHeadphoneMicRecordTestState()
     return getDualMicRecordTestState();
 }
 
+/* -------------------------------------------------------------------------- */
+/*                               Stream recorder                              */
+/* -------------------------------------------------------------------------- */
+// BOOST_REC_DIR=<dir>       where recordings go, ./recordings by default
+// BOOST_REC_WRITE_DELAY_MS  stall the writer before every pass, to see how much card latency the buffering absorbs
+using StreamRecorder = audio::StreamRecorder;
+
+struct StreamRecordData_t {
+    std::mutex mutex;
+    bool isRunning = false;
+    std::atomic<bool> killSignal{false};
+    uint32_t overrunsAtStart = 0;
+    std::string path;
+};
+static StreamRecordData_t _stream_record_data;
+static StreamRecorder _stream_recorder;
+
+static void _stream_record_task(int writeDelayMs)
+{
+    // Same split as on the device, the writer thread is the only one touching the file
+    std::atomic<bool> capture_done{false};
+    std::thread writer([&]() {
+        while (!capture_done.load()) {
+            if (writeDelayMs > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(writeDelayMs));
+            }
+            if (!_stream_recorder.service()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        }
+    });
+
+    std::vector<int16_t> buffer(AudioService::kPeriodFrames * 4 * AudioService::kCaptureChannels);
+    while (!_stream_record_data.killSignal.load()) {
+        size_t got = audio_service().pullCapture(buffer.data(), AudioService::kPeriodFrames * 4);
+        if (got == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+        _stream_recorder.write(buffer.data(), got);
+    }
+    capture_done = true;
+    writer.join();
+    _stream_recorder.stop();
+
+    auto stats = _stream_recorder.stats();
+    mclog::tagInfo(_tag, "record stop, {} frames, {} dropped, {} overruns, {} KB, slowest write {} us", stats.frames,
+                   stats.droppedFrames, audio_service().stats().overruns - _stream_record_data.overrunsAtStart,
+                   stats.bytes / 1024, stats.slowestWriteUs);
+
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    _stream_record_data.isRunning = false;
+}
+
+bool HalDesktop::startAudioRecord(AudioRecordFormat_t format, bool dualMic)
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    if (_stream_record_data.isRunning) {
+        mclog::tagWarn(_tag, "record is running");
+        return false;
+    }
+
+    const char* dir_env   = std::getenv("BOOST_REC_DIR");
+    const char* delay_env = std::getenv("BOOST_REC_WRITE_DELAY_MS");
+    const std::string dir = dir_env ? dir_env : "recordings";
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+
+    const std::string path = StreamRecorder::next_free_path(dir, "rec_");
+    const auto encoding    = format == AUDIO_RECORD_IMA_ADPCM ? StreamRecorder::FORMAT_IMA_ADPCM
+                                                               : StreamRecorder::FORMAT_PCM16;
+    const auto source      = dualMic ? StreamRecorder::SOURCE_DUAL_MIC : StreamRecorder::SOURCE_HEADSET_MIC;
+    if (!_stream_recorder.start(path, encoding, source)) {
+        mclog::tagError(_tag, "open {} failed", path);
+        return false;
+    }
+    mclog::tagInfo(_tag, "record to {}", path);
+
+    _stream_record_data.path            = path;
+    _stream_record_data.overrunsAtStart = audio_service().stats().overruns;
+    _stream_record_data.killSignal      = false;
+    _stream_record_data.isRunning       = true;
+    std::thread(_stream_record_task, delay_env ? std::atoi(delay_env) : 0).detach();
+    return true;
+}
+
+void HalDesktop::stopAudioRecord()
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    _stream_record_data.killSignal = true;
+}
+
+bool HalDesktop::isAudioRecording()
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    return _stream_record_data.isRunning;
+}
+
+std::string HalDesktop::getAudioRecordPath()
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    return _stream_record_data.path;
+}
+
+hal::HalBase::AudioRecordStats_t HalDesktop::getAudioRecordStats()
+{
+    auto stats = _stream_recorder.stats();
+    AudioRecordStats_t ret;
+    ret.frames         = stats.frames;
+    ret.droppedFrames  = stats.droppedFrames;
+    ret.overruns       = audio_service().stats().overruns - _stream_record_data.overrunsAtStart;
+    ret.bytes          = stats.bytes;
+    ret.slowestWriteUs = stats.slowestWriteUs;
+    return ret;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Stream player                               */
+/* -------------------------------------------------------------------------- */
+// BOOST_PLAYER_DECODE_DELAY_MS  stall the worker after every decode step, to see how much the read-ahead absorbs
+//
+// Only wav (PCM and IMA ADPCM) here, the mp3 decoder is an IDF component
+using StreamPlayer = audio::StreamPlayer;
+
+struct StreamPlayerData_t {
+    std::once_flag startFlag;
+    std::unique_ptr<StreamPlayer> player;
+};
+static StreamPlayerData_t _stream_player_data;
+
+static void _stream_player_task(int decodeDelayMs)
+{
+    auto& player                     = *_stream_player_data.player;
+    StreamPlayer::State_t last_state = StreamPlayer::STATE_IDLE;
+    while (true) {
+        if (!player.service()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        } else if (decodeDelayMs > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(decodeDelayMs));
+        }
+
+        auto status = player.status();
+        if (status.state == StreamPlayer::STATE_IDLE && last_state != StreamPlayer::STATE_IDLE) {
+            mclog::tagInfo(_tag, "player idle, {} underruns, decoding at {:.0f}x realtime", status.underruns,
+                           status.decodeSpeed);
+        }
+        last_state = status.state;
+    }
+}
+
+static StreamPlayer& stream_player()
+{
+    std::call_once(_stream_player_data.startFlag, []() {
+        const char* delay_env      = std::getenv("BOOST_PLAYER_DECODE_DELAY_MS");
+        _stream_player_data.player = std::make_unique<StreamPlayer>(audio_service().mixer());
+        std::thread(_stream_player_task, delay_env ? std::atoi(delay_env) : 0).detach();
+    });
+    return *_stream_player_data.player;
+}
+
+bool HalDesktop::audioPlayerEnqueue(const std::string& path)
+{
+    if (!stream_player().enqueue(path)) {
+        mclog::tagWarn(_tag, "no decoder for {}", path);
+        return false;
+    }
+    return true;
+}
+
+void HalDesktop::audioPlayerStop()
+{
+    stream_player().stop();
+}
+
+void HalDesktop::audioPlayerPause(bool pause)
+{
+    stream_player().setPaused(pause);
+}
+
+void HalDesktop::audioPlayerSkip()
+{
+    stream_player().skip();
+}
+
+void HalDesktop::audioPlayerSeek(uint32_t positionMs)
+{
+    stream_player().seek(positionMs);
+}
+
+hal::HalBase::AudioPlayerStatus_t HalDesktop::getAudioPlayerStatus()
+{
+    auto status = stream_player().status();
+    AudioPlayerStatus_t ret;
+    ret.state       = static_cast<AudioPlayerState_t>(status.state);
+    ret.path        = status.path;
+    ret.positionMs  = status.positionMs;
+    ret.durationMs  = status.durationMs;
+    ret.bufferedMs  = status.bufferedMs;
+    ret.queued      = status.queued;
+    ret.underruns   = status.underruns;
+    ret.decodeSpeed = status.decodeSpeed;
+    return ret;
+}
+
 struct MusicPlayTestData_t {
     std::mutex mutex;
     bool killSignal                      = false;
@@ -188,3 +567,157 @@ void HalDesktop::stopPlayMusicTest()
     std::lock_guard<std::mutex> lock(_music_play_test_data.mutex);
     _music_play_test_data.killSignal = true;
 }
+
+/* -------------------------------------------------------------------------- */
+/*                                  Boost DSP                                 */
+/* -------------------------------------------------------------------------- */
+// BOOST_DSP_INPUT=<wav>   feed the chain from a 1/2/4 channel 48 kHz wav instead of the mic, a 4 channel
+//                         [MIC-L, AEC, MIC-R, MIC-HP] recording carries the echo canceller reference
+// BOOST_DSP_OUTPUT=<wav>  run offline as fast as possible and write the processed stereo result
+using BoostEngine = app::dsp::BoostEngine;
+
+static_assert(BoostEngine::kFrameSamples == AudioService::kPeriodFrames, "dsp frame must match the audio period");
+
+struct DspTaskData_t {
+    std::mutex mutex;
+    bool killSignal = false;
+    bool isRunning  = false;
+};
+static DspTaskData_t _dsp_task_data;
+static BoostEngine _boost_engine;
+
+static void log_dsp_stats()
+{
+    auto& stats = _boost_engine.stats();
+    mclog::tagInfo(_tag, "dsp stop, {} frames, cycles/frame avg {} peak {}", stats.frames.load(), stats.average(),
+                   stats.peak.load());
+
+    auto& aec = _boost_engine.echoCanceller();
+    if (aec.stats().frames.load() > 0) {
+        mclog::tagInfo(_tag, "aec {} ms tail, cycles/frame avg {} peak {}, erle {:.1f} dB", aec.tailMs(),
+                       aec.stats().average(), aec.stats().peak.load(), aec.erleDb());
+    }
+
+    auto& ns = _boost_engine.noiseSuppressor();
+    if (ns.stats().frames.load() > 0) {
+        mclog::tagInfo(_tag, "ns cycles/frame avg {} peak {}", ns.stats().average(), ns.stats().peak.load());
+    }
+}
+
+// Offline mode bypasses the audio service, the input is consumed as fast as the chain can go
+static void _dsp_offline_task(std::string inputPath, std::string outputPath)
+{
+    audio::WavReader reader;
+    if (inputPath.empty() || !reader.open(inputPath)) {
+        mclog::tagError(_tag, "offline dsp needs BOOST_DSP_INPUT");
+    }
+
+    audio::WavWriter writer;
+    if (!writer.open(outputPath, BoostEngine::kSampleRate, BoostEngine::kPlaybackChannels)) {
+        mclog::tagError(_tag, "open dsp output {} failed", outputPath);
+    }
+
+    std::vector<int16_t> source(BoostEngine::kFrameSamples * std::max<size_t>(reader.channels(), 1));
+    std::vector<int16_t> capture(BoostEngine::kCaptureFrameSize);
+    std::vector<int16_t> playback(BoostEngine::kPlaybackFrameSize);
+
+    // Doubles as the chain benchmark, wall time against the audio duration is the share of a core it needs
+    size_t frames    = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (reader.isOpen() && writer.isOpen()) {
+        {
+            std::lock_guard<std::mutex> lock(_dsp_task_data.mutex);
+            if (_dsp_task_data.killSignal) {
+                break;
+            }
+        }
+
+        size_t got = reader.read(source.data(), BoostEngine::kFrameSamples);
+        if (got < BoostEngine::kFrameSamples) {
+            break;
+        }
+        expand_to_capture_layout(source.data(), reader.channels(), capture.data(), BoostEngine::kFrameSamples);
+        _boost_engine.process(capture.data(), playback.data());
+        writer.write(playback.data(), BoostEngine::kFrameSamples);
+        frames++;
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    const double elapsed_ms = elapsed.count();
+    const double audio_ms   = frames * 1000.0 * BoostEngine::kFrameSamples / BoostEngine::kSampleRate;
+    if (frames > 0) {
+        mclog::tagInfo(_tag, "offline {:.0f} ms of audio in {:.0f} ms, {:.1f}% of a core", audio_ms, elapsed_ms,
+                       elapsed_ms * 100.0 / audio_ms);
+    }
+    log_dsp_stats();
+
+    _dsp_task_data.mutex.lock();
+    _dsp_task_data.isRunning  = false;
+    _dsp_task_data.killSignal = false;
+    _dsp_task_data.mutex.unlock();
+}
+
+void HalDesktop::startAudioDsp()
+{
+    std::lock_guard<std::mutex> lock(_dsp_task_data.mutex);
+    if (_dsp_task_data.isRunning) {
+        mclog::tagWarn(_tag, "dsp is running");
+        return;
+    }
+    _dsp_task_data.isRunning  = true;
+    _dsp_task_data.killSignal = false;
+
+    _boost_engine.reset();
+    _boost_engine.stats().reset();
+    _boost_engine.echoCanceller().stats().reset();
+    _boost_engine.noiseSuppressor().stats().reset();
+
+    const char* input_path  = std::getenv("BOOST_DSP_INPUT");
+    const char* output_path = std::getenv("BOOST_DSP_OUTPUT");
+    if (output_path) {
+        std::thread(_dsp_offline_task, input_path ? input_path : "", output_path).detach();
+        return;
+    }
+
+    // Live, the wav input if any is already the service capture source
+    audio_service().setDuplexCallback(
+        [](const int16_t* capture, int16_t* playback) { _boost_engine.process(capture, playback); });
+}
+
+void HalDesktop::stopAudioDsp()
+{
+    std::lock_guard<std::mutex> lock(_dsp_task_data.mutex);
+    if (_audio_service.hasDuplexCallback()) {
+        _audio_service.setDuplexCallback(nullptr);
+        _dsp_task_data.isRunning = false;
+        log_dsp_stats();
+        return;
+    }
+    _dsp_task_data.killSignal = true;
+}
+
+bool HalDesktop::isAudioDspRunning()
+{
+    std::lock_guard<std::mutex> lock(_dsp_task_data.mutex);
+    return _dsp_task_data.isRunning;
+}
+
+hal::HalBase::AudioDspStats_t HalDesktop::getAudioDspStats()
+{
+    auto& stats = _boost_engine.stats();
+    AudioDspStats_t ret;
+    ret.frames     = stats.frames.load(std::memory_order_relaxed);
+    ret.lastCycles = stats.last.load(std::memory_order_relaxed);
+    ret.avgCycles  = stats.average();
+    ret.peakCycles = stats.peak.load(std::memory_order_relaxed);
+
+    auto& aec         = _boost_engine.echoCanceller();
+    ret.aecAvgCycles  = aec.stats().average();
+    ret.aecPeakCycles = aec.stats().peak.load(std::memory_order_relaxed);
+    ret.aecErleDb     = aec.erleDb();
+
+    auto& ns         = _boost_engine.noiseSuppressor();
+    ret.nsAvgCycles  = ns.stats().average();
+    ret.nsPeakCycles = ns.stats().peak.load(std::memory_order_relaxed);
+    return ret;
+}
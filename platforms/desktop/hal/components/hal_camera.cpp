@@ -0,0 +1,416 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "../hal_desktop.h"
+#include "hal/hal.h"
+#include <mooncake_log.h>
+#include <apps/utils/camera/jpeg_capture.h>
+#include <apps/utils/camera/h264_recorder.h>
+#include <apps/utils/camera/vision_frame_pool.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+static const std::string _tag = "camera";
+
+/* -------------------------------------------------------------------------- */
+/*                                Jpeg capture                                */
+/* -------------------------------------------------------------------------- */
+// No sensor here, a moving test pattern at the sensor's size and rate goes through the software encoder instead, so
+// the capture and writer split runs the same way it does on the device
+// BOOST_CAM_DIR=<dir>  where captures go, ./captures by default
+static constexpr uint16_t kFrameWidth    = 1280;
+static constexpr uint16_t kFrameHeight   = 720;
+static constexpr uint32_t kFrameInterval = 33;  // ms
+
+struct JpegCaptureData_t {
+    std::mutex mutex;
+    bool isRunning = false;
+    std::string path;
+};
+static JpegCaptureData_t _jpeg_capture_data;
+static camera::SoftJpegEncoder _jpeg_encoder(80);
+static camera::JpegCapture _jpeg_capture(_jpeg_encoder);
+
+// Colour bars scrolling sideways under a sweeping gradient, enough detail to give the encoder real work
+static void render_test_pattern(std::vector<uint16_t>& frame, uint32_t count)
+{
+    static const uint16_t bars[8] = {0xffff, 0xffe0, 0x07ff, 0x07e0, 0xf81f, 0xf800, 0x001f, 0x0000};
+    for (int y = 0; y < kFrameHeight; y++) {
+        uint16_t* row = frame.data() + y * kFrameWidth;
+        if (y < kFrameHeight * 2 / 3) {
+            for (int x = 0; x < kFrameWidth; x++) {
+                row[x] = bars[((x + count * 8) / (kFrameWidth / 8)) % 8];
+            }
+        } else {
+            for (int x = 0; x < kFrameWidth; x++) {
+                const uint16_t level = ((x + count * 4) % kFrameWidth) * 32 / kFrameWidth;
+                row[x]               = level << 11 | (level * 2) << 5 | level;
+            }
+        }
+    }
+}
+
+static std::string capture_dir()
+{
+    const char* dir_env   = std::getenv("BOOST_CAM_DIR");
+    const std::string dir = dir_env ? dir_env : "captures";
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    return dir;
+}
+
+static void _jpeg_capture_task()
+{
+    std::atomic<bool> encode_done{false};
+    std::thread writer([&]() {
+        while (!encode_done.load()) {
+            if (!_jpeg_capture.service()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        }
+    });
+
+    std::vector<uint16_t> frame(kFrameWidth * kFrameHeight);
+    uint32_t count = 0;
+    auto next      = std::chrono::steady_clock::now();
+    while (!_jpeg_capture.isDone()) {
+        render_test_pattern(frame, count++);
+        if (_jpeg_capture.wantsFrame()) {
+            _jpeg_capture.write(reinterpret_cast<const uint8_t*>(frame.data()), kFrameWidth, kFrameHeight);
+        }
+        next += std::chrono::milliseconds(kFrameInterval);
+        std::this_thread::sleep_until(next);
+    }
+    encode_done = true;
+    writer.join();
+    _jpeg_capture.stop();
+
+    auto stats = _jpeg_capture.stats();
+    mclog::tagInfo(_tag, "capture stop, {} frames, {} dropped, {} KB, encode avg {} us max {} us, {:.1f} fps",
+                   stats.frames, stats.droppedFrames, stats.bytes / 1024, stats.avgEncodeUs, stats.maxEncodeUs,
+                   stats.fps);
+
+    std::lock_guard<std::mutex> lock(_jpeg_capture_data.mutex);
+    _jpeg_capture_data.isRunning = false;
+}
+
+static bool start_jpeg_capture(camera::JpegCapture::Mode_t mode, uint32_t durationMs)
+{
+    std::lock_guard<std::mutex> lock(_jpeg_capture_data.mutex);
+    if (_jpeg_capture_data.isRunning) {
+        mclog::tagWarn(_tag, "capture is running");
+        return false;
+    }
+
+    const std::string dir  = capture_dir();
+    const bool burst       = mode == camera::JpegCapture::MODE_BURST;
+    const std::string path = camera::JpegCapture::next_free_path(dir, burst ? "burst_" : "img_",
+                                                                 burst ? "mjpeg" : "jpg");
+    if (!_jpeg_capture.start(path, mode, durationMs)) {
+        mclog::tagError(_tag, "open {} failed", path);
+        return false;
+    }
+    mclog::tagInfo(_tag, "capture to {}", path);
+
+    _jpeg_capture_data.path      = path;
+    _jpeg_capture_data.isRunning = true;
+    std::thread(_jpeg_capture_task).detach();
+    return true;
+}
+
+bool HalDesktop::cameraSnapshot()
+{
+    return start_jpeg_capture(camera::JpegCapture::MODE_SNAPSHOT, 0);
+}
+
+bool HalDesktop::startCameraBurst(uint32_t durationMs)
+{
+    return start_jpeg_capture(camera::JpegCapture::MODE_BURST, durationMs);
+}
+
+void HalDesktop::stopCameraBurst()
+{
+    _jpeg_capture.finish();
+}
+
+hal::HalBase::CameraCaptureStatus_t HalDesktop::getCameraCaptureStatus()
+{
+    CameraCaptureStatus_t ret;
+    {
+        std::lock_guard<std::mutex> lock(_jpeg_capture_data.mutex);
+        ret.isCapturing = _jpeg_capture_data.isRunning;
+        ret.path        = _jpeg_capture_data.path;
+    }
+
+    auto stats      = _jpeg_capture.stats();
+    ret.frames      = stats.frames;
+    ret.dropped     = stats.droppedFrames;
+    ret.bytes       = stats.bytes;
+    ret.encodeUs    = stats.lastEncodeUs;
+    ret.avgEncodeUs = stats.avgEncodeUs;
+    ret.maxEncodeUs = stats.maxEncodeUs;
+    ret.fps         = stats.fps;
+    return ret;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               H.264 recording                              */
+/* -------------------------------------------------------------------------- */
+// The synthetic encoder stands in for the hardware one, the files have real parameter sets and GOP structure but
+// filler slices, enough to check the muxer, the writer ring and the backpressure against a real card or disk
+struct H264RecordData_t {
+    std::mutex mutex;
+    bool isRunning = false;
+    std::string path;
+};
+static H264RecordData_t _h264_record_data;
+static camera::SyntheticH264Encoder _h264_encoder;
+static camera::H264Recorder _h264_recorder(_h264_encoder);
+
+static int64_t steady_clock_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void _h264_record_task()
+{
+    std::atomic<bool> encode_done{false};
+    std::thread writer([&]() {
+        while (!encode_done.load()) {
+            if (!_h264_recorder.service()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+        }
+    });
+
+    std::vector<uint16_t> frame(kFrameWidth * kFrameHeight);
+    uint32_t count = 0;
+    auto next      = std::chrono::steady_clock::now();
+    while (_h264_recorder.wantsFrame()) {
+        render_test_pattern(frame, count++);
+        _h264_recorder.write(reinterpret_cast<const uint8_t*>(frame.data()), kFrameWidth, kFrameHeight,
+                             steady_clock_us());
+        next += std::chrono::milliseconds(kFrameInterval);
+        std::this_thread::sleep_until(next);
+    }
+    encode_done = true;
+    writer.join();
+    _h264_recorder.stop();
+
+    auto stats = _h264_recorder.stats();
+    mclog::tagInfo(_tag, "record stop, {} frames, {} dropped, {} KB, {} kbps, {:.1f} fps, queue {}/{}", stats.frames,
+                   stats.droppedFrames, stats.bytes / 1024, stats.bitrate / 1000, stats.fps, stats.maxQueuedChunks,
+                   stats.chunks);
+
+    std::lock_guard<std::mutex> lock(_h264_record_data.mutex);
+    _h264_record_data.isRunning = false;
+}
+
+bool HalDesktop::startCameraRecord(const CameraRecordConfig_t& config)
+{
+    std::lock_guard<std::mutex> lock(_h264_record_data.mutex);
+    if (_h264_record_data.isRunning) {
+        mclog::tagWarn(_tag, "record is running");
+        return false;
+    }
+
+    camera::H264Config_t h264_config;
+    h264_config.bitrate = config.bitrate;
+    h264_config.gop     = config.gop;
+    _h264_encoder.setFrameRate(1000 / kFrameInterval);
+
+    const auto container   = config.mp4 ? camera::H264Recorder::CONTAINER_MP4 : camera::H264Recorder::CONTAINER_ANNEX_B;
+    const std::string path = camera::JpegCapture::next_free_path(capture_dir(), "vid_", config.mp4 ? "mp4" : "h264");
+    if (!_h264_recorder.start(path, container, kFrameWidth, kFrameHeight, h264_config)) {
+        mclog::tagError(_tag, "open {} failed", path);
+        return false;
+    }
+    mclog::tagInfo(_tag, "record to {}", path);
+
+    _h264_record_data.path      = path;
+    _h264_record_data.isRunning = true;
+    std::thread(_h264_record_task).detach();
+    return true;
+}
+
+void HalDesktop::stopCameraRecord()
+{
+    _h264_recorder.finish();
+}
+
+hal::HalBase::CameraRecordStatus_t HalDesktop::getCameraRecordStatus()
+{
+    CameraRecordStatus_t ret;
+    {
+        std::lock_guard<std::mutex> lock(_h264_record_data.mutex);
+        ret.isRecording = _h264_record_data.isRunning;
+        ret.path        = _h264_record_data.path;
+    }
+
+    auto stats      = _h264_recorder.stats();
+    ret.frames      = stats.frames;
+    ret.dropped     = stats.droppedFrames;
+    ret.bytes       = stats.bytes;
+    ret.bitrate     = stats.bitrate;
+    ret.fps         = stats.fps;
+    ret.encodeUs    = stats.lastEncodeUs;
+    ret.avgEncodeUs = stats.avgEncodeUs;
+    ret.queued      = stats.queuedChunks;
+    ret.maxQueued   = stats.maxQueuedChunks;
+    ret.queueSize   = stats.chunks;
+    return ret;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Vision frames                               */
+/* -------------------------------------------------------------------------- */
+// Always the software scaler here, the same one the device falls back on, fed from the test pattern
+static constexpr size_t kVisionSlotCount = 3;
+
+struct VisionData_t {
+    std::mutex mutex;
+    bool isRunning = false;
+    std::vector<uint8_t> slots[kVisionSlotCount];
+    std::atomic<bool> stopRequested{false};
+    std::atomic<uint32_t> scaleUs{0};
+    std::atomic<float> fps{0.0f};
+};
+static VisionData_t _vision_data;
+static camera::VisionFramePool _vision_pool;
+static camera::FrameScaler _vision_scaler;
+
+static void _vision_task()
+{
+    std::vector<uint16_t> source(kFrameWidth * kFrameHeight);
+    uint32_t count      = 0;
+    uint32_t fps_frames = 0;
+    auto fps_start      = std::chrono::steady_clock::now();
+    auto next           = fps_start;
+    while (!_vision_data.stopRequested.load()) {
+        render_test_pattern(source, count);
+
+        camera::VisionFramePool::Frame_t frame;
+        if (_vision_pool.acquireWrite(frame)) {
+            const int64_t start = steady_clock_us();
+            _vision_scaler.scale(source.data(), frame.data, frame.format);
+            frame.sequence  = count;
+            frame.captureUs = start;
+            _vision_pool.publish(frame);
+            _vision_data.scaleUs = steady_clock_us() - start;
+        }
+        count++;
+
+        fps_frames++;
+        const auto now = std::chrono::steady_clock::now();
+        if (now - fps_start >= std::chrono::seconds(1)) {
+            _vision_data.fps = fps_frames / std::chrono::duration<float>(now - fps_start).count();
+            fps_frames       = 0;
+            fps_start        = now;
+        }
+        next += std::chrono::milliseconds(kFrameInterval);
+        std::this_thread::sleep_until(next);
+    }
+    _vision_pool.flush();
+
+    std::lock_guard<std::mutex> lock(_vision_data.mutex);
+    _vision_data.isRunning = false;
+}
+
+bool HalDesktop::startCameraVision(const CameraVisionConfig_t& config)
+{
+    std::lock_guard<std::mutex> lock(_vision_data.mutex);
+    if (_vision_data.isRunning) {
+        mclog::tagWarn(_tag, "vision is running");
+        return false;
+    }
+
+    camera::Roi_t roi;
+    roi.x      = config.roiX;
+    roi.y      = config.roiY;
+    roi.width  = config.roiWidth;
+    roi.height = config.roiHeight;
+    if (!_vision_scaler.configure(kFrameWidth, kFrameHeight, roi, config.width, config.height)) {
+        mclog::tagWarn(_tag, "vision roi {},{} {}x{} cannot scale to {}x{}", roi.x, roi.y, roi.width, roi.height,
+                       config.width, config.height);
+        return false;
+    }
+
+    camera::VisionFramePool::Config_t pool_config;
+    pool_config.width     = config.width;
+    pool_config.height    = config.height;
+    pool_config.format    = config.gray ? camera::IMAGE_GRAY8 : camera::IMAGE_RGB565;
+    pool_config.slotCount = kVisionSlotCount;
+    if (!_vision_pool.configure(pool_config)) {
+        mclog::tagWarn(_tag, "vision frames are still held");
+        return false;
+    }
+
+    // Only ever grown, a late reader may still be looking at a slot after a stop
+    const size_t bytes = camera::image_bytes(config.width, config.height, pool_config.format);
+    for (size_t i = 0; i < kVisionSlotCount; i++) {
+        if (_vision_data.slots[i].size() < bytes) {
+            _vision_data.slots[i].resize(bytes);
+        }
+        _vision_pool.setBuffer(i, _vision_data.slots[i].data(), _vision_data.slots[i].size());
+    }
+    _vision_pool.resetStats();
+
+    _vision_data.stopRequested = false;
+    _vision_data.scaleUs       = 0;
+    _vision_data.fps           = 0.0f;
+    _vision_data.isRunning     = true;
+    std::thread(_vision_task).detach();
+    return true;
+}
+
+void HalDesktop::stopCameraVision()
+{
+    _vision_data.stopRequested = true;
+}
+
+bool HalDesktop::acquireCameraVisionFrame(CameraVisionFrame_t& frame, uint32_t timeoutMs)
+{
+    camera::VisionFramePool::Frame_t pool_frame;
+    if (!_vision_pool.acquire(pool_frame, timeoutMs)) {
+        return false;
+    }
+    frame.data      = pool_frame.data;
+    frame.width     = pool_frame.width;
+    frame.height    = pool_frame.height;
+    frame.gray      = pool_frame.format == camera::IMAGE_GRAY8;
+    frame.sequence  = pool_frame.sequence;
+    frame.captureUs = pool_frame.captureUs;
+    frame.slot      = pool_frame.slot;
+    return true;
+}
+
+void HalDesktop::releaseCameraVisionFrame(const CameraVisionFrame_t& frame)
+{
+    camera::VisionFramePool::Frame_t pool_frame;
+    pool_frame.slot = frame.slot;
+    _vision_pool.release(pool_frame);
+}
+
+hal::HalBase::CameraVisionStatus_t HalDesktop::getCameraVisionStatus()
+{
+    CameraVisionStatus_t ret;
+    {
+        std::lock_guard<std::mutex> lock(_vision_data.mutex);
+        ret.isRunning = _vision_data.isRunning;
+    }
+
+    auto stats     = _vision_pool.stats();
+    ret.frames     = stats.published;
+    ret.consumed   = stats.consumed;
+    ret.superseded = stats.superseded;
+    ret.scaleUs    = _vision_data.scaleUs;
+    ret.fps        = _vision_data.fps;
+    return ret;
+}
@@ -10,11 +10,220 @@
 #include <lvgl.h>
 #include <mutex>
 #include <thread>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
 #include <assets/assets.h>
 // https://github.com/lvgl/lv_port_pc_vscode/blob/master/main/src/main.c
 
 static const std::string _tag = "lvgl";
-static std::mutex _lvgl_mutex;
+
+/* -------------------------------------------------------------------------- */
+/*                          Tab5 panel layout harness                         */
+/* -------------------------------------------------------------------------- */
+// BOOST_FLUSH_SIM=copy|panel replays every flushed area onto a simulated 720x1280 Tab5 frame buffer, the UI rotated
+// by 90° as on the device, and times both flush layouts per frame:
+//   copy  - rotate into a scratch buffer, then copy that into the frame buffer (sw_rotate + draw_bitmap)
+//   panel - rotate straight to the area's place in the frame buffer (rotate_to_fb)
+// The value picks the layout getDisplayFlushStats() reports, the log line compares both every 5 s.
+struct FlushSimSums_t {
+    uint32_t flushes       = 0;
+    uint32_t frames        = 0;
+    uint64_t renderUs      = 0;  // frame time without the simulated flushes
+    uint64_t wallUs        = 0;
+    uint64_t copyRotateUs  = 0;
+    uint64_t copyCopyUs    = 0;
+    uint64_t panelRotateUs = 0;
+    uint64_t bytes         = 0;
+};
+
+struct FlushSimData_t {
+    bool enabled     = false;
+    bool reportCopy  = false;
+    int logicalWidth = 0;  // the rotated panel's height
+    int panelWidth   = 0;
+    std::vector<uint16_t> scratch;
+    std::vector<uint16_t> copyFb;
+    std::vector<uint16_t> panelFb;
+    std::chrono::steady_clock::time_point frameStart;
+    uint64_t frameSimUs = 0;
+    std::mutex mutex;
+    FlushSimSums_t sums;
+    FlushSimSums_t logged;
+    FlushSimSums_t reported;
+    std::chrono::steady_clock::time_point lastLog;
+    std::chrono::steady_clock::time_point lastReport;
+};
+static FlushSimData_t _flush_sim;
+
+static uint64_t _elapsed_us(std::chrono::steady_clock::time_point since)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+// Logical (x, y) lands on panel (y, logicalWidth - 1 - x), the LV_DISPLAY_ROTATION_90 mapping of the lvgl port
+static void _flush_sim_area(lv_display_t* display, const lv_area_t* area)
+{
+    auto& sim      = _flush_sim;
+    auto* draw_buf = lv_display_get_buf_active(display);
+    if (draw_buf == nullptr) {
+        return;
+    }
+    const int w          = lv_area_get_width(area);
+    const int h          = lv_area_get_height(area);
+    const uint32_t pitch = draw_buf->header.stride / sizeof(uint16_t);
+    const auto* src      = reinterpret_cast<const uint16_t*>(draw_buf->data) + area->y1 * pitch + area->x1;
+    const int panel_y1   = sim.logicalWidth - 1 - area->x2;
+
+    auto start = std::chrono::steady_clock::now();
+    sim.scratch.resize(static_cast<size_t>(w) * h);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            sim.scratch[static_cast<size_t>(w - 1 - x) * h + y] = src[y * pitch + x];
+        }
+    }
+    const uint64_t copy_rotate_us = _elapsed_us(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < w; r++) {
+        std::memcpy(&sim.copyFb[static_cast<size_t>(panel_y1 + r) * sim.panelWidth + area->y1],
+                    &sim.scratch[static_cast<size_t>(r) * h], h * sizeof(uint16_t));
+    }
+    const uint64_t copy_copy_us = _elapsed_us(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int y = 0; y < h; y++) {
+        uint16_t* dst = &sim.panelFb[static_cast<size_t>(panel_y1 + w - 1) * sim.panelWidth + area->y1 + y];
+        for (int x = 0; x < w; x++) {
+            *dst = src[y * pitch + x];
+            dst -= sim.panelWidth;
+        }
+    }
+    const uint64_t panel_rotate_us = _elapsed_us(start);
+
+    std::lock_guard<std::mutex> lock(sim.mutex);
+    sim.sums.flushes++;
+    sim.sums.bytes += static_cast<uint64_t>(w) * h * sizeof(uint16_t);
+    sim.sums.copyRotateUs += copy_rotate_us;
+    sim.sums.copyCopyUs += copy_copy_us;
+    sim.sums.panelRotateUs += panel_rotate_us;
+    sim.frameSimUs += copy_rotate_us + copy_copy_us + panel_rotate_us;
+}
+
+static void _flush_sim_log()
+{
+    auto& sim = _flush_sim;
+    FlushSimSums_t d;
+    {
+        std::lock_guard<std::mutex> lock(sim.mutex);
+        d.frames        = sim.sums.frames - sim.logged.frames;
+        d.renderUs      = sim.sums.renderUs - sim.logged.renderUs;
+        d.wallUs        = sim.sums.wallUs - sim.logged.wallUs;
+        d.copyRotateUs  = sim.sums.copyRotateUs - sim.logged.copyRotateUs;
+        d.copyCopyUs    = sim.sums.copyCopyUs - sim.logged.copyCopyUs;
+        d.panelRotateUs = sim.sums.panelRotateUs - sim.logged.panelRotateUs;
+        sim.logged      = sim.sums;
+    }
+    if (d.frames == 0) {
+        return;
+    }
+    const uint64_t render = d.renderUs / d.frames;
+    const uint64_t copy   = (d.copyRotateUs + d.copyCopyUs) / d.frames;
+    const uint64_t panel  = d.panelRotateUs / d.frames;
+    mclog::tagInfo(_tag, "flush sim {} frames: render {} us, copy layout +{} us = {} us, panel layout +{} us = {} us",
+                   d.frames, render, copy, render + copy, panel, render + panel);
+}
+
+static void _flush_sim_event_cb(lv_event_t* e)
+{
+    auto& sim             = _flush_sim;
+    lv_display_t* display = static_cast<lv_display_t*>(lv_event_get_target(e));
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_REFR_START:
+            sim.frameStart = std::chrono::steady_clock::now();
+            sim.frameSimUs = 0;
+            break;
+        case LV_EVENT_FLUSH_START:
+            _flush_sim_area(display, static_cast<const lv_area_t*>(lv_event_get_param(e)));
+            break;
+        case LV_EVENT_REFR_READY: {
+            const uint64_t wall_us = _elapsed_us(sim.frameStart);
+            {
+                std::lock_guard<std::mutex> lock(sim.mutex);
+                sim.sums.frames++;
+                sim.sums.wallUs += wall_us;
+                sim.sums.renderUs += wall_us - std::min(wall_us, sim.frameSimUs);
+            }
+            if (_elapsed_us(sim.lastLog) > 5000000) {
+                sim.lastLog = std::chrono::steady_clock::now();
+                _flush_sim_log();
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void _flush_sim_init(lv_display_t* display)
+{
+    const char* mode = std::getenv("BOOST_FLUSH_SIM");
+    if (mode == nullptr) {
+        return;
+    }
+    if (lv_display_get_color_format(display) != LV_COLOR_FORMAT_RGB565) {
+        mclog::tagWarn(_tag, "flush sim needs an RGB565 display");
+        return;
+    }
+
+    auto& sim        = _flush_sim;
+    sim.reportCopy   = std::strcmp(mode, "copy") == 0;
+    sim.logicalWidth = lv_display_get_horizontal_resolution(display);
+    sim.panelWidth   = lv_display_get_vertical_resolution(display);
+    sim.copyFb.assign(static_cast<size_t>(sim.logicalWidth) * sim.panelWidth, 0);
+    sim.panelFb.assign(static_cast<size_t>(sim.logicalWidth) * sim.panelWidth, 0);
+    sim.lastLog    = std::chrono::steady_clock::now();
+    sim.lastReport = sim.lastLog;
+    sim.enabled    = true;
+
+    lv_display_add_event_cb(display, _flush_sim_event_cb, LV_EVENT_REFR_START, nullptr);
+    lv_display_add_event_cb(display, _flush_sim_event_cb, LV_EVENT_FLUSH_START, nullptr);
+    lv_display_add_event_cb(display, _flush_sim_event_cb, LV_EVENT_REFR_READY, nullptr);
+    mclog::tagInfo(_tag, "flush sim on a {}x{} panel, reporting the {} layout", sim.panelWidth, sim.logicalWidth,
+                   sim.reportCopy ? "copy" : "panel");
+}
+
+hal::HalBase::DisplayFlushStats_t HalDesktop::getDisplayFlushStats()
+{
+    DisplayFlushStats_t ret;
+    auto& sim = _flush_sim;
+    if (!sim.enabled) {
+        return ret;
+    }
+
+    std::lock_guard<std::mutex> lock(sim.mutex);
+    const uint32_t n = sim.sums.flushes - sim.reported.flushes;
+    if (n > 0) {
+        const uint64_t rotate_us = sim.reportCopy ? sim.sums.copyRotateUs - sim.reported.copyRotateUs
+                                                  : sim.sums.panelRotateUs - sim.reported.panelRotateUs;
+        const uint64_t copy_us   = sim.reportCopy ? sim.sums.copyCopyUs - sim.reported.copyCopyUs : 0;
+        ret.flushes    = n;
+        ret.renderUs   = (sim.sums.renderUs - sim.reported.renderUs) / n;
+        ret.rotateUs   = rotate_us / n;
+        ret.transferUs = copy_us / n;
+        ret.latencyUs  = (rotate_us + copy_us) / n;
+        ret.frameUs    = _elapsed_us(sim.lastReport) / n;
+    }
+    if (const uint64_t elapsed_us = _elapsed_us(sim.lastReport); elapsed_us > 0) {
+        ret.bytesPerSecond = (sim.sums.bytes - sim.reported.bytes) * 1000000 / elapsed_us;
+    }
+    sim.reported   = sim.sums;
+    sim.lastReport = std::chrono::steady_clock::now();
+    return ret;
+}
 
 void HalDesktop::lvgl_init()
 {
@@ -26,6 +235,7 @@ void HalDesktop::lvgl_init()
 
     auto display = lv_sdl_window_create(HAL_SCREEN_WIDTH, HAL_SCREEN_HEIGHT);
     lv_display_set_default(display);
+    _flush_sim_init(display);
 
     lvTouchpad = lv_sdl_mouse_create();
     lv_indev_set_group(lvTouchpad, lv_group_get_default());
@@ -60,12 +270,13 @@ void HalDesktop::lvgl_init()
 #endif
 }
 
+// LVGL's own recursive lock, the one lv_timer_handler() takes around rendering and handing work to the draw threads
 void HalDesktop::lvglLock()
 {
-    _lvgl_mutex.lock();
+    lv_lock();
 }
 
 void HalDesktop::lvglUnlock()
 {
-    _lvgl_mutex.unlock();
+    lv_unlock();
 }
@@ -9,6 +9,13 @@
 #include <random>
 #include <filesystem>
 #include <thread>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <apps/utils/imu/attitude_estimator.h>
 
 static const std::string _tag = "hal";
 
@@ -40,6 +47,45 @@ int HalDesktop::getCpuTemp()
     return dis(gen) * 45.0f;
 }
 
+std::vector<float> HalDesktop::getCpuCoreLoads()
+{
+    // Per core jiffies from /proc/stat, Linux only
+    struct CoreTimes_t {
+        uint64_t busy  = 0;
+        uint64_t total = 0;
+    };
+    static std::vector<CoreTimes_t> last;
+
+    std::vector<CoreTimes_t> now;
+    std::ifstream stat("/proc/stat");
+    std::string line;
+    while (std::getline(stat, line)) {
+        if (line.compare(0, 3, "cpu") != 0) {
+            break;
+        }
+        if (line.size() < 4 || !std::isdigit(static_cast<unsigned char>(line[3]))) {
+            continue;  // the all cores line
+        }
+        std::istringstream fields(line.substr(line.find(' ')));
+        uint64_t user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+        fields >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal;
+        CoreTimes_t times;
+        times.busy  = user + nice + system + irq + softirq + steal;
+        times.total = times.busy + idle + iowait;
+        now.push_back(times);
+    }
+
+    std::vector<float> ret;
+    if (last.size() == now.size()) {
+        for (size_t i = 0; i < now.size(); i++) {
+            const uint64_t total = now[i].total - last[i].total;
+            ret.push_back(total > 0 ? 100.0f * (now[i].busy - last[i].busy) / total : 0.0f);
+        }
+    }
+    last = std::move(now);
+    return ret;
+}
+
 /* -------------------------------------------------------------------------- */
 /*                                   Display                                  */
 /* -------------------------------------------------------------------------- */
@@ -70,15 +116,65 @@ void HalDesktop::updatePowerMonitorData()
 /* -------------------------------------------------------------------------- */
 /*                                     IMU                                    */
 /* -------------------------------------------------------------------------- */
+// Simulated IMU, a slow rock about roll and pitch at the Tab5 rate, through the same fusion as the device
+static constexpr uint32_t kImuSamplePeriodUs = 5000;
+static constexpr size_t kImuBatch            = 4;
+
+static std::once_flag _imu_start_flag;
+static imu::AttitudeEstimator _attitude_estimator;
+
+static void _imu_sim_task()
+{
+    std::mt19937 gen(std::random_device{}());
+    std::normal_distribution<float> accel_noise(0.0f, 0.01f);
+    std::normal_distribution<float> gyro_noise(0.0f, 0.2f);
+    constexpr float kDegToRad = 0.0174532925f;
+    constexpr float kGyroBias = 0.8f;  // °/s, for the filter to find
+
+    imu::ImuSample_t samples[kImuBatch];
+    uint32_t timestamp = 0;
+    while (true) {
+        for (auto& sample : samples) {
+            const float t          = timestamp * 1e-6f;
+            const float roll       = 25.0f * std::sin(0.5f * t) * kDegToRad;
+            const float pitch      = 15.0f * std::sin(0.3f * t) * kDegToRad;
+            const float roll_rate  = 25.0f * 0.5f * std::cos(0.5f * t);
+            const float pitch_rate = 15.0f * 0.3f * std::cos(0.3f * t);
+
+            sample.timestampUs = timestamp;
+            sample.accel[0]    = -std::sin(pitch) + accel_noise(gen);
+            sample.accel[1]    = std::sin(roll) * std::cos(pitch) + accel_noise(gen);
+            sample.accel[2]    = std::cos(roll) * std::cos(pitch) + accel_noise(gen);
+            sample.gyro[0]     = roll_rate + kGyroBias + gyro_noise(gen);
+            sample.gyro[1]     = std::cos(roll) * pitch_rate + gyro_noise(gen);
+            sample.gyro[2]     = -std::sin(roll) * pitch_rate + gyro_noise(gen);
+            timestamp += kImuSamplePeriodUs;
+        }
+        _attitude_estimator.process(samples, kImuBatch);
+        std::this_thread::sleep_for(std::chrono::microseconds(kImuSamplePeriodUs * kImuBatch));
+    }
+}
+
 void HalDesktop::updateImuData()
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_real_distribution<> dis(-0.1, 0.1);
+    imu::Attitude_t attitude;
+    getImuAttitude(attitude);
+    const imu::ImuSample_t& sample = attitude.sample;
 
-    imuData.accelX = dis(gen);
-    imuData.accelY = dis(gen);
-    imuData.accelZ = dis(gen);
+    // Same axes and scale as the Tab5, whose accel y is mirrored against the estimator frame
+    imuData.accelX = sample.accel[0] * 9.8f / 10.0f;
+    imuData.accelY = -sample.accel[1] * 9.8f / 10.0f;
+    imuData.accelZ = sample.accel[2] * 9.8f / 10.0f;
+    imuData.gyroX  = sample.gyro[0] / 10.0f;
+    imuData.gyroY  = sample.gyro[1] / 10.0f;
+    imuData.gyroZ  = sample.gyro[2] / 10.0f;
+}
+
+bool HalDesktop::getImuAttitude(imu::Attitude_t& attitude)
+{
+    std::call_once(_imu_start_flag, []() { std::thread(_imu_sim_task).detach(); });
+    attitude = _attitude_estimator.attitude();
+    return attitude.sampleCount > 0;
 }
 
 /* -------------------------------------------------------------------------- */
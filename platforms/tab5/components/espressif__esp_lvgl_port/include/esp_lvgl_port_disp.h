@@ -64,9 +64,33 @@ typedef struct {
 #endif
         unsigned int full_refresh : 1; /*!< 1: Always make the whole screen redrawn */
         unsigned int direct_mode : 1;  /*!< 1: Use screen-sized buffers and draw to absolute coordinates */
+        unsigned int async_flush : 1;  /*!< 1: Rotate with the PPA and transfer without blocking the LVGL task
+                                          (MIPI-DSI, partial mode with sw_rotate only) */
+        unsigned int rotate_to_fb : 1; /*!< 1: The PPA rotates areas straight into the MIPI-DSI frame buffer, a flush
+                                          is that one DMA pass (partial mode with sw_rotate only, before async_flush) */
     } flags;
 } lvgl_port_display_cfg_t;
 
+/**
+ * @brief Flush timing of a display, sums in microseconds since it was added
+ *
+ * Wait and queue stay 0 unless the display flushes asynchronously. When nothing overlaps, a refresh takes about
+ * render + latency, the difference to the wall clock is what the async flush hides behind rendering. Partial and full
+ * refreshes are counted in MIPI-DSI direct mode only, where dirty areas go out as coalesced row bands.
+ */
+typedef struct {
+    uint32_t flushes;           /*!< Areas flushed */
+    uint64_t render_us;         /*!< LVGL rendering, from the refresh start or the previous flush callback on */
+    uint64_t wait_us;           /*!< Flush callback waiting for a free rotate buffer */
+    uint64_t rotate_us;         /*!< PPA rotation, issued to done */
+    uint64_t queue_us;          /*!< Rotated area waiting for the panel */
+    uint64_t transfer_us;       /*!< esp_lcd_panel_draw_bitmap to transfer done */
+    uint64_t latency_us;        /*!< Flush callback entry to transfer done */
+    uint64_t transfer_bytes;    /*!< Pixel data written to the panel */
+    uint32_t partial_refreshes; /*!< Direct mode refreshes sent as dirty bands */
+    uint32_t full_refreshes;    /*!< Direct mode refreshes sent whole, cheaper than their bands */
+} lvgl_port_flush_stats_t;
+
 /**
  * @brief Configuration RGB display structure
  */
@@ -137,6 +161,17 @@ lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg,
  */
 esp_err_t lvgl_port_remove_disp(lv_display_t *disp);
 
+/**
+ * @brief Get the flush timing of a display
+ *
+ * @param disp LVGL display
+ * @param stats Receives the sums since the display was added
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if a pointer is NULL
+ */
+esp_err_t lvgl_port_get_flush_stats(lv_display_t *disp, lvgl_port_flush_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
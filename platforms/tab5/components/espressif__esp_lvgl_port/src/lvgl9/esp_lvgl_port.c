@@ -162,12 +162,23 @@ bool lvgl_port_lock(uint32_t timeout_ms)
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
 
     const TickType_t timeout_ticks = (timeout_ms == 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-    return xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) == pdTRUE;
+    if (xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) != pdTRUE) {
+        return false;
+    }
+#if LV_USE_OS != LV_OS_NONE
+    /* Also hold LVGL's own lock, so code that only calls lv_lock() is kept out too. lv_timer_handler() takes it
+     * under the port lock as well, so the order is always port lock first and this does not block. */
+    lv_lock();
+#endif
+    return true;
 }
 
 void lvgl_port_unlock(void)
 {
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
+#if LV_USE_OS != LV_OS_NONE
+    lv_unlock();
+#endif
     xSemaphoreGiveRecursive(lvgl_port_ctx.lvgl_mux);
 }
 
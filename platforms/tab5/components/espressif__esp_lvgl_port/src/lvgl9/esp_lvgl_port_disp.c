@@ -12,6 +12,8 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
 #include "esp_heap_caps.h"
 #include "esp_idf_version.h"
 #include "esp_lcd_panel_io.h"
@@ -25,6 +27,15 @@
 #define ALIGN_UP_BY(num, align) (((num) + ((align)-1)) & ~((align)-1))
 #define BLOCK_SIZE_SMALL        (32)
 #define BLOCK_SIZE_LARGE        (256)
+#define ROTATE_BUFF_NUM         (2)    /* Rotated areas in flight with async_flush */
+#define FLUSH_TASK_PRIORITY     (5)    /* Above the LVGL task, it only hands areas to the panel */
+#define FLUSH_TASK_STACK        (3072)
+#define FLUSH_TASK_EXIT         (0xFF)
+#define DIRTY_BAND_NUM          (8)           /* Row bands tracked per direct mode refresh */
+#define DIRTY_LEARN_SMALL       (64 * 1024)   /* Transfers up to this size refine the per-call overhead */
+#define DIRTY_LEARN_LARGE       (256 * 1024)  /* Transfers from this size refine the per-byte cost */
+#define DIRTY_BAND_TIMEOUT_MS   (100)
+#define DIRTY_MIN_US_PER_BYTE   (0.0005f)     /* 2 GB/s, faster than any PSRAM copy, keeps the cost model finite */
 static ppa_client_handle_t ppa_srm_handle = NULL;
 static size_t data_cache_line_size        = 0;
 
@@ -52,7 +63,22 @@ static const char* TAG = "LVGL";
  * Types definitions
  *******************************************************************************/
 
+typedef struct lvgl_port_display_ctx_s lvgl_port_display_ctx_t;
+
+/* One flushed area, timestamps in us */
 typedef struct {
+    lvgl_port_display_ctx_t* disp_ctx;
+    uint8_t index;       /* Rotate buffer of the area */
+    lv_area_t area;      /* Panel coordinates */
+    int64_t flush_us;    /* Flush callback entry */
+    int64_t rotate_us;   /* PPA issued */
+    int64_t rotated_us;  /* PPA done */
+    int64_t transfer_us; /* esp_lcd_panel_draw_bitmap */
+    int64_t done_us;     /* Transfer done */
+    uint32_t bytes;      /* Written to the panel */
+} lvgl_port_flush_job_t;
+
+struct lvgl_port_display_ctx_s {
     lvgl_port_disp_type_t disp_type;       /* Display type */
     esp_lcd_panel_io_handle_t io_handle;   /* LCD panel IO handle */
     esp_lcd_panel_handle_t panel_handle;   /* LCD panel handle */
@@ -69,8 +95,38 @@ typedef struct {
         unsigned int full_refresh : 1; /* Always make the whole screen redrawn */
         unsigned int direct_mode : 1;  /* Use screen-sized buffers and draw to absolute coordinates */
         unsigned int sw_rotate : 1;    /* Use software rotation (slower) or PPA if available */
+        unsigned int async_flush : 1;  /* Non-blocking PPA rotation, transfers from the flush task */
     } flags;
-} lvgl_port_display_ctx_t;
+    struct {
+        lv_color_t* buffs[ROTATE_BUFF_NUM]; /* PPA output, the first one is draw_buffs[2] */
+        lvgl_port_flush_job_t jobs[ROTATE_BUFF_NUM];
+        QueueHandle_t free_queue;     /* Indices of rotate buffers free to take */
+        QueueHandle_t ready_queue;    /* Rotated areas, in PPA completion order */
+        SemaphoreHandle_t trans_done; /* Given when the flush task's transfer is done */
+        TaskHandle_t task;
+        volatile int transferring; /* Job the panel is transferring for the flush task, -1 for none */
+    } async;
+    struct {
+        SemaphoreHandle_t done; /* Given when a band transfer is done, NULL unless DSI direct mode */
+        TaskHandle_t task;      /* Sends a refresh's bands and signals flush ready */
+        volatile bool exit;
+        uint8_t* color_map;     /* Buffer of the refresh being sent */
+        uint32_t rows_align;    /* Bands start and end on rows whose offset is a whole number of cache lines */
+        uint32_t count;
+        struct {
+            int32_t y1;
+            int32_t y2;
+        } bands[DIRTY_BAND_NUM]; /* Sorted, disjoint */
+        float overhead_us;       /* Measured draw_bitmap cost: overhead_us + bytes * us_per_byte */
+        float us_per_byte;
+    } dirty;
+    void* panel_fb;                 /* MIPI-DSI frame buffer the PPA rotates into with rotate_to_fb */
+    volatile bool fb_rotating;      /* A rotation into panel_fb is in flight */
+    lvgl_port_flush_job_t sync_job; /* The area flushed from the LVGL task */
+    int64_t render_start_us;
+    portMUX_TYPE stats_lock;
+    lvgl_port_flush_stats_t stats;
+};
 
 /*******************************************************************************
  * Function definitions
@@ -89,9 +145,22 @@ static bool lvgl_port_flush_dpi_panel_ready_callback(esp_lcd_panel_handle_t pane
                                                      esp_lcd_dpi_panel_event_data_t* edata, void* user_ctx);
 static bool lvgl_port_flush_dpi_vsync_ready_callback(esp_lcd_panel_handle_t panel_io,
                                                      esp_lcd_dpi_panel_event_data_t* edata, void* user_ctx);
+static bool lvgl_port_ppa_rotate_done_callback(ppa_client_handle_t ppa_client, ppa_event_data_t* event_data,
+                                               void* user_data);
 #endif
 #endif
 static void lvgl_port_flush_callback(lv_display_t* drv, const lv_area_t* area, uint8_t* color_map);
+#if (CONFIG_IDF_TARGET_ESP32P4 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0))
+static esp_err_t lvgl_port_async_flush_init(lvgl_port_display_ctx_t* disp_ctx, const lvgl_port_display_cfg_t* disp_cfg);
+#endif
+static void lvgl_port_async_flush_deinit(lvgl_port_display_ctx_t* disp_ctx);
+static uint32_t lvgl_port_gcd(uint32_t a, uint32_t b);
+static esp_err_t lvgl_port_dirty_init(lvgl_port_display_ctx_t* disp_ctx);
+static void lvgl_port_dirty_deinit(lvgl_port_display_ctx_t* disp_ctx);
+static void lvgl_port_dirty_add(lvgl_port_display_ctx_t* disp_ctx, const lv_area_t* area);
+static void lvgl_port_dirty_task(void* arg);
+static void lvgl_port_flush_stats_add(lvgl_port_display_ctx_t* disp_ctx, const lvgl_port_flush_job_t* job);
+static void lvgl_port_refresh_start_callback(lv_event_t* e);
 static void lvgl_port_disp_size_update_callback(lv_event_t* e);
 static void lvgl_port_disp_rotation_update(lvgl_port_display_ctx_t* disp_ctx);
 static void lvgl_port_display_invalidate_callback(lv_event_t* e);
@@ -136,6 +205,12 @@ lv_display_t* lvgl_port_add_disp_dsi(const lvgl_port_display_cfg_t* disp_cfg,
         .oper_type = PPA_OPERATION_SRM,
     };
     ESP_ERROR_CHECK(ppa_register_client(&ppa_srm_config, &ppa_srm_handle));
+#if (CONFIG_IDF_TARGET_ESP32P4 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0))
+    ppa_event_callbacks_t ppa_cbs = {
+        .on_trans_done = lvgl_port_ppa_rotate_done_callback,
+    };
+    ESP_ERROR_CHECK(ppa_client_register_event_callbacks(ppa_srm_handle, &ppa_cbs));
+#endif
     ESP_ERROR_CHECK(esp_cache_get_alignment(MALLOC_CAP_SPIRAM, &data_cache_line_size));
 
     assert(dsi_cfg != NULL);
@@ -160,6 +235,34 @@ lv_display_t* lvgl_port_add_disp_dsi(const lvgl_port_display_cfg_t* disp_cfg,
         /* Register done callback */
         esp_lcd_dpi_panel_register_event_callbacks(disp_ctx->panel_handle, &cbs, disp);
 
+        if (disp_ctx->flags.direct_mode && !dsi_cfg->flags.avoid_tearing) {
+            if (lvgl_port_dirty_init(disp_ctx) != ESP_OK) {
+                ESP_LOGW(TAG, "Dirty band init failed, sending whole frames");
+                lvgl_port_dirty_deinit(disp_ctx);
+            }
+        }
+
+        if (disp_cfg->flags.async_flush || disp_cfg->flags.rotate_to_fb) {
+            if (dsi_cfg->flags.avoid_tearing || !disp_ctx->flags.sw_rotate || disp_ctx->flags.direct_mode ||
+                disp_ctx->flags.full_refresh || disp_ctx->flags.monochrome || disp_ctx->flags.swap_bytes ||
+                lv_display_get_color_format(disp) != LV_COLOR_FORMAT_RGB565) {
+                ESP_LOGW(TAG, "PPA flush needs partial mode RGB565 with sw_rotate, flushing synchronously");
+            } else if (disp_cfg->flags.rotate_to_fb &&
+                       esp_lcd_dpi_panel_get_frame_buffer(disp_ctx->panel_handle, 1, &disp_ctx->panel_fb) == ESP_OK) {
+                /* Areas land in the panel layout directly, the rotation buffer has nothing left to do */
+                free(disp_ctx->draw_buffs[2]);
+                disp_ctx->draw_buffs[2] = NULL;
+            } else if (!disp_cfg->flags.async_flush) {
+                disp_ctx->panel_fb = NULL;
+                ESP_LOGW(TAG, "No frame buffer to rotate into, flushing synchronously");
+            } else if (lvgl_port_async_flush_init(disp_ctx, disp_cfg) != ESP_OK) {
+                ESP_LOGW(TAG, "Async flush init failed, flushing synchronously");
+                lvgl_port_async_flush_deinit(disp_ctx);
+            } else {
+                disp_ctx->flags.async_flush = 1;
+            }
+        }
+
         /* Apply rotation from initial display configuration */
         lvgl_port_disp_rotation_update(disp_ctx);
 #else
@@ -222,7 +325,17 @@ esp_err_t lvgl_port_remove_disp(lv_display_t* disp)
     assert(disp);
     lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)lv_display_get_driver_data(disp);
 
+    /* PPA callbacks must not reach a removed display */
     lvgl_port_lock(0);
+    lvgl_port_async_flush_deinit(disp_ctx);
+    lvgl_port_dirty_deinit(disp_ctx);
+    if (disp_ctx->fb_rotating) {
+        while (disp_ctx->fb_rotating) {
+            vTaskDelay(1);
+        }
+        /* The done callback still calls flush ready on the display after clearing the mark, let it return */
+        vTaskDelay(1);
+    }
     lv_disp_remove(disp);
     lvgl_port_unlock();
 
@@ -257,6 +370,18 @@ void lvgl_port_flush_ready(lv_display_t* disp)
     lv_disp_flush_ready(disp);
 }
 
+esp_err_t lvgl_port_get_flush_stats(lv_display_t* disp, lvgl_port_flush_stats_t* stats)
+{
+    ESP_RETURN_ON_FALSE(disp && stats, ESP_ERR_INVALID_ARG, TAG, "Invalid arguments");
+    lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)lv_display_get_driver_data(disp);
+    ESP_RETURN_ON_FALSE(disp_ctx, ESP_ERR_INVALID_STATE, TAG, "Not a port display");
+
+    portENTER_CRITICAL(&disp_ctx->stats_lock);
+    *stats = disp_ctx->stats;
+    portEXIT_CRITICAL(&disp_ctx->stats_lock);
+    return ESP_OK;
+}
+
 /*******************************************************************************
  * Private functions
  *******************************************************************************/
@@ -313,6 +438,9 @@ static lv_display_t* lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t* disp
     disp_ctx->flags.swap_bytes  = disp_cfg->flags.swap_bytes;
     disp_ctx->flags.sw_rotate   = disp_cfg->flags.sw_rotate;
     disp_ctx->current_rotation  = LV_DISPLAY_ROTATION_0;
+    disp_ctx->async.transferring = -1;
+    disp_ctx->sync_job.disp_ctx  = disp_ctx;
+    portMUX_INITIALIZE(&disp_ctx->stats_lock);
 
     uint32_t buff_caps = 0;
 #if SOC_PSRAM_DMA_CAPABLE == 0
@@ -414,13 +542,16 @@ static lv_display_t* lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t* disp
     lv_display_add_event_cb(disp, lvgl_port_disp_size_update_callback, LV_EVENT_RESOLUTION_CHANGED, disp_ctx);
     lv_display_add_event_cb(disp, lvgl_port_display_invalidate_callback, LV_EVENT_INVALIDATE_AREA, disp_ctx);
     lv_display_add_event_cb(disp, lvgl_port_display_invalidate_callback, LV_EVENT_REFR_REQUEST, disp_ctx);
+    lv_display_add_event_cb(disp, lvgl_port_refresh_start_callback, LV_EVENT_REFR_START, disp_ctx);
 
     lv_display_set_driver_data(disp, disp_ctx);
     disp_ctx->disp_drv = disp;
 
-    /* Use SW rotation */
+    /* Use SW rotation, cache line aligned as the PPA writes it */
     if (disp_cfg->flags.sw_rotate) {
-        disp_ctx->draw_buffs[2] = heap_caps_malloc(buffer_size * color_bytes, buff_caps);
+        size_t align            = data_cache_line_size ? data_cache_line_size : CONFIG_LV_DRAW_BUF_ALIGN;
+        disp_ctx->draw_buffs[2] =
+            heap_caps_aligned_alloc(align, ALIGN_UP_BY(buffer_size * color_bytes, align), buff_caps);
         ESP_GOTO_ON_FALSE(disp_ctx->draw_buffs[2], ESP_ERR_NO_MEM, err, TAG,
                           "Not enough memory for LVGL buffer (rotation buffer) allocation!");
     }
@@ -456,6 +587,11 @@ static bool lvgl_port_flush_io_ready_callback(esp_lcd_panel_io_handle_t panel_io
 {
     lv_display_t* disp_drv = (lv_display_t*)user_ctx;
     assert(disp_drv != NULL);
+    lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)lv_display_get_driver_data(disp_drv);
+    if (disp_ctx) {
+        disp_ctx->sync_job.done_us = esp_timer_get_time();
+        lvgl_port_flush_stats_add(disp_ctx, &disp_ctx->sync_job);
+    }
     lv_disp_flush_ready(disp_drv);
     return false;
 }
@@ -464,12 +600,64 @@ static bool lvgl_port_flush_io_ready_callback(esp_lcd_panel_io_handle_t panel_io
 static bool lvgl_port_flush_dpi_panel_ready_callback(esp_lcd_panel_handle_t panel_io,
                                                      esp_lcd_dpi_panel_event_data_t* edata, void* user_ctx)
 {
+    BaseType_t need_yield = pdFALSE;
+
     lv_display_t* disp_drv = (lv_display_t*)user_ctx;
     assert(disp_drv != NULL);
+    lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)lv_display_get_driver_data(disp_drv);
+    assert(disp_ctx != NULL);
+
+    /* Direct mode band, the flush task waits for each and signals flush ready itself */
+    if (disp_ctx->dirty.done) {
+        xSemaphoreGiveFromISR(disp_ctx->dirty.done, &need_yield);
+        return (need_yield == pdTRUE);
+    }
+
+    /* Transfer started by the flush task, LVGL was released when the PPA finished */
+    int index = disp_ctx->async.transferring;
+    if (index >= 0) {
+        disp_ctx->async.jobs[index].done_us = esp_timer_get_time();
+        xSemaphoreGiveFromISR(disp_ctx->async.trans_done, &need_yield);
+        return (need_yield == pdTRUE);
+    }
+
+    if (!disp_ctx->flags.direct_mode && !disp_ctx->flags.full_refresh) {
+        disp_ctx->sync_job.done_us = esp_timer_get_time();
+        lvgl_port_flush_stats_add(disp_ctx, &disp_ctx->sync_job);
+    }
     lv_disp_flush_ready(disp_drv);
     return false;
 }
 
+static bool lvgl_port_ppa_rotate_done_callback(ppa_client_handle_t ppa_client, ppa_event_data_t* event_data,
+                                               void* user_data)
+{
+    BaseType_t need_yield = pdFALSE;
+
+    /* Blocking rotations carry no job */
+    lvgl_port_flush_job_t* job = (lvgl_port_flush_job_t*)user_data;
+    if (job == NULL) {
+        return false;
+    }
+
+    lvgl_port_display_ctx_t* disp_ctx = job->disp_ctx;
+    lv_display_t* disp_drv            = disp_ctx->disp_drv;
+    job->rotated_us                   = esp_timer_get_time();
+    if (disp_ctx->panel_fb) {
+        /* Rotated into the frame buffer the panel scans out, nothing left to transfer. sync_job and fb_rotating are
+         * done with before flush ready, after it the next flush may already be filling them in */
+        job->transfer_us = job->rotated_us;
+        job->done_us     = job->rotated_us;
+        lvgl_port_flush_stats_add(disp_ctx, job);
+        disp_ctx->fb_rotating = false;
+    } else {
+        xQueueSendFromISR(disp_ctx->async.ready_queue, &job->index, &need_yield);
+    }
+    /* The draw buffer has been read, LVGL can render into it while the rotated copy goes out */
+    lv_disp_flush_ready(disp_drv);
+    return (need_yield == pdTRUE);
+}
+
 static bool lvgl_port_flush_dpi_vsync_ready_callback(esp_lcd_panel_handle_t panel_io,
                                                      esp_lcd_dpi_panel_event_data_t* edata, void* user_ctx)
 {
@@ -607,8 +795,9 @@ void lvgl_port_rotate_area(lv_display_t* disp, lv_area_t* area)
     }
 }
 
-IRAM_ATTR static void rotate_copy_pixel(const uint16_t* from, uint16_t* to, uint16_t x_start, uint16_t y_start,
-                                        uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotation)
+IRAM_ATTR static esp_err_t rotate_copy_pixel(const uint16_t* from, uint16_t* to, uint16_t x_start, uint16_t y_start,
+                                             uint16_t x_end, uint16_t y_end, uint16_t w, uint16_t h, uint16_t rotation,
+                                             ppa_trans_mode_t mode, void* user_data)
 {
     ppa_srm_rotation_angle_t ppa_rotation;
     int x_offset = 0, y_offset = 0;
@@ -647,7 +836,7 @@ IRAM_ATTR static void rotate_copy_pixel(const uint16_t* from, uint16_t* to, uint
         .in.srm_cm         = (LV_COLOR_DEPTH == 24) ? PPA_SRM_COLOR_MODE_RGB888 : PPA_SRM_COLOR_MODE_RGB565,
 
         .out.buffer      = to,
-        .out.buffer_size = ALIGN_UP_BY(sizeof(lv_color_t) * w * h, data_cache_line_size),
+        .out.buffer_size = ALIGN_UP_BY((LV_COLOR_DEPTH / 8) * w * h, data_cache_line_size),
         .out.pic_w = (ppa_rotation == PPA_SRM_ROTATION_ANGLE_90 || ppa_rotation == PPA_SRM_ROTATION_ANGLE_270) ? h : w,
         .out.pic_h = (ppa_rotation == PPA_SRM_ROTATION_ANGLE_90 || ppa_rotation == PPA_SRM_ROTATION_ANGLE_270) ? w : h,
         .out.block_offset_x = x_offset,
@@ -659,10 +848,134 @@ IRAM_ATTR static void rotate_copy_pixel(const uint16_t* from, uint16_t* to, uint
         .scale_y        = 1.0,
         .rgb_swap       = 0,
         .byte_swap      = 0,
-        .mode           = PPA_TRANS_MODE_BLOCKING,
+        .mode           = mode,
+        .user_data      = user_data,
     };
 
-    ESP_ERROR_CHECK(ppa_do_scale_rotate_mirror(ppa_srm_handle, &oper_config));
+    return ppa_do_scale_rotate_mirror(ppa_srm_handle, &oper_config);
+}
+
+/* Take a rotate buffer, start the PPA into it and return, the rest happens in the callbacks and the flush task */
+static void lvgl_port_flush_async(lvgl_port_display_ctx_t* disp_ctx, const lv_area_t* area, uint8_t* color_map,
+                                  int64_t flush_us)
+{
+    uint8_t index = 0;
+    xQueueReceive(disp_ctx->async.free_queue, &index, portMAX_DELAY);
+
+    lvgl_port_flush_job_t* job = &disp_ctx->async.jobs[index];
+    job->flush_us              = flush_us;
+    job->bytes                 = lv_area_get_size(area) * sizeof(uint16_t);
+    job->area                  = *area;
+    lvgl_port_rotate_area(disp_ctx->disp_drv, &job->area);
+
+    uint16_t w = lv_area_get_width(area);
+    uint16_t h = lv_area_get_height(area);
+    uint16_t rotation;
+    switch (disp_ctx->current_rotation) {
+        case LV_DISPLAY_ROTATION_90:
+            rotation = 270;
+            break;
+        case LV_DISPLAY_ROTATION_180:
+            rotation = 180;
+            break;
+        default:
+            rotation = 90;
+            break;
+    }
+
+    job->rotate_us = esp_timer_get_time();
+    esp_err_t ret  = rotate_copy_pixel((uint16_t*)color_map, (uint16_t*)disp_ctx->async.buffs[index], 0, 0, w - 1,
+                                       h - 1, w, h, rotation, PPA_TRANS_MODE_NON_BLOCKING, job);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "PPA rotation failed (%s), area dropped", esp_err_to_name(ret));
+        xQueueSend(disp_ctx->async.free_queue, &index, 0);
+        lv_disp_flush_ready(disp_ctx->disp_drv);
+    }
+}
+
+/* Rotate an area to its place in the panel frame buffer, flush ready comes from the PPA done callback */
+static void lvgl_port_flush_to_frame_buffer(lvgl_port_display_ctx_t* disp_ctx, const lv_area_t* area,
+                                            const uint8_t* color_map, int64_t flush_us)
+{
+    lvgl_port_flush_job_t* job = &disp_ctx->sync_job;
+    job->flush_us              = flush_us;
+    job->bytes                 = lv_area_get_size(area) * sizeof(uint16_t);
+    job->area                  = *area;
+    lvgl_port_rotate_area(disp_ctx->disp_drv, &job->area);
+
+    ppa_srm_rotation_angle_t angle;
+    switch (disp_ctx->current_rotation) {
+        case LV_DISPLAY_ROTATION_90:
+            angle = PPA_SRM_ROTATION_ANGLE_90;
+            break;
+        case LV_DISPLAY_ROTATION_180:
+            angle = PPA_SRM_ROTATION_ANGLE_180;
+            break;
+        default:
+            angle = PPA_SRM_ROTATION_ANGLE_270;
+            break;
+    }
+
+    uint32_t w    = lv_area_get_width(area);
+    uint32_t h    = lv_area_get_height(area);
+    uint32_t hres = lv_display_get_physical_horizontal_resolution(disp_ctx->disp_drv);
+    uint32_t vres = lv_display_get_physical_vertical_resolution(disp_ctx->disp_drv);
+
+    /* The PPA syncs the cache over the whole output buffer, so hand it only the rows the area covers, widened to
+     * rows that start on a cache line */
+    uint32_t stride = hres * sizeof(uint16_t);
+    uint32_t line   = data_cache_line_size ? data_cache_line_size : CONFIG_LV_DRAW_BUF_ALIGN;
+    uint32_t align  = line / lvgl_port_gcd(stride, line);
+    uint32_t y1     = job->area.y1 / align * align;
+    uint32_t y2     = LV_MIN((job->area.y2 / align + 1) * align, vres);
+
+    ppa_srm_oper_config_t oper_config = {
+        .in.buffer         = color_map,
+        .in.pic_w          = w,
+        .in.pic_h          = h,
+        .in.block_w        = w,
+        .in.block_h        = h,
+        .in.block_offset_x = 0,
+        .in.block_offset_y = 0,
+        .in.srm_cm         = PPA_SRM_COLOR_MODE_RGB565,
+
+        .out.buffer         = (uint8_t*)disp_ctx->panel_fb + y1 * stride,
+        .out.buffer_size    = ALIGN_UP_BY((y2 - y1) * stride, line),
+        .out.pic_w          = hres,
+        .out.pic_h          = y2 - y1,
+        .out.block_offset_x = job->area.x1,
+        .out.block_offset_y = job->area.y1 - y1,
+        .out.srm_cm         = PPA_SRM_COLOR_MODE_RGB565,
+
+        .rotation_angle = angle,
+        .scale_x        = 1.0,
+        .scale_y        = 1.0,
+        .rgb_swap       = 0,
+        .byte_swap      = 0,
+        .mode           = PPA_TRANS_MODE_NON_BLOCKING,
+        .user_data      = job,
+    };
+
+    job->rotate_us        = esp_timer_get_time();
+    disp_ctx->fb_rotating = true;
+    esp_err_t ret         = ppa_do_scale_rotate_mirror(ppa_srm_handle, &oper_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "PPA rotation failed (%s), area dropped", esp_err_to_name(ret));
+        disp_ctx->fb_rotating = false;
+        lv_disp_flush_ready(disp_ctx->disp_drv);
+    }
+}
+
+/* Wait for every rotate buffer to come back, nothing of the async path is in flight afterwards */
+static void lvgl_port_flush_async_drain(lvgl_port_display_ctx_t* disp_ctx)
+{
+    uint8_t index[ROTATE_BUFF_NUM];
+    for (int i = 0; i < ROTATE_BUFF_NUM; i++) {
+        xQueueReceive(disp_ctx->async.free_queue, &index[i], portMAX_DELAY);
+    }
+    for (int i = 0; i < ROTATE_BUFF_NUM; i++) {
+        xQueueSend(disp_ctx->async.free_queue, &index[i], 0);
+    }
 }
 
 static void lvgl_port_flush_callback(lv_display_t* drv, const lv_area_t* area, uint8_t* color_map)
@@ -673,6 +986,32 @@ static void lvgl_port_flush_callback(lv_display_t* drv, const lv_area_t* area, u
     lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)lv_display_get_driver_data(drv);
     assert(disp_ctx != NULL);
 
+    int64_t flush_us = esp_timer_get_time();
+    portENTER_CRITICAL(&disp_ctx->stats_lock);
+    disp_ctx->stats.render_us += flush_us - disp_ctx->render_start_us;
+    portEXIT_CRITICAL(&disp_ctx->stats_lock);
+
+    if (disp_ctx->panel_fb && disp_ctx->current_rotation > LV_DISPLAY_ROTATION_0) {
+        lvgl_port_flush_to_frame_buffer(disp_ctx, area, color_map, flush_us);
+        disp_ctx->render_start_us = esp_timer_get_time();
+        return;
+    }
+
+    if (disp_ctx->flags.async_flush) {
+        if (disp_ctx->current_rotation > LV_DISPLAY_ROTATION_0) {
+            lvgl_port_flush_async(disp_ctx, area, color_map, flush_us);
+            disp_ctx->render_start_us = esp_timer_get_time();
+            return;
+        }
+        lvgl_port_flush_async_drain(disp_ctx);
+    }
+
+    lvgl_port_flush_job_t* job = &disp_ctx->sync_job;
+    job->flush_us              = flush_us;
+    job->rotate_us             = flush_us;
+    job->rotated_us            = flush_us;
+    job->bytes = lv_area_get_size(area) * lv_color_format_get_size(lv_display_get_color_format(drv));
+
     int offsetx1 = area->x1;
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
@@ -698,13 +1037,15 @@ static void lvgl_port_flush_callback(lv_display_t* drv, const lv_area_t* area, u
                 //                   LV_DISPLAY_ROTATION_90, cf);
                 // rotate_copy_pixel((uint16_t*)color_map, (uint16_t*)disp_ctx->draw_buffs[2], offsetx1, offsety1,
                 //                   offsetx2, offsety2, LV_HOR_RES, LV_VER_RES, 270);
-                rotate_copy_pixel((uint16_t*)color_map, (uint16_t*)disp_ctx->draw_buffs[2], 0, 0, offsetx2 - offsetx1,
-                                  offsety2 - offsety1, offsetx2 - offsetx1 + 1, offsety2 - offsety1 + 1, 270);
+                ESP_ERROR_CHECK(rotate_copy_pixel((uint16_t*)color_map, (uint16_t*)disp_ctx->draw_buffs[2], 0, 0,
+                                                  offsetx2 - offsetx1, offsety2 - offsety1, offsetx2 - offsetx1 + 1,
+                                                  offsety2 - offsety1 + 1, 270, PPA_TRANS_MODE_BLOCKING, NULL));
             } else if (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_270) {
                 lv_draw_sw_rotate(color_map, disp_ctx->draw_buffs[2], ww, hh, w_stride, h_stride,
                                   LV_DISPLAY_ROTATION_270, cf);
             }
-            color_map = (uint8_t*)disp_ctx->draw_buffs[2];
+            color_map       = (uint8_t*)disp_ctx->draw_buffs[2];
+            job->rotated_us = esp_timer_get_time();
             lvgl_port_rotate_area(drv, (lv_area_t*)area);
             offsetx1 = area->x1;
             offsetx2 = area->x2;
@@ -723,9 +1064,24 @@ static void lvgl_port_flush_callback(lv_display_t* drv, const lv_area_t* area, u
         _lvgl_port_transform_monochrome(drv, area, &color_map);
     }
 
-    if ((disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI) &&
-        (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh)) {
+    job->transfer_us = esp_timer_get_time();
+    if (disp_ctx->dirty.task && (!disp_ctx->flags.sw_rotate || disp_ctx->current_rotation == LV_DISPLAY_ROTATION_0)) {
+        /* Direct mode into LVGL's own buffers, only the rows that changed need to reach the panel */
+        lvgl_port_dirty_add(disp_ctx, area);
+        job->bytes = 0;
+        if (lv_disp_flush_is_last(drv)) {
+            /* The flush task owns the bands until it signals flush ready, LVGL goes on meanwhile */
+            disp_ctx->dirty.color_map = color_map;
+            xTaskNotifyGive(disp_ctx->dirty.task);
+            disp_ctx->render_start_us = esp_timer_get_time();
+            return;
+        }
+    } else if ((disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI) &&
+               (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh)) {
+        job->bytes = 0;
         if (lv_disp_flush_is_last(drv)) {
+            job->bytes = lv_disp_get_hor_res(drv) * lv_disp_get_ver_res(drv) *
+                         lv_color_format_get_size(lv_display_get_color_format(drv));
             /* If the interface is I80 or SPI, this step cannot be used for drawing. */
             esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, 0, 0, lv_disp_get_hor_res(drv), lv_disp_get_ver_res(drv),
                                       color_map);
@@ -740,8 +1096,11 @@ static void lvgl_port_flush_callback(lv_display_t* drv, const lv_area_t* area, u
     if (disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB ||
         (disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI &&
          (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh))) {
+        job->done_us = esp_timer_get_time();
+        lvgl_port_flush_stats_add(disp_ctx, job);
         lv_disp_flush_ready(drv);
     }
+    disp_ctx->render_start_us = esp_timer_get_time();
 }
 
 // static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, uint8_t *color_map)
@@ -874,3 +1233,316 @@ static void lvgl_port_display_invalidate_callback(lv_event_t* e)
     /* Wake LVGL task, if needed */
     lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, NULL);
 }
+
+static void lvgl_port_refresh_start_callback(lv_event_t* e)
+{
+    lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)lv_event_get_user_data(e);
+    disp_ctx->render_start_us         = esp_timer_get_time();
+}
+
+/* Called from the flush task, the LVGL task and transfer done ISRs */
+static void lvgl_port_flush_stats_add(lvgl_port_display_ctx_t* disp_ctx, const lvgl_port_flush_job_t* job)
+{
+    portENTER_CRITICAL_SAFE(&disp_ctx->stats_lock);
+    disp_ctx->stats.flushes++;
+    disp_ctx->stats.wait_us += job->rotate_us - job->flush_us;
+    disp_ctx->stats.rotate_us += job->rotated_us - job->rotate_us;
+    disp_ctx->stats.queue_us += job->transfer_us - job->rotated_us;
+    disp_ctx->stats.transfer_us += job->done_us - job->transfer_us;
+    disp_ctx->stats.latency_us += job->done_us - job->flush_us;
+    disp_ctx->stats.transfer_bytes += job->bytes;
+    portEXIT_CRITICAL_SAFE(&disp_ctx->stats_lock);
+}
+
+#if (CONFIG_IDF_TARGET_ESP32P4 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0))
+/* Hands rotated areas to the panel in PPA completion order, one transfer at a time */
+static void lvgl_port_flush_task(void* arg)
+{
+    lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)arg;
+    uint8_t index                     = 0;
+
+    while (xQueueReceive(disp_ctx->async.ready_queue, &index, portMAX_DELAY) == pdTRUE) {
+        if (index == FLUSH_TASK_EXIT) {
+            break;
+        }
+
+        lvgl_port_flush_job_t* job = &disp_ctx->async.jobs[index];
+        job->transfer_us           = esp_timer_get_time();
+
+        disp_ctx->async.transferring = index;
+        esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, job->area.x1, job->area.y1, job->area.x2 + 1,
+                                  job->area.y2 + 1, disp_ctx->async.buffs[index]);
+        xSemaphoreTake(disp_ctx->async.trans_done, portMAX_DELAY);
+        disp_ctx->async.transferring = -1;
+
+        lvgl_port_flush_stats_add(disp_ctx, job);
+        xQueueSend(disp_ctx->async.free_queue, &index, 0);
+    }
+
+    disp_ctx->async.task = NULL;
+    vTaskDelete(NULL);
+}
+
+static esp_err_t lvgl_port_async_flush_init(lvgl_port_display_ctx_t* disp_ctx, const lvgl_port_display_cfg_t* disp_cfg)
+{
+    ESP_RETURN_ON_FALSE(disp_ctx->draw_buffs[2], ESP_ERR_INVALID_STATE, TAG, "No rotation buffer");
+
+    uint32_t buff_caps = MALLOC_CAP_DMA;
+    if (disp_cfg->flags.buff_spiram) {
+        buff_caps |= MALLOC_CAP_SPIRAM;
+    }
+    size_t align = data_cache_line_size ? data_cache_line_size : CONFIG_LV_DRAW_BUF_ALIGN;
+    size_t size  = ALIGN_UP_BY(disp_cfg->buffer_size * lv_color_format_get_size(LV_COLOR_FORMAT_RGB565), align);
+
+    /* The synchronous rotation buffer is the first of the pool */
+    disp_ctx->async.buffs[0] = disp_ctx->draw_buffs[2];
+    for (int i = 1; i < ROTATE_BUFF_NUM; i++) {
+        disp_ctx->async.buffs[i] = heap_caps_aligned_alloc(align, size, buff_caps);
+        ESP_RETURN_ON_FALSE(disp_ctx->async.buffs[i], ESP_ERR_NO_MEM, TAG,
+                            "Not enough memory for LVGL buffer (async rotation buffer) allocation!");
+    }
+
+    disp_ctx->async.free_queue  = xQueueCreate(ROTATE_BUFF_NUM, sizeof(uint8_t));
+    disp_ctx->async.ready_queue = xQueueCreate(ROTATE_BUFF_NUM + 1, sizeof(uint8_t));
+    disp_ctx->async.trans_done  = xSemaphoreCreateBinary();
+    ESP_RETURN_ON_FALSE(disp_ctx->async.free_queue && disp_ctx->async.ready_queue && disp_ctx->async.trans_done,
+                        ESP_ERR_NO_MEM, TAG, "Failed to create async flush queues");
+
+    for (int i = 0; i < ROTATE_BUFF_NUM; i++) {
+        disp_ctx->async.jobs[i].disp_ctx = disp_ctx;
+        disp_ctx->async.jobs[i].index    = i;
+        uint8_t index                    = i;
+        xQueueSend(disp_ctx->async.free_queue, &index, 0);
+    }
+
+    BaseType_t res = xTaskCreate(lvgl_port_flush_task, "lvgl_flush", FLUSH_TASK_STACK, disp_ctx, FLUSH_TASK_PRIORITY,
+                                 &disp_ctx->async.task);
+    ESP_RETURN_ON_FALSE(res == pdPASS, ESP_FAIL, TAG, "Create LVGL flush task fail!");
+    return ESP_OK;
+}
+#endif
+
+static void lvgl_port_async_flush_deinit(lvgl_port_display_ctx_t* disp_ctx)
+{
+    if (disp_ctx->async.task) {
+        /* Areas still rotating or transferring finish first */
+        lvgl_port_flush_async_drain(disp_ctx);
+        uint8_t exit = FLUSH_TASK_EXIT;
+        xQueueSend(disp_ctx->async.ready_queue, &exit, portMAX_DELAY);
+        while (disp_ctx->async.task) {
+            vTaskDelay(1);
+        }
+    }
+    disp_ctx->flags.async_flush = 0;
+
+    for (int i = 1; i < ROTATE_BUFF_NUM; i++) {
+        if (disp_ctx->async.buffs[i]) {
+            free(disp_ctx->async.buffs[i]);
+            disp_ctx->async.buffs[i] = NULL;
+        }
+    }
+    disp_ctx->async.buffs[0] = NULL;
+
+    if (disp_ctx->async.free_queue) {
+        vQueueDelete(disp_ctx->async.free_queue);
+        disp_ctx->async.free_queue = NULL;
+    }
+    if (disp_ctx->async.ready_queue) {
+        vQueueDelete(disp_ctx->async.ready_queue);
+        disp_ctx->async.ready_queue = NULL;
+    }
+    if (disp_ctx->async.trans_done) {
+        vSemaphoreDelete(disp_ctx->async.trans_done);
+        disp_ctx->async.trans_done = NULL;
+    }
+}
+
+/*******************************************************************************
+ * Direct mode dirty bands
+ *******************************************************************************/
+
+/* The panel takes contiguous pixel data only, so from a screen sized buffer the dirty areas go out as full width row
+ * bands. Bands are aligned to whole cache lines of the buffer, touching or cheap to bridge ones are merged and the
+ * refresh falls back to one full transfer when that is measured to be cheaper. */
+
+static uint32_t lvgl_port_gcd(uint32_t a, uint32_t b)
+{
+    while (b) {
+        uint32_t t = a % b;
+        a          = b;
+        b          = t;
+    }
+    return a;
+}
+
+static esp_err_t lvgl_port_dirty_init(lvgl_port_display_ctx_t* disp_ctx)
+{
+    lv_display_t* disp = disp_ctx->disp_drv;
+    uint32_t stride    = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp),
+                                                     lv_display_get_color_format(disp));
+    uint32_t line      = data_cache_line_size ? data_cache_line_size : CONFIG_LV_DRAW_BUF_ALIGN;
+
+    disp_ctx->dirty.rows_align  = line / lvgl_port_gcd(stride, line);
+    disp_ctx->dirty.overhead_us = 20.0f;
+    disp_ctx->dirty.us_per_byte = 0.005f; /* PSRAM to PSRAM copy, refined by the first full refresh */
+    disp_ctx->dirty.done        = xSemaphoreCreateBinary();
+    ESP_RETURN_ON_FALSE(disp_ctx->dirty.done, ESP_ERR_NO_MEM, TAG, "Failed to create dirty band semaphore");
+
+    BaseType_t res = xTaskCreate(lvgl_port_dirty_task, "lvgl_flush", FLUSH_TASK_STACK, disp_ctx, FLUSH_TASK_PRIORITY,
+                                 &disp_ctx->dirty.task);
+    ESP_RETURN_ON_FALSE(res == pdPASS, ESP_FAIL, TAG, "Create LVGL flush task fail!");
+    return ESP_OK;
+}
+
+static void lvgl_port_dirty_deinit(lvgl_port_display_ctx_t* disp_ctx)
+{
+    if (disp_ctx->dirty.task) {
+        /* A refresh being sent finishes first */
+        disp_ctx->dirty.exit = true;
+        xTaskNotifyGive(disp_ctx->dirty.task);
+        while (disp_ctx->dirty.task) {
+            vTaskDelay(1);
+        }
+    }
+    if (disp_ctx->dirty.done) {
+        vSemaphoreDelete(disp_ctx->dirty.done);
+        disp_ctx->dirty.done = NULL;
+    }
+}
+
+/* Merge neighbours closer than gap_rows, the bands are kept sorted */
+static void lvgl_port_dirty_coalesce(lvgl_port_display_ctx_t* disp_ctx, int32_t gap_rows)
+{
+    uint32_t out = 0;
+    for (uint32_t i = 1; i < disp_ctx->dirty.count; i++) {
+        if (disp_ctx->dirty.bands[i].y1 <= disp_ctx->dirty.bands[out].y2 + 1 + gap_rows) {
+            disp_ctx->dirty.bands[out].y2 = LV_MAX(disp_ctx->dirty.bands[out].y2, disp_ctx->dirty.bands[i].y2);
+        } else {
+            disp_ctx->dirty.bands[++out] = disp_ctx->dirty.bands[i];
+        }
+    }
+    if (disp_ctx->dirty.count) {
+        disp_ctx->dirty.count = out + 1;
+    }
+}
+
+static void lvgl_port_dirty_add(lvgl_port_display_ctx_t* disp_ctx, const lv_area_t* area)
+{
+    int32_t align = disp_ctx->dirty.rows_align;
+    int32_t vres  = lv_display_get_vertical_resolution(disp_ctx->disp_drv);
+    int32_t y1    = area->y1 / align * align;
+    int32_t y2    = LV_MIN((area->y2 / align + 1) * align, vres) - 1;
+
+    /* Full, give up the narrowest gap */
+    if (disp_ctx->dirty.count == DIRTY_BAND_NUM) {
+        uint32_t best = 0;
+        for (uint32_t i = 1; i + 1 < DIRTY_BAND_NUM; i++) {
+            if (disp_ctx->dirty.bands[i + 1].y1 - disp_ctx->dirty.bands[i].y2 <
+                disp_ctx->dirty.bands[best + 1].y1 - disp_ctx->dirty.bands[best].y2) {
+                best = i;
+            }
+        }
+        disp_ctx->dirty.bands[best].y2 = disp_ctx->dirty.bands[best + 1].y2;
+        memmove(&disp_ctx->dirty.bands[best + 1], &disp_ctx->dirty.bands[best + 2],
+                (DIRTY_BAND_NUM - best - 2) * sizeof(disp_ctx->dirty.bands[0]));
+        disp_ctx->dirty.count--;
+    }
+
+    uint32_t i = disp_ctx->dirty.count;
+    while (i > 0 && disp_ctx->dirty.bands[i - 1].y1 > y1) {
+        disp_ctx->dirty.bands[i] = disp_ctx->dirty.bands[i - 1];
+        i--;
+    }
+    disp_ctx->dirty.bands[i].y1 = y1;
+    disp_ctx->dirty.bands[i].y2 = y2;
+    disp_ctx->dirty.count++;
+    lvgl_port_dirty_coalesce(disp_ctx, 0);
+}
+
+/* Fit the cost model, small transfers tell the overhead and large ones the per-byte cost */
+static void lvgl_port_dirty_learn(lvgl_port_display_ctx_t* disp_ctx, uint32_t bytes, float us)
+{
+    if (bytes >= DIRTY_LEARN_LARGE) {
+        /* A transfer faster than the overhead estimate would pull the per-byte cost to zero */
+        float per_byte              = LV_MAX(us - disp_ctx->dirty.overhead_us, 0.0f) / bytes;
+        disp_ctx->dirty.us_per_byte = LV_MAX(0.9f * disp_ctx->dirty.us_per_byte + 0.1f * per_byte,
+                                             DIRTY_MIN_US_PER_BYTE);
+    } else if (bytes <= DIRTY_LEARN_SMALL) {
+        float overhead              = LV_MAX(us - disp_ctx->dirty.us_per_byte * bytes, 0.0f);
+        disp_ctx->dirty.overhead_us = 0.9f * disp_ctx->dirty.overhead_us + 0.1f * overhead;
+    }
+}
+
+/* Send the refresh's bands, or the whole frame if that costs less, returns the bytes sent */
+static uint32_t lvgl_port_dirty_send(lvgl_port_display_ctx_t* disp_ctx, uint8_t* color_map)
+{
+    lv_display_t* disp = disp_ctx->disp_drv;
+    int32_t hres       = lv_display_get_horizontal_resolution(disp);
+    int32_t vres       = lv_display_get_vertical_resolution(disp);
+    uint32_t stride    = lv_draw_buf_width_to_stride(hres, lv_display_get_color_format(disp));
+
+    /* Bridge gaps that cost less to send than another call */
+    float gap_rows = disp_ctx->dirty.overhead_us / (disp_ctx->dirty.us_per_byte * stride);
+    lvgl_port_dirty_coalesce(disp_ctx, (int32_t)LV_CLAMP(0.0f, gap_rows, (float)vres));
+
+    uint32_t dirty_bytes = 0;
+    for (uint32_t i = 0; i < disp_ctx->dirty.count; i++) {
+        dirty_bytes += (disp_ctx->dirty.bands[i].y2 - disp_ctx->dirty.bands[i].y1 + 1) * stride;
+    }
+    float partial_us = disp_ctx->dirty.count * disp_ctx->dirty.overhead_us + dirty_bytes * disp_ctx->dirty.us_per_byte;
+    float full_us    = disp_ctx->dirty.overhead_us + (float)vres * stride * disp_ctx->dirty.us_per_byte;
+    bool full        = disp_ctx->dirty.count == 0 || full_us <= partial_us;
+    if (full) {
+        disp_ctx->dirty.count       = 1;
+        disp_ctx->dirty.bands[0].y1 = 0;
+        disp_ctx->dirty.bands[0].y2 = vres - 1;
+    }
+
+    uint32_t sent = 0;
+    for (uint32_t i = 0; i < disp_ctx->dirty.count; i++) {
+        int32_t y1     = disp_ctx->dirty.bands[i].y1;
+        int32_t y2     = disp_ctx->dirty.bands[i].y2;
+        uint32_t bytes = (y2 - y1 + 1) * stride;
+
+        xSemaphoreTake(disp_ctx->dirty.done, 0); /* Stale give from a frame sent whole */
+        int64_t start_us = esp_timer_get_time();
+        esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, 0, y1, hres, y2 + 1, color_map + y1 * stride);
+        if (xSemaphoreTake(disp_ctx->dirty.done, pdMS_TO_TICKS(DIRTY_BAND_TIMEOUT_MS)) != pdTRUE) {
+            ESP_LOGW(TAG, "Band transfer timed out");
+        }
+        lvgl_port_dirty_learn(disp_ctx, bytes, (float)(esp_timer_get_time() - start_us));
+        sent += bytes;
+    }
+    disp_ctx->dirty.count = 0;
+
+    portENTER_CRITICAL(&disp_ctx->stats_lock);
+    if (full) {
+        disp_ctx->stats.full_refreshes++;
+    } else {
+        disp_ctx->stats.partial_refreshes++;
+    }
+    portEXIT_CRITICAL(&disp_ctx->stats_lock);
+    return sent;
+}
+
+/* Sends each direct mode refresh in the background, the LVGL task only waits for it before drawing the next one */
+static void lvgl_port_dirty_task(void* arg)
+{
+    lvgl_port_display_ctx_t* disp_ctx = (lvgl_port_display_ctx_t*)arg;
+    lvgl_port_flush_job_t* job        = &disp_ctx->sync_job;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (disp_ctx->dirty.exit) {
+            break;
+        }
+
+        job->bytes   = lvgl_port_dirty_send(disp_ctx, disp_ctx->dirty.color_map);
+        job->done_us = esp_timer_get_time();
+        lvgl_port_flush_stats_add(disp_ctx, job);
+        lv_disp_flush_ready(disp_ctx->disp_drv);
+    }
+
+    disp_ctx->dirty.task = NULL;
+    vTaskDelete(NULL);
+}
@@ -18,6 +18,11 @@ float fast_log(float x);
 float fast_log2(float x);
 float fast_powf(float a, float b);
 void fast_get_min_max(float *data, size_t data_len, float *p_min, float *p_max);
+void fast_get_min_max_u8(const uint8_t *data, size_t data_len, uint8_t *p_min, uint8_t *p_max);
+
+// 数组版本（可向量化），dst 不能与输入重叠
+void fast_expf_v(const float *__restrict src, float *__restrict dst, size_t len);
+void fast_atan2f_v(const float *__restrict y, const float *__restrict x, float *__restrict dst, size_t len);
 
 // 快速平方根函数
 static inline float fast_sqrtf(float x)
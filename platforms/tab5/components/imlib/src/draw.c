@@ -83,6 +83,162 @@ void imlib_set_pixel(image_t *img, int x, int y, int p)
     }
 }
 
+// Span fills. Clipping and the format switch happen once per run of pixels instead of once per pixel, which is what
+// makes filled shapes and thick outlines cheap enough to draw over every camera frame. The *_fmt helpers take the
+// pixel format as an argument so that, called with a constant, the compiler drops the switch from the inner loops.
+
+/**
+ * 一行的字节数
+ */
+static inline __attribute__((always_inline)) int row_stride(const image_t *img, uint32_t pixfmt)
+{
+    switch (pixfmt) {
+        case PIXFORMAT_BINARY: {
+            return IMAGE_BINARY_LINE_LEN_BYTES(img);
+        }
+        case PIXFORMAT_GRAYSCALE: {
+            return IMAGE_GRAYSCALE_LINE_LEN_BYTES(img);
+        }
+        case PIXFORMAT_RGB565: {
+            return IMAGE_RGB565_LINE_LEN_BYTES(img);
+        }
+        default: {
+            return 0;
+        }
+    }
+}
+
+/**
+ * 填充二值图像一行中 [x0, x1] 的像素（已裁剪）
+ */
+static inline void fill_binary_span(uint32_t *row, int x0, int x1, int c)
+{
+    const int i0      = x0 >> UINT32_T_SHIFT;
+    const int i1      = x1 >> UINT32_T_SHIFT;
+    const uint32_t m0 = UINT32_MAX << (x0 & UINT32_T_MASK);
+    const uint32_t m1 = UINT32_MAX >> (UINT32_T_MASK - (x1 & UINT32_T_MASK));
+    const uint32_t v  = (c & 1) ? UINT32_MAX : 0;
+
+    if (i0 == i1) {
+        row[i0] = (row[i0] & ~(m0 & m1)) | (v & m0 & m1);
+        return;
+    }
+    row[i0] = (row[i0] & ~m0) | (v & m0);
+    for (int i = i0 + 1; i < i1; i++) {
+        row[i] = v;
+    }
+    row[i1] = (row[i1] & ~m1) | (v & m1);
+}
+
+/**
+ * 填充 RGB565 图像一行中 [x0, x1] 的像素（已裁剪）
+ */
+static inline void fill_rgb565_span(uint16_t *row, int x0, int x1, int c)
+{
+    // Two pixels a store once the pointer is word aligned
+    uint16_t *ptr = row + x0;
+    int n         = x1 - x0 + 1;
+    if (((uintptr_t)ptr & 2) && n > 0) {
+        *ptr++ = c;
+        n--;
+    }
+    const uint32_t pair = ((uint32_t)(uint16_t)c << 16) | (uint16_t)c;
+    for (; n >= 2; n -= 2, ptr += 2) {
+        memcpy(ptr, &pair, sizeof(pair));
+    }
+    if (n > 0) {
+        *ptr = c;
+    }
+}
+
+/**
+ * 填充一行中 [x0, x1] 的像素（已裁剪）
+ */
+static inline __attribute__((always_inline)) void fill_row_fmt(void *row, int x0, int x1, int c, uint32_t pixfmt)
+{
+    switch (pixfmt) {
+        case PIXFORMAT_BINARY: {
+            if (x0 == x1) {
+                IMAGE_PUT_BINARY_PIXEL_FAST((uint32_t *)row, x0, c);
+            } else {
+                fill_binary_span((uint32_t *)row, x0, x1, c);
+            }
+            break;
+        }
+        case PIXFORMAT_GRAYSCALE: {
+            if (x0 == x1) {
+                IMAGE_PUT_GRAYSCALE_PIXEL_FAST((uint8_t *)row, x0, c);
+            } else {
+                memset((uint8_t *)row + x0, c, x1 - x0 + 1);
+            }
+            break;
+        }
+        case PIXFORMAT_RGB565: {
+            if (x0 == x1) {
+                IMAGE_PUT_RGB565_PIXEL_FAST((uint16_t *)row, x0, c);
+            } else {
+                fill_rgb565_span((uint16_t *)row, x0, x1, c);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+/**
+ * 填充矩形 [x0, x1] x [y0, y1]（含边界，自动裁剪）
+ */
+static inline __attribute__((always_inline)) void fill_rect_fmt(image_t *img, int x0, int y0, int x1, int y1, int c,
+                                                                uint32_t pixfmt)
+{
+    x0 = IM_MAX(x0, 0);
+    y0 = IM_MAX(y0, 0);
+    x1 = IM_MIN(x1, img->w - 1);
+    y1 = IM_MIN(y1, img->h - 1);
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+
+    const int stride = row_stride(img, pixfmt);
+    uint8_t *row     = img->data + (y0 * stride);
+    for (int y = y0; y <= y1; y++, row += stride) {
+        fill_row_fmt(row, x0, x1, c, pixfmt);
+    }
+}
+
+static void fill_rect(image_t *img, int x0, int y0, int x1, int y1, int c)
+{
+    switch (img->pixfmt) {
+        case PIXFORMAT_BINARY: {
+            fill_rect_fmt(img, x0, y0, x1, y1, c, PIXFORMAT_BINARY);
+            break;
+        }
+        case PIXFORMAT_GRAYSCALE: {
+            fill_rect_fmt(img, x0, y0, x1, y1, c, PIXFORMAT_GRAYSCALE);
+            break;
+        }
+        case PIXFORMAT_RGB565: {
+            fill_rect_fmt(img, x0, y0, x1, y1, c, PIXFORMAT_RGB565);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+static void xLine(image_t *img, int x1, int x2, int y, int c)
+{
+    fill_rect(img, x1, y, x2, y, c);
+}
+
+static void yLine(image_t *img, int x, int y1, int y2, int c)
+{
+    fill_rect(img, x, y1, x, y2, c);
+}
+
 // https://stackoverflow.com/questions/1201200/fast-algorithm-for-drawing-filled-circles
 /**
  * 填充一个圆形区域
@@ -103,35 +259,28 @@ static void point_fill(image_t *img, int cx, int cy, int r0, int r1, int c)
 }
 
 /**
- * 设置图像中的单个像素点的颜色，支持抗锯齿(anti-aliasing)效果。
- * @param img：目标图像，类型为 image_t，包含图像宽度、高度、像素格式等信息。
- * @param x, y：待设置的像素位置。
- * @param err：混合系数，范围从 0 到 255，表示新颜色 c 所占的比例。较大的 err 值表示原始颜色占的比重较大。
- * @param c：新颜色值，其具体含义因像素格式而异。
+ * 按混合系数把颜色 c 混合到一行中的第 x 个像素，像素格式为 pixfmt。
+ * 调用方传入常量 pixfmt 时编译器会去掉格式分支。
  */
-static void imlib_set_pixel_aa(image_t *img, int x, int y, int err, int c)
+static inline __attribute__((always_inline)) void blend_pixel(void *row, int x, int err, int c, uint32_t pixfmt)
 {
-    if (!((0 <= x) && (x < img->w) && (0 <= y) && (y < img->h))) {
-        return;
-    }
-
-    switch (img->pixfmt) {
+    switch (pixfmt) {
         case PIXFORMAT_BINARY: {
-            uint32_t *ptr = IMAGE_COMPUTE_BINARY_PIXEL_ROW_PTR(img, y);
+            uint32_t *ptr = (uint32_t *)row;
             int old_c     = IMAGE_GET_BINARY_PIXEL_FAST(ptr, x) * 255;
             int new_c     = (((old_c * err) + ((c ? 255 : 0) * (256 - err))) >> 8) > 127;
             IMAGE_PUT_BINARY_PIXEL_FAST(ptr, x, new_c);
             break;
         }
         case PIXFORMAT_GRAYSCALE: {
-            uint8_t *ptr = IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(img, y);
+            uint8_t *ptr = (uint8_t *)row;
             int old_c    = IMAGE_GET_GRAYSCALE_PIXEL_FAST(ptr, x);
             int new_c    = ((old_c * err) + ((c & 0xff) * (256 - err))) >> 8;
             IMAGE_PUT_GRAYSCALE_PIXEL_FAST(ptr, x, new_c);
             break;
         }
         case PIXFORMAT_RGB565: {
-            uint16_t *ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(img, y);
+            uint16_t *ptr = (uint16_t *)row;
             int old_c     = IMAGE_GET_RGB565_PIXEL_FAST(ptr, x);
             int old_c_r5  = COLOR_RGB565_TO_R5(old_c);
             int old_c_g6  = COLOR_RGB565_TO_G6(old_c);
@@ -152,11 +301,56 @@ static void imlib_set_pixel_aa(image_t *img, int x, int y, int err, int c)
     }
 }
 
+/**
+ * 设置图像中的单个像素点的颜色，支持抗锯齿(anti-aliasing)效果。
+ * @param img：目标图像，类型为 image_t，包含图像宽度、高度、像素格式等信息。
+ * @param x, y：待设置的像素位置。
+ * @param err：混合系数，范围从 0 到 255，表示新颜色 c 所占的比例。较大的 err 值表示原始颜色占的比重较大。
+ * @param c：新颜色值，其具体含义因像素格式而异。
+ */
+static void imlib_set_pixel_aa(image_t *img, int x, int y, int err, int c)
+{
+    if (!((0 <= x) && (x < img->w) && (0 <= y) && (y < img->h))) {
+        return;
+    }
+
+    switch (img->pixfmt) {
+        case PIXFORMAT_BINARY: {
+            blend_pixel(IMAGE_COMPUTE_BINARY_PIXEL_ROW_PTR(img, y), x, err, c, PIXFORMAT_BINARY);
+            break;
+        }
+        case PIXFORMAT_GRAYSCALE: {
+            blend_pixel(IMAGE_COMPUTE_GRAYSCALE_PIXEL_ROW_PTR(img, y), x, err, c, PIXFORMAT_GRAYSCALE);
+            break;
+        }
+        case PIXFORMAT_RGB565: {
+            blend_pixel(IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(img, y), x, err, c, PIXFORMAT_RGB565);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+/**
+ * 同 imlib_set_pixel_aa，像素格式由调用方给出
+ */
+static inline __attribute__((always_inline)) void set_pixel_aa_fmt(image_t *img, int x, int y, int err, int c,
+                                                                   uint32_t pixfmt)
+{
+    if ((0 <= x) && (x < img->w) && (0 <= y) && (y < img->h)) {
+        blend_pixel(img->data + (y * row_stride(img, pixfmt)), x, err, c, pixfmt);
+    }
+}
+
 // https://gist.github.com/randvoorhies/807ce6e20840ab5314eb7c547899de68#file-bresenham-js-L381
 /**
  * 画线
+ * 行指针只在 y 方向步进时移动一个行跨度，不再逐像素计算地址
  */
-static void imlib_draw_thin_line(image_t *img, int x0, int y0, int x1, int y1, int c)
+static inline __attribute__((always_inline)) void draw_thin_line_fmt(image_t *img, int x0, int y0, int x1, int y1,
+                                                                     int c, uint32_t pixfmt)
 {
     const int dx = abs(x1 - x0);
     const int sx = x0 < x1 ? 1 : -1;
@@ -166,9 +360,13 @@ static void imlib_draw_thin_line(image_t *img, int x0, int y0, int x1, int y1, i
     int e2, x2;  // error value e_xy
     int ed = dx + dy == 0 ? 1 : fast_floorf(fast_sqrtf(dx * dx + dy * dy));
 
+    // The end points are clipped, so only the anti-aliasing neighbours can fall outside
+    const int stride = row_stride(img, pixfmt);
+    uint8_t *row     = img->data + (y0 * stride);
+
     for (;;) {
         // pixel loop
-        imlib_set_pixel_aa(img, x0, y0, 256 * abs(err - dx + dy) / ed, c);
+        blend_pixel(row, x0, 256 * abs(err - dx + dy) / ed, c, pixfmt);
         e2 = err;
         x2 = x0;
         if (2 * e2 >= -dx) {
@@ -176,8 +374,8 @@ static void imlib_draw_thin_line(image_t *img, int x0, int y0, int x1, int y1, i
             if (x0 == x1) {
                 break;
             }
-            if (e2 + dy < ed) {
-                imlib_set_pixel_aa(img, x0, y0 + sy, 256 * (e2 + dy) / ed, c);
+            if ((e2 + dy < ed) && (0 <= y0 + sy) && (y0 + sy < img->h)) {
+                blend_pixel(row + (sy * stride), x0, 256 * (e2 + dy) / ed, c, pixfmt);
             }
             err -= dy;
             x0 += sx;
@@ -187,31 +385,23 @@ static void imlib_draw_thin_line(image_t *img, int x0, int y0, int x1, int y1, i
             if (y0 == y1) {
                 break;
             }
-            if (dx - e2 < ed) {
-                imlib_set_pixel_aa(img, x2 + sx, y0, 256 * (dx - e2) / ed, c);
+            if ((dx - e2 < ed) && (0 <= x2 + sx) && (x2 + sx < img->w)) {
+                blend_pixel(row, x2 + sx, 256 * (dx - e2) / ed, c, pixfmt);
             }
             err += dx;
             y0 += sy;
+            row += sy * stride;
         }
     }
 }
 
 // https://gist.github.com/randvoorhies/807ce6e20840ab5314eb7c547899de68#file-bresenham-js-L813
 /**
- * 画线
+ * 画粗线，每一行（或列）线上的像素按一段填充
  */
-void imlib_draw_line(image_t *img, int x0, int y0, int x1, int y1, int c, int th)
+static inline __attribute__((always_inline)) void draw_thick_line_fmt(image_t *img, int x0, int y0, int x1, int y1,
+                                                                      int c, int th, uint32_t pixfmt)
 {
-    line_t line = {x0, y0, x1, y1};
-    if (!lb_clip_line(&line, 0, 0, img->w, img->h)) {
-        return;
-    }
-
-    x0 = line.x1;
-    y0 = line.y1;
-    x1 = line.x2;
-    y1 = line.y2;
-
     // plot an anti-aliased line of width th pixel
     const int ex = abs(x1 - x0);
     const int sx = x0 < x1 ? 1 : -1;
@@ -219,10 +409,6 @@ void imlib_draw_line(image_t *img, int x0, int y0, int x1, int y1, int c, int th
     const int sy = y0 < y1 ? 1 : -1;
     int e2       = fast_floorf(fast_sqrtf(ex * ex + ey * ey));  // length
 
-    if (th <= 1 || e2 == 0) {
-        return imlib_draw_thin_line(img, x0, y0, x1, y1, c);  // assert
-    }
-
     int dx = ex * 256 / e2;
     int dy = ey * 256 / e2;
     th     = 256 * (th - 1);  // scale values
@@ -232,13 +418,16 @@ void imlib_draw_line(image_t *img, int x0, int y0, int x1, int y1, int c, int th
         x1      = (e2 + th / 2) / dy;  // start offset
         int err = x1 * dy - th / 2;    // shift error value to offset width
         for (x0 -= x1 * sx;; y0 += sy) {
-            x1 = x0;
-            imlib_set_pixel_aa(img, x1, y0, err, c);  // aliasing pre-pixel
-            for (e2 = dy - err - th; e2 + dy < 256; e2 += dy) {
-                x1 += sx;
-                imlib_set_pixel(img, x1, y0, c);  // pixel on the line
+            set_pixel_aa_fmt(img, x0, y0, err, c, pixfmt);  // aliasing pre-pixel
+            // Pixels on the line, as many as stepping e2 by dy takes to reach 256
+            e2          = dy - err - th;
+            const int n = (e2 + dy < 256) ? (255 - e2) / dy : 0;
+            e2         += n * dy;
+            x1          = x0 + (n * sx);
+            if (n > 0) {
+                fill_rect_fmt(img, IM_MIN(x0 + sx, x1), y0, IM_MAX(x0 + sx, x1), y0, c, pixfmt);
             }
-            imlib_set_pixel_aa(img, x1 + sx, y0, e2, c);  // aliasing post-pixel
+            set_pixel_aa_fmt(img, x1 + sx, y0, e2, c, pixfmt);  // aliasing post-pixel
             if (y0 == y1) {
                 break;
             }
@@ -253,13 +442,16 @@ void imlib_draw_line(image_t *img, int x0, int y0, int x1, int y1, int c, int th
         y1      = (e2 + th / 2) / dx;  // start offset
         int err = y1 * dx - th / 2;    // shift error value to offset width
         for (y0 -= y1 * sy;; x0 += sx) {
-            y1 = y0;
-            imlib_set_pixel_aa(img, x0, y1, err, c);  // aliasing pre-pixel
-            for (e2 = dx - err - th; e2 + dx < 256; e2 += dx) {
-                y1 += sy;
-                imlib_set_pixel(img, x0, y1, c);  // pixel on the line
+            set_pixel_aa_fmt(img, x0, y0, err, c, pixfmt);  // aliasing pre-pixel
+            // Pixels on the line, as many as stepping e2 by dx takes to reach 256
+            e2          = dx - err - th;
+            const int n = (e2 + dx < 256) ? (255 - e2) / dx : 0;
+            e2         += n * dx;
+            y1          = y0 + (n * sy);
+            if (n > 0) {
+                fill_rect_fmt(img, x0, IM_MIN(y0 + sy, y1), x0, IM_MAX(y0 + sy, y1), c, pixfmt);
             }
-            imlib_set_pixel_aa(img, x0, y1 + sy, e2, c);  // aliasing post-pixel
+            set_pixel_aa_fmt(img, x0, y1 + sy, e2, c, pixfmt);  // aliasing post-pixel
             if (x0 == x1) {
                 break;
             }
@@ -272,6 +464,57 @@ void imlib_draw_line(image_t *img, int x0, int y0, int x1, int y1, int c, int th
     }
 }
 
+/**
+ * 画线
+ */
+void imlib_draw_line(image_t *img, int x0, int y0, int x1, int y1, int c, int th)
+{
+    line_t line = {x0, y0, x1, y1};
+    if (!lb_clip_line(&line, 0, 0, img->w, img->h)) {
+        return;
+    }
+
+    x0 = line.x1;
+    y0 = line.y1;
+    x1 = line.x2;
+    y1 = line.y2;
+
+    const int ex    = abs(x1 - x0);
+    const int ey    = abs(y1 - y0);
+    const bool thin = th <= 1 || fast_floorf(fast_sqrtf(ex * ex + ey * ey)) == 0;
+
+    // One copy of each loop per format, the format is looked at once per line
+    switch (img->pixfmt) {
+        case PIXFORMAT_BINARY: {
+            if (thin) {
+                draw_thin_line_fmt(img, x0, y0, x1, y1, c, PIXFORMAT_BINARY);
+            } else {
+                draw_thick_line_fmt(img, x0, y0, x1, y1, c, th, PIXFORMAT_BINARY);
+            }
+            break;
+        }
+        case PIXFORMAT_GRAYSCALE: {
+            if (thin) {
+                draw_thin_line_fmt(img, x0, y0, x1, y1, c, PIXFORMAT_GRAYSCALE);
+            } else {
+                draw_thick_line_fmt(img, x0, y0, x1, y1, c, th, PIXFORMAT_GRAYSCALE);
+            }
+            break;
+        }
+        case PIXFORMAT_RGB565: {
+            if (thin) {
+                draw_thin_line_fmt(img, x0, y0, x1, y1, c, PIXFORMAT_RGB565);
+            } else {
+                draw_thick_line_fmt(img, x0, y0, x1, y1, c, th, PIXFORMAT_RGB565);
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
 /**
  * 画线
  */
@@ -296,45 +539,25 @@ void imlib_draw_arrow(image_t *img, int x0, int y0, int x1, int y1, int c, int t
     imlib_draw_line(img, x1, y1, a1x, a1y, c, th);
 }
 
-static void xLine(image_t *img, int x1, int x2, int y, int c)
-{
-    while (x1 <= x2) {
-        imlib_set_pixel(img, x1++, y, c);
-    }
-}
-
-static void yLine(image_t *img, int x, int y1, int y2, int c)
-{
-    while (y1 <= y2) {
-        imlib_set_pixel(img, x, y1++, c);
-    }
-}
-
 /**
  * 画矩形
  */
 void imlib_draw_rectangle(image_t *img, int rx, int ry, int rw, int rh, int c, int thickness, bool fill)
 {
     if (fill) {
-        for (int y = ry, yy = ry + rh; y < yy; y++) {
-            for (int x = rx, xx = rx + rw; x < xx; x++) {
-                imlib_set_pixel(img, x, y, c);
-            }
-        }
+        fill_rect(img, rx, ry, rx + rw - 1, ry + rh - 1, c);
 
     } else if (thickness > 0) {
         int thickness0 = (thickness - 0) / 2;
         int thickness1 = (thickness - 1) / 2;
-
-        for (int i = rx - thickness0, j = rx + rw + thickness1, k = ry + rh - 1; i < j; i++) {
-            yLine(img, i, ry - thickness0, ry + thickness1, c);
-            yLine(img, i, k - thickness0, k + thickness1, c);
-        }
-
-        for (int i = ry - thickness0, j = ry + rh + thickness1, k = rx + rw - 1; i < j; i++) {
-            xLine(img, rx - thickness0, rx + thickness1, i, c);
-            xLine(img, k - thickness0, k + thickness1, i, c);
-        }
+        int right      = rx + rw - 1;
+        int bottom     = ry + rh - 1;
+
+        // Top and bottom bands, then the left and right ones
+        fill_rect(img, rx - thickness0, ry - thickness0, right + thickness1, ry + thickness1, c);
+        fill_rect(img, rx - thickness0, bottom - thickness0, right + thickness1, bottom + thickness1, c);
+        fill_rect(img, rx - thickness0, ry - thickness0, rx + thickness1, bottom + thickness1, c);
+        fill_rect(img, right - thickness0, ry - thickness0, right + thickness1, bottom + thickness1, c);
     }
 }
 
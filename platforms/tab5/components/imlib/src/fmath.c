@@ -118,7 +118,8 @@ float fast_atan2f(float y, float x)
         return 2 * M_PI - fast_atanf(-y / x);
     }
 
-    return (y == 0) ? 0 : ((y > 0) ? M_PI : -M_PI);
+    // On the y axis, same [0, 2pi) range as the quadrants above
+    return (y == 0) ? 0 : ((y > 0) ? M_PI_2 : 3 * M_PI_2);
 }
 
 float fast_log2(float x)
@@ -154,10 +155,58 @@ float fast_powf(float a, float b)
 
 void fast_get_min_max(float *data, size_t data_len, float *p_min, float *p_max)
 {
-    float min = FLT_MAX, max = -FLT_MAX;
+    // Eight independent running min/max, so a block is a compare and select per lane with no loop carried branch
+    float min[8], max[8];
+    for (int j = 0; j < 8; j++) {
+        min[j] = FLT_MAX;
+        max[j] = -FLT_MAX;
+    }
 
-    for (size_t i = 0; i < data_len; i++) {
+    size_t i = 0;
+    for (; i + 8 <= data_len; i += 8) {
+        for (int j = 0; j < 8; j++) {
+            float temp = data[i + j];
+            min[j]     = (temp < min[j]) ? temp : min[j];
+            max[j]     = (temp > max[j]) ? temp : max[j];
+        }
+    }
+    for (; i < data_len; i++) {
         float temp = data[i];
+        min[0]     = (temp < min[0]) ? temp : min[0];
+        max[0]     = (temp > max[0]) ? temp : max[0];
+    }
+
+    for (int j = 1; j < 8; j++) {
+        min[0] = (min[j] < min[0]) ? min[j] : min[0];
+        max[0] = (max[j] > max[0]) ? max[j] : max[0];
+    }
+
+    *p_min = min[0];
+    *p_max = max[0];
+}
+
+void fast_get_min_max_u8(const uint8_t *data, size_t data_len, uint8_t *p_min, uint8_t *p_max)
+{
+    uint8_t min = UINT8_MAX, max = 0;
+
+    // Integer min/max is an exact reduction, a fixed block length lets it vectorize even where the compiler will not
+    // emit a remainder loop for an unknown one (GCC at -O2)
+    size_t i = 0;
+    for (; i + 256 <= data_len; i += 256) {
+        for (int j = 0; j < 256; j++) {
+            uint8_t temp = data[i + j];
+
+            if (temp < min) {
+                min = temp;
+            }
+
+            if (temp > max) {
+                max = temp;
+            }
+        }
+    }
+    for (; i < data_len; i++) {
+        uint8_t temp = data[i];
 
         if (temp < min) {
             min = temp;
@@ -171,3 +220,93 @@ void fast_get_min_max(float *data, size_t data_len, float *p_min, float *p_max)
     *p_min = min;
     *p_max = max;
 }
+
+/*
+ * Array versions. The loop bodies have no branches, unions or calls, so GCC and Clang vectorize them where the target
+ * has vector registers, and where it has none each element still costs a straight run of instructions. Like
+ * fast_get_min_max_u8 they run in blocks of a fixed length: GCC at -O2 only vectorizes a loop whose trip count needs
+ * no remainder, the tail goes through the same code one element at a time.
+ */
+#define FAST_V_BLOCK 16
+
+// a if cond else b as a bit mask, a ternary would be lowered to a branch the vectorizer cannot take with floating
+// point traps enabled
+static inline float select_f(int cond, float a, float b)
+{
+    uint32_t ua, ub;
+    memcpy(&ua, &a, sizeof(ua));
+    memcpy(&ub, &b, sizeof(ub));
+    const uint32_t mask = -(uint32_t)(cond != 0);
+    const uint32_t ur   = (ua & mask) | (ub & ~mask);
+    float r;
+    memcpy(&r, &ur, sizeof(r));
+    return r;
+}
+
+// Same bit manipulation as fast_expf on plain integers, and the same result for any x where float exp is finite
+static inline __attribute__((always_inline)) float expf_element(float x)
+{
+    uint32_t l      = (uint32_t)(int32_t)(1512775 * x + 1072632447);
+    uint32_t packed = (l & 0x80000000) | ((((l >> 20) - 1023 + 127) & 0xFF) << 23) | ((l & 0xFFFFF) << 3);
+    float r;
+    memcpy(&r, &packed, sizeof(r));
+    return r;
+}
+
+// fast_atan2f without branches, the range reduction of fast_atanf is done on |y| / |x| and the quadrant put back after
+static inline __attribute__((always_inline)) float atan2f_element(float y, float x)
+{
+    const float ax = fabsf(x);
+    const float ay = fabsf(y);
+
+    // fast_atanf reduces t = ay / ax to -1 / t or (t - 1) / (t + 1) above tan(3pi/8) and tan(pi/8). Written over ay
+    // and ax each reduction is one quotient, so the numerator and denominator are picked and divided once.
+    const int hi    = ay > 2.414213562373095f * ax;
+    const int mid   = ay > 0.4142135623730950f * ax;
+    const float num = select_f(hi, -ax, select_f(mid, ay - ax, ay));
+    const float den = select_f(hi, ay, select_f(mid, ay + ax, ax));
+    const float r   = num / den;
+    float a         = select_f(hi, (float)M_PI_2, select_f(mid, (float)M_PI_4, 0.0f));
+
+    const float z = r * r;
+    const float p = ((8.05374449538e-2f * z - 1.38776856032E-1f) * z + 1.99777106478E-1f) * z - 3.33329491539E-1f;
+    a += p * z * r + r;
+
+    const int xn     = x < 0;
+    const int yn     = y < 0;
+    const float base = select_f(xn, (float)M_PI, select_f(yn, (float)(2 * M_PI), 0.0f));
+    const float q    = base + select_f(xn != yn, -a, a);
+    return select_f((ax == 0) & (ay == 0), 0.0f, q);
+}
+
+/**
+ * fast_expf over an array
+ */
+void fast_expf_v(const float *__restrict src, float *__restrict dst, size_t len)
+{
+    size_t i = 0;
+    for (; i + FAST_V_BLOCK <= len; i += FAST_V_BLOCK) {
+        for (int j = 0; j < FAST_V_BLOCK; j++) {
+            dst[i + j] = expf_element(src[i + j]);
+        }
+    }
+    for (; i < len; i++) {
+        dst[i] = expf_element(src[i]);
+    }
+}
+
+/**
+ * fast_atan2f over an array, result in [0, 2pi) like fast_atan2f
+ */
+void fast_atan2f_v(const float *__restrict y, const float *__restrict x, float *__restrict dst, size_t len)
+{
+    size_t i = 0;
+    for (; i + FAST_V_BLOCK <= len; i += FAST_V_BLOCK) {
+        for (int j = 0; j < FAST_V_BLOCK; j++) {
+            dst[i + j] = atan2f_element(y[i + j], x[i + j]);
+        }
+    }
+    for (; i < len; i++) {
+        dst[i] = atan2f_element(y[i], x[i]);
+    }
+}
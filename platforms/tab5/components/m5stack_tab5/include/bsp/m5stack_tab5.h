@@ -311,6 +311,8 @@ typedef struct {
         unsigned int buff_spiram : 1; /*!< Allocated LVGL buffer will be in PSRAM */
         unsigned int
             sw_rotate : 1; /*!< Use software rotation (slower), The feature is unavailable under avoid-tear mode */
+        unsigned int async_flush : 1;  /*!< Rotate and transfer without blocking LVGL, needs sw_rotate */
+        unsigned int rotate_to_fb : 1; /*!< Rotate straight into the panel frame buffer, needs sw_rotate */
     } flags;
 } bsp_display_cfg_t;
 
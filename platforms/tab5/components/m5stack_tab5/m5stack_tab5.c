@@ -1542,7 +1542,9 @@ static lv_display_t* bsp_display_lcd_init(const bsp_display_cfg_t* cfg)
 #if CONFIG_BSP_DISPLAY_LVGL_AVOID_TEAR
          .sw_rotate = false, /* Avoid tearing is not supported for SW rotation */
 #else
-         .sw_rotate   = cfg->flags.sw_rotate, /* Only SW rotation is supported for 90° and 270° */
+         .sw_rotate    = cfg->flags.sw_rotate, /* Only SW rotation is supported for 90° and 270° */
+         .async_flush  = cfg->flags.async_flush,
+         .rotate_to_fb = cfg->flags.rotate_to_fb,
 #endif
 #if CONFIG_BSP_DISPLAY_LVGL_FULL_REFRESH
          .full_refresh = true,
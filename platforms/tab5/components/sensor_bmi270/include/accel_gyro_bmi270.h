@@ -16,6 +16,10 @@ void accel_gyro_bmi270_get_data(struct bmi2_sens_data *data);
 bool accel_gyro_bmi270_check_irq(void);
 void accel_gyro_bmi270_clear_irq_int(void);
 bool accel_gyro_bmi270_motion_irq(void);
+bool accel_gyro_bmi270_enable_fifo(void);
+// Drain up to max_frames accel + gyro samples, oldest first, returns the number read
+uint16_t accel_gyro_bmi270_read_fifo(struct bmi2_sens_axes_data *accel, struct bmi2_sens_axes_data *gyro,
+                                     uint16_t max_frames);
 
 #ifdef __cplusplus
 }
@@ -253,6 +253,69 @@ void accel_gyro_bmi270_get_data(struct bmi2_sens_data *data)
     bmi2_get_sensor_data(data, &bmi270);
 }
 
+/* Headerless accel + gyro frames, read in one burst */
+#define FIFO_MAX_FRAMES 64
+static uint8_t fifo_buffer[FIFO_MAX_FRAMES * BMI2_FIFO_ACC_GYR_LENGTH];
+
+bool accel_gyro_bmi270_enable_fifo(void)
+{
+    if (i2c_dev_handle_bmi270 == NULL) {
+        ESP_LOGE(TAG, "i2c_dev_handle_bmi270 is NULL");
+        return false;
+    }
+
+    /* Headerless frames of 12 bytes, no sensor time, the oldest frames are dropped when full */
+    int8_t rslt = bmi2_set_fifo_config(
+        BMI2_FIFO_ALL_EN | BMI2_FIFO_HEADER_EN | BMI2_FIFO_TIME_EN | BMI2_FIFO_STOP_ON_FULL, BMI2_DISABLE, &bmi270);
+    if (rslt == BMI2_OK) {
+        rslt = bmi2_set_fifo_config(BMI2_FIFO_ACC_EN | BMI2_FIFO_GYR_EN, BMI2_ENABLE, &bmi270);
+    }
+    if (rslt == BMI2_OK) {
+        rslt = bmi2_set_command_register(BMI2_FIFO_FLUSH_CMD, &bmi270);
+    }
+    bmi2_error_codes_print_result(rslt);
+    return rslt == BMI2_OK;
+}
+
+uint16_t accel_gyro_bmi270_read_fifo(struct bmi2_sens_axes_data *accel, struct bmi2_sens_axes_data *gyro,
+                                     uint16_t max_frames)
+{
+    if (i2c_dev_handle_bmi270 == NULL) {
+        ESP_LOGE(TAG, "i2c_dev_handle_bmi270 is NULL");
+        return 0;
+    }
+
+    uint16_t fifo_length = 0;
+    if (bmi2_get_fifo_length(&fifo_length, &bmi270) != BMI2_OK) {
+        return 0;
+    }
+
+    /* Whole frames only, whatever is left stays for the next read */
+    uint16_t frames = fifo_length / BMI2_FIFO_ACC_GYR_LENGTH;
+    if (frames > max_frames) {
+        frames = max_frames;
+    }
+    if (frames > FIFO_MAX_FRAMES) {
+        frames = FIFO_MAX_FRAMES;
+    }
+    if (frames == 0) {
+        return 0;
+    }
+
+    struct bmi2_fifo_frame fifo = {0};
+    fifo.data                   = fifo_buffer;
+    fifo.length                 = frames * BMI2_FIFO_ACC_GYR_LENGTH;
+    if (bmi2_read_fifo_data(&fifo, &bmi270) != BMI2_OK) {
+        return 0;
+    }
+
+    uint16_t accel_frames = frames;
+    uint16_t gyro_frames  = frames;
+    bmi2_extract_accel(accel, &accel_frames, &fifo, &bmi270);
+    bmi2_extract_gyro(gyro, &gyro_frames, &fifo, &bmi270);
+    return (accel_frames < gyro_frames) ? accel_frames : gyro_frames;
+}
+
 bool accel_gyro_bmi270_check_irq(void)
 {
     if (i2c_dev_handle_bmi270 == NULL) {
@@ -299,7 +362,9 @@ void accel_gyro_bmi270_clear_irq_int(void)
 
 static int8_t bmi270_i2c_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
 {
-    if ((reg_data == NULL) || (len == 0) || (len > 32)) {
+    /* FIFO bursts are longer than any register block */
+    uint32_t max_len = (reg_addr == BMI2_FIFO_DATA_ADDR) ? sizeof(fifo_buffer) : 32;
+    if ((reg_data == NULL) || (len == 0) || (len > max_len)) {
         return -1;
     }
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  */
 #include "hal/hal_esp32.h"
+#include "hal/utils/mp3_decoder/mp3_decoder.h"
 #include <mooncake_log.h>
 #include <vector>
 #include <memory>
@@ -14,15 +15,83 @@
 #include <thread>
 #include <mutex>
 #include <audio_player.h>
+#include <apps/utils/dsp/boost_engine.h>
+#include <apps/utils/audio/audio_service.h>
+#include <apps/utils/audio/stream_recorder.h>
+#include <apps/utils/audio/stream_player.h>
+#include <sys/stat.h>
+#include <atomic>
 
 static const char* TAG = "audio";
 
 static uint8_t _current_speaker_volume = 60;
 
+/* -------------------------------------------------------------------------- */
+/*                                Audio service                               */
+/* -------------------------------------------------------------------------- */
+using AudioService = audio::AudioService;
+
+struct AudioIoData_t {
+    std::once_flag startFlag;
+    std::atomic<bool> isRunning{false};
+    std::mutex gainMutex;
+    float inGain = -1.0f;
+};
+static AudioIoData_t _audio_io_data;
+static AudioService _audio_service;
+static int16_t _io_capture_period[AudioService::kPeriodFrames * AudioService::kCaptureChannels];
+static int16_t _io_playback_period[AudioService::kPeriodFrames * AudioService::kPlaybackChannels];
+
+static void _audio_io_task(void* param)
+{
+    mclog::tagInfo(TAG, "audio io task start on core {}", xPortGetCoreID());
+
+    bsp_codec_config_t* codec_handle = bsp_get_codec_handle();
+    codec_handle->set_volume(_current_speaker_volume);
+    codec_handle->i2s_reconfig_clk_fn(AudioService::kSampleRate, 16, I2S_SLOT_MODE_STEREO);
+
+    // Blocking reads and writes of one period each, the DMA holds about a period per direction
+    _audio_service.setDeviceLatency(AudioService::kPeriodFrames, AudioService::kPeriodFrames);
+    _audio_io_data.isRunning = true;
+
+    size_t bytes = 0;
+    while (true) {
+        // The codec read blocks until a whole period is in, which paces the loop
+        codec_handle->i2s_read(_io_capture_period, sizeof(_io_capture_period), &bytes, portMAX_DELAY);
+        _audio_service.onCapture(_io_capture_period, bytes / (AudioService::kCaptureChannels * sizeof(int16_t)));
+        _audio_service.onPlayback(_io_playback_period, AudioService::kPeriodFrames);
+        codec_handle->i2s_write(_io_playback_period, sizeof(_io_playback_period), &bytes, portMAX_DELAY);
+    }
+}
+
+static AudioService& audio_service()
+{
+    std::call_once(_audio_io_data.startFlag, []() {
+        // Core 1 is mostly idle, keep the period loop away from the lvgl task
+        xTaskCreatePinnedToCore(_audio_io_task, "audio_io", 6144, nullptr, 7, nullptr, 1);
+    });
+    return _audio_service;
+}
+
+// Returns the gain it replaced, so a temporary change can be undone
+static float set_in_gain(float gain)
+{
+    std::lock_guard<std::mutex> lock(_audio_io_data.gainMutex);
+    const float previous = _audio_io_data.inGain;
+    if (gain != previous) {
+        _audio_io_data.inGain = gain;
+        bsp_get_codec_handle()->set_in_gain(gain);
+    }
+    return previous;
+}
+
 void HalEsp32::setSpeakerVolume(uint8_t volume)
 {
     _current_speaker_volume = std::clamp((int)volume, 0, 100);
     mclog::tagInfo(TAG, "set speaker volume: {}%", _current_speaker_volume);
+    if (_audio_io_data.isRunning) {
+        bsp_get_codec_handle()->set_volume(_current_speaker_volume);
+    }
 }
 
 uint8_t HalEsp32::getSpeakerVolume()
@@ -32,81 +101,80 @@ uint8_t HalEsp32::getSpeakerVolume()
 
 void HalEsp32::audioRecord(std::vector<int16_t>& data, uint16_t durationMs, float gain)
 {
-    data.resize(48000 * 4 * durationMs / 1000);
+    const size_t frames = AudioService::kSampleRate * durationMs / 1000;
+    data.resize(frames * AudioService::kCaptureChannels);
 
-    // ESP_LOGI(TAG, "start record");
-    bsp_codec_config_t* codec_handle = bsp_get_codec_handle();
-    codec_handle->set_in_gain(gain);
-    size_t bytes_read = 0;
-    codec_handle->i2s_read((char*)data.data(), (48000 * 4 * durationMs / 1000) * sizeof(uint16_t), &bytes_read,
-                           portMAX_DELAY);
-    // ESP_LOGI(TAG, "record done, %d bytes", bytes_read);
+    set_in_gain(gain);
+    audio_service().readCapture(data.data(), frames, durationMs + 100);
 }
 
-struct AudioTaskData_t {
-    std::mutex mutex;
-    bool is_task_running  = false;
-    bool is_audio_ready   = false;
-    bool is_audio_playing = false;
-    std::vector<int16_t> audio_data;
-};
-static AudioTaskData_t _audio_task_data;
-
-void _audio_play_task(void* param)
+void HalEsp32::audioPlay(std::vector<int16_t>& data, bool async)
 {
-    size_t bytes_written = 0;
+    auto& mixer = audio_service().mixer();
 
-    while (true) {
-        _audio_task_data.mutex.lock();
+    int voice = mixer.play(std::vector<int16_t>(data));
+    if (voice < 0) {
+        mclog::tagWarn(TAG, "no free mixer voice");
+        return;
+    }
 
-        if (_audio_task_data.is_audio_ready) {
-            _audio_task_data.is_audio_playing = true;
-            _audio_task_data.mutex.unlock();
+    if (!async) {
+        while (mixer.isPlaying(voice)) {
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+    }
+}
 
-            bsp_codec_config_t* codec_handle = bsp_get_codec_handle();
-            codec_handle->set_volume(_current_speaker_volume);
-            codec_handle->i2s_reconfig_clk_fn(48000, 16, I2S_SLOT_MODE_STEREO);
-            codec_handle->i2s_write(_audio_task_data.audio_data.data(),
-                                    _audio_task_data.audio_data.size() * sizeof(uint16_t), &bytes_written,
-                                    portMAX_DELAY);
+void HalEsp32::setAudioCaptureCallback(AudioCaptureCallback_t callback)
+{
+    audio_service().setCaptureCallback(std::move(callback));
+}
 
-            _audio_task_data.mutex.lock();
-            _audio_task_data.is_audio_playing = false;
-            _audio_task_data.is_audio_ready   = false;
-            _audio_task_data.mutex.unlock();
+void HalEsp32::setAudioPlaybackCallback(AudioPlaybackCallback_t callback)
+{
+    audio_service().setPlaybackCallback(std::move(callback));
+}
 
-            continue;
-        }
+size_t HalEsp32::audioPushPlayback(const int16_t* data, size_t frames)
+{
+    return audio_service().pushPlayback(data, frames);
+}
 
-        _audio_task_data.mutex.unlock();
-        vTaskDelay(10 / portTICK_PERIOD_MS);
-    }
+size_t HalEsp32::audioPullCapture(int16_t* data, size_t frames)
+{
+    return audio_service().pullCapture(data, frames);
 }
 
-void HalEsp32::audioPlay(std::vector<int16_t>& data, bool async)
+hal::HalBase::AudioIoStats_t HalEsp32::getAudioIoStats()
 {
-    if (async) {
-        std::lock_guard<std::mutex> lock(_audio_task_data.mutex);
+    auto stats = _audio_service.stats();
+    AudioIoStats_t ret;
+    ret.periods   = stats.periods;
+    ret.underruns = stats.underruns;
+    ret.overruns  = stats.overruns;
+    ret.latencyUs = static_cast<uint64_t>(stats.latencyFrames) * 1000000 / AudioService::kSampleRate;
+    return ret;
+}
 
-        if (_audio_task_data.is_audio_playing) {
-            mclog::tagWarn(TAG, "audio is playing");
-            return;
-        }
+void HalEsp32::setMicGain(float gain)
+{
+    set_in_gain(gain);
+}
 
-        if (!_audio_task_data.is_task_running) {
-            _audio_task_data.is_task_running = true;
-            xTaskCreate(_audio_play_task, "audio", 4096, nullptr, 5, nullptr);
-        }
+bool HalEsp32::getAudioCaptureSnapshot(audio::CaptureSnapshot_t& snapshot)
+{
+    snapshot = audio_service().captureSnapshot();
+    return true;
+}
 
-        _audio_task_data.audio_data     = data;
-        _audio_task_data.is_audio_ready = true;
-    } else {
-        bsp_codec_config_t* codec_handle = bsp_get_codec_handle();
-        codec_handle->set_volume(_current_speaker_volume);
-        size_t bytes_written = 0;
-        codec_handle->i2s_reconfig_clk_fn(48000, 16, I2S_SLOT_MODE_STEREO);
-        codec_handle->i2s_write(data.data(), data.size() * sizeof(uint16_t), &bytes_written, portMAX_DELAY);
-    }
+bool HalEsp32::audioAddSource(audio::MixerSource* source)
+{
+    return audio_service().mixer().addSource(source);
+}
+
+void HalEsp32::audioRemoveSource(audio::MixerSource* source)
+{
+    _audio_service.mixer().removeSource(source);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -116,8 +184,6 @@ struct RecTestData_t {
     std::mutex mutex;
     bool isDualMic                     = true;
     hal::HalBase::MicTestState_t state = hal::HalBase::MIC_TEST_IDLE;
-    int16_t* audio_buffer              = nullptr;
-    int16_t* read_buffer               = nullptr;
 };
 static RecTestData_t _rec_test_data;
 
@@ -125,76 +191,43 @@ static void _rec_test_task(void* param)
 {
     mclog::tagInfo(TAG, "start record test");
 
-    const size_t read_buffer_size  = 48000 * 4 * 3;
-    const size_t audio_buffer_size = 48000 * 2 * 3;
-
-    // Create buffers
-    if (_rec_test_data.audio_buffer == nullptr) {
-        _rec_test_data.audio_buffer = new int16_t[audio_buffer_size](0);
-    }
-    if (_rec_test_data.read_buffer == nullptr) {
-        _rec_test_data.read_buffer = new int16_t[read_buffer_size](0);
-    }
-
-    const size_t sample_rate   = 48000;
-    const size_t total_samples = sample_rate * 4 * 3;  // 4通道，3秒
-    const size_t chunk_samples = 4096 * 4;             // 4通道一帧
-    const size_t chunk_bytes   = chunk_samples * sizeof(int16_t);
-
-    size_t total_read_samples = 0;
-    size_t total_read_bytes   = 0;
-
-    bsp_codec_config_t* codec_handle = bsp_get_codec_handle();
-    codec_handle->set_in_gain(240);
+    const size_t frames = AudioService::kSampleRate * 3;
 
-    int16_t* read_buf = _rec_test_data.read_buffer;
-    memset(read_buf, 0, total_samples * sizeof(int16_t));  // 清零
+    // Pull from the service instead of the codec, so playback keeps running meanwhile
+    std::vector<int16_t> record(frames * AudioService::kCaptureChannels);
+    const float meter_gain = set_in_gain(240);
 
     mclog::tagInfo(TAG, "start record");
-
-    while (total_read_samples < total_samples) {
-        size_t bytes_to_read = chunk_bytes;
-        if (total_read_samples + chunk_samples > total_samples) {
-            bytes_to_read = (total_samples - total_read_samples) * sizeof(int16_t);
-        }
-
-        size_t bytes_read = 0;
-        codec_handle->i2s_read((char*)(read_buf + total_read_samples), bytes_to_read, &bytes_read, portMAX_DELAY);
-
-        total_read_samples += bytes_read / sizeof(int16_t);
-        total_read_bytes += bytes_read;
-
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
-
+    audio_service().readCapture(record.data(), frames, 3500);
     mclog::tagInfo(TAG, "record done");
 
-    // Create audio data  [MIC-L, AEC, MIC-R, MIC-HP]
-    int num_frames = audio_buffer_size / 2;  // 每帧一组 stereo 输出
-    for (int i = 0; i < num_frames; ++i) {
-        int16_t* in  = _rec_test_data.read_buffer;
-        int16_t* out = _rec_test_data.audio_buffer;
+    // Hand the mics back to the meters at the gain they were opened with
+    set_in_gain(meter_gain);
 
+    // [MIC-L, AEC, MIC-R, MIC-HP] -> stereo
+    std::vector<int16_t> playback(frames * AudioService::kPlaybackChannels);
+    for (size_t i = 0; i < frames; ++i) {
+        const int16_t* in = &record[i * 4];
         if (_rec_test_data.isDualMic) {
-            out[i * 2 + 0] = in[i * 4 + 0];  // MIC-L
-            out[i * 2 + 1] = in[i * 4 + 2];  // MIC-R
+            playback[i * 2 + 0] = in[0];  // MIC-L
+            playback[i * 2 + 1] = in[2];  // MIC-R
         } else {
-            out[i * 2 + 0] = in[i * 4 + 3];  // MIC-HP
-            out[i * 2 + 1] = in[i * 4 + 3];  // MIC-HP (duplicate for stereo)
+            playback[i * 2 + 0] = in[3];  // MIC-HP
+            playback[i * 2 + 1] = in[3];  // MIC-HP (duplicate for stereo)
         }
     }
+    std::vector<int16_t>().swap(record);
 
     _rec_test_data.mutex.lock();
     _rec_test_data.state = hal::HalBase::MIC_TEST_PLAYING;
     _rec_test_data.mutex.unlock();
 
-    size_t bytes_written = 0;
-    codec_handle->set_volume(_current_speaker_volume);
-    codec_handle->i2s_reconfig_clk_fn(48000, 16, I2S_SLOT_MODE_STEREO);
-
     mclog::tagInfo(TAG, "start playback");
-    codec_handle->i2s_write(_rec_test_data.audio_buffer, (48000 * 2 * 3) * sizeof(uint16_t), &bytes_written,
-                            portMAX_DELAY);
+    auto& mixer = audio_service().mixer();
+    int voice   = mixer.play(std::move(playback));
+    while (mixer.isPlaying(voice)) {
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
     mclog::tagInfo(TAG, "playback done");
 
     _rec_test_data.mutex.lock();
@@ -247,6 +280,243 @@ hal::HalBase::MicTestState_t HalEsp32::getHeadphoneMicRecordTestState()
     return _rec_test_data.state;
 }
 
+/* -------------------------------------------------------------------------- */
+/*                               Stream recorder                              */
+/* -------------------------------------------------------------------------- */
+// The capture task only pulls, converts and encodes, the writer task is the one that waits on the card
+using StreamRecorder = audio::StreamRecorder;
+
+static constexpr const char* kRecordDir = "/sd/rec";
+
+struct StreamRecordData_t {
+    std::mutex mutex;
+    bool isRunning = false;
+    std::atomic<bool> killSignal{false};
+    std::atomic<bool> captureDone{false};
+    uint32_t overrunsAtStart = 0;
+    std::string path;
+};
+static StreamRecordData_t _stream_record_data;
+static StreamRecorder _stream_recorder;
+
+static void _stream_record_capture_task(void* param)
+{
+    // Up to 4 periods per pull, the capture ring holds about 170 ms
+    static int16_t buffer[AudioService::kPeriodFrames * 4 * AudioService::kCaptureChannels];
+
+    while (!_stream_record_data.killSignal.load()) {
+        size_t got = audio_service().pullCapture(buffer, AudioService::kPeriodFrames * 4);
+        if (got == 0) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
+        }
+        _stream_recorder.write(buffer, got);
+    }
+
+    _stream_record_data.captureDone = true;
+    vTaskDelete(NULL);
+}
+
+static void _stream_record_writer_task(void* param)
+{
+    while (!_stream_record_data.captureDone.load()) {
+        if (!_stream_recorder.service()) {
+            vTaskDelay(pdMS_TO_TICKS(20));
+        }
+    }
+    _stream_recorder.stop();
+
+    auto stats = _stream_recorder.stats();
+    mclog::tagInfo(TAG, "record stop, {} frames, {} dropped, {} KB, slowest write {} us", stats.frames,
+                   stats.droppedFrames, stats.bytes / 1024, stats.slowestWriteUs);
+
+    static_cast<HalEsp32*>(param)->sdCardRelease();
+
+    _stream_record_data.mutex.lock();
+    _stream_record_data.isRunning = false;
+    _stream_record_data.mutex.unlock();
+
+    vTaskDelete(NULL);
+}
+
+bool HalEsp32::startAudioRecord(AudioRecordFormat_t format, bool dualMic)
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    if (_stream_record_data.isRunning) {
+        mclog::tagWarn(TAG, "record is running");
+        return false;
+    }
+
+    if (!sdCardAcquire()) {
+        return false;
+    }
+    mkdir(kRecordDir, 0775);
+
+    const std::string path = StreamRecorder::next_free_path(kRecordDir, "rec_");
+    const auto encoding    = format == AUDIO_RECORD_IMA_ADPCM ? StreamRecorder::FORMAT_IMA_ADPCM
+                                                               : StreamRecorder::FORMAT_PCM16;
+    const auto source      = dualMic ? StreamRecorder::SOURCE_DUAL_MIC : StreamRecorder::SOURCE_HEADSET_MIC;
+    if (!_stream_recorder.start(path, encoding, source)) {
+        mclog::tagError(TAG, "open {} failed", path);
+        sdCardRelease();
+        return false;
+    }
+    mclog::tagInfo(TAG, "record to {}", path);
+
+    set_in_gain(80.0f);
+    _stream_record_data.path            = path;
+    _stream_record_data.overrunsAtStart = audio_service().stats().overruns;
+    _stream_record_data.killSignal      = false;
+    _stream_record_data.captureDone     = false;
+    _stream_record_data.isRunning       = true;
+
+    // Capture next to the audio io task, the writer on the other core where blocking on the card costs nothing
+    xTaskCreatePinnedToCore(_stream_record_capture_task, "rec_cap", 4096, nullptr, 6, nullptr, 1);
+    xTaskCreatePinnedToCore(_stream_record_writer_task, "rec_wr", 4096, this, 2, nullptr, 0);
+    return true;
+}
+
+void HalEsp32::stopAudioRecord()
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    _stream_record_data.killSignal = true;
+}
+
+bool HalEsp32::isAudioRecording()
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    return _stream_record_data.isRunning;
+}
+
+std::string HalEsp32::getAudioRecordPath()
+{
+    std::lock_guard<std::mutex> lock(_stream_record_data.mutex);
+    return _stream_record_data.path;
+}
+
+hal::HalBase::AudioRecordStats_t HalEsp32::getAudioRecordStats()
+{
+    auto stats = _stream_recorder.stats();
+    AudioRecordStats_t ret;
+    ret.frames         = stats.frames;
+    ret.droppedFrames  = stats.droppedFrames;
+    ret.overruns       = audio_service().stats().overruns - _stream_record_data.overrunsAtStart;
+    ret.bytes          = stats.bytes;
+    ret.slowestWriteUs = stats.slowestWriteUs;
+    return ret;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Stream player                               */
+/* -------------------------------------------------------------------------- */
+// The worker decodes on core 0, the audio io task on core 1 only pulls from the mixer ring it fills. The card stays
+// mounted from the first enqueue until the playlist has played out.
+using StreamPlayer = audio::StreamPlayer;
+
+struct StreamPlayerData_t {
+    std::mutex mutex;
+    std::once_flag startFlag;
+    std::unique_ptr<StreamPlayer> player;
+    bool holdsSdCard = false;
+};
+static StreamPlayerData_t _stream_player_data;
+
+static void _stream_player_task(void* param)
+{
+    auto* hal                        = static_cast<HalEsp32*>(param);
+    auto& player                     = *_stream_player_data.player;
+    StreamPlayer::State_t last_state = StreamPlayer::STATE_IDLE;
+
+    while (true) {
+        if (player.service()) {
+            continue;
+        }
+
+        auto status = player.status();
+        if (status.state == StreamPlayer::STATE_IDLE && last_state != StreamPlayer::STATE_IDLE) {
+            mclog::tagInfo(TAG, "player idle, {} underruns, decoding at {:.1f}x realtime", status.underruns,
+                           status.decodeSpeed);
+        }
+        last_state = status.state;
+
+        // Enqueue takes the lock around mounting and queueing, so an empty idle player here has nothing left to open
+        if (status.state == StreamPlayer::STATE_IDLE && status.queued == 0) {
+            std::lock_guard<std::mutex> lock(_stream_player_data.mutex);
+            status = player.status();
+            if (_stream_player_data.holdsSdCard && status.state == StreamPlayer::STATE_IDLE && status.queued == 0) {
+                hal->sdCardRelease();
+                _stream_player_data.holdsSdCard = false;
+            }
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+static StreamPlayer& stream_player(HalEsp32* hal)
+{
+    std::call_once(_stream_player_data.startFlag, [hal]() {
+        _stream_player_data.player = std::make_unique<StreamPlayer>(audio_service().mixer());
+        _stream_player_data.player->registerDecoder(".mp3", Mp3StreamDecoder::create);
+        xTaskCreatePinnedToCore(_stream_player_task, "player", 8192, hal, 3, nullptr, 0);
+    });
+    return *_stream_player_data.player;
+}
+
+bool HalEsp32::audioPlayerEnqueue(const std::string& path)
+{
+    auto& player = stream_player(this);
+
+    std::lock_guard<std::mutex> lock(_stream_player_data.mutex);
+    if (!_stream_player_data.holdsSdCard) {
+        if (!sdCardAcquire()) {
+            return false;
+        }
+        _stream_player_data.holdsSdCard = true;
+    }
+
+    // Relative to the card root, like scanSdCard()
+    if (!player.enqueue("/sd/" + path)) {
+        mclog::tagWarn(TAG, "no decoder for {}", path);
+        return false;
+    }
+    return true;
+}
+
+void HalEsp32::audioPlayerStop()
+{
+    stream_player(this).stop();
+}
+
+void HalEsp32::audioPlayerPause(bool pause)
+{
+    stream_player(this).setPaused(pause);
+}
+
+void HalEsp32::audioPlayerSkip()
+{
+    stream_player(this).skip();
+}
+
+void HalEsp32::audioPlayerSeek(uint32_t positionMs)
+{
+    stream_player(this).seek(positionMs);
+}
+
+hal::HalBase::AudioPlayerStatus_t HalEsp32::getAudioPlayerStatus()
+{
+    auto status = stream_player(this).status();
+    AudioPlayerStatus_t ret;
+    ret.state       = static_cast<AudioPlayerState_t>(status.state);
+    ret.path        = status.path;
+    ret.positionMs  = status.positionMs;
+    ret.durationMs  = status.durationMs;
+    ret.bufferedMs  = status.bufferedMs;
+    ret.queued      = status.queued;
+    ret.underruns   = status.underruns;
+    ret.decodeSpeed = status.decodeSpeed;
+    return ret;
+}
+
 /* -------------------------------------------------------------------------- */
 /*                               Music play test                              */
 /* -------------------------------------------------------------------------- */
@@ -266,15 +536,35 @@ enum Mp3PlayTarget_t {
 struct MusicTestData_t {
     std::mutex mutex;
     bool killSignal                      = false;
+    bool finished                        = false;
     hal::HalBase::MusicPlayState_t state = hal::HalBase::MUSIC_PLAY_IDLE;
     Mp3PlayTarget_t target               = MP3_PLAY_TARGET_CANON_IN_D;
+    audio::MixerStream* stream           = nullptr;
 };
 static MusicTestData_t _music_test_data;
 
+// The player decodes into a mixer stream instead of owning the codec, so tones and sfx can overlap with it
 static esp_err_t audio_mute_function(AUDIO_PLAYER_MUTE_SETTING setting)
 {
-    bsp_codec_config_t* codec_handle = bsp_get_codec_handle();
-    codec_handle->set_mute(setting == AUDIO_PLAYER_MUTE ? true : false);
+    _music_test_data.stream->setGain(setting == AUDIO_PLAYER_MUTE ? 0.0f : 1.0f);
+    return ESP_OK;
+}
+
+static esp_err_t audio_clk_set_function(uint32_t rate, uint32_t bits_cfg, i2s_slot_mode_t ch)
+{
+    if (bits_cfg != 16) {
+        mclog::tagWarn(TAG, "unsupported mp3 output bits: {}", bits_cfg);
+    }
+    _music_test_data.stream->setFormat(rate, ch == I2S_SLOT_MODE_MONO ? 1 : 2);
+    return ESP_OK;
+}
+
+static esp_err_t audio_write_function(void* audio_buffer, size_t len, size_t* bytes_written, uint32_t timeout_ms)
+{
+    auto* stream             = _music_test_data.stream;
+    const size_t frame_bytes = stream->channels() * sizeof(int16_t);
+    const size_t frames      = stream->write(static_cast<const int16_t*>(audio_buffer), len / frame_bytes, timeout_ms);
+    *bytes_written           = frames * frame_bytes;
     return ESP_OK;
 }
 
@@ -286,21 +576,34 @@ static void audio_player_callback(audio_player_cb_ctx_t* ctx)
     mclog::tagInfo(TAG, "audio state: {}", (int)state);
 
     if (state == AUDIO_PLAYER_STATE_IDLE) {
+        {
+            std::lock_guard<std::mutex> lock(_music_test_data.mutex);
+            _music_test_data.finished = true;
+        }
         GetHAL()->stopPlayMusicTest();
     }
 }
 
 static void _music_play_task(void* param)
 {
-    bsp_codec_config_t* codec_handle = bsp_get_codec_handle();
-    codec_handle->set_volume(_current_speaker_volume);
-    codec_handle->i2s_reconfig_clk_fn(48000, 16, I2S_SLOT_MODE_STEREO);
+    // Deep enough to ride out a few mp3 frames of decoder jitter
+    auto& mixer             = audio_service().mixer();
+    _music_test_data.stream = mixer.openStream(4096);
+    if (_music_test_data.stream == nullptr) {
+        mclog::tagError(TAG, "no free mixer stream");
+        _music_test_data.mutex.lock();
+        _music_test_data.state = hal::HalBase::MUSIC_PLAY_IDLE;
+        _music_test_data.mutex.unlock();
+        vTaskDelete(NULL);
+        return;
+    }
 
     audio_player_config_t config = {
         .mute_fn    = audio_mute_function,
-        .clk_set_fn = codec_handle->i2s_reconfig_clk_fn,
-        .write_fn   = codec_handle->i2s_write,
-        .priority   = 8,
+        .clk_set_fn = audio_clk_set_function,
+        .write_fn   = audio_write_function,
+        // Below audio_io (7) on the same core, the decoder only fills the stream ring and must never delay a period
+        .priority   = 5,
         .coreID     = 1,
     };
     ESP_ERROR_CHECK(audio_player_new(config));
@@ -326,6 +629,12 @@ static void _music_play_task(void* param)
     esp_err_t ret = audio_player_play(fp);
     if (ret != ESP_OK) {
         mclog::tagError(TAG, "audio play failed");
+        audio_player_delete();
+        _music_test_data.mutex.lock();
+        mixer.closeStream(_music_test_data.stream);
+        _music_test_data.stream = nullptr;
+        _music_test_data.state  = hal::HalBase::MUSIC_PLAY_IDLE;
+        _music_test_data.mutex.unlock();
         vTaskDelete(NULL);
         return;
     }
@@ -345,8 +654,12 @@ static void _music_play_task(void* param)
     }
 
     _music_test_data.mutex.lock();
+    // Let a track that ended on its own play out the queued tail, a stop request cuts it
+    mixer.closeStream(_music_test_data.stream, _music_test_data.finished);
+    _music_test_data.stream     = nullptr;
     _music_test_data.state      = hal::HalBase::MUSIC_PLAY_IDLE;
     _music_test_data.killSignal = false;
+    _music_test_data.finished   = false;
     _music_test_data.mutex.unlock();
 
     vTaskDelete(NULL);
@@ -358,6 +671,7 @@ void try_create_music_play_task(Mp3PlayTarget_t target)
         _music_test_data.state      = hal::HalBase::MUSIC_PLAY_PLAYING;
         _music_test_data.target     = target;
         _music_test_data.killSignal = false;
+        _music_test_data.finished   = false;
         xTaskCreate(_music_play_task, "music", 3000, nullptr, 5, nullptr);
     } else {
         mclog::tagWarn(TAG, "music play is running");
@@ -396,3 +710,77 @@ void HalEsp32::playShutdownSfx()
     std::lock_guard<std::mutex> lock(_music_test_data.mutex);
     try_create_music_play_task(MP3_PLAY_TARGET_SHUTDOWN_SFX);
 }
+
+/* -------------------------------------------------------------------------- */
+/*                                  Boost DSP                                 */
+/* -------------------------------------------------------------------------- */
+using BoostEngine = app::dsp::BoostEngine;
+
+static_assert(BoostEngine::kFrameSamples == AudioService::kPeriodFrames, "dsp frame must match the audio period");
+
+static std::mutex _dsp_mutex;
+static BoostEngine _boost_engine;
+
+void HalEsp32::startAudioDsp()
+{
+    std::lock_guard<std::mutex> lock(_dsp_mutex);
+    auto& service = audio_service();
+    if (service.hasDuplexCallback()) {
+        mclog::tagWarn(TAG, "dsp is running");
+        return;
+    }
+
+    set_in_gain(80.0f);
+    _boost_engine.reset();
+    _boost_engine.stats().reset();
+    _boost_engine.echoCanceller().stats().reset();
+    _boost_engine.noiseSuppressor().stats().reset();
+    service.setDuplexCallback(
+        [](const int16_t* capture, int16_t* playback) { _boost_engine.process(capture, playback); });
+}
+
+void HalEsp32::stopAudioDsp()
+{
+    std::lock_guard<std::mutex> lock(_dsp_mutex);
+    _audio_service.setDuplexCallback(nullptr);
+
+    auto& stats = _boost_engine.stats();
+    mclog::tagInfo(TAG, "dsp stop, {} frames, avg {} cycles/frame, peak {}", stats.frames.load(), stats.average(),
+                   stats.peak.load());
+
+    auto& aec = _boost_engine.echoCanceller();
+    if (aec.stats().frames.load() > 0) {
+        mclog::tagInfo(TAG, "aec {} ms tail, avg {} cycles/frame, peak {}, erle {:.1f} dB", aec.tailMs(),
+                       aec.stats().average(), aec.stats().peak.load(), aec.erleDb());
+    }
+
+    auto& ns = _boost_engine.noiseSuppressor();
+    if (ns.stats().frames.load() > 0) {
+        mclog::tagInfo(TAG, "ns avg {} cycles/frame, peak {}", ns.stats().average(), ns.stats().peak.load());
+    }
+}
+
+bool HalEsp32::isAudioDspRunning()
+{
+    return _audio_service.hasDuplexCallback();
+}
+
+hal::HalBase::AudioDspStats_t HalEsp32::getAudioDspStats()
+{
+    auto& stats = _boost_engine.stats();
+    AudioDspStats_t ret;
+    ret.frames     = stats.frames.load(std::memory_order_relaxed);
+    ret.lastCycles = stats.last.load(std::memory_order_relaxed);
+    ret.avgCycles  = stats.average();
+    ret.peakCycles = stats.peak.load(std::memory_order_relaxed);
+
+    auto& aec         = _boost_engine.echoCanceller();
+    ret.aecAvgCycles  = aec.stats().average();
+    ret.aecPeakCycles = aec.stats().peak.load(std::memory_order_relaxed);
+    ret.aecErleDb     = aec.erleDb();
+
+    auto& ns         = _boost_engine.noiseSuppressor();
+    ret.nsAvgCycles  = ns.stats().average();
+    ret.nsPeakCycles = ns.stats().peak.load(std::memory_order_relaxed);
+    return ret;
+}
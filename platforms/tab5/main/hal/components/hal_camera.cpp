@@ -29,6 +29,14 @@
 #include "driver/ppa.h"
 #include "imlib.h"
 #include "freertos/queue.h"
+#include <apps/utils/camera/frame_pool.h>
+#include <apps/utils/camera/jpeg_capture.h>
+#include <apps/utils/camera/h264_recorder.h>
+#include <apps/utils/camera/vision_frame_pool.h>
+#include "hal/utils/jpeg_m2m/jpeg_m2m_encoder.h"
+#include "hal/utils/h264_m2m/h264_m2m_encoder.h"
+#include <sys/stat.h>
+#include <atomic>
 
 #define CAMERA_WIDTH  1280
 #define CAMERA_HEIGHT 720
@@ -46,9 +54,14 @@ static std::mutex camera_mutex;
 
 static const char* TAG = "camera";
 
-#define EXAMPLE_VIDEO_BUFFER_COUNT 2
-#define MEMORY_TYPE                V4L2_MEMORY_MMAP
-#define CAM_DEV_PATH               ESP_VIDEO_MIPI_CSI_DEVICE_NAME
+// Capture buffer pool. With V4L2_MEMORY_MMAP the driver places the buffers, with V4L2_MEMORY_USERPTR they are
+// allocated here with CAMERA_BUFFER_CAPS. The display, the jpeg capture, the H.264 recording and the vision branch can
+// each hold one, which still leaves the sensor two to fill
+#define CAMERA_BUFFER_COUNT  6
+#define CAMERA_BUFFER_POLICY camera::FramePool::POLICY_DROP_OLDEST
+#define MEMORY_TYPE          V4L2_MEMORY_USERPTR
+#define CAMERA_BUFFER_CAPS   (MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA)
+#define CAM_DEV_PATH         ESP_VIDEO_MIPI_CSI_DEVICE_NAME
 #ifndef ARRAY_SIZE
 #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof(arr[0]))
 #endif
@@ -58,9 +71,12 @@ typedef struct cam {
     uint32_t width;
     uint32_t height;
     uint32_t pixel_format;
-    uint8_t* buffer[EXAMPLE_VIDEO_BUFFER_COUNT];
+    uint32_t buffer_size;
 } cam_t;
 
+// Which capture buffers are with the driver, waiting, or held by the display pipeline
+static std::unique_ptr<camera::FramePool> frame_pool;
+
 /*
  * The image format type definition used in the example.
  */
@@ -135,6 +151,25 @@ exit_0:
     return -1;
 }
 
+// Hand a buffer back to the driver, the pool calls this whenever it gives up ownership
+static bool queue_capture_buffer(cam_t* wc, uint32_t index)
+{
+    struct v4l2_buffer buf;
+    memset(&buf, 0, sizeof(buf));
+    buf.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = MEMORY_TYPE;
+    buf.index  = index;
+    if (MEMORY_TYPE == V4L2_MEMORY_USERPTR) {
+        buf.m.userptr = (unsigned long)frame_pool->buffer(index);
+        buf.length    = wc->buffer_size;
+    }
+    if (ioctl(wc->fd, VIDIOC_QBUF, &buf) != 0) {
+        ESP_LOGE(TAG, "failed to queue video frame %" PRIu32, index);
+        return false;
+    }
+    return true;
+}
+
 static esp_err_t new_cam(int cam_fd, cam_t** ret_wc)
 {
     int ret;
@@ -159,9 +194,10 @@ static esp_err_t new_cam(int cam_fd, cam_t** ret_wc)
     wc->width        = format.fmt.pix.width;
     wc->height       = format.fmt.pix.height;
     wc->pixel_format = format.fmt.pix.pixelformat;
+    wc->buffer_size  = format.fmt.pix.sizeimage ? format.fmt.pix.sizeimage : wc->width * wc->height * 2;
 
     memset(&req, 0, sizeof(req));
-    req.count  = ARRAY_SIZE(wc->buffer);
+    req.count  = CAMERA_BUFFER_COUNT;
     req.type   = type;
     req.memory = MEMORY_TYPE;
     if (ioctl(wc->fd, VIDIOC_REQBUFS, &req) != 0) {
@@ -170,7 +206,16 @@ static esp_err_t new_cam(int cam_fd, cam_t** ret_wc)
         goto errout;
     }
 
-    for (int i = 0; i < ARRAY_SIZE(wc->buffer); i++) {
+    {
+        camera::FramePool::Config_t pool_config;
+        pool_config.bufferCount = CAMERA_BUFFER_COUNT;
+        pool_config.policy      = CAMERA_BUFFER_POLICY;
+
+        frame_pool = std::make_unique<camera::FramePool>(
+            pool_config, [wc](uint32_t index) { return queue_capture_buffer(wc, index); }, esp_timer_get_time);
+    }
+
+    for (int i = 0; i < CAMERA_BUFFER_COUNT; i++) {
         struct v4l2_buffer buf;
 
         memset(&buf, 0, sizeof(buf));
@@ -183,14 +228,24 @@ static esp_err_t new_cam(int cam_fd, cam_t** ret_wc)
             goto errout;
         }
 
-        wc->buffer[i] = (uint8_t*)mmap(NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, wc->fd, buf.m.offset);
-        if (!wc->buffer[i]) {
+        uint8_t* data = NULL;
+        if (MEMORY_TYPE == V4L2_MEMORY_MMAP) {
+            // The driver decides the size of its own buffers
+            wc->buffer_size = buf.length;
+
+            data = (uint8_t*)mmap(NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, wc->fd, buf.m.offset);
+        } else {
+            // Cache line aligned so the ISP DMA and the PPA can both work on it
+            data = (uint8_t*)heap_caps_aligned_calloc(64, wc->buffer_size, 1, CAMERA_BUFFER_CAPS);
+        }
+        if (!data) {
             ESP_LOGE(TAG, "failed to map buffer");
             ret = ESP_FAIL;
             goto errout;
         }
+        frame_pool->setBuffer(i, data, wc->buffer_size);
 
-        if (ioctl(wc->fd, VIDIOC_QBUF, &buf) != 0) {
+        if (!queue_capture_buffer(wc, i)) {
             ESP_LOGE(TAG, "failed to queue frame buffer");
             ret = ESP_FAIL;
             goto errout;
@@ -207,6 +262,7 @@ static esp_err_t new_cam(int cam_fd, cam_t** ret_wc)
     return ESP_OK;
 
 errout:
+    frame_pool.reset();
     free(wc);
     return ret;
 }
@@ -215,6 +271,488 @@ errout:
 static bool cam_is_initial = false;
 static cam_t* camera       = NULL;
 
+/* -------------------------------------------------------------------------- */
+/*                              Display pipeline                              */
+/* -------------------------------------------------------------------------- */
+// The PPA mirrors each capture buffer into one of these and the canvas shows it by reference. One slot is on screen,
+// one can wait for the next refresh and one can be in the PPA, so neither side ever waits on the other.
+#define DISPLAY_SLOT_COUNT 3
+#define DISPLAY_FRAME_SIZE (CAMERA_WIDTH * CAMERA_HEIGHT * 2)
+
+enum DisplaySlotState_t {
+    SLOT_FREE,
+    SLOT_MIRRORING,
+    SLOT_READY,
+    SLOT_SHOWN,
+};
+
+struct DisplaySlot_t {
+    uint8_t* data            = nullptr;
+    DisplaySlotState_t state = SLOT_FREE;
+    uint32_t captureIndex    = 0;  // the pool token, held until the PPA is done reading the capture buffer
+    int64_t captureUs        = 0;
+};
+
+struct CameraPipeline_t {
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    DisplaySlot_t slots[DISPLAY_SLOT_COUNT];
+    QueueHandle_t returnQueue = NULL;  // pool tokens to release, filled from the PPA isr
+
+    // Stats, guarded by the lock
+    int64_t latchedCaptureUs = 0;  // frame latched at refresh start, its latency is taken at refresh ready
+    uint32_t frames          = 0;
+    uint32_t dropped         = 0;
+    uint32_t latencyUs       = 0;
+    uint32_t fpsFrames       = 0;
+    int64_t fpsStartUs       = 0;
+    float fps                = 0.0f;
+};
+static CameraPipeline_t _pipeline;
+
+static bool IRAM_ATTR _on_ppa_mirror_done(ppa_client_handle_t client, ppa_event_data_t* event, void* userData)
+{
+    const int slot     = (int)(intptr_t)userData;
+    BaseType_t wake_up = pdFALSE;
+
+    portENTER_CRITICAL_ISR(&_pipeline.lock);
+    // A newer frame supersedes one that never made it to the screen
+    for (int i = 0; i < DISPLAY_SLOT_COUNT; i++) {
+        if (_pipeline.slots[i].state == SLOT_READY) {
+            _pipeline.slots[i].state = SLOT_FREE;
+            _pipeline.dropped++;
+        }
+    }
+    _pipeline.slots[slot].state = SLOT_READY;
+    portEXIT_CRITICAL_ISR(&_pipeline.lock);
+
+    xQueueSendFromISR(_pipeline.returnQueue, &_pipeline.slots[slot].captureIndex, &wake_up);
+    return wake_up == pdTRUE;
+}
+
+// Runs in the lvgl task, so the canvas is only ever touched between two refreshes
+static void _on_display_refresh(lv_event_t* e)
+{
+    const int64_t now = esp_timer_get_time();
+
+    if (lv_event_get_code(e) == LV_EVENT_REFR_READY) {
+        portENTER_CRITICAL(&_pipeline.lock);
+        if (_pipeline.latchedCaptureUs != 0) {
+            const uint32_t latency     = now - _pipeline.latchedCaptureUs;
+            _pipeline.latencyUs        = _pipeline.latencyUs == 0 ? latency : (_pipeline.latencyUs * 7 + latency) / 8;
+            _pipeline.latchedCaptureUs = 0;
+        }
+        portEXIT_CRITICAL(&_pipeline.lock);
+        return;
+    }
+
+    // LV_EVENT_REFR_START, latch the newest mirrored frame
+    uint8_t* latched = nullptr;
+    portENTER_CRITICAL(&_pipeline.lock);
+    for (int i = 0; i < DISPLAY_SLOT_COUNT; i++) {
+        if (_pipeline.slots[i].state == SLOT_READY) {
+            for (int j = 0; j < DISPLAY_SLOT_COUNT; j++) {
+                if (_pipeline.slots[j].state == SLOT_SHOWN) {
+                    _pipeline.slots[j].state = SLOT_FREE;
+                }
+            }
+            _pipeline.slots[i].state   = SLOT_SHOWN;
+            _pipeline.latchedCaptureUs = _pipeline.slots[i].captureUs;
+            _pipeline.frames++;
+            _pipeline.fpsFrames++;
+            latched = _pipeline.slots[i].data;
+            break;
+        }
+    }
+    if (now - _pipeline.fpsStartUs >= 1000000) {
+        _pipeline.fps        = _pipeline.fpsFrames * 1000000.0f / (now - _pipeline.fpsStartUs);
+        _pipeline.fpsFrames  = 0;
+        _pipeline.fpsStartUs = now;
+    }
+    portEXIT_CRITICAL(&_pipeline.lock);
+
+    if (latched) {
+        lv_canvas_set_buffer(camera_canvas, latched, CAMERA_WIDTH, CAMERA_HEIGHT, LV_COLOR_FORMAT_RGB565);
+    }
+}
+
+// A free slot to mirror into, there always is one while nothing is in the PPA
+static int _acquire_display_slot()
+{
+    int slot = -1;
+    portENTER_CRITICAL(&_pipeline.lock);
+    for (int i = 0; i < DISPLAY_SLOT_COUNT; i++) {
+        if (_pipeline.slots[i].state == SLOT_FREE) {
+            _pipeline.slots[i].state = SLOT_MIRRORING;
+            slot                     = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&_pipeline.lock);
+    return slot;
+}
+
+static void _return_capture_buffers()
+{
+    uint32_t index = 0;
+    while (xQueueReceive(_pipeline.returnQueue, &index, 0) == pdPASS) {
+        frame_pool->release(index);
+    }
+}
+
+static bool _is_mirroring()
+{
+    bool mirroring = false;
+    portENTER_CRITICAL(&_pipeline.lock);
+    for (int i = 0; i < DISPLAY_SLOT_COUNT; i++) {
+        mirroring |= _pipeline.slots[i].state == SLOT_MIRRORING;
+    }
+    portEXIT_CRITICAL(&_pipeline.lock);
+    return mirroring;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Frame offers                                */
+/* -------------------------------------------------------------------------- */
+// Encode tasks borrow capture buffers straight from the pool. A consumer raises its flag once it would take a frame
+// and the camera task shares the next one it acquires, so neither side waits on the other and a consumer never holds
+// more than one capture buffer.
+struct OfferedFrame_t {
+    uint32_t index    = 0;  // pool token, released by the consumer
+    uint32_t sequence = 0;
+    int64_t captureUs = 0;
+};
+
+struct FrameOffer_t {
+    std::mutex mutex;
+    bool wantsFrame     = false;
+    QueueHandle_t queue = NULL;
+};
+
+// Camera task side, shares the frame if the consumer is waiting for one
+static void _offer_capture_frame(FrameOffer_t& offer, const camera::FramePool::Frame_t& frame)
+{
+    std::lock_guard<std::mutex> lock(offer.mutex);
+    if (!offer.wantsFrame || !frame_pool->retain(frame.index)) {
+        return;
+    }
+    offer.wantsFrame = false;
+
+    OfferedFrame_t offered;
+    offered.index     = frame.index;
+    offered.sequence  = frame.sequence;
+    offered.captureUs = frame.dequeueUs;
+    if (xQueueSend(offer.queue, &offered, 0) != pdPASS) {
+        frame_pool->release(frame.index);
+    }
+}
+
+static void _open_frame_offer(FrameOffer_t& offer)
+{
+    if (offer.queue == NULL) {
+        offer.queue = xQueueCreate(1, sizeof(OfferedFrame_t));
+    }
+}
+
+static void _request_capture_frame(FrameOffer_t& offer)
+{
+    std::lock_guard<std::mutex> lock(offer.mutex);
+    offer.wantsFrame = true;
+}
+
+// No frame can be offered once the flag is down under the lock, so the queue is drained for good
+static void _close_frame_offer(FrameOffer_t& offer)
+{
+    offer.mutex.lock();
+    offer.wantsFrame = false;
+    offer.mutex.unlock();
+
+    OfferedFrame_t offered;
+    while (xQueueReceive(offer.queue, &offered, 0) == pdPASS) {
+        frame_pool->release(offered.index);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Jpeg capture                                */
+/* -------------------------------------------------------------------------- */
+// The encode task feeds offered frames to the jpeg M2M device, the writer task is the one that waits on the card
+#define CAPTURE_DIR          "/sd/cam"
+#define CAPTURE_JPEG_QUALITY 80
+
+struct JpegCaptureData_t {
+    std::mutex mutex;
+    bool isRunning = false;
+    std::string path;
+    std::atomic<bool> encodeDone{false};
+    FrameOffer_t offer;
+};
+static JpegCaptureData_t _jpeg_capture_data;
+static JpegM2mEncoder _jpeg_encoder(CAPTURE_JPEG_QUALITY);
+static camera::JpegCapture _jpeg_capture(_jpeg_encoder, esp_timer_get_time);
+
+static void _jpeg_capture_encode_task(void* param)
+{
+    OfferedFrame_t frame;
+    while (!_jpeg_capture.isDone()) {
+        // Also where a burst ends when the camera stopped delivering
+        if (_jpeg_capture.wantsFrame()) {
+            _request_capture_frame(_jpeg_capture_data.offer);
+        }
+        if (xQueueReceive(_jpeg_capture_data.offer.queue, &frame, pdMS_TO_TICKS(20)) == pdPASS) {
+            _jpeg_capture.write(frame_pool->buffer(frame.index), CAMERA_WIDTH, CAMERA_HEIGHT);
+            frame_pool->release(frame.index);
+        }
+    }
+    _close_frame_offer(_jpeg_capture_data.offer);
+
+    _jpeg_capture_data.encodeDone = true;
+    vTaskDelete(NULL);
+}
+
+static void _jpeg_capture_writer_task(void* param)
+{
+    while (!_jpeg_capture_data.encodeDone.load()) {
+        if (!_jpeg_capture.service()) {
+            vTaskDelay(pdMS_TO_TICKS(20));
+        }
+    }
+    _jpeg_capture.stop();
+
+    auto stats = _jpeg_capture.stats();
+    mclog::tagInfo(TAG, "capture stop, {} frames, {} dropped, {} KB, encode avg {} us max {} us, {:.1f} fps",
+                   stats.frames, stats.droppedFrames, stats.bytes / 1024, stats.avgEncodeUs, stats.maxEncodeUs,
+                   stats.fps);
+
+    static_cast<HalEsp32*>(param)->sdCardRelease();
+
+    _jpeg_capture_data.mutex.lock();
+    _jpeg_capture_data.isRunning = false;
+    _jpeg_capture_data.mutex.unlock();
+
+    vTaskDelete(NULL);
+}
+
+static bool _start_jpeg_capture(HalEsp32* hal, camera::JpegCapture::Mode_t mode, uint32_t durationMs)
+{
+    std::lock_guard<std::mutex> lock(_jpeg_capture_data.mutex);
+    if (_jpeg_capture_data.isRunning) {
+        mclog::tagWarn(TAG, "capture is running");
+        return false;
+    }
+    if (!hal->isCameraCapturing()) {
+        mclog::tagWarn(TAG, "camera is not running");
+        return false;
+    }
+
+    if (!hal->sdCardAcquire()) {
+        return false;
+    }
+    mkdir(CAPTURE_DIR, 0775);
+
+    const bool burst       = mode == camera::JpegCapture::MODE_BURST;
+    const std::string path = camera::JpegCapture::next_free_path(CAPTURE_DIR, burst ? "burst_" : "img_",
+                                                                 burst ? "mjpeg" : "jpg");
+    if (!_jpeg_capture.start(path, mode, durationMs)) {
+        mclog::tagError(TAG, "open {} failed", path);
+        hal->sdCardRelease();
+        return false;
+    }
+    mclog::tagInfo(TAG, "capture to {}", path);
+
+    _open_frame_offer(_jpeg_capture_data.offer);
+    _jpeg_capture_data.path       = path;
+    _jpeg_capture_data.encodeDone = false;
+    _jpeg_capture_data.isRunning  = true;
+
+    // Encode next to the camera task, the writer on the other core where blocking on the card costs nothing
+    xTaskCreatePinnedToCore(_jpeg_capture_encode_task, "cam_enc", 4096, nullptr, 4, nullptr, 1);
+    xTaskCreatePinnedToCore(_jpeg_capture_writer_task, "cam_wr", 4096, hal, 2, nullptr, 0);
+    return true;
+}
+
+/* -------------------------------------------------------------------------- */
+/*                               H.264 recording                              */
+/* -------------------------------------------------------------------------- */
+// Every frame the encoder keeps up with goes through the PPA into YUV420 and on to the H.264 M2M device, the muxed
+// access units wait in the recorder's writer ring for the writer task, the only one that ever waits on the card
+#define RECORD_ENCODE_STACK 6 * 1024
+
+struct H264RecordData_t {
+    std::mutex mutex;
+    bool isRunning = false;
+    std::string path;
+    std::atomic<bool> encodeDone{false};
+    FrameOffer_t offer;
+};
+static H264RecordData_t _h264_record_data;
+static H264M2mEncoder _h264_encoder;
+static camera::H264Recorder _h264_recorder(_h264_encoder, esp_timer_get_time);
+
+static void _h264_record_encode_task(void* param)
+{
+    OfferedFrame_t frame;
+    while (!_h264_recorder.isDone()) {
+        if (_h264_recorder.wantsFrame()) {
+            _request_capture_frame(_h264_record_data.offer);
+        }
+        if (xQueueReceive(_h264_record_data.offer.queue, &frame, pdMS_TO_TICKS(20)) == pdPASS) {
+            _h264_recorder.write(frame_pool->buffer(frame.index), CAMERA_WIDTH, CAMERA_HEIGHT, frame.captureUs);
+            frame_pool->release(frame.index);
+        }
+    }
+    _close_frame_offer(_h264_record_data.offer);
+
+    _h264_record_data.encodeDone = true;
+    vTaskDelete(NULL);
+}
+
+static void _h264_record_writer_task(void* param)
+{
+    while (!_h264_record_data.encodeDone.load()) {
+        if (!_h264_recorder.service()) {
+            vTaskDelay(pdMS_TO_TICKS(20));
+        }
+    }
+    _h264_recorder.stop();
+
+    auto stats = _h264_recorder.stats();
+    mclog::tagInfo(TAG, "record stop, {} frames, {} dropped, {} KB, {} kbps, {:.1f} fps, encode avg {} us, queue {}/{}",
+                   stats.frames, stats.droppedFrames, stats.bytes / 1024, stats.bitrate / 1000, stats.fps,
+                   stats.avgEncodeUs, stats.maxQueuedChunks, stats.chunks);
+
+    static_cast<HalEsp32*>(param)->sdCardRelease();
+
+    _h264_record_data.mutex.lock();
+    _h264_record_data.isRunning = false;
+    _h264_record_data.mutex.unlock();
+
+    vTaskDelete(NULL);
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                Vision frames                               */
+/* -------------------------------------------------------------------------- */
+// A second branch off the capture buffer, so the preview is never copied again for analysis: the PPA scales the roi
+// straight out of the borrowed capture buffer into an analysis slot, and the luma pass only touches the small frame.
+// The PPA scales in sixteenths, a ratio it cannot hit exactly goes through the software scaler instead.
+#define VISION_SLOT_COUNT 3
+#define VISION_STACK      4 * 1024
+#define PPA_SCALE_STEPS   16
+
+struct VisionData_t {
+    std::mutex mutex;
+    bool isRunning                    = false;
+    bool hardware                     = false;
+    uint8_t* slots[VISION_SLOT_COUNT] = {};
+    size_t slotBytes                  = 0;
+    std::atomic<bool> stopRequested{false};
+    std::atomic<uint32_t> scaleUs{0};
+    std::atomic<float> fps{0.0f};
+    FrameOffer_t offer;
+};
+static VisionData_t _vision_data;
+static camera::VisionFramePool _vision_pool;
+static camera::FrameScaler _vision_scaler;
+
+static bool _vision_scale_ppa(ppa_client_handle_t ppa, const uint8_t* src,
+                              const camera::VisionFramePool::Frame_t& frame)
+{
+    const camera::Roi_t& roi         = _vision_scaler.roi();
+    ppa_srm_oper_config_t srm_config = {};
+    srm_config.in.buffer             = src;
+    srm_config.in.pic_w              = CAMERA_WIDTH;
+    srm_config.in.pic_h              = CAMERA_HEIGHT;
+    srm_config.in.block_w            = roi.width;
+    srm_config.in.block_h            = roi.height;
+    srm_config.in.block_offset_x     = roi.x;
+    srm_config.in.block_offset_y     = roi.y;
+    srm_config.in.srm_cm             = PPA_SRM_COLOR_MODE_RGB565;
+    srm_config.out.buffer            = frame.data;
+    srm_config.out.buffer_size       = _vision_data.slotBytes;
+    srm_config.out.pic_w             = frame.width;
+    srm_config.out.pic_h             = frame.height;
+    srm_config.out.srm_cm            = PPA_SRM_COLOR_MODE_RGB565;
+    srm_config.rotation_angle        = PPA_SRM_ROTATION_ANGLE_0;
+    srm_config.scale_x               = (float)frame.width / roi.width;
+    srm_config.scale_y               = (float)frame.height / roi.height;
+    srm_config.mode                  = PPA_TRANS_MODE_BLOCKING;
+    return ppa_do_scale_rotate_mirror(ppa, &srm_config) == ESP_OK;
+}
+
+static void _vision_task(void* param)
+{
+    ppa_client_handle_t ppa = NULL;
+    if (_vision_data.hardware) {
+        ppa_client_config_t ppa_config   = {};
+        ppa_config.oper_type             = PPA_OPERATION_SRM;
+        ppa_config.max_pending_trans_num = 1;
+        if (ppa_register_client(&ppa_config, &ppa) != ESP_OK) {
+            ESP_LOGW(TAG, "no ppa client for vision, scaling in software");
+            _vision_data.mutex.lock();
+            _vision_data.hardware = false;
+            _vision_data.mutex.unlock();
+        }
+    }
+
+    uint32_t fps_frames  = 0;
+    int64_t fps_start_us = esp_timer_get_time();
+    OfferedFrame_t offered;
+    while (!_vision_data.stopRequested.load()) {
+        _request_capture_frame(_vision_data.offer);
+        if (xQueueReceive(_vision_data.offer.queue, &offered, pdMS_TO_TICKS(20)) != pdPASS) {
+            continue;
+        }
+
+        camera::VisionFramePool::Frame_t frame;
+        if (!_vision_pool.acquireWrite(frame)) {
+            frame_pool->release(offered.index);
+            continue;
+        }
+
+        const int64_t start = esp_timer_get_time();
+        const uint8_t* src  = frame_pool->buffer(offered.index);
+        bool scaled         = true;
+        if (_vision_data.hardware) {
+            scaled = _vision_scale_ppa(ppa, src, frame);
+        } else {
+            _vision_scaler.scale(reinterpret_cast<const uint16_t*>(src), frame.data, frame.format);
+        }
+        frame_pool->release(offered.index);
+
+        if (!scaled) {
+            _vision_pool.cancel(frame);
+            continue;
+        }
+        if (_vision_data.hardware && frame.format == camera::IMAGE_GRAY8) {
+            camera::FrameScaler::rgb565_to_gray8(reinterpret_cast<const uint16_t*>(frame.data), frame.data,
+                                                 (size_t)frame.width * frame.height);
+        }
+        frame.sequence  = offered.sequence;
+        frame.captureUs = offered.captureUs;
+        _vision_pool.publish(frame);
+
+        const int64_t now    = esp_timer_get_time();
+        _vision_data.scaleUs = now - start;
+        fps_frames++;
+        if (now - fps_start_us >= 1000000) {
+            _vision_data.fps = fps_frames * 1000000.0f / (now - fps_start_us);
+            fps_frames       = 0;
+            fps_start_us     = now;
+        }
+    }
+    _close_frame_offer(_vision_data.offer);
+    _vision_pool.flush();
+    if (ppa) {
+        ppa_unregister_client(ppa);
+    }
+
+    _vision_data.mutex.lock();
+    _vision_data.isRunning = false;
+    _vision_data.mutex.unlock();
+
+    vTaskDelete(NULL);
+}
+
 void app_camera_display(void* arg)
 {
     /* camera config */
@@ -252,27 +790,24 @@ void app_camera_display(void* arg)
 
     struct v4l2_buffer buf;
 
-    /* */
-    uint16_t screen_width  = 1280;  // 640;//lcd_height();
-    uint16_t screen_height = 720;   // 480;//lcd_width();
-    uint8_t* img_show_data = NULL;
-    uint32_t img_show_size = screen_width * screen_height * 2;
-    // uint32_t img_offset = 280 * 720 * 2;
-    uint32_t img_offset = 0;
-    static image_t* img_show;  // 初始化静态变量时不能使用非常量表达式
-    if (img_show == NULL) {
-        img_show    = (image_t*)malloc(sizeof(image_t));
-        img_show->w = 720,            // screen_width;
-                                      // img_show->h = 720, // screen_height;
-            img_show->h      = 1280,  // screen_height;
-            img_show->pixfmt = PIXFORMAT_RGB565;
-        img_show->size       = img_show->w * img_show->h * img_show->bpp;
-        img_show_data        = (uint8_t*)heap_caps_calloc(img_show_size, 1, MALLOC_CAP_DMA | MALLOC_CAP_SPIRAM);
-        img_show->data       = img_show_data + img_offset;
-        if (img_show->data == NULL) {
-            ESP_LOGE(TAG, "malloc for img_show->data failed");
+    // Display slots, cache line aligned for the PPA
+    for (int i = 0; i < DISPLAY_SLOT_COUNT; i++) {
+        _pipeline.slots[i].data =
+            (uint8_t*)heap_caps_aligned_calloc(64, DISPLAY_FRAME_SIZE, 1, MALLOC_CAP_DMA | MALLOC_CAP_SPIRAM);
+        _pipeline.slots[i].state = SLOT_FREE;
+        if (_pipeline.slots[i].data == NULL) {
+            ESP_LOGE(TAG, "malloc for display slot %d failed", i);
         }
     }
+    _pipeline.returnQueue      = xQueueCreate(CAMERA_BUFFER_COUNT, sizeof(uint32_t));
+    _pipeline.frames           = 0;
+    _pipeline.dropped          = 0;
+    _pipeline.latencyUs        = 0;
+    _pipeline.latchedCaptureUs = 0;
+    _pipeline.fpsFrames        = 0;
+    _pipeline.fpsStartUs       = esp_timer_get_time();
+    _pipeline.fps              = 0.0f;
+    frame_pool->resetStats();
 
     ppa_client_handle_t ppa_srm_handle = NULL;
     ppa_client_config_t ppa_srm_config = {
@@ -280,9 +815,21 @@ void app_camera_display(void* arg)
         .max_pending_trans_num = 1,
     };
     ESP_ERROR_CHECK(ppa_register_client(&ppa_srm_config, &ppa_srm_handle));
+    ppa_event_callbacks_t ppa_callbacks = {
+        .on_trans_done = _on_ppa_mirror_done,
+    };
+    ESP_ERROR_CHECK(ppa_client_register_event_callbacks(ppa_srm_handle, &ppa_callbacks));
+
+    // Frames are paced by the sensor on this side and by the display refresh on the other
+    bsp_display_lock(0);
+    lv_display_add_event_cb(lv_display_get_default(), _on_display_refresh, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(lv_display_get_default(), _on_display_refresh, LV_EVENT_REFR_READY, NULL);
+    bsp_display_unlock();
 
     int task_control = 0;
     while (1) {
+        _return_capture_buffers();
+
         memset(&buf, 0, sizeof(buf));
         buf.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
         buf.memory = MEMORY_TYPE;
@@ -290,42 +837,55 @@ void app_camera_display(void* arg)
             ESP_LOGE(TAG, "failed to receive video frame");
             break;
         }
+        frame_pool->push(buf.index, buf.sequence, buf.timestamp.tv_sec * 1000000LL + buf.timestamp.tv_usec);
 
-        ppa_srm_oper_config_t srm_config = {.in             = {.buffer         = camera->buffer[buf.index],
-                                                               .pic_w          = 1280,
-                                                               .pic_h          = 720,
-                                                               .block_w        = 1280,
-                                                               .block_h        = 720,
-                                                               .block_offset_x = 0,
-                                                               .block_offset_y = 0,
-                                                               .srm_cm         = PPA_SRM_COLOR_MODE_RGB565},
-                                            .out            = {.buffer         = img_show_data,
-                                                               .buffer_size    = img_show_size,
-                                                               .pic_w          = 1280,
-                                                               .pic_h          = 720,
-                                                               .block_offset_x = 0,
-                                                               .block_offset_y = 0,
-                                                               .srm_cm         = PPA_SRM_COLOR_MODE_RGB565},
-                                            .rotation_angle = PPA_SRM_ROTATION_ANGLE_0,
-                                            .scale_x        = 1,
-                                            .scale_y        = 1,
-                                            .mirror_x       = true,
-                                            .mirror_y       = false,
-                                            .rgb_swap       = false,
-                                            .byte_swap      = false,
-                                            .mode           = PPA_TRANS_MODE_BLOCKING};
-        ppa_do_scale_rotate_mirror(ppa_srm_handle, &srm_config);
-
-        // auto detect_results = human_face_detector->run(dl_img); // format: hwc
+        _return_capture_buffers();
 
-        bsp_display_lock(0);
-        lv_canvas_set_buffer(camera_canvas, img_show->data, CAMERA_WIDTH, CAMERA_HEIGHT, LV_COLOR_FORMAT_RGB565);
-        bsp_display_unlock();
+        // One frame in the PPA at a time, the pool keeps the rest waiting or hands them back to the sensor
+        camera::FramePool::Frame_t frame;
+        if (!_is_mirroring() && frame_pool->acquire(frame, 0)) {
+            const int slot                     = _acquire_display_slot();
+            _pipeline.slots[slot].captureIndex = frame.index;
+            _pipeline.slots[slot].captureUs    = frame.dequeueUs;
+            _offer_capture_frame(_jpeg_capture_data.offer, frame);
+            _offer_capture_frame(_h264_record_data.offer, frame);
+            _offer_capture_frame(_vision_data.offer, frame);
 
-        if (ioctl(camera->fd, VIDIOC_QBUF, &buf) != 0) {
-            ESP_LOGE(TAG, "failed to free video frame");
+            ppa_srm_oper_config_t srm_config = {.in             = {.buffer         = frame.data,
+                                                                   .pic_w          = CAMERA_WIDTH,
+                                                                   .pic_h          = CAMERA_HEIGHT,
+                                                                   .block_w        = CAMERA_WIDTH,
+                                                                   .block_h        = CAMERA_HEIGHT,
+                                                                   .block_offset_x = 0,
+                                                                   .block_offset_y = 0,
+                                                                   .srm_cm         = PPA_SRM_COLOR_MODE_RGB565},
+                                                .out            = {.buffer         = _pipeline.slots[slot].data,
+                                                                   .buffer_size    = DISPLAY_FRAME_SIZE,
+                                                                   .pic_w          = CAMERA_WIDTH,
+                                                                   .pic_h          = CAMERA_HEIGHT,
+                                                                   .block_offset_x = 0,
+                                                                   .block_offset_y = 0,
+                                                                   .srm_cm         = PPA_SRM_COLOR_MODE_RGB565},
+                                                .rotation_angle = PPA_SRM_ROTATION_ANGLE_0,
+                                                .scale_x        = 1,
+                                                .scale_y        = 1,
+                                                .mirror_x       = true,
+                                                .mirror_y       = false,
+                                                .rgb_swap       = false,
+                                                .byte_swap      = false,
+                                                .mode           = PPA_TRANS_MODE_NON_BLOCKING,
+                                                .user_data      = (void*)(intptr_t)slot};
+            if (ppa_do_scale_rotate_mirror(ppa_srm_handle, &srm_config) != ESP_OK) {
+                portENTER_CRITICAL(&_pipeline.lock);
+                _pipeline.slots[slot].state = SLOT_FREE;
+                _pipeline.dropped++;
+                portEXIT_CRITICAL(&_pipeline.lock);
+                frame_pool->release(frame.index);
+            }
         }
 
+        // auto detect_results = human_face_detector->run(dl_img); // format: hwc
+
         if (xQueueReceive(queue_camera_ctrl, &task_control, 0) == pdPASS) {
             if (task_control == TASK_CONTROL_PAUSE) {
                 ESP_LOGI(TAG, "task pause");
@@ -338,20 +898,31 @@ void app_camera_display(void* arg)
                 }
             }
         }
-
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
 
     ESP_LOGI(TAG, "task exit");
+    bsp_display_lock(0);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), _on_display_refresh, NULL);
+    // The canvas still draws from the shown slot, freed below, and lives on until the panel deletes it
+    if (camera_canvas) {
+        lv_obj_add_flag(camera_canvas, LV_OBJ_FLAG_HIDDEN);
+        camera_canvas = nullptr;
+    }
+    bsp_display_unlock();
+
+    // Let the last mirror land before its buffers go away
+    while (_is_mirroring()) {
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    _return_capture_buffers();
     ppa_unregister_client(ppa_srm_handle);
+    vQueueDelete(_pipeline.returnQueue);
+    _pipeline.returnQueue = NULL;
     // delete human_face_detector;
-    if (img_show_data) {
-        heap_caps_free(img_show_data);
-        img_show_data = NULL;
-    }
-    if (img_show) {
-        heap_caps_free(img_show);
-        img_show = NULL;
+    for (int i = 0; i < DISPLAY_SLOT_COUNT; i++) {
+        heap_caps_free(_pipeline.slots[i].data);
+        _pipeline.slots[i].data  = nullptr;
+        _pipeline.slots[i].state = SLOT_FREE;
     }
     // close(camera->fd);
 
@@ -393,3 +964,248 @@ bool HalEsp32::isCameraCapturing()
     std::lock_guard<std::mutex> lock(camera_mutex);
     return is_camera_capturing;
 }
+
+hal::HalBase::CameraStats_t HalEsp32::getCameraStats()
+{
+    CameraStats_t ret;
+    portENTER_CRITICAL(&_pipeline.lock);
+    ret.fps       = _pipeline.fps;
+    ret.latencyMs = _pipeline.latencyUs / 1000;
+    ret.frames    = _pipeline.frames;
+    ret.dropped   = _pipeline.dropped;
+    portEXIT_CRITICAL(&_pipeline.lock);
+
+    if (frame_pool) {
+        auto pool            = frame_pool->stats();
+        ret.dropped         += pool.dropped + pool.sequenceGaps;
+        ret.queueDepth       = pool.maxQueueDepth;
+        ret.minDriverBuffers = pool.minDriverDepth;
+        ret.bufferCount      = frame_pool->config().bufferCount;
+        ret.frameIntervalUs  = pool.frameIntervalUs;
+    }
+    return ret;
+}
+
+bool HalEsp32::cameraSnapshot()
+{
+    return _start_jpeg_capture(this, camera::JpegCapture::MODE_SNAPSHOT, 0);
+}
+
+bool HalEsp32::startCameraBurst(uint32_t durationMs)
+{
+    return _start_jpeg_capture(this, camera::JpegCapture::MODE_BURST, durationMs);
+}
+
+void HalEsp32::stopCameraBurst()
+{
+    _jpeg_capture.finish();
+}
+
+hal::HalBase::CameraCaptureStatus_t HalEsp32::getCameraCaptureStatus()
+{
+    CameraCaptureStatus_t ret;
+    {
+        std::lock_guard<std::mutex> lock(_jpeg_capture_data.mutex);
+        ret.isCapturing = _jpeg_capture_data.isRunning;
+        ret.path        = _jpeg_capture_data.path;
+    }
+
+    auto stats      = _jpeg_capture.stats();
+    ret.frames      = stats.frames;
+    ret.dropped     = stats.droppedFrames;
+    ret.bytes       = stats.bytes;
+    ret.encodeUs    = stats.lastEncodeUs;
+    ret.avgEncodeUs = stats.avgEncodeUs;
+    ret.maxEncodeUs = stats.maxEncodeUs;
+    ret.fps         = stats.fps;
+    return ret;
+}
+
+bool HalEsp32::startCameraRecord(const CameraRecordConfig_t& config)
+{
+    std::lock_guard<std::mutex> lock(_h264_record_data.mutex);
+    if (_h264_record_data.isRunning) {
+        mclog::tagWarn(TAG, "record is running");
+        return false;
+    }
+    if (!isCameraCapturing()) {
+        mclog::tagWarn(TAG, "camera is not running");
+        return false;
+    }
+
+    if (!sdCardAcquire()) {
+        return false;
+    }
+    mkdir(CAPTURE_DIR, 0775);
+
+    camera::H264Config_t h264_config;
+    h264_config.bitrate = config.bitrate;
+    h264_config.gop     = config.gop;
+
+    const auto container   = config.mp4 ? camera::H264Recorder::CONTAINER_MP4 : camera::H264Recorder::CONTAINER_ANNEX_B;
+    const std::string path = camera::JpegCapture::next_free_path(CAPTURE_DIR, "vid_", config.mp4 ? "mp4" : "h264");
+    if (!_h264_recorder.start(path, container, CAMERA_WIDTH, CAMERA_HEIGHT, h264_config)) {
+        mclog::tagError(TAG, "open {} failed", path);
+        sdCardRelease();
+        return false;
+    }
+    mclog::tagInfo(TAG, "record to {}", path);
+
+    _open_frame_offer(_h264_record_data.offer);
+    _h264_record_data.path       = path;
+    _h264_record_data.encodeDone = false;
+    _h264_record_data.isRunning  = true;
+
+    xTaskCreatePinnedToCore(_h264_record_encode_task, "cam_h264", RECORD_ENCODE_STACK, nullptr, 4, nullptr, 1);
+    xTaskCreatePinnedToCore(_h264_record_writer_task, "cam_rec", 4096, this, 2, nullptr, 0);
+    return true;
+}
+
+void HalEsp32::stopCameraRecord()
+{
+    _h264_recorder.finish();
+}
+
+hal::HalBase::CameraRecordStatus_t HalEsp32::getCameraRecordStatus()
+{
+    CameraRecordStatus_t ret;
+    {
+        std::lock_guard<std::mutex> lock(_h264_record_data.mutex);
+        ret.isRecording = _h264_record_data.isRunning;
+        ret.path        = _h264_record_data.path;
+    }
+
+    auto stats      = _h264_recorder.stats();
+    ret.frames      = stats.frames;
+    ret.dropped     = stats.droppedFrames;
+    ret.bytes       = stats.bytes;
+    ret.bitrate     = stats.bitrate;
+    ret.fps         = stats.fps;
+    ret.encodeUs    = stats.lastEncodeUs;
+    ret.avgEncodeUs = stats.avgEncodeUs;
+    ret.queued      = stats.queuedChunks;
+    ret.maxQueued   = stats.maxQueuedChunks;
+    ret.queueSize   = stats.chunks;
+    return ret;
+}
+
+static void _to_vision_frame(const camera::VisionFramePool::Frame_t& frame, hal::HalBase::CameraVisionFrame_t& out)
+{
+    out.data      = frame.data;
+    out.width     = frame.width;
+    out.height    = frame.height;
+    out.gray      = frame.format == camera::IMAGE_GRAY8;
+    out.sequence  = frame.sequence;
+    out.captureUs = frame.captureUs;
+    out.slot      = frame.slot;
+}
+
+bool HalEsp32::startCameraVision(const CameraVisionConfig_t& config)
+{
+    std::lock_guard<std::mutex> lock(_vision_data.mutex);
+    if (_vision_data.isRunning) {
+        mclog::tagWarn(TAG, "vision is running");
+        return false;
+    }
+    if (!isCameraCapturing()) {
+        mclog::tagWarn(TAG, "camera is not running");
+        return false;
+    }
+
+    camera::Roi_t roi;
+    roi.x      = config.roiX;
+    roi.y      = config.roiY;
+    roi.width  = config.roiWidth;
+    roi.height = config.roiHeight;
+    if (!_vision_scaler.configure(CAMERA_WIDTH, CAMERA_HEIGHT, roi, config.width, config.height)) {
+        mclog::tagWarn(TAG, "vision roi {},{} {}x{} cannot scale to {}x{}", roi.x, roi.y, roi.width, roi.height,
+                       config.width, config.height);
+        return false;
+    }
+
+    camera::VisionFramePool::Config_t pool_config;
+    pool_config.width     = config.width;
+    pool_config.height    = config.height;
+    pool_config.format    = config.gray ? camera::IMAGE_GRAY8 : camera::IMAGE_RGB565;
+    pool_config.slotCount = VISION_SLOT_COUNT;
+    if (!_vision_pool.configure(pool_config)) {
+        mclog::tagWarn(TAG, "vision frames are still held");
+        return false;
+    }
+
+    // Slots take RGB565 whatever the format, that is what the PPA writes, and whole cache lines for its DMA. They are
+    // only ever grown, a late reader may still be looking at one after a stop.
+    const size_t bytes = (camera::image_bytes(config.width, config.height, camera::IMAGE_RGB565) + 63) & ~(size_t)63;
+    if (bytes > _vision_data.slotBytes) {
+        for (int i = 0; i < VISION_SLOT_COUNT; i++) {
+            heap_caps_free(_vision_data.slots[i]);
+            _vision_data.slots[i] = (uint8_t*)heap_caps_aligned_calloc(64, bytes, 1, CAMERA_BUFFER_CAPS);
+            if (_vision_data.slots[i] == nullptr) {
+                mclog::tagError(TAG, "malloc for vision slot {} failed", i);
+                _vision_data.slotBytes = 0;
+                return false;
+            }
+        }
+        _vision_data.slotBytes = bytes;
+    }
+    for (int i = 0; i < VISION_SLOT_COUNT; i++) {
+        _vision_pool.setBuffer(i, _vision_data.slots[i], _vision_data.slotBytes);
+    }
+    _vision_pool.resetStats();
+
+    const camera::Roi_t& clipped = _vision_scaler.roi();
+    _vision_data.hardware        = (config.width * PPA_SCALE_STEPS) % clipped.width == 0 &&
+                                   (config.height * PPA_SCALE_STEPS) % clipped.height == 0;
+    mclog::tagInfo(TAG, "vision {},{} {}x{} to {}x{} {}, {}", clipped.x, clipped.y, clipped.width, clipped.height,
+                   config.width, config.height, config.gray ? "gray" : "rgb565",
+                   _vision_data.hardware ? "ppa" : "software");
+
+    _open_frame_offer(_vision_data.offer);
+    _vision_data.stopRequested = false;
+    _vision_data.scaleUs       = 0;
+    _vision_data.fps           = 0.0f;
+    _vision_data.isRunning     = true;
+
+    xTaskCreatePinnedToCore(_vision_task, "cam_cv", VISION_STACK, nullptr, 3, nullptr, 1);
+    return true;
+}
+
+void HalEsp32::stopCameraVision()
+{
+    _vision_data.stopRequested = true;
+}
+
+bool HalEsp32::acquireCameraVisionFrame(CameraVisionFrame_t& frame, uint32_t timeoutMs)
+{
+    camera::VisionFramePool::Frame_t pool_frame;
+    if (!_vision_pool.acquire(pool_frame, timeoutMs)) {
+        return false;
+    }
+    _to_vision_frame(pool_frame, frame);
+    return true;
+}
+
+void HalEsp32::releaseCameraVisionFrame(const CameraVisionFrame_t& frame)
+{
+    camera::VisionFramePool::Frame_t pool_frame;
+    pool_frame.slot = frame.slot;
+    _vision_pool.release(pool_frame);
+}
+
+hal::HalBase::CameraVisionStatus_t HalEsp32::getCameraVisionStatus()
+{
+    CameraVisionStatus_t ret;
+    {
+        std::lock_guard<std::mutex> lock(_vision_data.mutex);
+        ret.isRunning = _vision_data.isRunning;
+        ret.hardware  = _vision_data.hardware;
+    }
+
+    auto stats     = _vision_pool.stats();
+    ret.frames     = stats.published;
+    ret.consumed   = stats.consumed;
+    ret.superseded = stats.superseded;
+    ret.scaleUs    = _vision_data.scaleUs;
+    ret.fps        = _vision_data.fps;
+    return ret;
+}
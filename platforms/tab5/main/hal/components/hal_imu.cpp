@@ -17,12 +17,117 @@
 #include "freertos/queue.h"
 #include "esp_timer.h"
 #include "accel_gyro_bmi270.h"
+#include <apps/utils/imu/attitude_estimator.h>
+#include <cstdlib>
+#include <mutex>
 
 static const std::string _tag = "imu";
 
+/* -------------------------------------------------------------------------- */
+/*                               Attitude fusion                              */
+/* -------------------------------------------------------------------------- */
+// Estimator frame, right handed, the axes imuData's gyro always had: x = sensor y, y = sensor x, z = -sensor z
+static constexpr float kAccelLsbPerG      = 8192.0f;  // ±4 g
+static constexpr float kGyroLsbPerDps     = 32.768f;  // ±1000 °/s
+static constexpr uint32_t kSamplePeriodUs = 5000;     // 200 Hz ODR
+static constexpr uint32_t kDrainPeriodMs  = 20;
+static constexpr uint16_t kMaxBatch       = 32;
+static constexpr int32_t kResyncUs        = 20000;
+
+struct ImuFusionData_t {
+    std::once_flag startFlag;
+    std::mutex driverMutex;  // the bmi270 driver is not reentrant, the irq and sleep paths share it
+    bool stop                = false;
+    bool timestamped         = false;
+    uint32_t lastTimestampUs = 0;
+};
+static ImuFusionData_t _imu_fusion_data;
+static imu::AttitudeEstimator _attitude_estimator;
+
+static uint32_t first_sample_timestamp(uint16_t frames)
+{
+    // The newest frame is about as old as the read, the ones before it one ODR period apart
+    uint32_t first = static_cast<uint32_t>(esp_timer_get_time()) - ((frames - 1) * kSamplePeriodUs);
+    if (_imu_fusion_data.timestamped) {
+        // Carry on from the last batch and slew towards the clock, the ODR is steadier than the task wake ups
+        const uint32_t next = _imu_fusion_data.lastTimestampUs + kSamplePeriodUs;
+        const int32_t error = static_cast<int32_t>(first - next);
+        if (std::abs(error) < kResyncUs) {
+            first = next + (error / 16);
+        }
+    }
+    _imu_fusion_data.timestamped     = true;
+    _imu_fusion_data.lastTimestampUs = first + ((frames - 1) * kSamplePeriodUs);
+    return first;
+}
+
+static void _imu_fusion_task(void* param)
+{
+    mclog::tagInfo(_tag, "imu fusion task start on core {}", xPortGetCoreID());
+
+    static struct bmi2_sens_axes_data accel[kMaxBatch];
+    static struct bmi2_sens_axes_data gyro[kMaxBatch];
+    static imu::ImuSample_t samples[kMaxBatch];
+
+    {
+        std::lock_guard<std::mutex> lock(_imu_fusion_data.driverMutex);
+        if (!accel_gyro_bmi270_enable_fifo()) {
+            mclog::tagError(_tag, "enable fifo failed");
+        }
+    }
+
+    while (true) {
+        uint16_t frames = 0;
+        {
+            std::lock_guard<std::mutex> lock(_imu_fusion_data.driverMutex);
+            if (_imu_fusion_data.stop) {
+                break;
+            }
+            frames = accel_gyro_bmi270_read_fifo(accel, gyro, kMaxBatch);
+        }
+
+        if (frames > 0) {
+            uint32_t timestamp = first_sample_timestamp(frames);
+            for (uint16_t i = 0; i < frames; i++) {
+                imu::ImuSample_t& sample = samples[i];
+                sample.timestampUs       = timestamp;
+                sample.accel[0]          = accel[i].y / kAccelLsbPerG;
+                sample.accel[1]          = accel[i].x / kAccelLsbPerG;
+                sample.accel[2]          = -accel[i].z / kAccelLsbPerG;
+                sample.gyro[0]           = gyro[i].y / kGyroLsbPerDps;
+                sample.gyro[1]           = gyro[i].x / kGyroLsbPerDps;
+                sample.gyro[2]           = -gyro[i].z / kGyroLsbPerDps;
+                timestamp += kSamplePeriodUs;
+            }
+            _attitude_estimator.process(samples, frames);
+        }
+
+        // A full batch means the fifo still holds more
+        if (frames < kMaxBatch) {
+            vTaskDelay(pdMS_TO_TICKS(kDrainPeriodMs));
+        }
+    }
+
+    mclog::tagInfo(_tag, "imu fusion task stop");
+    vTaskDelete(nullptr);
+}
+
+static imu::AttitudeEstimator& attitude_estimator()
+{
+    std::call_once(_imu_fusion_data.startFlag, []() {
+        // Core 1 next to the audio io, one short i2c burst every drain period
+        xTaskCreatePinnedToCore(_imu_fusion_task, "imu_fusion", 4096, nullptr, 5, nullptr, 1);
+    });
+    return _attitude_estimator;
+}
+
 void HalEsp32::clearImuIrq()
 {
     mclog::tagInfo(_tag, "clear imu irq");
+
+    // Only ahead of sleep or power off, the fusion task is not restarted
+    std::lock_guard<std::mutex> lock(_imu_fusion_data.driverMutex);
+    _imu_fusion_data.stop = true;
     accel_gyro_bmi270_init(bsp_i2c_get_handle());
     if (accel_gyro_bmi270_check_irq()) {
         accel_gyro_bmi270_clear_irq_int();
@@ -44,16 +149,24 @@ void HalEsp32::imu_init()
 
 void HalEsp32::updateImuData()
 {
-    static struct bmi2_sens_data bmi_sensor_data;
-    accel_gyro_bmi270_get_data(&bmi_sensor_data);
+    // Latest fifo sample, no i2c traffic here
+    imu::Attitude_t attitude;
+    getImuAttitude(attitude);
+    const imu::ImuSample_t& sample = attitude.sample;
 
     /* 根据设置量程转换 */
-    imuData.accelX = bmi_sensor_data.acc.y / 835.92 / 10.0f;  // m/s^2
-    imuData.accelY = -bmi_sensor_data.acc.x / 835.92 / 10.0f;
-    imuData.accelZ = -bmi_sensor_data.acc.z / 835.92 / 10.0f;
-    imuData.gyroX  = bmi_sensor_data.gyr.y / 32.768 / 10.0f;  // °/s   gyro_raw*2*1000/2^16 --> 0.0305
-    imuData.gyroY  = bmi_sensor_data.gyr.x / 32.768 / 10.0f;
-    imuData.gyroZ  = -bmi_sensor_data.gyr.z / 32.768 / 10.0f;
+    imuData.accelX = sample.accel[0] * 9.8f / 10.0f;  // m/s^2
+    imuData.accelY = -sample.accel[1] * 9.8f / 10.0f;
+    imuData.accelZ = sample.accel[2] * 9.8f / 10.0f;
+    imuData.gyroX  = sample.gyro[0] / 10.0f;  // °/s
+    imuData.gyroY  = sample.gyro[1] / 10.0f;
+    imuData.gyroZ  = sample.gyro[2] / 10.0f;
+}
+
+bool HalEsp32::getImuAttitude(imu::Attitude_t& attitude)
+{
+    attitude = attitude_estimator().attitude();
+    return attitude.sampleCount > 0;
 }
 
 void HalEsp32::sleepAndShakeWakeup()
@@ -9,10 +9,12 @@ extern "C" {
 }
 #include <mooncake_log.h>
 #include <esp_timer.h>
+#include <esp_heap_caps.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <bsp/m5stack_tab5.h>
 #include <lv_demos.h>
+#include <algorithm>
 
 extern esp_lcd_touch_handle_t _lcd_touch_handle;
 
@@ -44,6 +46,29 @@ static void lvgl_read_cb(lv_indev_t* indev, lv_indev_data_t* data)
     }
 }
 
+// Decoded images sit in the lvgl image cache, keep them in psram whatever their size instead of letting the small ones
+// take internal ram
+static void* _image_cache_malloc(size_t size, lv_color_format_t cf)
+{
+    LV_UNUSED(cf);
+    return heap_caps_malloc(size + LV_DRAW_BUF_ALIGN - 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+
+static void _image_cache_free(void* buf)
+{
+    heap_caps_free(buf);
+}
+
+static void _image_cache_use_psram()
+{
+    // Separate handlers for decoded images came with lvgl 9.2, older versions keep them in the default heap
+#if LVGL_VERSION_MAJOR > 9 || (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 2)
+    auto* handlers          = lv_draw_buf_get_image_handlers();
+    handlers->buf_malloc_cb = _image_cache_malloc;
+    handlers->buf_free_cb   = _image_cache_free;
+#endif
+}
+
 void HalEsp32::init()
 {
     mclog::tagInfo(_tag, "init");
@@ -97,11 +122,14 @@ void HalEsp32::init()
 #else
                                  .buff_dma = true,
 #endif
-                                 .buff_spiram = true,
-                                 .sw_rotate   = true,
+                                 .buff_spiram  = true,
+                                 .sw_rotate    = true,
+                                 .async_flush  = true,
+                                 .rotate_to_fb = true,
                              }};
     lvDisp = bsp_display_start_with_config(&cfg);
     lv_display_set_rotation(lvDisp, LV_DISPLAY_ROTATION_90);
+    _image_cache_use_psram();
     bsp_display_backlight_on();
 
     // // Touchpad lvgl indev
@@ -206,6 +234,26 @@ int HalEsp32::getCpuTemp()
     return temp;
 }
 
+std::vector<float> HalEsp32::getCpuCoreLoads()
+{
+    // Idle task run time against wall time, the run time stats clock is esp_timer so both are in us
+    static uint32_t last_idle[configNUMBER_OF_CORES] = {};
+    static int64_t last_us                           = 0;
+
+    std::vector<float> ret;
+    int64_t now_us = esp_timer_get_time();
+    for (int core = 0; core < configNUMBER_OF_CORES; core++) {
+        uint32_t idle = ulTaskGetIdleRunTimeCounterForCore(core);
+        if (last_us > 0 && now_us > last_us) {
+            float idle_ratio = (float)(uint32_t)(idle - last_idle[core]) / (float)(now_us - last_us);
+            ret.push_back(std::clamp(100.0f * (1.0f - idle_ratio), 0.0f, 100.0f));
+        }
+        last_idle[core] = idle;
+    }
+    last_us = now_us;
+    return ret;
+}
+
 /* -------------------------------------------------------------------------- */
 /*                                   Display                                  */
 /* -------------------------------------------------------------------------- */
@@ -221,6 +269,40 @@ uint8_t HalEsp32::getDisplayBrightness()
     return _current_lcd_brightness;
 }
 
+hal::HalBase::DisplayFlushStats_t HalEsp32::getDisplayFlushStats()
+{
+    // Averages over the interval since the previous call
+    static lvgl_port_flush_stats_t last = {};
+    static int64_t last_us              = 0;
+
+    DisplayFlushStats_t ret;
+    lvgl_port_flush_stats_t now = {};
+    if (lvDisp == nullptr || lvgl_port_get_flush_stats(lvDisp, &now) != ESP_OK) {
+        return ret;
+    }
+    int64_t now_us = esp_timer_get_time();
+
+    uint32_t n = now.flushes - last.flushes;
+    if (n > 0) {
+        ret.flushes    = n;
+        ret.renderUs   = (now.render_us - last.render_us) / n;
+        ret.waitUs     = (now.wait_us - last.wait_us) / n;
+        ret.rotateUs   = (now.rotate_us - last.rotate_us) / n;
+        ret.queueUs    = (now.queue_us - last.queue_us) / n;
+        ret.transferUs = (now.transfer_us - last.transfer_us) / n;
+        ret.latencyUs  = (now.latency_us - last.latency_us) / n;
+        ret.frameUs    = last_us > 0 ? (now_us - last_us) / n : 0;
+    }
+    if (last_us > 0 && now_us > last_us) {
+        ret.bytesPerSecond = (now.transfer_bytes - last.transfer_bytes) * 1000000 / (now_us - last_us);
+    }
+    ret.partialRefreshes = now.partial_refreshes - last.partial_refreshes;
+    ret.fullRefreshes    = now.full_refreshes - last.full_refreshes;
+    last    = now;
+    last_us = now_us;
+    return ret;
+}
+
 void HalEsp32::lvglLock()
 {
     lvgl_port_lock(0);
@@ -269,19 +351,44 @@ void HalEsp32::update_system_time()
 /* -------------------------------------------------------------------------- */
 #include <dirent.h>
 #include <sys/types.h>
+#include <mutex>
 
 bool HalEsp32::isSdCardMounted()
 {
     return true;
 }
 
+static std::mutex _sd_card_mutex;
+static int _sd_card_users = 0;
+
+bool HalEsp32::sdCardAcquire()
+{
+    std::lock_guard<std::mutex> lock(_sd_card_mutex);
+    if (_sd_card_users == 0) {
+        mclog::tagInfo(_tag, "init sd card");
+        if (bsp_sdcard_init("/sd", 25) != ESP_OK) {
+            mclog::error("failed to mount sd card");
+            return false;
+        }
+    }
+    _sd_card_users++;
+    return true;
+}
+
+void HalEsp32::sdCardRelease()
+{
+    std::lock_guard<std::mutex> lock(_sd_card_mutex);
+    if (_sd_card_users > 0 && --_sd_card_users == 0) {
+        mclog::tagInfo(_tag, "deinit sd card");
+        bsp_sdcard_deinit("/sd");
+    }
+}
+
 std::vector<hal::HalBase::FileEntry_t> HalEsp32::scanSdCard(const std::string& dirPath)
 {
     std::vector<hal::HalBase::FileEntry_t> file_entries;
 
-    mclog::tagInfo(_tag, "init sd card");
-    if (bsp_sdcard_init("/sd", 25) != ESP_OK) {
-        mclog::error("failed to mount sd card");
+    if (!sdCardAcquire()) {
         return file_entries;
     }
 
@@ -290,6 +397,7 @@ std::vector<hal::HalBase::FileEntry_t> HalEsp32::scanSdCard(const std::string& d
     DIR* dir = opendir(target_path.c_str());
     if (dir == nullptr) {
         mclog::error("failed to open directory: {}", target_path);
+        sdCardRelease();
         return file_entries;
     }
 
@@ -307,8 +415,7 @@ std::vector<hal::HalBase::FileEntry_t> HalEsp32::scanSdCard(const std::string& d
 
     closedir(dir);
 
-    mclog::tagInfo(_tag, "deinit sd card");
-    bsp_sdcard_deinit("/sd");
+    sdCardRelease();
 
     return file_entries;
 }
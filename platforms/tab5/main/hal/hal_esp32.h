@@ -21,6 +21,7 @@ public:
     void delay(uint32_t ms) override;
     uint32_t millis() override;
     int getCpuTemp() override;
+    std::vector<float> getCpuCoreLoads() override;
 
     INA226 ina226;
     RX8130_Class rx8130;
@@ -29,12 +30,14 @@ public:
 
     void setDisplayBrightness(uint8_t brightness) override;
     uint8_t getDisplayBrightness() override;
+    DisplayFlushStats_t getDisplayFlushStats() override;
 
     void lvglLock() override;
     void lvglUnlock() override;
 
     void updatePowerMonitorData() override;
     void updateImuData() override;
+    bool getImuAttitude(imu::Attitude_t& attitude) override;
     void clearImuIrq() override;
 
     void clearRtcIrq() override;
@@ -56,20 +59,57 @@ public:
     void startCameraCapture(lv_obj_t* imgCanvas) override;
     void stopCameraCapture() override;
     bool isCameraCapturing() override;
+    CameraStats_t getCameraStats() override;
+    bool cameraSnapshot() override;
+    bool startCameraBurst(uint32_t durationMs) override;
+    void stopCameraBurst() override;
+    CameraCaptureStatus_t getCameraCaptureStatus() override;
+    bool startCameraRecord(const CameraRecordConfig_t& config) override;
+    void stopCameraRecord() override;
+    CameraRecordStatus_t getCameraRecordStatus() override;
+    bool startCameraVision(const CameraVisionConfig_t& config) override;
+    void stopCameraVision() override;
+    bool acquireCameraVisionFrame(CameraVisionFrame_t& frame, uint32_t timeoutMs) override;
+    void releaseCameraVisionFrame(const CameraVisionFrame_t& frame) override;
+    CameraVisionStatus_t getCameraVisionStatus() override;
 
     void setSpeakerVolume(uint8_t volume) override;
     uint8_t getSpeakerVolume() override;
     void audioRecord(std::vector<int16_t>& data, uint16_t durationMs, float gain = 80.0f) override;
     void audioPlay(std::vector<int16_t>& data, bool async = true) override;
+    void setAudioCaptureCallback(AudioCaptureCallback_t callback) override;
+    void setAudioPlaybackCallback(AudioPlaybackCallback_t callback) override;
+    size_t audioPushPlayback(const int16_t* data, size_t frames) override;
+    size_t audioPullCapture(int16_t* data, size_t frames) override;
+    AudioIoStats_t getAudioIoStats() override;
+    void setMicGain(float gain) override;
+    bool getAudioCaptureSnapshot(audio::CaptureSnapshot_t& snapshot) override;
+    bool audioAddSource(audio::MixerSource* source) override;
+    void audioRemoveSource(audio::MixerSource* source) override;
     void startDualMicRecordTest() override;
     MicTestState_t getDualMicRecordTestState() override;
     void startHeadphoneMicRecordTest() override;
     MicTestState_t getHeadphoneMicRecordTestState() override;
+    bool startAudioRecord(AudioRecordFormat_t format, bool dualMic = true) override;
+    void stopAudioRecord() override;
+    bool isAudioRecording() override;
+    std::string getAudioRecordPath() override;
+    AudioRecordStats_t getAudioRecordStats() override;
+    bool audioPlayerEnqueue(const std::string& path) override;
+    void audioPlayerStop() override;
+    void audioPlayerPause(bool pause) override;
+    void audioPlayerSkip() override;
+    void audioPlayerSeek(uint32_t positionMs) override;
+    AudioPlayerStatus_t getAudioPlayerStatus() override;
     void startPlayMusicTest() override;
     MusicPlayState_t getMusicPlayTestState() override;
     void stopPlayMusicTest() override;
     void playStartupSfx() override;
     void playShutdownSfx() override;
+    void startAudioDsp() override;
+    void stopAudioDsp() override;
+    bool isAudioDspRunning() override;
+    AudioDspStats_t getAudioDspStats() override;
 
     void setExtAntennaEnable(bool enable) override;
     bool getExtAntennaEnable() override;
@@ -77,6 +117,9 @@ public:
 
     bool isSdCardMounted() override;
     std::vector<FileEntry_t> scanSdCard(const std::string& dirPath) override;
+    // The recorder, the player, the camera capture and recording and scanSdCard share one mount, the last user unmounts
+    bool sdCardAcquire();
+    void sdCardRelease();
 
     bool usbCDetect() override;
     bool usbADetect() override;
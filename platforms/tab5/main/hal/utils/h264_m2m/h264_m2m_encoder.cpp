@@ -0,0 +1,277 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "h264_m2m_encoder.h"
+#include <algorithm>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "linux/videodev2.h"
+#include "esp_video_device.h"
+
+static const char* TAG = "h264-m2m";
+
+// Limits of the esp_video H.264 device
+#define H264_MAX_BITRATE  2500000
+#define H264_MIN_BITRATE  25000
+#define H264_BITRATE_STEP 25000
+#define H264_MAX_I_PERIOD 120
+
+H264M2mEncoder::~H264M2mEncoder()
+{
+    close_device();
+}
+
+void H264M2mEncoder::configure(const camera::H264Config_t& config)
+{
+    _config = config;
+    _reopen = true;
+}
+
+const uint8_t* H264M2mEncoder::encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes)
+{
+    if (rgb565 == nullptr || width == 0 || height == 0) {
+        return nullptr;
+    }
+    if (_reopen || _fd < 0 || width != _width || height != _height) {
+        close_device();
+        _reopen = false;
+        if (!open_device(width, height)) {
+            close_device();
+            return nullptr;
+        }
+    }
+
+    if (!convert(rgb565)) {
+        return nullptr;
+    }
+
+    // The previous access unit is given up here, its buffer takes the next one
+    struct v4l2_buffer capture_buf;
+    memset(&capture_buf, 0, sizeof(capture_buf));
+    capture_buf.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    capture_buf.memory = V4L2_MEMORY_MMAP;
+    capture_buf.index  = 0;
+    if (!_capture_queued) {
+        if (ioctl(_fd, VIDIOC_QBUF, &capture_buf) != 0) {
+            ESP_LOGE(TAG, "failed to queue capture buffer");
+            return nullptr;
+        }
+        _capture_queued = true;
+    }
+
+    struct v4l2_buffer output_buf;
+    memset(&output_buf, 0, sizeof(output_buf));
+    output_buf.type      = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    output_buf.memory    = V4L2_MEMORY_USERPTR;
+    output_buf.index     = 0;
+    output_buf.m.userptr = (unsigned long)_yuv_buffer;
+    output_buf.length    = _yuv_length;
+    if (ioctl(_fd, VIDIOC_QBUF, &output_buf) != 0) {
+        ESP_LOGE(TAG, "failed to queue frame");
+        return nullptr;
+    }
+
+    const bool encoded = ioctl(_fd, VIDIOC_DQBUF, &capture_buf) == 0;
+    _capture_queued    = !encoded;
+    if (ioctl(_fd, VIDIOC_DQBUF, &output_buf) != 0) {
+        ESP_LOGE(TAG, "failed to dequeue frame");
+    }
+    if (!encoded || capture_buf.bytesused == 0) {
+        ESP_LOGE(TAG, "encode failed");
+        return nullptr;
+    }
+
+    bytes = capture_buf.bytesused;
+    return _capture_buffer;
+}
+
+// RGB565 to the encoder's YUV420 layout, limited range BT.601, which is what a decoder assumes without VUI
+bool H264M2mEncoder::convert(const uint8_t* rgb565)
+{
+    ppa_srm_oper_config_t srm_config = {};
+    srm_config.in.buffer             = rgb565;
+    srm_config.in.pic_w              = _width;
+    srm_config.in.pic_h              = _height;
+    srm_config.in.block_w            = _width;
+    srm_config.in.block_h            = _height;
+    srm_config.in.srm_cm             = PPA_SRM_COLOR_MODE_RGB565;
+    srm_config.out.buffer            = _yuv_buffer;
+    srm_config.out.buffer_size       = _yuv_length;
+    srm_config.out.pic_w             = _width;
+    srm_config.out.pic_h             = _height;
+    srm_config.out.srm_cm            = PPA_SRM_COLOR_MODE_YUV420;
+    srm_config.out.yuv_range         = PPA_COLOR_RANGE_LIMIT;
+    srm_config.out.yuv_std           = PPA_COLOR_CONV_STD_RGB_YUV_BT601;
+    srm_config.rotation_angle        = PPA_SRM_ROTATION_ANGLE_0;
+    srm_config.scale_x               = 1;
+    srm_config.scale_y               = 1;
+    srm_config.mode                  = PPA_TRANS_MODE_BLOCKING;
+    if (ppa_do_scale_rotate_mirror(_ppa, &srm_config) != ESP_OK) {
+        ESP_LOGE(TAG, "color conversion failed");
+        return false;
+    }
+    return true;
+}
+
+bool H264M2mEncoder::open_device(uint16_t width, uint16_t height)
+{
+    // 12 bits a pixel, padded to whole cache lines for the PPA
+    _yuv_length = ((size_t)width * height * 3 / 2 + 63) & ~(size_t)63;
+    _yuv_buffer = (uint8_t*)heap_caps_aligned_calloc(64, _yuv_length, 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA);
+    if (_yuv_buffer == nullptr) {
+        ESP_LOGE(TAG, "failed to allocate %u byte frame", (unsigned)_yuv_length);
+        return false;
+    }
+
+    ppa_client_config_t ppa_config   = {};
+    ppa_config.oper_type             = PPA_OPERATION_SRM;
+    ppa_config.max_pending_trans_num = 1;
+    if (ppa_register_client(&ppa_config, &_ppa) != ESP_OK) {
+        ESP_LOGE(TAG, "failed to register ppa client");
+        return false;
+    }
+
+    _fd = open(ESP_VIDEO_H264_DEVICE_NAME, O_RDONLY);
+    if (_fd < 0) {
+        ESP_LOGE(TAG, "failed to open %s", ESP_VIDEO_H264_DEVICE_NAME);
+        return false;
+    }
+
+    // The device budgets frames by the I period, so a GOP other than the frame rate scales the real bitrate with it
+    const int bitrate = std::clamp<int>(_config.bitrate / H264_BITRATE_STEP * H264_BITRATE_STEP, H264_MIN_BITRATE,
+                                        H264_MAX_BITRATE);
+    struct v4l2_ext_controls controls;
+    struct v4l2_ext_control control[4];
+    memset(&controls, 0, sizeof(controls));
+    memset(control, 0, sizeof(control));
+    controls.ctrl_class = V4L2_CID_CODEC_CLASS;
+    controls.count      = 4;
+    controls.controls   = control;
+    control[0].id       = V4L2_CID_MPEG_VIDEO_H264_I_PERIOD;
+    control[0].value    = std::clamp<int>(_config.gop, 1, H264_MAX_I_PERIOD);
+    control[1].id       = V4L2_CID_MPEG_VIDEO_BITRATE;
+    control[1].value    = bitrate;
+    control[2].id       = V4L2_CID_MPEG_VIDEO_H264_MIN_QP;
+    control[2].value    = std::min<int>(_config.minQp, 51);
+    control[3].id       = V4L2_CID_MPEG_VIDEO_H264_MAX_QP;
+    control[3].value    = std::clamp<int>(_config.maxQp, control[2].value, 51);
+    if (ioctl(_fd, VIDIOC_S_EXT_CTRLS, &controls) != 0) {
+        ESP_LOGW(TAG, "failed to set encoder controls");
+    }
+
+    // YUV420 frames in on the output queue
+    struct v4l2_format format;
+    memset(&format, 0, sizeof(format));
+    format.type                = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    format.fmt.pix.width       = width;
+    format.fmt.pix.height      = height;
+    format.fmt.pix.pixelformat = V4L2_PIX_FMT_YUV420;
+    if (ioctl(_fd, VIDIOC_S_FMT, &format) != 0) {
+        ESP_LOGE(TAG, "failed to set output format");
+        return false;
+    }
+
+    struct v4l2_requestbuffers req;
+    memset(&req, 0, sizeof(req));
+    req.count  = 1;
+    req.type   = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    req.memory = V4L2_MEMORY_USERPTR;
+    if (ioctl(_fd, VIDIOC_REQBUFS, &req) != 0) {
+        ESP_LOGE(TAG, "failed to request output buffer");
+        return false;
+    }
+
+    // Annex-B access units out on the capture queue
+    memset(&format, 0, sizeof(format));
+    format.type                = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    format.fmt.pix.width       = width;
+    format.fmt.pix.height      = height;
+    format.fmt.pix.pixelformat = V4L2_PIX_FMT_H264;
+    if (ioctl(_fd, VIDIOC_S_FMT, &format) != 0) {
+        ESP_LOGE(TAG, "failed to set capture format");
+        return false;
+    }
+
+    memset(&req, 0, sizeof(req));
+    req.count  = 1;
+    req.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(_fd, VIDIOC_REQBUFS, &req) != 0) {
+        ESP_LOGE(TAG, "failed to request capture buffer");
+        return false;
+    }
+
+    struct v4l2_buffer buf;
+    memset(&buf, 0, sizeof(buf));
+    buf.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    buf.index  = 0;
+    if (ioctl(_fd, VIDIOC_QUERYBUF, &buf) != 0) {
+        ESP_LOGE(TAG, "failed to query capture buffer");
+        return false;
+    }
+    _capture_buffer = (uint8_t*)mmap(NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, buf.m.offset);
+    if (_capture_buffer == nullptr) {
+        ESP_LOGE(TAG, "failed to map capture buffer");
+        return false;
+    }
+    _capture_length = buf.length;
+    if (ioctl(_fd, VIDIOC_QBUF, &buf) != 0) {
+        ESP_LOGE(TAG, "failed to queue capture buffer");
+        return false;
+    }
+    _capture_queued = true;
+
+    // The encoder is created when the capture stream starts, with the controls above
+    int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (ioctl(_fd, VIDIOC_STREAMON, &type) != 0) {
+        ESP_LOGE(TAG, "failed to start capture stream");
+        return false;
+    }
+    type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    if (ioctl(_fd, VIDIOC_STREAMON, &type) != 0) {
+        ESP_LOGE(TAG, "failed to start output stream");
+        return false;
+    }
+
+    _width  = width;
+    _height = height;
+    ESP_LOGI(TAG, "%dx%d %d bps gop %d, %u byte stream buffer", width, height, bitrate, control[0].value,
+             (unsigned)_capture_length);
+    return true;
+}
+
+void H264M2mEncoder::close_device()
+{
+    if (_fd >= 0) {
+        int type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+        ioctl(_fd, VIDIOC_STREAMOFF, &type);
+        type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        ioctl(_fd, VIDIOC_STREAMOFF, &type);
+        if (_capture_buffer) {
+            munmap(_capture_buffer, _capture_length);
+        }
+        close(_fd);
+    }
+    if (_ppa) {
+        ppa_unregister_client(_ppa);
+    }
+    heap_caps_free(_yuv_buffer);
+
+    _fd             = -1;
+    _width          = 0;
+    _height         = 0;
+    _capture_buffer = nullptr;
+    _capture_length = 0;
+    _capture_queued = false;
+    _yuv_buffer     = nullptr;
+    _yuv_length     = 0;
+    _ppa            = nullptr;
+}
@@ -0,0 +1,40 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <apps/utils/camera/h264_encoder.h>
+#include "driver/ppa.h"
+
+/**
+ * @brief Hardware H.264 through the esp_video M2M device
+ *
+ * The encoder only takes YUV420, so the PPA converts each frame into a buffer of ours first, which the device reads as
+ * a USERPTR output buffer. The access unit comes back in the device's own MMAP capture buffer. The device has no
+ * control to force an IDR, so configure() reopens it on the next frame, whose first frame is an IDR by definition.
+ */
+class H264M2mEncoder : public camera::H264Encoder {
+public:
+    ~H264M2mEncoder();
+
+    void configure(const camera::H264Config_t& config) override;
+    const uint8_t* encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes) override;
+
+private:
+    camera::H264Config_t _config;
+    bool _reopen             = true;
+    int _fd                  = -1;
+    uint16_t _width          = 0;
+    uint16_t _height         = 0;
+    uint8_t* _capture_buffer = nullptr;
+    size_t _capture_length   = 0;
+    bool _capture_queued     = false;
+    uint8_t* _yuv_buffer     = nullptr;
+    size_t _yuv_length       = 0;
+    ppa_client_handle_t _ppa = nullptr;
+
+    bool open_device(uint16_t width, uint16_t height);
+    void close_device();
+    bool convert(const uint8_t* rgb565);
+};
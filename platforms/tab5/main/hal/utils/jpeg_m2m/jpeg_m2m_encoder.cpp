@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "jpeg_m2m_encoder.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include "esp_log.h"
+#include "linux/videodev2.h"
+#include "esp_video_device.h"
+
+static const char* TAG = "jpeg-m2m";
+
+JpegM2mEncoder::~JpegM2mEncoder()
+{
+    close_device();
+}
+
+const uint8_t* JpegM2mEncoder::encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes)
+{
+    if (rgb565 == nullptr || width == 0 || height == 0) {
+        return nullptr;
+    }
+    if (_fd < 0 || width != _width || height != _height) {
+        close_device();
+        if (!open_device(width, height)) {
+            close_device();
+            return nullptr;
+        }
+    }
+
+    // The previous jpeg is given up here, its buffer takes the next one
+    struct v4l2_buffer capture_buf;
+    memset(&capture_buf, 0, sizeof(capture_buf));
+    capture_buf.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    capture_buf.memory = V4L2_MEMORY_MMAP;
+    capture_buf.index  = 0;
+    if (!_capture_queued) {
+        if (ioctl(_fd, VIDIOC_QBUF, &capture_buf) != 0) {
+            ESP_LOGE(TAG, "failed to queue capture buffer");
+            return nullptr;
+        }
+        _capture_queued = true;
+    }
+
+    // Queuing the frame pairs it with the capture buffer and starts the encoder
+    struct v4l2_buffer output_buf;
+    memset(&output_buf, 0, sizeof(output_buf));
+    output_buf.type      = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    output_buf.memory    = V4L2_MEMORY_USERPTR;
+    output_buf.index     = 0;
+    output_buf.m.userptr = (unsigned long)rgb565;
+    output_buf.length    = (uint32_t)width * height * 2;
+    if (ioctl(_fd, VIDIOC_QBUF, &output_buf) != 0) {
+        ESP_LOGE(TAG, "failed to queue frame");
+        return nullptr;
+    }
+
+    const bool encoded = ioctl(_fd, VIDIOC_DQBUF, &capture_buf) == 0;
+    _capture_queued    = !encoded;
+    if (ioctl(_fd, VIDIOC_DQBUF, &output_buf) != 0) {
+        ESP_LOGE(TAG, "failed to dequeue frame");
+    }
+    if (!encoded || capture_buf.bytesused == 0) {
+        ESP_LOGE(TAG, "encode failed");
+        return nullptr;
+    }
+
+    bytes = capture_buf.bytesused;
+    return _capture_buffer;
+}
+
+bool JpegM2mEncoder::open_device(uint16_t width, uint16_t height)
+{
+    _fd = open(ESP_VIDEO_JPEG_DEVICE_NAME, O_RDONLY);
+    if (_fd < 0) {
+        ESP_LOGE(TAG, "failed to open %s", ESP_VIDEO_JPEG_DEVICE_NAME);
+        return false;
+    }
+
+    struct v4l2_ext_controls controls;
+    struct v4l2_ext_control control[1];
+    memset(&controls, 0, sizeof(controls));
+    memset(control, 0, sizeof(control));
+    controls.ctrl_class = V4L2_CID_JPEG_CLASS;
+    controls.count      = 1;
+    controls.controls   = control;
+    control[0].id       = V4L2_CID_JPEG_COMPRESSION_QUALITY;
+    control[0].value    = _quality;
+    if (ioctl(_fd, VIDIOC_S_EXT_CTRLS, &controls) != 0) {
+        ESP_LOGW(TAG, "failed to set quality");
+    }
+
+    // Raw frames in on the output queue
+    struct v4l2_format format;
+    memset(&format, 0, sizeof(format));
+    format.type                = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    format.fmt.pix.width       = width;
+    format.fmt.pix.height      = height;
+    format.fmt.pix.pixelformat = V4L2_PIX_FMT_RGB565;
+    if (ioctl(_fd, VIDIOC_S_FMT, &format) != 0) {
+        ESP_LOGE(TAG, "failed to set output format");
+        return false;
+    }
+
+    struct v4l2_requestbuffers req;
+    memset(&req, 0, sizeof(req));
+    req.count  = 1;
+    req.type   = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    req.memory = V4L2_MEMORY_USERPTR;
+    if (ioctl(_fd, VIDIOC_REQBUFS, &req) != 0) {
+        ESP_LOGE(TAG, "failed to request output buffer");
+        return false;
+    }
+
+    // Jpeg out on the capture queue
+    memset(&format, 0, sizeof(format));
+    format.type                = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    format.fmt.pix.width       = width;
+    format.fmt.pix.height      = height;
+    format.fmt.pix.pixelformat = V4L2_PIX_FMT_JPEG;
+    if (ioctl(_fd, VIDIOC_S_FMT, &format) != 0) {
+        ESP_LOGE(TAG, "failed to set capture format");
+        return false;
+    }
+
+    memset(&req, 0, sizeof(req));
+    req.count  = 1;
+    req.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    req.memory = V4L2_MEMORY_MMAP;
+    if (ioctl(_fd, VIDIOC_REQBUFS, &req) != 0) {
+        ESP_LOGE(TAG, "failed to request capture buffer");
+        return false;
+    }
+
+    struct v4l2_buffer buf;
+    memset(&buf, 0, sizeof(buf));
+    buf.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+    buf.index  = 0;
+    if (ioctl(_fd, VIDIOC_QUERYBUF, &buf) != 0) {
+        ESP_LOGE(TAG, "failed to query capture buffer");
+        return false;
+    }
+    _capture_buffer = (uint8_t*)mmap(NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, buf.m.offset);
+    if (_capture_buffer == nullptr) {
+        ESP_LOGE(TAG, "failed to map capture buffer");
+        return false;
+    }
+    _capture_length = buf.length;
+    if (ioctl(_fd, VIDIOC_QBUF, &buf) != 0) {
+        ESP_LOGE(TAG, "failed to queue capture buffer");
+        return false;
+    }
+    _capture_queued = true;
+
+    int type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    if (ioctl(_fd, VIDIOC_STREAMON, &type) != 0) {
+        ESP_LOGE(TAG, "failed to start capture stream");
+        return false;
+    }
+    type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    if (ioctl(_fd, VIDIOC_STREAMON, &type) != 0) {
+        ESP_LOGE(TAG, "failed to start output stream");
+        return false;
+    }
+
+    _width  = width;
+    _height = height;
+    ESP_LOGI(TAG, "%dx%d quality %d, %u byte jpeg buffer", width, height, _quality, (unsigned)_capture_length);
+    return true;
+}
+
+void JpegM2mEncoder::close_device()
+{
+    if (_fd < 0) {
+        return;
+    }
+
+    int type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+    ioctl(_fd, VIDIOC_STREAMOFF, &type);
+    type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    ioctl(_fd, VIDIOC_STREAMOFF, &type);
+    if (_capture_buffer) {
+        munmap(_capture_buffer, _capture_length);
+    }
+    close(_fd);
+
+    _fd             = -1;
+    _width          = 0;
+    _height         = 0;
+    _capture_buffer = nullptr;
+    _capture_length = 0;
+    _capture_queued = false;
+}
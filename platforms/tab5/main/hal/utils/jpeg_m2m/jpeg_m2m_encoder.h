@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <apps/utils/camera/jpeg_encoder.h>
+
+/**
+ * @brief Hardware jpeg through the esp_video M2M device
+ *
+ * The frame goes in by pointer as a USERPTR output buffer, so it has to be DMA capable and cache line aligned, which
+ * the capture buffers are. The jpeg comes back in the device's own MMAP capture buffer. The device is opened on the
+ * first frame and reconfigured when the frame size changes.
+ */
+class JpegM2mEncoder : public camera::JpegEncoder {
+public:
+    explicit JpegM2mEncoder(int quality = 80) : _quality(quality)
+    {
+    }
+    ~JpegM2mEncoder();
+
+    const uint8_t* encode(const uint8_t* rgb565, uint16_t width, uint16_t height, size_t& bytes) override;
+
+private:
+    int _quality;
+    int _fd                  = -1;
+    uint16_t _width          = 0;
+    uint16_t _height         = 0;
+    uint8_t* _capture_buffer = nullptr;
+    size_t _capture_length   = 0;
+    bool _capture_queued     = false;
+
+    bool open_device(uint16_t width, uint16_t height);
+    void close_device();
+};
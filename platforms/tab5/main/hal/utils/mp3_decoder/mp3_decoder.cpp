@@ -0,0 +1,244 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "mp3_decoder.h"
+#include <algorithm>
+#include <string.h>
+
+// Give up on a file that shows this many bad frames in a row
+static constexpr int kMaxResync = 64;
+
+static uint32_t read_be32(const uint8_t* p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+Mp3StreamDecoder::~Mp3StreamDecoder()
+{
+    if (_decoder) {
+        MP3FreeDecoder(_decoder);
+    }
+    if (_file) {
+        fclose(_file);
+    }
+}
+
+bool Mp3StreamDecoder::open(const std::string& path)
+{
+    _file = fopen(path.c_str(), "rb");
+    if (_file == nullptr) {
+        return false;
+    }
+    setvbuf(_file, nullptr, _IOFBF, kReadAheadBytes);
+
+    fseek(_file, 0, SEEK_END);
+    const long file_size = ftell(_file);
+    fseek(_file, 0, SEEK_SET);
+
+    // Skip an ID3v2 tag, its size is a 28-bit syncsafe integer
+    uint8_t tag[10];
+    if (fread(tag, 1, sizeof(tag), _file) == sizeof(tag) && memcmp(tag, "ID3", 3) == 0) {
+        _data_start = 10 + ((tag[6] & 0x7f) << 21 | (tag[7] & 0x7f) << 14 | (tag[8] & 0x7f) << 7 | (tag[9] & 0x7f));
+        if (tag[5] & 0x10) {
+            _data_start += 10;  // footer
+        }
+    }
+    if (file_size <= (long)_data_start) {
+        return false;
+    }
+    _data_bytes = file_size - _data_start;
+
+    // And an ID3v1 tag at the end
+    if (_data_bytes > 128) {
+        fseek(_file, file_size - 128, SEEK_SET);
+        if (fread(tag, 1, 3, _file) == 3 && memcmp(tag, "TAG", 3) == 0) {
+            _data_bytes -= 128;
+        }
+    }
+    fseek(_file, _data_start, SEEK_SET);
+    _file_pos = _data_start;
+
+    _decoder = MP3InitDecoder();
+    if (_decoder == nullptr) {
+        return false;
+    }
+
+    // The first frame header gives the format
+    MP3FrameInfo info;
+    for (int i = 0; i < kMaxResync; i++) {
+        if (!fill_input()) {
+            return false;
+        }
+        const int offset = MP3FindSyncWord(_read_ptr, _bytes_left);
+        if (offset < 0) {
+            _bytes_left = 0;
+            continue;
+        }
+        _read_ptr += offset;
+        _bytes_left -= offset;
+        if (_bytes_left >= 4 && MP3GetNextFrameInfo(_decoder, &info, _read_ptr) == ERR_MP3_NONE) {
+            fill_input();
+            _sample_rate = info.samprate;
+            _channels    = info.nChans == 1 ? 1 : 2;
+            parse_xing(info);
+            if (_total_frames == 0 && info.bitrate > 0) {
+                _total_frames = (uint64_t)_data_bytes * 8 * _sample_rate / info.bitrate;
+            }
+            return true;
+        }
+        _read_ptr++;
+        _bytes_left--;
+    }
+    return false;
+}
+
+void Mp3StreamDecoder::parse_xing(const MP3FrameInfo& info)
+{
+    // Encoders put the tag in place of the audio data of the first frame, right after the side info
+    const bool mpeg1          = info.version == MPEG1;
+    const int side_info_bytes = mpeg1 ? (info.nChans == 1 ? 17 : 32) : (info.nChans == 1 ? 9 : 17);
+    const uint8_t* p          = _read_ptr + 4 + side_info_bytes;
+    if (_bytes_left < 4 + side_info_bytes + 8 + 4 + 4 + 100) {
+        return;
+    }
+    if (memcmp(p, "Xing", 4) != 0 && memcmp(p, "Info", 4) != 0) {
+        return;
+    }
+
+    const uint32_t flags = read_be32(p + 4);
+    p += 8;
+    if (flags & 0x1) {
+        _total_frames = read_be32(p) * (mpeg1 ? 1152 : 576);
+        p += 4;
+    }
+    if (flags & 0x2) {
+        const uint32_t bytes = read_be32(p);
+        if (bytes > 0 && bytes <= _data_bytes) {
+            _data_bytes = bytes;
+        }
+        p += 4;
+    }
+    if (flags & 0x4) {
+        memcpy(_toc, p, sizeof(_toc));
+        _has_toc = true;
+    }
+}
+
+bool Mp3StreamDecoder::fill_input()
+{
+    // Keep at least a whole frame in front of the decoder while the file lasts
+    if (_bytes_left < MAINBUF_SIZE && !_eof) {
+        memmove(_input, _read_ptr, _bytes_left);
+        _read_ptr = _input;
+
+        const uint32_t data_end = _data_start + _data_bytes;
+        const size_t wanted     = std::min<size_t>(kInputBytes - _bytes_left, data_end - _file_pos);
+        const size_t got        = fread(_input + _bytes_left, 1, wanted, _file);
+        _file_pos += got;
+        _bytes_left += got;
+        _eof = got < wanted || _file_pos >= data_end;
+    }
+    return _bytes_left > 0;
+}
+
+bool Mp3StreamDecoder::decode_frame()
+{
+    if (_decoder == nullptr) {
+        return false;
+    }
+    for (int i = 0; i < kMaxResync; i++) {
+        if (!fill_input()) {
+            return false;
+        }
+        const int offset = MP3FindSyncWord(_read_ptr, _bytes_left);
+        if (offset < 0) {
+            _bytes_left = 0;
+            continue;
+        }
+        _read_ptr += offset;
+        _bytes_left -= offset;
+
+        const int err = MP3Decode(_decoder, &_read_ptr, &_bytes_left, _pcm, 0);
+        if (err == ERR_MP3_NONE) {
+            MP3FrameInfo info;
+            MP3GetLastFrameInfo(_decoder, &info);
+            const int channels = info.nChans == 1 ? 1 : 2;
+            _pcm_frames        = info.outputSamps / channels;
+            _pcm_used          = 0;
+
+            // A stream that switches channel mode midway is legal, keep what was announced
+            if (channels == 1 && _channels == 2) {
+                for (size_t f = _pcm_frames; f-- > 0;) {
+                    _pcm[f * 2] = _pcm[f * 2 + 1] = _pcm[f];
+                }
+            } else if (channels == 2 && _channels == 1) {
+                for (size_t f = 0; f < _pcm_frames; f++) {
+                    _pcm[f] = (_pcm[f * 2] + _pcm[f * 2 + 1]) / 2;
+                }
+            }
+            return true;
+        }
+        if (err == ERR_MP3_MAINDATA_UNDERFLOW) {
+            // The bit reservoir is not primed yet after a seek, the decoder already moved past the frame
+            continue;
+        }
+        if (err == ERR_MP3_INDATA_UNDERFLOW && _eof) {
+            return false;  // truncated last frame
+        }
+        _read_ptr++;
+        _bytes_left--;
+    }
+    return false;
+}
+
+size_t Mp3StreamDecoder::decode(int16_t* frames, size_t maxFrames)
+{
+    size_t done = 0;
+    while (done < maxFrames) {
+        if (_pcm_used == _pcm_frames && !decode_frame()) {
+            break;
+        }
+        const size_t count = std::min(maxFrames - done, _pcm_frames - _pcm_used);
+        memcpy(frames + done * _channels, _pcm + _pcm_used * _channels, count * _channels * sizeof(int16_t));
+        done += count;
+        _pcm_used += count;
+    }
+    return done;
+}
+
+uint32_t Mp3StreamDecoder::seek(uint32_t frame)
+{
+    if (_file == nullptr) {
+        return 0;
+    }
+    if (_total_frames == 0) {
+        frame = 0;
+    }
+    frame = std::min(frame, _total_frames);
+
+    uint32_t offset = 0;
+    if (frame > 0 && _has_toc) {
+        const float percent = std::min(frame * 100.0f / _total_frames, 99.999f);
+        const int i         = (int)percent;
+        const float a       = _toc[i];
+        const float b       = i < 99 ? _toc[i + 1] : 256.0f;
+        offset              = (uint32_t)((a + (b - a) * (percent - i)) / 256.0f * _data_bytes);
+    } else if (frame > 0) {
+        offset = (uint64_t)frame * _data_bytes / _total_frames;
+    }
+
+    // Fresh decoder state, the overlap and reservoir of the old position would only glitch
+    MP3FreeDecoder(_decoder);
+    _decoder = MP3InitDecoder();
+
+    _file_pos = _data_start + offset;
+    fseek(_file, _file_pos, SEEK_SET);
+    _eof        = false;
+    _read_ptr   = _input;
+    _bytes_left = 0;
+    _pcm_frames = 0;
+    _pcm_used   = 0;
+    return frame;
+}
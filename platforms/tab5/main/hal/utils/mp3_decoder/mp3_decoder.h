@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <apps/utils/audio/stream_decoder.h>
+#include <mp3dec.h>
+#include <cstdio>
+
+/**
+ * @brief Helix mp3 decoder for the stream player
+ *
+ * Length and seek come from the Xing/Info header when the encoder wrote one (every VBR file does), otherwise from the
+ * first frame's bitrate, which is exact for CBR.
+ */
+class Mp3StreamDecoder : public audio::StreamDecoder {
+public:
+    ~Mp3StreamDecoder();
+
+    bool open(const std::string& path) override;
+    uint32_t sampleRate() const override
+    {
+        return _sample_rate;
+    }
+    uint8_t channels() const override
+    {
+        return _channels;
+    }
+    uint32_t totalFrames() const override
+    {
+        return _total_frames;
+    }
+    size_t decode(int16_t* frames, size_t maxFrames) override;
+    uint32_t seek(uint32_t frame) override;
+
+    static std::unique_ptr<audio::StreamDecoder> create()
+    {
+        return std::make_unique<Mp3StreamDecoder>();
+    }
+
+private:
+    static constexpr size_t kInputBytes      = MAINBUF_SIZE * 2;
+    static constexpr size_t kMaxFrameSamples = MAX_NSAMP * MAX_NGRAN * MAX_NCHAN;
+
+    FILE* _file            = nullptr;
+    HMP3Decoder _decoder   = nullptr;
+    uint32_t _sample_rate  = 0;
+    uint8_t _channels      = 0;
+    uint32_t _total_frames = 0;
+    uint32_t _data_start   = 0;  // first frame, past any ID3v2 tag
+    uint32_t _data_bytes   = 0;
+    uint32_t _file_pos     = 0;
+    bool _has_toc          = false;
+    bool _eof              = false;
+    uint8_t _toc[100];  // Xing seek table, byte position in 1/256 of the stream at each percent of the duration
+
+    uint8_t _input[kInputBytes];
+    uint8_t* _read_ptr = _input;
+    int _bytes_left    = 0;
+
+    int16_t _pcm[kMaxFrameSamples];
+    size_t _pcm_frames = 0;
+    size_t _pcm_used   = 0;
+
+    bool fill_input();
+    bool decode_frame();
+    void parse_xing(const MP3FrameInfo& info);
+};
@@ -0,0 +1,24 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <hal/hal.h>
+#include "imlib.h"
+
+/**
+ * @brief A held vision frame as an imlib image, no copy
+ *
+ * The image is the frame's memory, so it is only valid until the frame is released, and imlib drawing on it lands in
+ * that frame only.
+ */
+inline image_t imlib_image(const hal::HalBase::CameraVisionFrame_t& frame)
+{
+    image_t image = {};
+    image.w       = frame.width;
+    image.h       = frame.height;
+    image.pixfmt  = frame.gray ? PIXFORMAT_GRAYSCALE : PIXFORMAT_RGB565;
+    image.data    = frame.data;
+    return image;
+}
@@ -0,0 +1,7 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+/* Host stand-in for the IDF header, imlib includes it but logs nothing on the paths tested here */
+#pragma once
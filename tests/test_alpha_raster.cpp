@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <apps/utils/ui/alpha_raster.h>
+#include <assets/meshes/space_ship.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace ui;
+namespace ship = meshes::space_ship;
+
+static bool all_zero(const std::vector<uint8_t>& buffer)
+{
+    return std::all_of(buffer.begin(), buffer.end(), [](uint8_t v) { return v == 0; });
+}
+
+static std::vector<uint8_t> copy(AlphaRaster& raster)
+{
+    return std::vector<uint8_t>(raster.data(), raster.data() + raster.stride() * raster.height());
+}
+
+static void test_line_coverage()
+{
+    AlphaRaster raster;
+    raster.init(64, 32);
+
+    // Solid along a horizontal line's centre row, nothing a row beyond its reach, round caps past the ends
+    raster.drawLine(10.0f, 16.0f, 50.0f, 16.0f, 3.0f);
+    const uint8_t* p = raster.data();
+    for (int x = 10; x <= 50; x++) {
+        CHECK(p[16 * 64 + x] == 255);
+        CHECK(p[15 * 64 + x] == 255);
+        CHECK(p[17 * 64 + x] == 255);
+        CHECK(p[13 * 64 + x] == 0);
+        CHECK(p[19 * 64 + x] == 0);
+    }
+    CHECK(p[16 * 64 + 9] == 255);
+    CHECK(p[16 * 64 + 7] == 0);
+
+    // The drawn area covers all of it, give or take the pixel where coverage reaches zero
+    const auto area = raster.drawnArea();
+    CHECK(area.x1 >= 7 && area.x1 <= 9 && area.x2 >= 51 && area.x2 <= 53);
+    CHECK(area.y1 >= 13 && area.y1 <= 15 && area.y2 >= 17 && area.y2 <= 19);
+
+    // A diagonal is symmetric about itself
+    raster.clear();
+    raster.drawLine(4.0f, 4.0f, 28.0f, 28.0f, 2.0f);
+    bool symmetric = true;
+    for (int y = 0; y < 32; y++) {
+        for (int x = 0; x < 32; x++) {
+            symmetric = symmetric && p[y * 64 + x] == p[x * 64 + y];
+        }
+    }
+    CHECK(symmetric);
+}
+
+static void test_clear_and_clipping()
+{
+    // A stride wider than the image, the padding must never be written
+    AlphaRaster raster;
+    raster.init(50, 40, 64);
+    raster.drawLine(-30.0f, -10.0f, 80.0f, 60.0f, 4.0f);
+    raster.drawLine(25.0f, -100.0f, 25.0f, 100.0f, 1.0f);
+    raster.drawLine(-20.0f, -20.0f, -5.0f, -8.0f, 3.0f);
+
+    bool padding_clean = true;
+    for (int y = 0; y < 40; y++) {
+        for (int x = 50; x < 64; x++) {
+            padding_clean = padding_clean && raster.data()[y * 64 + x] == 0;
+        }
+    }
+    CHECK(padding_clean);
+
+    const auto drawn = raster.drawnArea();
+    CHECK(drawn.x1 >= 0 && drawn.y1 >= 0 && drawn.x2 < 50 && drawn.y2 < 40);
+
+    // clear() hands back exactly what was drawn and leaves nothing behind
+    const auto cleared = raster.clear();
+    CHECK(cleared.x1 == drawn.x1 && cleared.y1 == drawn.y1 && cleared.x2 == drawn.x2 && cleared.y2 == drawn.y2);
+    CHECK(all_zero(copy(raster)));
+    CHECK(raster.drawnArea().empty());
+    CHECK(raster.clear().empty());
+}
+
+/* -------------------------------------------------------------------------- */
+/*                            Ship wireframe frames                           */
+/* -------------------------------------------------------------------------- */
+/**
+ * @brief The portable half of ShipWireframe in panel_imu.cpp: projection and rasterization, no canvas
+ *
+ */
+struct Wireframe {
+    AlphaRaster raster;
+    std::vector<std::array<float, 2>> points;
+    float width = 1.0f;
+    float scale = 1.0f;
+    float depth = 1.0f;
+
+    Wireframe(int w, int h, float lineWidth) : width(lineWidth)
+    {
+        raster.init(w, h);
+        scale = 0.82f * std::min(w / static_cast<float>(ship::kMax.x - ship::kMin.x),
+                                 h / static_cast<float>(ship::kMax.y - ship::kMin.y));
+        depth = (ship::kMax.z - ship::kMin.z) * 2.0f;
+        points.assign(sizeof(ship::kVertices) / sizeof(ship::kVertices[0]), {0.0f, 0.0f});
+    }
+
+    void project(float roll_deg, float pitch_deg)
+    {
+        const float roll  = roll_deg / 57.2957795f;
+        const float pitch = (pitch_deg - 90.0f) / 57.2957795f;
+        const float cx    = (ship::kMin.x + ship::kMax.x) * 0.5f;
+        const float cy    = (ship::kMin.y + ship::kMax.y) * 0.5f;
+        const float cz    = (ship::kMin.z + ship::kMax.z) * 0.5f;
+        for (size_t i = 0; i < points.size(); i++) {
+            const auto& v     = ship::kVertices[i];
+            const float y1    = ((v.y - cy) * std::cos(pitch)) - ((v.z - cz) * std::sin(pitch));
+            const float z1    = ((v.y - cy) * std::sin(pitch)) + ((v.z - cz) * std::cos(pitch));
+            const float x2    = ((v.x - cx) * std::cos(roll)) - (y1 * std::sin(roll));
+            const float y2    = ((v.x - cx) * std::sin(roll)) + (y1 * std::cos(roll));
+            const float persp = depth / (depth + z1 + depth * 0.15f);
+            points[i][0]      = raster.width() * 0.5f - y2 * scale * persp;
+            points[i][1]      = raster.height() * 0.5f - x2 * scale * persp;
+        }
+    }
+
+    // Returns the area to invalidate, last frame's plus this one's
+    AlphaRaster::Area_t frame(float roll_deg, float pitch_deg)
+    {
+        project(roll_deg, pitch_deg);
+        auto dirty = raster.clear();
+        for (const auto& edge : ship::kEdges) {
+            raster.drawLine(points[edge.a][0], points[edge.a][1], points[edge.b][0], points[edge.b][1], width);
+        }
+        dirty.join(raster.drawnArea());
+        return dirty;
+    }
+
+    // What an lv_line per edge invalidated on the same frame: every edge's old and new box, width included
+    double per_edge_area(const std::vector<std::array<float, 2>>& last) const
+    {
+        double sum = 0.0;
+        for (const auto& edge : ship::kEdges) {
+            for (const auto* p : {&last, &points}) {
+                const auto& a = (*p)[edge.a];
+                const auto& b = (*p)[edge.b];
+                sum += (std::fabs(a[0] - b[0]) + width + 1) * (std::fabs(a[1] - b[1]) + width + 1);
+            }
+        }
+        return sum;
+    }
+};
+
+static void bench_wireframe(const char* name, int w, int h, float lineWidth)
+{
+    constexpr int frames = 2000;
+    Wireframe wireframe(w, h, lineWidth);
+
+    // A sweep of attitudes like a slow tumble
+    double dirty_px    = 0.0;
+    double per_edge_px = 0.0;
+    auto last          = wireframe.points;
+    for (int i = 0; i < frames; i++) {
+        const auto dirty = wireframe.frame(40.0f * std::sin(i * 0.013f), 30.0f * std::sin(i * 0.007f));
+        dirty_px += static_cast<double>(dirty.x2 - dirty.x1 + 1) * (dirty.y2 - dirty.y1 + 1);
+        per_edge_px += wireframe.per_edge_area(last);
+        last = wireframe.points;
+    }
+
+    const double seconds = test::best_seconds(
+        [&] {
+            for (int i = 0; i < frames; i++) {
+                wireframe.frame(40.0f * std::sin(i * 0.013f), 30.0f * std::sin(i * 0.007f));
+            }
+        },
+        3);
+    const double frame_us = seconds / frames * 1e6;
+    std::printf("%s %dx%d width %.0f: %.0f us a frame, dirty box %.1fk px, line objects invalidated %.1fk px\n", name,
+                w, h, lineWidth, frame_us, dirty_px / frames / 1e3, per_edge_px / frames / 1e3);
+
+    // Well inside a 60 Hz frame, and one box never covers more than the per line areas summed
+    CHECK(frame_us < 16667.0);
+    CHECK(dirty_px < per_edge_px);
+    CHECK(!wireframe.raster.drawnArea().empty());
+}
+
+int main()
+{
+    test_line_coverage();
+    test_clear_and_clipping();
+    bench_wireframe("panel", 190, 110, 2.0f);
+    bench_wireframe("window", 410, 260, 3.0f);
+    return test::result();
+}
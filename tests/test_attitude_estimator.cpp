@@ -0,0 +1,282 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <apps/utils/imu/attitude_estimator.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace imu;
+
+static constexpr double kDegToRad = M_PI / 180.0;
+static constexpr size_t kBatch    = 16;  // samples per FIFO drain
+
+/**
+ * @brief A log line per sample, "timestamp_us,ax,ay,az,gx,gy,gz" in g and °/s, lines starting with # are skipped
+ *
+ */
+static bool read_log(const char* path, std::vector<ImuSample_t>& samples)
+{
+    std::ifstream file(path);
+    if (!file) {
+        std::printf("%s: can't open\n", path);
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream fields(line);
+        ImuSample_t sample;
+        if (fields >> sample.timestampUs >> sample.accel[0] >> sample.accel[1] >> sample.accel[2] >> sample.gyro[0] >>
+            sample.gyro[1] >> sample.gyro[2]) {
+            samples.push_back(sample);
+        }
+    }
+    std::printf("%s: %zu samples\n", path, samples.size());
+    return !samples.empty();
+}
+
+/* -------------------------------------------------------------------------- */
+/*                     Synthetic log with a known attitude                    */
+/* -------------------------------------------------------------------------- */
+struct Quat {
+    double w = 1.0, x = 0.0, y = 0.0, z = 0.0;
+
+    // Earth up in the sensor frame, what an ideal accelerometer reads at rest
+    void up(double out[3]) const
+    {
+        out[0] = 2.0 * (x * z - w * y);
+        out[1] = 2.0 * (w * x + y * z);
+        out[2] = w * w - x * x - y * y + z * z;
+    }
+};
+
+struct Log {
+    std::vector<ImuSample_t> samples;
+    std::vector<std::array<double, 3>> up;  // true gravity per sample
+    double bias[3] = {1.5, -2.0, 0.8};      // °/s
+};
+
+/**
+ * @brief Two minutes of tumbling at about 400 Hz: gyro bias and noise, accel noise, 0.5 g shakes, timing jitter, and
+ * the 32-bit microsecond clock wrapping five seconds in
+ *
+ */
+static Log make_log(double seconds, bool still = false)
+{
+    Log log;
+    std::mt19937 rng(20);
+    std::normal_distribution<double> accel_noise(0.0, 0.01);
+    std::normal_distribution<double> gyro_noise(0.0, 0.1);
+    std::uniform_real_distribution<double> jitter(-100.0, 100.0);
+    std::uniform_real_distribution<double> direction(-1.0, 1.0);
+
+    Quat q;
+    double t          = 0.0;
+    uint32_t stamp    = UINT32_MAX - 5000000u;
+    double shake[3]   = {};
+    double shake_left = 0.0;
+    while (t < seconds) {
+        const double dt = (2500.0 + jitter(rng)) * 1e-6;
+        t += dt;
+        stamp += static_cast<uint32_t>(dt * 1e6);
+
+        double omega[3] = {};  // °/s, sensor frame
+        if (!still) {
+            omega[0] = 60.0 * std::sin(0.9 * t);
+            omega[1] = 45.0 * std::sin(0.6 * t + 1.0);
+            omega[2] = 30.0 * std::cos(0.4 * t);
+        }
+
+        // q' = q * (0, omega) / 2, in double at the true rate
+        const double h  = 0.5 * dt * kDegToRad;
+        const Quat p    = q;
+        q.w            += h * (-p.x * omega[0] - p.y * omega[1] - p.z * omega[2]);
+        q.x            += h * (p.w * omega[0] + p.y * omega[2] - p.z * omega[1]);
+        q.y            += h * (p.w * omega[1] - p.x * omega[2] + p.z * omega[0]);
+        q.z            += h * (p.w * omega[2] + p.x * omega[1] - p.y * omega[0]);
+        const double n  = std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+        q.w /= n;
+        q.x /= n;
+        q.y /= n;
+        q.z /= n;
+
+        // A 0.2 s, 0.5 g shake every seven seconds
+        if (!still && std::fmod(t, 7.0) < dt) {
+            shake_left = 0.2;
+            for (auto& s : shake) {
+                s = 0.5 * direction(rng);
+            }
+        }
+        shake_left -= dt;
+
+        std::array<double, 3> up;
+        q.up(up.data());
+        ImuSample_t sample;
+        sample.timestampUs = stamp;
+        for (int i = 0; i < 3; i++) {
+            sample.accel[i] = static_cast<float>(up[i] + (shake_left > 0.0 ? shake[i] : 0.0) + accel_noise(rng));
+            sample.gyro[i]  = static_cast<float>(omega[i] + log.bias[i] + gyro_noise(rng));
+        }
+        log.samples.push_back(sample);
+        log.up.push_back(up);
+    }
+    return log;
+}
+
+static double angle_deg(const float a[3], const double b[3])
+{
+    const double na  = std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+    const double dot = (a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) / na;
+    return std::acos(std::clamp(dot, -1.0, 1.0)) / kDegToRad;
+}
+
+struct Errors_t {
+    double fusedMean = 0.0;
+    double fusedMax  = 0.0;
+    double accelMean = 0.0;
+    double accelMax  = 0.0;
+};
+
+/**
+ * @brief Replay in FIFO sized batches, tilt error of the published attitude after each one, from settle seconds on
+ *
+ */
+static Errors_t replay(AttitudeEstimator& estimator, const Log& log, double settle)
+{
+    Errors_t errors;
+    size_t counted    = 0;
+    const size_t skip = static_cast<size_t>(settle * 400.0);
+    for (size_t i = 0; i + kBatch <= log.samples.size(); i += kBatch) {
+        estimator.process(&log.samples[i], kBatch);
+        const size_t last = i + kBatch - 1;
+        if (last < skip) {
+            continue;
+        }
+
+        const Attitude_t attitude = estimator.attitude();
+        const double fused        = angle_deg(attitude.gravity, log.up[last].data());
+        const double accel        = angle_deg(log.samples[last].accel, log.up[last].data());
+        errors.fusedMean += fused;
+        errors.fusedMax   = std::max(errors.fusedMax, fused);
+        errors.accelMean += accel;
+        errors.accelMax   = std::max(errors.accelMax, accel);
+        counted++;
+    }
+    errors.fusedMean /= counted;
+    errors.accelMean /= counted;
+    return errors;
+}
+
+static void test_tumbling_log()
+{
+    const Log log = make_log(120.0);
+    AttitudeEstimator estimator;
+    const Errors_t errors = replay(estimator, log, 5.0);
+    const Attitude_t end  = estimator.attitude();
+
+    std::printf("tumbling: tilt error fused %.2f mean %.1f max, accel only %.2f mean %.1f max (degrees)\n",
+                errors.fusedMean, errors.fusedMax, errors.accelMean, errors.accelMax);
+    std::printf("gyro bias estimated %.2f %.2f %.2f, true %.2f %.2f %.2f (°/s)\n", end.gyroBias[0], end.gyroBias[1],
+                end.gyroBias[2], log.bias[0], log.bias[1], log.bias[2]);
+
+    CHECK(errors.fusedMean < 1.5);
+    CHECK(errors.fusedMax < 10.0);
+    CHECK(errors.fusedMean < errors.accelMean);
+    CHECK(errors.fusedMax * 4 < errors.accelMax);
+    for (int i = 0; i < 3; i++) {
+        CHECK(std::fabs(end.gyroBias[i] - log.bias[i]) < 0.5);
+    }
+    CHECK(end.sampleCount == log.samples.size() / kBatch * kBatch);
+}
+
+static void test_resting_with_bias()
+{
+    // Lying still and tilted with a biased gyro, once the integral term has caught up with the bias (Kp / Ki is a
+    // 20 s time constant) roll and pitch must not drift
+    Log log = make_log(90.0, true);
+    const double tilt[3] = {std::sin(0.3), 0.0, std::cos(0.3)};
+    for (size_t i = 0; i < log.samples.size(); i++) {
+        const double rotated[3] = {log.up[i][0] * tilt[2] + log.up[i][2] * tilt[0], log.up[i][1],
+                                   log.up[i][2] * tilt[2] - log.up[i][0] * tilt[0]};
+        for (int k = 0; k < 3; k++) {
+            log.samples[i].accel[k] += static_cast<float>(rotated[k] - log.up[i][k]);
+            log.up[i][k] = rotated[k];
+        }
+    }
+
+    AttitudeEstimator estimator;
+    const Errors_t errors = replay(estimator, log, 45.0);
+    std::printf("resting: tilt error fused %.2f mean %.2f max (degrees)\n", errors.fusedMean, errors.fusedMax);
+    CHECK(errors.fusedMean < 0.5);
+    CHECK(errors.fusedMax < 1.0);
+}
+
+static void test_gap_restarts_from_accel()
+{
+    const Log log = make_log(4.0);
+    AttitudeEstimator estimator;
+    estimator.process(log.samples.data(), log.samples.size() / 2);
+
+    // A gap longer than kMaxDt, the next sample alone decides the tilt
+    ImuSample_t later = log.samples.back();
+    later.timestampUs = log.samples[log.samples.size() / 2].timestampUs + 200000;
+    estimator.process(&later, 1);
+    const Attitude_t attitude = estimator.attitude();
+    const double gravity[3]   = {attitude.gravity[0], attitude.gravity[1], attitude.gravity[2]};
+    CHECK(angle_deg(later.accel, gravity) < 0.1);
+}
+
+static void replay_file(const char* path)
+{
+    // A recorded log has no ground truth, so only report and check the filter stayed sane
+    std::vector<ImuSample_t> samples;
+    if (!read_log(path, samples)) {
+        test::fail(__FILE__, __LINE__, "read_log");
+        return;
+    }
+
+    AttitudeEstimator estimator;
+    double worst = 0.0;
+    for (size_t i = 0; i < samples.size(); i += kBatch) {
+        const size_t count = std::min(kBatch, samples.size() - i);
+        estimator.process(&samples[i], count);
+        const Attitude_t a = estimator.attitude();
+        const double norm  = std::sqrt(a.quaternion[0] * a.quaternion[0] + a.quaternion[1] * a.quaternion[1] +
+                                       a.quaternion[2] * a.quaternion[2] + a.quaternion[3] * a.quaternion[3]);
+        worst              = std::max(worst, std::fabs(norm - 1.0));
+    }
+
+    const Attitude_t end = estimator.attitude();
+    std::printf("end: roll %.1f pitch %.1f yaw %.1f, gyro bias %.2f %.2f %.2f °/s\n", end.roll, end.pitch, end.yaw,
+                end.gyroBias[0], end.gyroBias[1], end.gyroBias[2]);
+    CHECK(worst < 1e-4);
+    CHECK(std::isfinite(end.roll) && std::isfinite(end.pitch));
+}
+
+int main(int argc, char** argv)
+{
+    // test_attitude_estimator [log.csv] replays a recorded log instead of the synthetic ones
+    if (argc > 1) {
+        replay_file(argv[1]);
+        return test::result();
+    }
+
+    test_tumbling_log();
+    test_resting_with_bias();
+    test_gap_restarts_from_accel();
+    return test::result();
+}
@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <apps/utils/dsp/beamformer.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <vector>
+
+using namespace app::dsp;
+
+static constexpr size_t kBlock   = Beamformer::kBlockSize;
+static constexpr size_t kSeconds = 4;
+static constexpr size_t kLength  = Beamformer::kSampleRate * kSeconds;
+static constexpr int kSincHalf   = 32;  // scene delays are all taken relative to this
+
+/**
+ * @brief First channel of a 16-bit PCM wav, looped or cut to kLength
+ *
+ */
+static bool read_wav(const char* path, std::vector<float>& out)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() < 12 || std::memcmp(data.data(), "RIFF", 4) != 0 || std::memcmp(data.data() + 8, "WAVE", 4) != 0) {
+        std::printf("%s: not a wav file\n", path);
+        return false;
+    }
+
+    uint16_t channels = 0;
+    uint16_t bits     = 0;
+    uint32_t rate     = 0;
+    for (size_t pos = 12; pos + 8 <= data.size();) {
+        uint32_t size = 0;
+        std::memcpy(&size, data.data() + pos + 4, 4);
+        const char* chunk = data.data() + pos + 8;
+        if (std::memcmp(data.data() + pos, "fmt ", 4) == 0) {
+            std::memcpy(&channels, chunk + 2, 2);
+            std::memcpy(&rate, chunk + 4, 4);
+            std::memcpy(&bits, chunk + 14, 2);
+        } else if (std::memcmp(data.data() + pos, "data", 4) == 0 && bits == 16 && channels > 0) {
+            const size_t frames = std::min<size_t>(size, data.size() - pos - 8) / (2 * channels);
+            if (frames == 0) {
+                break;
+            }
+            if (rate != Beamformer::kSampleRate) {
+                std::printf("%s: %u Hz, played as %u Hz\n", path, rate, Beamformer::kSampleRate);
+            }
+            out.resize(kLength);
+            for (size_t i = 0; i < kLength; i++) {
+                int16_t s = 0;
+                std::memcpy(&s, chunk + (i % frames) * 2 * channels, 2);
+                out[i] = s / 32768.0f;
+            }
+            return true;
+        }
+        pos += 8 + size + (size & 1);
+    }
+    std::printf("%s: only 16-bit pcm wav files are supported\n", path);
+    return false;
+}
+
+// Voiced speech stand-in, 150 Hz harmonics up to 4 kHz with a 4 Hz syllable envelope
+static std::vector<float> make_target()
+{
+    std::vector<float> out(kLength);
+    for (size_t i = 0; i < kLength; i++) {
+        const double t = static_cast<double>(i) / Beamformer::kSampleRate;
+        double v       = 0.0;
+        for (int k = 1; 150 * k < 4000; k++) {
+            v += std::sin(2.0 * M_PI * 150.0 * k * t + k) / k;
+        }
+        out[i] = static_cast<float>(v * (0.6 + 0.4 * std::sin(2.0 * M_PI * 4.0 * t)));
+    }
+    return out;
+}
+
+// Babble stand-in, noise in the speech band
+static std::vector<float> make_interferer()
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> phase(0.0, 2.0 * M_PI);
+    std::vector<double> hz(300);
+    std::vector<double> ph(hz.size());
+    for (size_t k = 0; k < hz.size(); k++) {
+        hz[k] = 100.0 + 3900.0 * k / hz.size();
+        ph[k] = phase(rng);
+    }
+
+    std::vector<float> out(kLength);
+    for (size_t i = 0; i < kLength; i++) {
+        const double t = static_cast<double>(i) / Beamformer::kSampleRate;
+        double v       = 0.0;
+        for (size_t k = 0; k < hz.size(); k++) {
+            v += std::sin(2.0 * M_PI * hz[k] * t + ph[k]);
+        }
+        out[i] = static_cast<float>(v);
+    }
+    return out;
+}
+
+// Hann windowed sinc, delays by kSincHalf + delay samples
+static std::vector<float> delayed(const std::vector<float>& in, double delay)
+{
+    std::vector<float> out(in.size(), 0.0f);
+    for (int k = -kSincHalf; k <= kSincHalf; k++) {
+        const double x = k - (delay - std::floor(delay));
+        const double h = (x == 0.0 ? 1.0 : std::sin(M_PI * x) / (M_PI * x)) *
+                         (0.5 + 0.5 * std::cos(M_PI * x / (kSincHalf + 1)));
+        const long shift = kSincHalf + static_cast<long>(std::floor(delay)) + k;
+        for (size_t i = std::max<long>(shift, 0); i < in.size(); i++) {
+            out[i] += static_cast<float>(h * in[i - shift]);
+        }
+    }
+    return out;
+}
+
+static double power(const float* x, size_t n)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        sum += static_cast<double>(x[i]) * x[i];
+    }
+    return sum / n;
+}
+
+static void scale_to(std::vector<float>& x, double target)
+{
+    const float gain = static_cast<float>(std::sqrt(target / power(x.data(), x.size())));
+    for (auto& v : x) {
+        v *= gain;
+    }
+}
+
+static std::vector<float> run(Beamformer& bf, const std::vector<float>& left, const std::vector<float>& right)
+{
+    std::vector<float> out(kLength);
+    for (size_t i = 0; i + kBlock <= kLength; i += kBlock) {
+        bf.process(&left[i], &right[i], &out[i]);
+    }
+    return out;
+}
+
+/**
+ * @brief SNR of out in dB, taking the best scaled copy of target as signal and everything else as noise
+ *
+ * Measured over the second half, after the canceller has converged.
+ */
+static double snr_db(const std::vector<float>& out, const std::vector<float>& target)
+{
+    const size_t begin = kLength / 2;
+    const size_t n     = kLength - begin - 64;
+
+    double best = 0.0;
+    size_t lag  = 0;
+    for (size_t l = 0; l < 64; l++) {
+        double dot = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            dot += static_cast<double>(out[begin + i]) * target[begin + i - l];
+        }
+        if (std::fabs(dot) > std::fabs(best)) {
+            best = dot;
+            lag  = l;
+        }
+    }
+
+    const double gain = best / (power(&target[begin - lag], n) * n);
+    double noise      = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        const double e = out[begin + i] - gain * target[begin + i - lag];
+        noise += e * e;
+    }
+    return 10.0 * std::log10(gain * gain * power(&target[begin - lag], n) * n / noise);
+}
+
+int main(int argc, char** argv)
+{
+    // test_beamformer [target.wav interferer.wav] to use real recordings instead of the synthesized scene
+    std::vector<float> target;
+    std::vector<float> interferer;
+    if (argc == 3) {
+        if (!read_wav(argv[1], target) || !read_wav(argv[2], interferer)) {
+            return 1;
+        }
+    } else {
+        target     = make_target();
+        interferer = make_interferer();
+    }
+
+    // Target straight ahead, interferer 60 degrees off towards MIC-R at 0 dB, and a little uncorrelated mic noise
+    const double tau = Beamformer::kMicSpacingM * std::sin(M_PI / 3.0) * Beamformer::kSampleRate /
+                       Beamformer::kSpeedOfSound;
+    scale_to(target, 0.01);
+    scale_to(interferer, 0.01);
+    const auto interferer_l = delayed(interferer, tau);
+    const auto interferer_r = delayed(interferer, 0.0);
+    const auto target_mic   = delayed(target, 0.0);
+
+    std::mt19937 rng(7);
+    std::normal_distribution<float> mic_noise(0.0f, 0.001f);
+    std::vector<float> left(kLength);
+    std::vector<float> right(kLength);
+    for (size_t i = 0; i < kLength; i++) {
+        left[i]  = target_mic[i] + interferer_l[i] + mic_noise(rng);
+        right[i] = target_mic[i] + interferer_r[i] + mic_noise(rng);
+    }
+
+    const double input = snr_db(left, target_mic);
+
+    Beamformer wide;
+    wide.configure(0.0f, 1.0f);
+    const double das = snr_db(run(wide, left, right), target_mic) - input;
+
+    Beamformer narrow;
+    narrow.configure(0.0f, 0.0f);
+    const double gsc = snr_db(run(narrow, left, right), target_mic) - input;
+
+    std::printf("input snr %.1f dB, gain: delay-and-sum %.1f dB, with canceller %.1f dB\n", input, das, gsc);
+    // Two mics 5 cm apart can't do much below 1 kHz, and the capped canceller norm limits how far it goes there
+    CHECK(das > 2.0);
+    CHECK(gsc > das + 3.0);
+
+    // The look direction alone passes through the narrowest beam undistorted
+    Beamformer clean;
+    clean.configure(0.0f, 0.0f);
+    const double clean_snr = snr_db(run(clean, target_mic, target_mic), target_mic);
+    std::printf("target only, narrow beam: %.1f dB\n", clean_snr);
+    CHECK(clean_snr > 60.0);
+
+    // Steering decides which of the two comes through: the interferer's side against the opposite side
+    Beamformer toward;
+    Beamformer away;
+    toward.configure(60.0f, 0.0f);
+    away.configure(-60.0f, 0.0f);
+    const double right_snr   = snr_db(right, interferer_r);
+    const double toward_gain = snr_db(run(toward, left, right), interferer_r) - right_snr;
+    const double away_gain   = snr_db(run(away, left, right), interferer_r) - right_snr;
+    std::printf("interferer gain steered towards it %.1f dB, away from it %.1f dB\n", toward_gain, away_gain);
+    CHECK(toward_gain > away_gain + 10.0);
+
+    std::vector<float> out(kLength);
+    const double seconds = test::best_seconds([&] {
+        for (size_t i = 0; i + kBlock <= kLength; i += kBlock) {
+            narrow.process(&left[i], &right[i], &out[i]);
+        }
+        test::keep(out[kBlock]);
+    });
+    const double block_us = seconds / (kLength / kBlock) * 1e6;
+    std::printf("%.2f us per %zu sample block, %.2f%% of real time\n", block_us, kBlock,
+                block_us / (1e6 * kBlock / Beamformer::kSampleRate) * 100.0);
+    CHECK(block_us < 1e6 * kBlock / Beamformer::kSampleRate);
+
+    return test::result();
+}
@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include <fmath.h>
+}
+
+static int64_t float_order(float f)
+{
+    int32_t i;
+    std::memcpy(&i, &f, sizeof(i));
+    return i < 0 ? -static_cast<int64_t>(i & 0x7FFFFFFF) : i;
+}
+
+static int64_t ulp_distance(float a, float b)
+{
+    return std::llabs(float_order(a) - float_order(b));
+}
+
+// libm's atan2 moved to fast_atan2f's [0, 2pi)
+static float reference_atan2(float y, float x)
+{
+    double a = std::atan2(static_cast<double>(y), static_cast<double>(x));
+    if (a < 0.0) {
+        a += 2.0 * M_PI;
+    }
+    return static_cast<float>(a);
+}
+
+static void test_atan2()
+{
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+
+    int64_t max_ulp  = 0;
+    double max_error = 0.0;
+    for (int i = 0; i < 1000000; i++) {
+        const float y      = value(rng);
+        const float x      = value(rng);
+        const float fast   = fast_atan2f(y, x);
+        const float expect = reference_atan2(y, x);
+        max_ulp            = std::max(max_ulp, ulp_distance(fast, expect));
+        max_error          = std::max(max_error, std::fabs(static_cast<double>(fast) - expect));
+    }
+    std::printf("atan2f: max %lld ulp, %.2g rad\n", static_cast<long long>(max_ulp), max_error);
+    CHECK(max_ulp <= 4);
+    CHECK(max_error < 1e-6);
+
+    // The axes and the origin, in the same [0, 2pi) range as everything else
+    CHECK(fast_atan2f(0.0f, 1.0f) == 0.0f);
+    CHECK(std::fabs(fast_atan2f(1.0f, 0.0f) - static_cast<float>(M_PI_2)) < 1e-6f);
+    CHECK(std::fabs(fast_atan2f(0.0f, -1.0f) - static_cast<float>(M_PI)) < 1e-6f);
+    CHECK(std::fabs(fast_atan2f(-1.0f, 0.0f) - static_cast<float>(3 * M_PI_2)) < 1e-6f);
+    CHECK(fast_atan2f(0.0f, 0.0f) == 0.0f);
+}
+
+static void test_expf()
+{
+    // Schraudolph's approximation, a few percent by design
+    double max_relative = 0.0;
+    for (float x = -87.0f; x <= 88.0f; x += 1.0f / 4096) {
+        const double expect = std::exp(static_cast<double>(x));
+        max_relative        = std::max(max_relative, std::fabs(fast_expf(x) - expect) / expect);
+    }
+    std::printf("expf: max relative error %.2f%%\n", max_relative * 100.0);
+    CHECK(max_relative < 0.05);
+}
+
+static void test_min_max()
+{
+    // Every length up to a few blocks, so each remainder is covered, and all negative data for the initial values
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> value(-1000.0f, -1.0f);
+    for (size_t length = 1; length < 40; length++) {
+        std::vector<float> data(length);
+        for (auto& v : data) {
+            v = value(rng);
+        }
+        float min;
+        float max;
+        fast_get_min_max(data.data(), data.size(), &min, &max);
+        CHECK(min == *std::min_element(data.begin(), data.end()));
+        CHECK(max == *std::max_element(data.begin(), data.end()));
+    }
+}
+
+static void test_array_variants()
+{
+    // Odd length so the scalar tail after the last block is covered too
+    constexpr size_t count = 100003;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> value(-100.0f, 100.0f);
+    std::vector<float> y(count);
+    std::vector<float> x(count);
+    std::vector<float> out(count);
+    for (size_t i = 0; i < count; i++) {
+        y[i] = value(rng);
+        x[i] = value(rng);
+    }
+    // The axes and the origin in among the blocks
+    y[5] = 0.0f, x[5] = 1.0f;
+    y[6] = 1.0f, x[6] = 0.0f;
+    y[7] = 0.0f, x[7] = -1.0f;
+    y[8] = -1.0f, x[8] = 0.0f;
+    y[9] = 0.0f, x[9] = 0.0f;
+
+    fast_atan2f_v(y.data(), x.data(), out.data(), count);
+    int64_t atan2_ulp = 0;
+    for (size_t i = 0; i < count; i++) {
+        const float expect = i == 9 ? 0.0f : reference_atan2(y[i], x[i]);
+        atan2_ulp          = std::max(atan2_ulp, ulp_distance(out[i], expect));
+    }
+
+    // fast_expf is a few percent off by design, the array version must match it bit for bit. 4% is at most
+    // 0.04 * 2^24 ulp, a float's ulp being 2^-23 to 2^-24 of its value
+    for (size_t i = 0; i < count; i++) {
+        x[i] = -87.0f + 175.0f * i / count;
+    }
+    fast_expf_v(x.data(), out.data(), count);
+    int64_t expf_ulp  = 0;
+    bool expf_matches = true;
+    for (size_t i = 0; i < count; i++) {
+        expf_ulp     = std::max(expf_ulp, ulp_distance(out[i], std::exp(x[i])));
+        expf_matches = expf_matches && out[i] == fast_expf(x[i]);
+    }
+
+    std::vector<uint8_t> gray(count);
+    for (auto& v : gray) {
+        v = static_cast<uint8_t>(20 + rng() % 200);
+    }
+    gray[count - 1] = 3;
+    uint8_t min;
+    uint8_t max;
+    fast_get_min_max_u8(gray.data(), count, &min, &max);
+
+    std::printf("atan2f_v: max %lld ulp, expf_v: max %lld ulp\n", static_cast<long long>(atan2_ulp),
+                static_cast<long long>(expf_ulp));
+    CHECK(atan2_ulp <= 4);
+    CHECK(expf_matches);
+    CHECK(expf_ulp < (1 << 24) / 25);
+    CHECK(min == 3);
+    CHECK(max == *std::max_element(gray.begin(), gray.end()));
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Benchmark                                 */
+/* -------------------------------------------------------------------------- */
+// The single running min/max fast_get_min_max was before the lanes
+static void reference_min_max(const float* data, size_t length, float* min, float* max)
+{
+    *min = FLT_MAX;
+    *max = -FLT_MAX;
+    for (size_t i = 0; i < length; i++) {
+        *min = data[i] < *min ? data[i] : *min;
+        *max = data[i] > *max ? data[i] : *max;
+    }
+}
+
+template <typename Fn>
+static double ns_per_element(size_t count, Fn&& fn)
+{
+    return test::best_seconds(fn) / count * 1e9;
+}
+
+static void bench()
+{
+    constexpr size_t count = 1 << 20;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> value(-80.0f, 80.0f);
+    std::vector<float> a(count);
+    std::vector<float> b(count);
+    std::vector<float> out(count);
+    for (size_t i = 0; i < count; i++) {
+        a[i] = value(rng);
+        b[i] = value(rng);
+    }
+
+    const double expf_fast = ns_per_element(count, [&] {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = fast_expf(a[i]);
+        }
+        test::keep(out[count / 2]);
+    });
+    const double expf_array = ns_per_element(count, [&] {
+        fast_expf_v(a.data(), out.data(), count);
+        test::keep(out[count / 2]);
+    });
+    const double expf_libm = ns_per_element(count, [&] {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = std::exp(a[i]);
+        }
+        test::keep(out[count / 2]);
+    });
+    const double atan2_fast = ns_per_element(count, [&] {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = fast_atan2f(a[i], b[i]);
+        }
+        test::keep(out[count / 2]);
+    });
+    const double atan2_array = ns_per_element(count, [&] {
+        fast_atan2f_v(a.data(), b.data(), out.data(), count);
+        test::keep(out[count / 2]);
+    });
+    const double atan2_libm = ns_per_element(count, [&] {
+        for (size_t i = 0; i < count; i++) {
+            out[i] = std::atan2(a[i], b[i]);
+        }
+        test::keep(out[count / 2]);
+    });
+
+    float min;
+    float max;
+    const double min_max_lanes = ns_per_element(count, [&] {
+        fast_get_min_max(a.data(), count, &min, &max);
+        test::keep(min + max);
+    });
+    const double min_max_single = ns_per_element(count, [&] {
+        reference_min_max(a.data(), count, &min, &max);
+        test::keep(min + max);
+    });
+
+    std::vector<uint8_t> gray(count);
+    for (size_t i = 0; i < count; i++) {
+        gray[i] = static_cast<uint8_t>(a[i] + 100.0f);
+    }
+    uint8_t min8;
+    uint8_t max8;
+    const double min_max_u8 = ns_per_element(count, [&] {
+        fast_get_min_max_u8(gray.data(), count, &min8, &max8);
+        test::keep(min8 + max8);
+    });
+    const double min_max_u8_single = ns_per_element(count, [&] {
+        min8 = UINT8_MAX;
+        max8 = 0;
+        for (size_t i = 0; i < count; i++) {
+            min8 = gray[i] < min8 ? gray[i] : min8;
+            max8 = gray[i] > max8 ? gray[i] : max8;
+            // Keeps the compiler from turning the reference into the vectorized reduction it stands against
+            __asm__ volatile("" : "+r"(min8), "+r"(max8));
+        }
+        test::keep(min8 + max8);
+    });
+
+    // imlib, scalar functions included, builds at -O2 like the firmware
+    std::printf("ns per element    scalar   array    libm / single running min max\n");
+    std::printf("expf             %7.2f %7.2f %7.2f\n", expf_fast, expf_array, expf_libm);
+    std::printf("atan2f           %7.2f %7.2f %7.2f\n", atan2_fast, atan2_array, atan2_libm);
+    std::printf("min/max float            %7.2f %7.2f\n", min_max_lanes, min_max_single);
+    std::printf("min/max u8               %7.2f %7.2f\n", min_max_u8, min_max_u8_single);
+    CHECK(min_max_lanes < min_max_single);
+    CHECK(atan2_array < atan2_fast);
+    CHECK(expf_array < expf_fast);
+    CHECK(min_max_u8 < min_max_u8_single);
+}
+
+int main()
+{
+    test_atan2();
+    test_expf();
+    test_min_max();
+    test_array_variants();
+    bench();
+    return test::result();
+}
@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <apps/utils/camera/frame_pool.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace camera;
+
+static int64_t _now_us = 0;
+
+static int64_t fake_clock()
+{
+    return _now_us;
+}
+
+/**
+ * @brief Stands in for V4L2: a free list the pool requeues into, and a sensor that only produces a frame when it
+ * has a buffer, otherwise the frame's sequence number is lost like a real driver's would be
+ *
+ */
+class FakeDriver {
+public:
+    bool accept = true;
+
+    explicit FakeDriver(size_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            _free.push_back(i);
+        }
+    }
+
+    bool requeue(uint32_t index)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!accept) {
+            return false;
+        }
+        _free.push_back(index);
+        return true;
+    }
+
+    // One sensor frame, pushed into the pool if there was a buffer for it
+    bool tick(FramePool& pool)
+    {
+        uint32_t index;
+        const uint32_t sequence = _sequence++;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_free.empty()) {
+                return false;
+            }
+            index = _free.front();
+            _free.pop_front();
+        }
+        pool.push(index, sequence, static_cast<int64_t>(sequence) * 33333);
+        return true;
+    }
+
+    size_t owned()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _free.size();
+    }
+
+private:
+    std::mutex _mutex;
+    std::deque<uint32_t> _free;
+    uint32_t _sequence = 0;
+};
+
+static FramePool make_pool(FakeDriver& driver, FramePool::Policy_t policy, size_t count = 4)
+{
+    FramePool::Config_t config;
+    config.bufferCount   = count;
+    config.policy        = policy;
+    config.driverReserve = 1;
+    return FramePool(config, [&driver](uint32_t index) { return driver.requeue(index); }, fake_clock);
+}
+
+static void test_drop_oldest()
+{
+    FakeDriver driver(4);
+    auto pool = make_pool(driver, FramePool::POLICY_DROP_OLDEST);
+
+    // With no consumer the pool keeps one buffer with the sensor by giving up the oldest frame
+    for (int i = 0; i < 4; i++) {
+        CHECK(driver.tick(pool));
+    }
+    auto stats = pool.stats();
+    CHECK(stats.queueDepth == 3);
+    CHECK(stats.maxQueueDepth == 3);
+    CHECK(stats.dropped == 1);
+    CHECK(stats.minDriverDepth == 1);
+    CHECK(driver.owned() == 1);
+
+    // A late consumer gets the newest frame, everything older goes straight back
+    FramePool::Frame_t frame;
+    CHECK(pool.acquire(frame, 0));
+    CHECK(frame.sequence == 3);
+    CHECK(frame.timestampUs == 3 * 33333);
+    stats = pool.stats();
+    CHECK(stats.queueDepth == 0);
+    CHECK(stats.dropped == 3);
+    CHECK(stats.delivered == 1);
+    CHECK(driver.owned() == 3);
+    CHECK(!pool.acquire(frame, 0));
+
+    pool.release(frame.index);
+    CHECK(driver.owned() == 4);
+    CHECK(pool.stats().frameIntervalUs == 33333);
+    CHECK(pool.stats().sequenceGaps == 0);
+}
+
+static void test_block()
+{
+    FakeDriver driver(4);
+    auto pool = make_pool(driver, FramePool::POLICY_BLOCK);
+
+    // Every frame is kept, the sensor runs dry and loses the fifth
+    for (int i = 0; i < 4; i++) {
+        CHECK(driver.tick(pool));
+    }
+    CHECK(!driver.tick(pool));
+    auto stats = pool.stats();
+    CHECK(stats.queueDepth == 4);
+    CHECK(stats.dropped == 0);
+    CHECK(stats.minDriverDepth == 0);
+
+    // In order, oldest first
+    for (uint32_t i = 0; i < 4; i++) {
+        FramePool::Frame_t frame;
+        CHECK(pool.acquire(frame, 0));
+        CHECK(frame.sequence == i);
+        CHECK(pool.stats().queueDepth == 3 - i);
+        pool.release(frame.index);
+    }
+
+    CHECK(driver.tick(pool));
+    CHECK(pool.stats().sequenceGaps == 1);
+}
+
+static void test_latency_and_retain()
+{
+    FakeDriver driver(2);
+    auto pool = make_pool(driver, FramePool::POLICY_BLOCK, 2);
+
+    _now_us = 1000;
+    driver.tick(pool);
+    _now_us = 3000;
+    FramePool::Frame_t frame;
+    CHECK(pool.acquire(frame, 0));
+    CHECK(frame.dequeueUs == 1000);
+    CHECK(pool.stats().queueLatencyUs == 2000);
+
+    // A second holder keeps the buffer away from the driver until both let go
+    CHECK(pool.retain(frame.index));
+    _now_us = 8000;
+    pool.release(frame.index);
+    CHECK(driver.owned() == 1);
+    pool.release(frame.index);
+    CHECK(driver.owned() == 2);
+    CHECK(pool.stats().holdLatencyUs == 7000);
+    CHECK(!pool.retain(frame.index));
+}
+
+static void test_refused_requeue()
+{
+    FakeDriver driver(2);
+    auto pool = make_pool(driver, FramePool::POLICY_BLOCK, 2);
+
+    driver.tick(pool);
+    FramePool::Frame_t frame;
+    pool.acquire(frame, 0);
+
+    // The driver refuses the buffer, the pool holds on to it and tries again on the next release or push
+    driver.accept = false;
+    pool.release(frame.index);
+    CHECK(pool.stats().driverDepth == 1);
+    driver.accept = true;
+    driver.tick(pool);
+    CHECK(pool.stats().driverDepth == 1);
+    CHECK(driver.owned() == 1);
+}
+
+/**
+ * @brief A sensor thread against a consumer three times slower, the policies should trade frames against stalls
+ *
+ */
+static void run_threaded(FramePool::Policy_t policy, FramePool::Stats_t& stats, std::vector<uint32_t>& sequences)
+{
+    FakeDriver driver(4);
+    FramePool::Config_t config;
+    config.bufferCount   = 4;
+    config.policy        = policy;
+    config.driverReserve = 1;
+    FramePool pool(config, [&driver](uint32_t index) { return driver.requeue(index); });
+
+    std::atomic<bool> done{false};
+    std::thread sensor([&] {
+        for (int i = 0; i < 300; i++) {
+            driver.tick(pool);
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+        done = true;
+    });
+
+    FramePool::Frame_t frame;
+    while (!done || pool.stats().queueDepth > 0) {
+        if (pool.acquire(frame, 5)) {
+            sequences.push_back(frame.sequence);
+            std::this_thread::sleep_for(std::chrono::microseconds(1500));
+            pool.release(frame.index);
+        }
+    }
+    sensor.join();
+    stats = pool.stats();
+}
+
+static void test_threaded()
+{
+    FramePool::Stats_t drop;
+    std::vector<uint32_t> drop_seq;
+    run_threaded(FramePool::POLICY_DROP_OLDEST, drop, drop_seq);
+
+    FramePool::Stats_t block;
+    std::vector<uint32_t> block_seq;
+    run_threaded(FramePool::POLICY_BLOCK, block, block_seq);
+
+    std::printf("drop oldest: %u frames, %u delivered, %u dropped, %u lost, max queue %u, min driver %u\n", drop.frames,
+                drop.delivered, drop.dropped, drop.sequenceGaps, drop.maxQueueDepth, drop.minDriverDepth);
+    std::printf("block:       %u frames, %u delivered, %u dropped, %u lost, max queue %u, min driver %u\n",
+                block.frames, block.delivered, block.dropped, block.sequenceGaps, block.maxQueueDepth,
+                block.minDriverDepth);
+
+    // Drop oldest never lets the sensor run dry and never loses a frame at the driver
+    CHECK(drop.minDriverDepth >= 1);
+    CHECK(drop.sequenceGaps == 0);
+    CHECK(drop.frames == 300);
+    CHECK(drop.delivered + drop.dropped == drop.frames);
+
+    // Block delivers everything the driver got in order, the slow consumer costs sensor frames instead. Frames lost
+    // after the last push never show up as a gap
+    CHECK(block.dropped == 0);
+    CHECK(block.delivered == block.frames);
+    CHECK(block.sequenceGaps > 0);
+    CHECK(block.frames + block.sequenceGaps <= 300);
+
+    bool increasing = true;
+    for (size_t i = 1; i < drop_seq.size(); i++) {
+        increasing = increasing && drop_seq[i] > drop_seq[i - 1];
+    }
+    for (size_t i = 1; i < block_seq.size(); i++) {
+        increasing = increasing && block_seq[i] > block_seq[i - 1];
+    }
+    CHECK(increasing);
+}
+
+int main()
+{
+    test_drop_oldest();
+    test_block();
+    test_latency_and_retain();
+    test_refused_requeue();
+    test_threaded();
+    return test::result();
+}
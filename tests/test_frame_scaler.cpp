@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <apps/utils/camera/frame_scaler.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace camera;
+
+static constexpr uint16_t kWidth  = 1280;
+static constexpr uint16_t kHeight = 720;
+
+static uint16_t rgb565(uint32_t r, uint32_t g, uint32_t b)
+{
+    return static_cast<uint16_t>((r >> 3) << 11 | (g >> 2) << 5 | b >> 3);
+}
+
+// Smooth gradients with a fine checkerboard in the middle third, which is where nearest sampling would alias
+static std::vector<uint16_t> make_frame()
+{
+    std::vector<uint16_t> frame(static_cast<size_t>(kWidth) * kHeight);
+    for (uint32_t y = 0; y < kHeight; y++) {
+        for (uint32_t x = 0; x < kWidth; x++) {
+            uint16_t pixel = rgb565(x * 255 / kWidth, y * 255 / kHeight, (x + y) & 0xFF);
+            if (x >= kWidth / 3 && x < kWidth * 2 / 3) {
+                pixel = (x + y) & 1 ? 0xFFFF : 0x0000;
+            }
+            frame[y * kWidth + x] = pixel;
+        }
+    }
+    return frame;
+}
+
+/**
+ * @brief Reference image: the plain mean over each output pixel's area in double, channels widened like imlib
+ *
+ */
+static std::vector<double> reference(const std::vector<uint16_t>& frame, const Roi_t& roi, uint16_t width,
+                                     uint16_t height)
+{
+    std::vector<double> out(static_cast<size_t>(width) * height * 3);
+    for (uint32_t oy = 0; oy < height; oy++) {
+        const uint32_t y0 = roi.y + oy * roi.height / height;
+        const uint32_t y1 = roi.y + (oy + 1) * roi.height / height;
+        for (uint32_t ox = 0; ox < width; ox++) {
+            const uint32_t x0 = roi.x + ox * roi.width / width;
+            const uint32_t x1 = roi.x + (ox + 1) * roi.width / width;
+            double sum[3]     = {};
+            for (uint32_t y = y0; y < y1; y++) {
+                for (uint32_t x = x0; x < x1; x++) {
+                    const uint32_t p = frame[y * kWidth + x];
+                    const uint32_t r = (p >> 8) & 0xF8;
+                    const uint32_t g = (p >> 3) & 0xFC;
+                    const uint32_t b = (p << 3) & 0xF8;
+                    sum[0] += r | r >> 5;
+                    sum[1] += g | g >> 6;
+                    sum[2] += b | b >> 5;
+                }
+            }
+            const double n = static_cast<double>(x1 - x0) * (y1 - y0);
+            for (int c = 0; c < 3; c++) {
+                out[(oy * width + ox) * 3 + c] = sum[c] / n;
+            }
+        }
+    }
+    return out;
+}
+
+static void check_against_reference(const Roi_t& roi, uint16_t width, uint16_t height)
+{
+    const auto frame = make_frame();
+    FrameScaler scaler;
+    CHECK(scaler.configure(kWidth, kHeight, roi, width, height));
+    const auto ref = reference(frame, scaler.roi(), width, height);
+
+    std::vector<uint8_t> gray(image_bytes(width, height, IMAGE_GRAY8));
+    std::vector<uint16_t> rgb(static_cast<size_t>(width) * height);
+    scaler.scale(frame.data(), gray.data(), IMAGE_GRAY8);
+    scaler.scale(frame.data(), reinterpret_cast<uint8_t*>(rgb.data()), IMAGE_RGB565);
+
+    // Gray within one level of the reference luma, RGB565 within one step of the rounded reference per channel
+    int gray_error = 0;
+    int rgb_error  = 0;
+    for (size_t i = 0; i < gray.size(); i++) {
+        const double r = ref[i * 3 + 0];
+        const double g = ref[i * 3 + 1];
+        const double b = ref[i * 3 + 2];
+        gray_error     = std::max(gray_error, std::abs(gray[i] - static_cast<int>((r * 38 + g * 75 + b * 15) / 128)));
+
+        const uint16_t expect = rgb565(std::lround(r), std::lround(g), std::lround(b));
+        rgb_error             = std::max({rgb_error, std::abs((rgb[i] >> 11) - (expect >> 11)),
+                                          std::abs(((rgb[i] >> 5) & 0x3F) - ((expect >> 5) & 0x3F)),
+                                          std::abs((rgb[i] & 0x1F) - (expect & 0x1F))});
+    }
+    std::printf("roi %ux%u+%u+%u to %ux%u: max error gray %d, rgb565 %d\n", scaler.roi().width, scaler.roi().height,
+                scaler.roi().x, scaler.roi().y, width, height, gray_error, rgb_error);
+    CHECK(gray_error <= 1);
+    CHECK(rgb_error <= 1);
+}
+
+static void test_reference_images()
+{
+    check_against_reference({}, 160, 120);                    // 8 x 6, integer
+    check_against_reference({}, 320, 240);                    // 4 x 3
+    check_against_reference({100, 50, 1000, 600}, 240, 240);  // non-integer both ways
+    check_against_reference({1000, 600, 0, 0}, 96, 96);       // rest of the frame from the corner
+    check_against_reference({1200, 700, 500, 500}, 40, 20);   // clipped to the frame
+}
+
+static void test_flat_and_checkerboard()
+{
+    // A flat colour survives exactly, and the checkerboard averages to mid grey rather than aliasing to black or white
+    std::vector<uint16_t> frame(static_cast<size_t>(kWidth) * kHeight);
+    for (uint32_t y = 0; y < kHeight; y++) {
+        for (uint32_t x = 0; x < kWidth; x++) {
+            frame[y * kWidth + x] = x < kWidth / 2 ? rgb565(200, 100, 40) : ((x + y) & 1 ? 0xFFFF : 0x0000);
+        }
+    }
+
+    FrameScaler scaler;
+    CHECK(scaler.configure(kWidth, kHeight, {}, 213, 120));
+    std::vector<uint16_t> rgb(213 * 120);
+    scaler.scale(frame.data(), reinterpret_cast<uint8_t*>(rgb.data()), IMAGE_RGB565);
+    CHECK(rgb[60 * 213 + 10] == rgb565(200, 100, 40));
+
+    std::vector<uint8_t> gray(213 * 120);
+    scaler.scale(frame.data(), gray.data(), IMAGE_GRAY8);
+    CHECK(std::abs(gray[60 * 213 + 200] - 127) <= 2);
+}
+
+static void test_configure()
+{
+    FrameScaler scaler;
+    CHECK(!scaler.configure(kWidth, kHeight, {kWidth, 0, 0, 0}, 10, 10));
+    CHECK(!scaler.configure(kWidth, kHeight, {0, 0, 100, 100}, 200, 50));
+    CHECK(!scaler.configure(kWidth, kHeight, {}, 0, 10));
+    CHECK(scaler.configure(kWidth, kHeight, {0, 0, 100, 100}, 100, 100));
+}
+
+static void test_gray_in_place()
+{
+    // imlib's luma weights, converted over the RGB565 buffer itself
+    std::vector<uint16_t> pixels = {0x0000, 0xFFFF, rgb565(255, 0, 0), rgb565(0, 255, 0), rgb565(0, 0, 255)};
+    const uint8_t expect[]       = {0, 255, 75, 149, 29};
+    auto* gray                   = reinterpret_cast<uint8_t*>(pixels.data());
+    FrameScaler::rgb565_to_gray8(pixels.data(), gray, pixels.size());
+    for (size_t i = 0; i < pixels.size(); i++) {
+        CHECK(gray[i] == expect[i]);
+    }
+}
+
+static void bench_preview_to_analysis()
+{
+    // The whole 1280x720 preview down to the 320x240 the vision branch runs on
+    const auto frame = make_frame();
+    FrameScaler scaler;
+    scaler.configure(kWidth, kHeight, {}, 320, 240);
+    std::vector<uint8_t> gray(image_bytes(320, 240, IMAGE_GRAY8));
+
+    const double seconds = test::best_seconds([&] {
+        for (int i = 0; i < 20; i++) {
+            scaler.scale(frame.data(), gray.data(), IMAGE_GRAY8);
+            test::keep(gray[i]);
+        }
+    });
+    const double frame_ms = seconds / 20 * 1e3;
+    std::printf("1280x720 to 320x240 gray: %.2f ms a frame, %.0f MP/s in\n", frame_ms,
+                kWidth * kHeight / (frame_ms * 1e3));
+}
+
+int main()
+{
+    test_reference_images();
+    test_flat_and_checkerboard();
+    test_configure();
+    test_gray_in_place();
+    bench_preview_to_analysis();
+    return test::result();
+}
@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <imlib.h>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+static constexpr int kWidth  = 1280;
+static constexpr int kHeight = 720;
+static constexpr int kShapes = 2000;
+
+struct Format_t {
+    const char* name;
+    uint32_t pixfmt;
+    int color;
+};
+
+static const Format_t _formats[] = {
+    {"binary", PIXFORMAT_BINARY, 1},
+    {"gray", PIXFORMAT_GRAYSCALE, 0xC8},
+    {"rgb565", PIXFORMAT_RGB565, 0xF81F},
+};
+
+struct Image {
+    std::vector<uint32_t> storage;  // word aligned, binary rows are words
+    image_t img = {};
+
+    explicit Image(uint32_t pixfmt)
+    {
+        img.w      = kWidth;
+        img.h      = kHeight;
+        img.pixfmt = pixfmt;
+        storage.assign(kWidth * kHeight / 2 + kHeight, 0);
+        img.data = reinterpret_cast<uint8_t*>(storage.data());
+    }
+
+    void clear()
+    {
+        std::fill(storage.begin(), storage.end(), 0);
+    }
+
+    bool operator==(const Image& other) const
+    {
+        return storage == other.storage;
+    }
+};
+
+struct Shape_t {
+    int x0, y0, x1, y1, r;
+};
+
+// Shapes partly off the image as well, so the clipping is part of what's measured
+static std::vector<Shape_t> make_shapes()
+{
+    std::mt19937 rng(16);
+    std::uniform_int_distribution<int> x(-100, kWidth + 100);
+    std::uniform_int_distribution<int> y(-100, kHeight + 100);
+    std::uniform_int_distribution<int> r(4, 120);
+    std::vector<Shape_t> shapes(kShapes);
+    for (auto& s : shapes) {
+        s = {x(rng), y(rng), x(rng), y(rng), r(rng)};
+    }
+    return shapes;
+}
+
+/* -------------------------------------------------------------------------- */
+/*              The pixel at a time rectangle imlib had before                */
+/* -------------------------------------------------------------------------- */
+static void reference_rectangle(image_t* img, int rx, int ry, int rw, int rh, int c, int thickness, bool fill)
+{
+    if (fill) {
+        for (int y = ry; y < ry + rh; y++) {
+            for (int x = rx; x < rx + rw; x++) {
+                imlib_set_pixel(img, x, y, c);
+            }
+        }
+        return;
+    }
+
+    const int t0 = thickness / 2;
+    const int t1 = (thickness - 1) / 2;
+    for (int i = rx - t0, k = ry + rh - 1; i < rx + rw + t1; i++) {
+        for (int y = ry - t0; y <= ry + t1; y++) {
+            imlib_set_pixel(img, i, y, c);
+        }
+        for (int y = k - t0; y <= k + t1; y++) {
+            imlib_set_pixel(img, i, y, c);
+        }
+    }
+    for (int i = ry - t0, k = rx + rw - 1; i < ry + rh + t1; i++) {
+        for (int x = rx - t0; x <= rx + t1; x++) {
+            imlib_set_pixel(img, x, i, c);
+        }
+        for (int x = k - t0; x <= k + t1; x++) {
+            imlib_set_pixel(img, x, i, c);
+        }
+    }
+}
+
+static void test_rectangles_match_reference()
+{
+    const auto shapes = make_shapes();
+    for (const auto& format : _formats) {
+        for (int thickness : {1, 2, 5}) {
+            for (bool fill : {false, true}) {
+                Image fast(format.pixfmt);
+                Image slow(format.pixfmt);
+                for (const auto& s : shapes) {
+                    const int w = std::abs(s.x1 - s.x0) / 4;
+                    const int h = std::abs(s.y1 - s.y0) / 4;
+                    imlib_draw_rectangle(&fast.img, s.x0, s.y0, w, h, format.color, thickness, fill);
+                    reference_rectangle(&slow.img, s.x0, s.y0, w, h, format.color, thickness, fill);
+                }
+                CHECK(fast == slow);
+            }
+        }
+    }
+}
+
+static int get_pixel(const Image& image, int x, int y)
+{
+    switch (image.img.pixfmt) {
+        case PIXFORMAT_BINARY:
+            return (image.storage[y * ((kWidth + 31) / 32) + x / 32] >> (x % 32)) & 1;
+        case PIXFORMAT_GRAYSCALE:
+            return image.img.data[y * kWidth + x];
+        default:
+            return reinterpret_cast<const uint16_t*>(image.img.data)[y * kWidth + x];
+    }
+}
+
+static size_t count_set(const Image& image)
+{
+    size_t count = 0;
+    for (int y = 0; y < kHeight; y++) {
+        for (int x = 0; x < kWidth; x++) {
+            count += get_pixel(image, x, y) != 0;
+        }
+    }
+    return count;
+}
+
+static void test_circle_and_line()
+{
+    for (const auto& format : _formats) {
+        // A filled circle covers about pi r^2, anti-aliased edge pixels included
+        Image image(format.pixfmt);
+        imlib_draw_circle(&image.img, 640, 360, 100, format.color, 1, true);
+        const double area = M_PI * 100 * 100;
+        CHECK(std::fabs(count_set(image) - area) < area * 0.02);
+
+        // A thin horizontal line is exactly its pixels, a diagonal reaches both end points
+        image.clear();
+        imlib_draw_line(&image.img, 100, 200, 400, 200, format.color, 1);
+        CHECK(count_set(image) == 301);
+        image.clear();
+        imlib_draw_line(&image.img, 100, 100, 400, 400, format.color, 1);
+        CHECK(count_set(image) >= 301);
+        CHECK(get_pixel(image, 100, 100) != 0);
+        CHECK(get_pixel(image, 400, 400) != 0);
+
+        // Entirely off the image draws nothing and touches nothing
+        image.clear();
+        imlib_draw_rectangle(&image.img, -500, -500, 200, 200, format.color, 3, true);
+        imlib_draw_circle(&image.img, kWidth + 300, 0, 100, format.color, 5, false);
+        imlib_draw_line(&image.img, -10, -10, -400, -300, format.color, 4);
+        CHECK(count_set(image) == 0);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/*                                  Benchmark                                 */
+/* -------------------------------------------------------------------------- */
+struct Primitive_t {
+    const char* name;
+    bool reference;  // also timed through reference_rectangle()
+    void (*draw)(image_t*, const Shape_t&, int c, bool reference);
+    double (*pixels)(const Shape_t&);  // touched by one shape, before clipping
+};
+
+static double line_length(const Shape_t& s)
+{
+    return std::max(std::abs(s.x1 - s.x0), std::abs(s.y1 - s.y0)) + 1.0;
+}
+
+static void draw_line_1(image_t* img, const Shape_t& s, int c, bool)
+{
+    imlib_draw_line(img, s.x0, s.y0, s.x1, s.y1, c, 1);
+}
+
+static void draw_line_4(image_t* img, const Shape_t& s, int c, bool)
+{
+    imlib_draw_line(img, s.x0, s.y0, s.x1, s.y1, c, 4);
+}
+
+static void draw_rect_2(image_t* img, const Shape_t& s, int c, bool reference)
+{
+    (reference ? reference_rectangle : imlib_draw_rectangle)(img, s.x0, s.y0, s.r * 3, s.r * 2, c, 2, false);
+}
+
+static void draw_rect_fill(image_t* img, const Shape_t& s, int c, bool reference)
+{
+    (reference ? reference_rectangle : imlib_draw_rectangle)(img, s.x0, s.y0, s.r * 3, s.r * 2, c, 1, true);
+}
+
+static void draw_circle_fill(image_t* img, const Shape_t& s, int c, bool)
+{
+    imlib_draw_circle(img, s.x0, s.y0, s.r, c, 1, true);
+}
+
+static void draw_circle_5(image_t* img, const Shape_t& s, int c, bool)
+{
+    imlib_draw_circle(img, s.x0, s.y0, s.r, c, 5, false);
+}
+
+static const Primitive_t _primitives[] = {
+    {"line th=1",   false, draw_line_1,      [](const Shape_t& s) { return line_length(s); }},
+    {"line th=4",   false, draw_line_4,      [](const Shape_t& s) { return line_length(s) * 4; }},
+    {"rect th=2",   true,  draw_rect_2,      [](const Shape_t& s) { return s.r * 5.0 * 2 * 2; }},
+    {"rect fill",   true,  draw_rect_fill,   [](const Shape_t& s) { return s.r * 3.0 * s.r * 2; }},
+    {"circle fill", false, draw_circle_fill, [](const Shape_t& s) { return M_PI * s.r * s.r; }},
+    {"circle th=5", false, draw_circle_5,    [](const Shape_t& s) { return 2 * M_PI * s.r * 5; }},
+};
+
+static double mpx_per_second(const Primitive_t& primitive, Image& image, const std::vector<Shape_t>& shapes, int color,
+                             bool reference)
+{
+    double pixels = 0.0;
+    for (const auto& s : shapes) {
+        pixels += primitive.pixels(s);
+    }
+    const double seconds = test::best_seconds(
+        [&] {
+            for (const auto& s : shapes) {
+                primitive.draw(&image.img, s, color, reference);
+            }
+        },
+        3);
+    return pixels / seconds / 1e6;
+}
+
+static void bench_primitives()
+{
+    // Mpx/s over the shapes' own pixel counts, clipped parts included, so a cheap clip shows up as throughput
+    const auto shapes = make_shapes();
+    std::printf("%-24s", "Mpx/s");
+    for (const auto& format : _formats) {
+        std::printf("%16s", format.name);
+    }
+    std::printf("\n");
+
+    for (const auto& primitive : _primitives) {
+        for (bool reference : {true, false}) {
+            if (reference && !primitive.reference) {
+                continue;
+            }
+            std::printf("%-14s%-10s", primitive.name, primitive.reference ? (reference ? "per pixel" : "spans") : "");
+            for (const auto& format : _formats) {
+                Image image(format.pixfmt);
+                std::printf("%16.0f", mpx_per_second(primitive, image, shapes, format.color, reference));
+            }
+            std::printf("\n");
+        }
+    }
+}
+
+int main()
+{
+    test_rectangles_match_reference();
+    test_circle_and_line();
+    bench_primitives();
+    return test::result();
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <apps/utils/dsp/boost_settings.h>
+#include <apps/utils/sync/seqlock.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using app::sync::SeqLock;
+
+// Every field holds the same counter, a copy mixing two stores shows up as fields that disagree
+struct Payload_t {
+    uint32_t fields[15] = {};
+    uint16_t tail       = 0;  // not a whole word, the last word is partly padding
+};
+
+static Payload_t make_payload(uint32_t counter)
+{
+    Payload_t payload;
+    for (auto& f : payload.fields) {
+        f = counter;
+    }
+    payload.tail = static_cast<uint16_t>(counter);
+    return payload;
+}
+
+static bool consistent(const Payload_t& payload)
+{
+    for (auto f : payload.fields) {
+        if (f != payload.fields[0]) {
+            return false;
+        }
+    }
+    return payload.tail == static_cast<uint16_t>(payload.fields[0]);
+}
+
+struct ReaderResult_t {
+    uint64_t loads        = 0;
+    uint64_t failed       = 0;  // tryLoad() gave up
+    bool torn             = false;
+    bool went_back        = false;
+    bool mismatch         = false;  // payload not from the generation reported with it
+    bool touched_on_fail  = false;
+};
+
+static void test_stress()
+{
+    constexpr uint32_t kStores  = 500000;
+    constexpr int kReaders      = 4;
+    SeqLock<Payload_t> lock;
+    std::atomic<bool> done{false};
+    std::vector<ReaderResult_t> results(kReaders);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < kReaders; r++) {
+        readers.emplace_back([&, r] {
+            ReaderResult_t& result = results[r];
+            uint32_t last          = 0;
+            const auto check       = [&](const Payload_t& payload, uint32_t generation) {
+                result.torn      = result.torn || !consistent(payload);
+                result.went_back = result.went_back || generation < last;
+                result.mismatch  = result.mismatch || payload.fields[0] != generation;
+                last             = generation;
+                result.loads++;
+            };
+
+            while (!done.load(std::memory_order_relaxed)) {
+                uint32_t generation = 0;
+                const Payload_t payload = lock.load(&generation);
+                check(payload, generation);
+
+                // One attempt only, so it fails often while the writer is busy
+                Payload_t copy           = make_payload(0xDEADBEEF);
+                uint32_t copy_generation = 0xDEADBEEF;
+                if (lock.tryLoad(copy, &copy_generation, 1)) {
+                    check(copy, copy_generation);
+                } else {
+                    result.failed++;
+                    result.touched_on_fail = result.touched_on_fail || copy_generation != 0xDEADBEEF ||
+                                             !consistent(copy) || copy.fields[0] != 0xDEADBEEF;
+                }
+            }
+        });
+    }
+
+    // Counter i + 1 is the i-th store, which is also the generation it publishes
+    std::thread writer([&] {
+        for (uint32_t i = 1; i <= kStores; i++) {
+            lock.store(make_payload(i));
+        }
+        done = true;
+    });
+    writer.join();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    for (int r = 0; r < kReaders; r++) {
+        const auto& result = results[r];
+        std::printf("reader %d: %llu loads, %llu tryLoad failures\n", r, static_cast<unsigned long long>(result.loads),
+                    static_cast<unsigned long long>(result.failed));
+        CHECK(result.loads > 0);
+        CHECK(!result.torn);
+        CHECK(!result.went_back);
+        CHECK(!result.mismatch);
+        CHECK(!result.touched_on_fail);
+    }
+    CHECK(lock.generation() == kStores);
+    CHECK(lock.load().fields[0] == kStores);
+}
+
+static void test_try_load_failure()
+{
+    // No attempts allowed is a guaranteed failure, the outputs stay as they were
+    SeqLock<Payload_t> lock(make_payload(7));
+    Payload_t value     = make_payload(3);
+    uint32_t generation = 42;
+    CHECK(!lock.tryLoad(value, &generation, 0));
+    CHECK(value.fields[0] == 3 && consistent(value));
+    CHECK(generation == 42);
+
+    CHECK(lock.tryLoad(value, &generation));
+    CHECK(value.fields[0] == 7 && consistent(value));
+    CHECK(generation == 0);
+}
+
+static void test_boost_settings_generation()
+{
+    // What the audio task polls once a block: a set_* is one new generation carrying the new value
+    auto& store             = app::dsp::BoostSettingsStore::instance();
+    const uint32_t before   = store.generation();
+    store.set_beam_width(0.25f);
+    CHECK(store.generation() == before + 1);
+
+    app::dsp::BoostSettings settings;
+    uint32_t generation = 0;
+    CHECK(store.tryGet(settings, &generation));
+    CHECK(generation == before + 1);
+    CHECK(settings.beam_width == 0.25f);
+
+    store.set_beam_width(3.0f);
+    store.set_noise_reduction(0.5f);
+    CHECK(store.generation() == before + 3);
+    settings = store.get(&generation);
+    CHECK(generation == before + 3);
+    CHECK(settings.beam_width == 1.0f);
+    CHECK(settings.noise_reduction == 0.5f);
+}
+
+int main()
+{
+    test_try_load_failure();
+    test_boost_settings_generation();
+    test_stress();
+    return test::result();
+}
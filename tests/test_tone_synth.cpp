@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include "test_utils.h"
+#include <apps/utils/audio/tone_synth.h>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace audio;
+
+static constexpr uint32_t kRate = ToneSynth::kSampleRate;
+
+// The per-sample double sin() path play_tone() used before the synth, kept as the benchmark baseline
+static void reference_tone(std::vector<int16_t>& buffer, int frequency, double durationSec)
+{
+    const int samples     = static_cast<int>(kRate * durationSec);
+    const int fade_len    = 200;
+    const float amplitude = 32767.0f / 5;
+
+    buffer.resize(samples * 2);
+    for (int i = 0; i < samples; ++i) {
+        float amp = amplitude;
+        if (i >= samples - fade_len) {
+            amp *= static_cast<float>(samples - i) / fade_len;
+        }
+        int16_t value     = static_cast<int16_t>(amp * sin(2.0 * M_PI * frequency * i / kRate));
+        buffer[i * 2]     = value;
+        buffer[i * 2 + 1] = value;
+    }
+}
+
+static ToneSynth::Note_t make_note(int midi, uint32_t holdFrames, uint32_t releaseFrames)
+{
+    ToneSynth::Note_t note;
+    note.phaseIncrement = ToneSynth::kMidiPhaseIncrement[midi];
+    note.holdFrames     = holdFrames;
+    note.releaseFrames  = releaseFrames;
+    note.amplitude      = 32767 / 5;
+    return note;
+}
+
+static std::vector<float> render(ToneSynth& synth, size_t frames)
+{
+    std::vector<float> stereo(frames * 2, 0.0f);
+    synth.render(stereo.data(), frames);
+    return stereo;
+}
+
+static void test_pitch_and_level()
+{
+    ToneSynth synth;
+    synth.trigger(make_note(69, kRate, 0));
+    const auto out = render(synth, kRate);
+
+    int crossings = 0;
+    float peak    = 0.0f;
+    for (size_t i = 1; i < kRate; i++) {
+        crossings += out[(i - 1) * 2] < 0.0f && out[i * 2] >= 0.0f;
+        peak = std::max(peak, std::fabs(out[i * 2]));
+    }
+    std::printf("A4: %d rising zero crossings in 1 s, peak %.0f\n", crossings, peak);
+    CHECK(std::abs(crossings - 440) <= 1);
+    CHECK(std::fabs(peak - 32767 / 5) < 32767 / 5 * 0.01f);
+}
+
+static void test_note_ends()
+{
+    ToneSynth synth;
+    synth.trigger(make_note(60, 480, 480));
+    render(synth, 960);
+    const auto tail = render(synth, 480);
+    bool silent     = true;
+    for (float s : tail) {
+        silent = silent && s == 0.0f;
+    }
+    CHECK(silent);
+}
+
+static void test_holding_voices_not_stolen()
+{
+    // A full pool of holding notes, one more must be dropped rather than cut one of them off
+    ToneSynth synth;
+    for (size_t i = 0; i < ToneSynth::kMaxVoices; i++) {
+        synth.trigger(make_note(60 + i, kRate, 100));
+    }
+    render(synth, 64);
+    synth.trigger(make_note(90, kRate, 100));
+    render(synth, 64);
+    CHECK(synth.droppedNotes() == 1);
+
+    // Notes still waiting for their slot in a melody hold their voice too
+    ToneSynth waiting;
+    for (size_t i = 0; i < ToneSynth::kMaxVoices; i++) {
+        auto note        = make_note(60 + i, 100, 100);
+        note.delayFrames = kRate;
+        waiting.trigger(note);
+    }
+    render(waiting, 64);
+    waiting.trigger(make_note(90, 100, 100));
+    render(waiting, 64);
+    CHECK(waiting.droppedNotes() == 1);
+
+    // Once they release, a new note takes the voice closest to its end
+    ToneSynth releasing;
+    for (size_t i = 0; i < ToneSynth::kMaxVoices; i++) {
+        releasing.trigger(make_note(60 + i, 0, kRate));
+    }
+    render(releasing, 64);
+    releasing.trigger(make_note(90, 100, 100));
+    render(releasing, 64);
+    CHECK(releasing.droppedNotes() == 0);
+}
+
+static void bench_against_reference()
+{
+    // One 0.1 s click, the most common ui sound
+    constexpr double duration = 0.1;
+    const size_t frames       = static_cast<size_t>(kRate * duration);
+    std::vector<int16_t> buffer;
+    std::vector<float> stereo(frames * 2);
+
+    const double ref = test::best_seconds([&] {
+        for (int i = 0; i < 20; i++) {
+            reference_tone(buffer, 1000, duration);
+            test::keep(buffer[frames]);
+        }
+    });
+
+    ToneSynth synth;
+    const double wt = test::best_seconds([&] {
+        for (int i = 0; i < 20; i++) {
+            synth.trigger(make_note(84, frames - 200, 200));
+            std::fill(stereo.begin(), stereo.end(), 0.0f);
+            synth.render(stereo.data(), frames);
+            test::keep(stereo[frames]);
+        }
+    });
+
+    const double samples = 20.0 * frames;
+    std::printf("0.1 s tone: reference %.1f Msamples/s, wavetable %.1f Msamples/s\n", samples / ref / 1e6,
+                samples / wt / 1e6);
+    CHECK(wt < ref);
+}
+
+int main()
+{
+    test_pitch_and_level();
+    test_note_ends();
+    test_holding_voices_not_stolen();
+    bench_against_reference();
+    return test::result();
+}
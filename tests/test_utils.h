@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2025 M5Stack Technology CO LTD
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#pragma once
+#include <chrono>
+#include <cstdio>
+
+namespace test {
+
+inline int& failures()
+{
+    static int count = 0;
+    return count;
+}
+
+inline void fail(const char* file, int line, const char* expr)
+{
+    std::printf("%s:%d: check failed: %s\n", file, line, expr);
+    failures()++;
+}
+
+// main() returns this, ctest reads the exit code
+inline int result()
+{
+    if (failures() == 0) {
+        std::printf("ok\n");
+        return 0;
+    }
+    std::printf("%d check(s) failed\n", failures());
+    return 1;
+}
+
+/**
+ * @brief Best of a few runs of fn, in seconds, so one preempted run doesn't decide a benchmark
+ *
+ */
+template <typename Fn>
+double best_seconds(Fn&& fn, int runs = 5)
+{
+    double best = 1e30;
+    for (int i = 0; i < runs; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best           = s < best ? s : best;
+    }
+    return best;
+}
+
+// Keeps a benchmark result alive without printing it
+template <typename T>
+inline void keep(const T& value)
+{
+    static volatile T sink;
+    sink = value;
+    (void)sink;
+}
+
+}  // namespace test
+
+#define CHECK(cond)                                  \
+    do {                                             \
+        if (!(cond)) {                               \
+            test::fail(__FILE__, __LINE__, #cond);   \
+        }                                            \
+    } while (0)